@@ -0,0 +1,561 @@
+/**
+ * @file IPv4AddressColumn.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4AddressColumn class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv4AddressColumn.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <stdexcept>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IPV4_ADDRESS_COLUMN_SSE2
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define IPV4_ADDRESS_COLUMN_AVX
+#define IPV4_ADDRESS_COLUMN_AVX2_TARGET __attribute__((target("avx2")))
+#define IPV4_ADDRESS_COLUMN_AVX512_TARGET __attribute__((target("avx512f")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define IPV4_ADDRESS_COLUMN_AVX
+#define IPV4_ADDRESS_COLUMN_AVX2_TARGET
+#define IPV4_ADDRESS_COLUMN_AVX512_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Returns the number of trailing zero bits.
+         * @param cWord The word to scan, must not be zero.
+         * @return The index of the lowest set bit.
+         */
+        inline uint32_t CountTrailingZeros(const uint32_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanForward(&index, cWord);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctz(cWord));
+#endif
+        }
+
+        /**
+         * @brief Appends the rows of a match bitmask to a selection vector.
+         * @param mask Bit i set if row cBase + i matches.
+         * @param cBase The row of bit 0.
+         * @param selection The selection vector position to write to.
+         * @return The number of rows written.
+         */
+        inline size_t AppendSelection(uint32_t mask, const uint32_t &cBase, uint32_t *selection)
+        {
+            size_t count{};
+            while (mask)
+            {
+                selection[count++] = cBase + CountTrailingZeros(mask);
+                mask &= mask - 1;
+            }
+            return count;
+        }
+
+#if defined(IPV4_ADDRESS_COLUMN_AVX)
+        /**
+         * @brief Returns the number of set bits of a 16-bit match mask.
+         */
+        inline uint32_t PopulationCount(const uint32_t &cMask)
+        {
+#if defined(_MSC_VER)
+            return static_cast<uint32_t>(__popcnt(cMask));
+#else
+            return static_cast<uint32_t>(__builtin_popcount(cMask));
+#endif
+        }
+#endif
+
+        /**
+         * @brief Selects the rows whose value lies in [cLow, cHigh] after masking with cMask.
+         *
+         * Equality, prefix and range filters are all this test: equality is a full mask with
+         * cLow == cHigh, a prefix is the prefix mask with cLow == cHigh == network. Point tests
+         * (Point == true) need one compare per lane instead of two and ignore cHigh.
+         *
+         * This is the reference every SIMD variant must match; they call it for the rows left
+         * after their last full block.
+         *
+         * @tparam Point `true` if cLow == cHigh.
+         * @param cValues The values.
+         * @param cRow The first row to test.
+         * @param cCount The number of values.
+         * @param cMask The mask applied to every value.
+         * @param cLow The lowest matching masked value.
+         * @param cHigh The highest matching masked value.
+         * @param selection Receives the matching row indices.
+         * @return The number of matching rows.
+         */
+        template <bool Point>
+        size_t SelectScalar(const uint32_t *cValues, const size_t &cRow, const size_t &cCount, const uint32_t &cMask, const uint32_t &cLow, const uint32_t &cHigh,
+                            uint32_t *selection)
+        {
+            size_t count{};
+            for (size_t row = cRow; row < cCount; row++)
+            {
+                const uint32_t cValue = cValues[row] & cMask;
+                selection[count] = static_cast<uint32_t>(row);
+                count += cValue >= cLow && cValue <= cHigh;
+            }
+            return count;
+        }
+
+#if defined(IPV4_ADDRESS_COLUMN_SSE2)
+        /**
+         * @brief SelectScalar() for 16 rows per step with SSE2.
+         */
+        template <bool Point>
+        size_t SelectSse2(const uint32_t *cValues, const size_t &cRow, const size_t &cCount, const uint32_t &cMask, const uint32_t &cLow, const uint32_t &cHigh,
+                          uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            // SSE2 only has signed compares: flipping the sign bit maps unsigned order onto signed order.
+            const __m128i cSign = _mm_set1_epi32(INT32_MIN);
+            const __m128i cMaskVector = _mm_set1_epi32(static_cast<int32_t>(cMask));
+            const __m128i cLowVector = _mm_set1_epi32(static_cast<int32_t>(cLow ^ 0x80000000u));
+            const __m128i cHighVector = _mm_set1_epi32(static_cast<int32_t>(cHigh ^ 0x80000000u));
+            const __m128i cEqualVector = _mm_set1_epi32(static_cast<int32_t>(cLow));
+
+            for (; row + 16 <= cCount; row += 16)
+            {
+                __m128i lanes[4];
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const __m128i cValue = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cValues + row + 4 * i)), cMaskVector);
+                    if (Point)
+                    {
+                        lanes[i] = _mm_cmpeq_epi32(cValue, cEqualVector);
+                    }
+                    else
+                    {
+                        const __m128i cSigned = _mm_xor_si128(cValue, cSign);
+                        const __m128i cOutside = _mm_or_si128(_mm_cmplt_epi32(cSigned, cLowVector), _mm_cmpgt_epi32(cSigned, cHighVector));
+                        lanes[i] = _mm_andnot_si128(cOutside, _mm_set1_epi32(-1));
+                    }
+                }
+                const __m128i cPacked = _mm_packs_epi16(_mm_packs_epi32(lanes[0], lanes[1]), _mm_packs_epi32(lanes[2], lanes[3]));
+                const uint32_t cMatches = static_cast<uint32_t>(_mm_movemask_epi8(cPacked));
+                if (cMatches)
+                {
+                    count += AppendSelection(cMatches, static_cast<uint32_t>(row), selection + count);
+                }
+            }
+            return count + SelectScalar<Point>(cValues, row, cCount, cMask, cLow, cHigh, selection + count);
+        }
+#endif
+
+#if defined(IPV4_ADDRESS_COLUMN_AVX)
+        /**
+         * @brief SelectScalar() for 32 rows per step with AVX2.
+         */
+        template <bool Point>
+        IPV4_ADDRESS_COLUMN_AVX2_TARGET size_t SelectAvx2(const uint32_t *cValues, const size_t &cRow, const size_t &cCount, const uint32_t &cMask, const uint32_t &cLow,
+                                                          const uint32_t &cHigh, uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            const __m256i cMaskVector = _mm256_set1_epi32(static_cast<int32_t>(cMask));
+            const __m256i cLowVector = _mm256_set1_epi32(static_cast<int32_t>(cLow));
+            const __m256i cHighVector = _mm256_set1_epi32(static_cast<int32_t>(cHigh));
+
+            for (; row + 32 <= cCount; row += 32)
+            {
+                uint32_t matches{};
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const __m256i cValue = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(cValues + row + 8 * i)), cMaskVector);
+                    __m256i lanes;
+                    if (Point)
+                    {
+                        lanes = _mm256_cmpeq_epi32(cValue, cLowVector);
+                    }
+                    else
+                    {
+                        // Unsigned bounds without the sign flip: the value is inside if clamping it changes nothing.
+                        const __m256i cClamped = _mm256_min_epu32(_mm256_max_epu32(cValue, cLowVector), cHighVector);
+                        lanes = _mm256_cmpeq_epi32(cClamped, cValue);
+                    }
+                    matches |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes))) << (8 * i);
+                }
+                if (matches)
+                {
+                    count += AppendSelection(matches, static_cast<uint32_t>(row), selection + count);
+                }
+            }
+            return count + SelectScalar<Point>(cValues, row, cCount, cMask, cLow, cHigh, selection + count);
+        }
+
+        /**
+         * @brief SelectScalar() for 16 rows per step with AVX-512.
+         *
+         * The mask compare gives the matching lanes directly and the compress instruction packs
+         * their row indices, so there is no loop over the set bits. The packed vector is stored
+         * whole: count <= row, so the 16 lanes stay within the cCount rows of the selection.
+         */
+        template <bool Point>
+        IPV4_ADDRESS_COLUMN_AVX512_TARGET size_t SelectAvx512(const uint32_t *cValues, const size_t &cRow, const size_t &cCount, const uint32_t &cMask,
+                                                              const uint32_t &cLow, const uint32_t &cHigh, uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            const __m512i cMaskVector = _mm512_set1_epi32(static_cast<int32_t>(cMask));
+            const __m512i cLowVector = _mm512_set1_epi32(static_cast<int32_t>(cLow));
+            const __m512i cHighVector = _mm512_set1_epi32(static_cast<int32_t>(cHigh));
+            const __m512i cStep = _mm512_set1_epi32(16);
+            __m512i rows = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int32_t>(row)),
+                                            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+
+            for (; row + 16 <= cCount; row += 16)
+            {
+                const __m512i cValue = _mm512_and_si512(_mm512_loadu_si512(cValues + row), cMaskVector);
+                const __mmask16 cMatches = Point ? _mm512_cmpeq_epu32_mask(cValue, cLowVector)
+                                                 : _mm512_mask_cmple_epu32_mask(_mm512_cmpge_epu32_mask(cValue, cLowVector), cValue, cHighVector);
+                _mm512_storeu_si512(selection + count, _mm512_maskz_compress_epi32(cMatches, rows));
+                count += PopulationCount(cMatches);
+                rows = _mm512_add_epi32(rows, cStep);
+            }
+            return count + SelectScalar<Point>(cValues, row, cCount, cMask, cLow, cHigh, selection + count);
+        }
+#endif
+
+        /**
+         * @brief The signature shared by the variants of SelectScalar().
+         */
+        using SelectFunction = size_t (*)(const uint32_t *, const size_t &, const size_t &, const uint32_t &, const uint32_t &, const uint32_t &, uint32_t *);
+
+        /**
+         * @brief Returns the variant of SelectScalar() for the tier chosen by CpuFeatures.
+         *
+         * Each tier without its own variant takes the one of the tier below it (SSE4.2 adds
+         * nothing this kernel uses). The table is built on the first call.
+         *
+         * @tparam Point `true` if cLow == cHigh.
+         * @param cTier The tier.
+         * @return The variant.
+         */
+        template <bool Point>
+        SelectFunction SelectKernel(const CpuFeatures::Tier &cTier)
+        {
+            static const SelectFunction cTable[CpuFeatures::TIER_COUNT]{
+                SelectScalar<Point>,
+#if defined(IPV4_ADDRESS_COLUMN_SSE2)
+                SelectSse2<Point>,
+                SelectSse2<Point>,
+#else
+                SelectScalar<Point>,
+                SelectScalar<Point>,
+#endif
+#if defined(IPV4_ADDRESS_COLUMN_AVX)
+                SelectAvx2<Point>,
+                SelectAvx512<Point>,
+#elif defined(IPV4_ADDRESS_COLUMN_SSE2)
+                SelectSse2<Point>,
+                SelectSse2<Point>,
+#else
+                SelectScalar<Point>,
+                SelectScalar<Point>,
+#endif
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+
+        /**
+         * @brief Selects the rows whose value lies in [cLow, cHigh] after masking with cMask.
+         *
+         * Calls the variant of the selected tier, which is looked up once.
+         */
+        template <bool Point>
+        size_t Select(const uint32_t *cValues, const size_t &cCount, const uint32_t &cMask, const uint32_t &cLow, const uint32_t &cHigh, uint32_t *selection)
+        {
+            static const SelectFunction cSelect = SelectKernel<Point>(CpuFeatures::Selected());
+            return cSelect(cValues, 0, cCount, cMask, cLow, cHigh, selection);
+        }
+
+        /**
+         * @brief Hashes a value to a slot of a power-of-two table.
+         */
+        inline size_t Slot(const uint32_t &cValue, const uint8_t &cShift)
+        {
+            return static_cast<size_t>((cValue * 0x9E3779B97F4A7C15ull) >> cShift);
+        }
+    }
+
+    /**
+     * @brief Constructor for the IPv4AddressColumn class.
+     * @param cAddresses The addresses to store.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    IPv4AddressColumn::IPv4AddressColumn(const std::vector<IPv4Address> &cAddresses)
+    {
+        Append(cAddresses.data(), cAddresses.size());
+    } /* IPv4AddressColumn::IPv4AddressColumn(const std::vector<IPv4Address> &cAddresses) */
+
+    /**
+     * @brief Appends an address.
+     * @param cAddress The address.
+     * @throw std::out_of_range If the column already holds MAX_SIZE rows.
+     */
+    void IPv4AddressColumn::PushBack(const IPv4Address &cAddress)
+    {
+        if (_values.size() >= MAX_SIZE)
+        {
+            throw std::out_of_range(COLUMN_FULL);
+        }
+        _values.push_back(cAddress.ToUint32());
+    } /* void IPv4AddressColumn::PushBack(const IPv4Address &cAddress) */
+
+    /**
+     * @brief Appends an array of addresses.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @throw std::invalid_argument If the pointer is null and cCount is not zero.
+     * @throw std::out_of_range If the column would exceed MAX_SIZE rows.
+     */
+    void IPv4AddressColumn::Append(const IPv4Address *cAddresses, const size_t &cCount)
+    {
+        if (!cCount)
+        {
+            return;
+        }
+        if (!cAddresses)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (cCount > MAX_SIZE - _values.size())
+        {
+            throw std::out_of_range(COLUMN_FULL);
+        }
+
+        const size_t cOffset = _values.size();
+        _values.resize(cOffset + cCount);
+        uint32_t *const cValues = _values.data() + cOffset;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            cValues[i] = cAddresses[i].ToUint32();
+        }
+    } /* void IPv4AddressColumn::Append(const IPv4Address *cAddresses, const size_t &cCount) */
+
+    /**
+     * @brief Returns the address of a row.
+     * @param cRow The row index.
+     * @return The address.
+     * @throw std::out_of_range If the row does not exist.
+     */
+    IPv4Address IPv4AddressColumn::Get(const size_t &cRow) const
+    {
+        if (cRow >= _values.size())
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        return IPv4Address::FromUint32(_values[cRow]);
+    } /* IPv4Address IPv4AddressColumn::Get(const size_t &cRow) const */
+
+    /**
+     * @brief Replaces the address of a row.
+     * @param cRow The row index.
+     * @param cAddress The new address.
+     * @throw std::out_of_range If the row does not exist.
+     */
+    void IPv4AddressColumn::Set(const size_t &cRow, const IPv4Address &cAddress)
+    {
+        if (cRow >= _values.size())
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        _values[cRow] = cAddress.ToUint32();
+    } /* void IPv4AddressColumn::Set(const size_t &cRow, const IPv4Address &cAddress) */
+
+    /**
+     * @brief Selects the rows equal to an address.
+     * @param cAddress The address to look for.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv4AddressColumn::FilterEqual(const IPv4Address &cAddress, uint32_t *selection) const
+    {
+        if (!selection && !_values.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        return Select<true>(_values.data(), _values.size(), UINT32_MAX, cAddress.ToUint32(), cAddress.ToUint32(), selection);
+    } /* size_t IPv4AddressColumn::FilterEqual(const IPv4Address &cAddress, uint32_t *selection) const */
+
+    /**
+     * @brief Selects the rows within a prefix.
+     * @param cPrefix The prefix.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv4AddressColumn::FilterPrefix(const IPv4Prefix &cPrefix, uint32_t *selection) const
+    {
+        if (!selection && !_values.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        const uint32_t cNetwork = cPrefix.GetAddress().ToUint32();
+        return Select<true>(_values.data(), _values.size(), IPv4Prefix::MaskFromLength(cPrefix.GetLength()), cNetwork, cNetwork, selection);
+    } /* size_t IPv4AddressColumn::FilterPrefix(const IPv4Prefix &cPrefix, uint32_t *selection) const */
+
+    /**
+     * @brief Selects the rows within an inclusive address range.
+     * @param cRange The range.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv4AddressColumn::FilterRange(const IPv4Range &cRange, uint32_t *selection) const
+    {
+        if (!selection && !_values.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        return Select<false>(_values.data(), _values.size(), UINT32_MAX, cRange.GetFirst().ToUint32(), cRange.GetLast().ToUint32(), selection);
+    } /* size_t IPv4AddressColumn::FilterRange(const IPv4Range &cRange, uint32_t *selection) const */
+
+    /**
+     * @brief Builds a column from selected rows.
+     * @param cIndices The row indices, e.g. a selection vector. Indices may repeat.
+     * @param cCount The number of indices.
+     * @return The column holding row cIndices[i] at row i.
+     * @throw std::invalid_argument If the index pointer is null and cCount is not zero.
+     * @throw std::out_of_range If an index does not exist.
+     */
+    IPv4AddressColumn IPv4AddressColumn::Gather(const uint32_t *cIndices, const size_t &cCount) const
+    {
+        if (!cIndices && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        IPv4AddressColumn gathered;
+        gathered._values.resize(cCount);
+        uint32_t *const cOutput = gathered._values.data();
+        const uint32_t *const cValues = _values.data();
+        const size_t cSize = _values.size();
+        // The bound check is folded into one flag so the loop body stays branch-free.
+        bool outOfRange{};
+        for (size_t i = 0; i < cCount; i++)
+        {
+            const uint32_t cIndex = cIndices[i];
+            outOfRange |= cIndex >= cSize;
+            cOutput[i] = cValues[cIndex < cSize ? cIndex : 0];
+        }
+        if (outOfRange)
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        return gathered;
+    } /* IPv4AddressColumn IPv4AddressColumn::Gather(const uint32_t *cIndices, const size_t &cCount) const */
+
+    /**
+     * @brief Writes the rows of another column to selected rows of this one.
+     * @param cIndices The target row indices, one per row of cValues.
+     * @param cValues The values to write.
+     * @throw std::invalid_argument If the index pointer is null and cValues is not empty.
+     * @throw std::out_of_range If an index does not exist. Rows before the bad index are written.
+     */
+    void IPv4AddressColumn::Scatter(const uint32_t *cIndices, const IPv4AddressColumn &cValues)
+    {
+        if (!cIndices && !cValues.Empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        const size_t cSize = _values.size();
+        for (size_t i = 0; i < cValues.Size(); i++)
+        {
+            if (cIndices[i] >= cSize)
+            {
+                throw std::out_of_range(ROW_OUT_OF_RANGE);
+            }
+            _values[cIndices[i]] = cValues._values[i];
+        }
+    } /* void IPv4AddressColumn::Scatter(const uint32_t *cIndices, const IPv4AddressColumn &cValues) */
+
+    /**
+     * @brief Dictionary-encodes the column.
+     *
+     * Distinct values are found with an open-addressing hash table (linear probing, at most half
+     * full) that stores dictionary indices; the values themselves are read from the dictionary.
+     *
+     * @param codes Receives the dictionary index of every row, must have room for Size() codes.
+     * @return The dictionary.
+     * @throw std::invalid_argument If the code pointer is null and the column is not empty.
+     */
+    IPv4AddressColumn IPv4AddressColumn::DictionaryEncode(uint32_t *codes) const
+    {
+        if (!codes && !_values.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        constexpr uint32_t cEmpty = UINT32_MAX;
+        IPv4AddressColumn dictionary;
+        uint8_t shift = 64 - 10;
+        std::vector<uint32_t> table(size_t{1} << (64 - shift), cEmpty);
+
+        for (size_t row = 0; row < _values.size(); row++)
+        {
+            const uint32_t cValue = _values[row];
+            size_t slot = Slot(cValue, shift);
+            const size_t cMask = table.size() - 1;
+            while (table[slot] != cEmpty && dictionary._values[table[slot]] != cValue)
+            {
+                slot = (slot + 1) & cMask;
+            }
+
+            if (table[slot] == cEmpty)
+            {
+                table[slot] = static_cast<uint32_t>(dictionary._values.size());
+                dictionary._values.push_back(cValue);
+
+                if (2 * dictionary._values.size() > table.size())
+                {
+                    shift--;
+                    table.assign(size_t{1} << (64 - shift), cEmpty);
+                    for (uint32_t code = 0; code < dictionary._values.size(); code++)
+                    {
+                        size_t rehashed = Slot(dictionary._values[code], shift);
+                        while (table[rehashed] != cEmpty)
+                        {
+                            rehashed = (rehashed + 1) & (table.size() - 1);
+                        }
+                        table[rehashed] = code;
+                    }
+                }
+                codes[row] = static_cast<uint32_t>(dictionary._values.size() - 1);
+            }
+            else
+            {
+                codes[row] = table[slot];
+            }
+        }
+        return dictionary;
+    } /* IPv4AddressColumn IPv4AddressColumn::DictionaryEncode(uint32_t *codes) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
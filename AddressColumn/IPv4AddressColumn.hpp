@@ -0,0 +1,202 @@
+/**
+ * @file IPv4AddressColumn.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4AddressColumn (columnar storage of IPv4 addresses for analytics) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV4ADDRESSCOLUMN_H
+#define IPV4ADDRESSCOLUMN_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv4Address/IPv4Prefix.hpp"
+#include "IPv4Address/IPv4Range.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv4AddressColumn
+     * @brief A column of IPv4 addresses stored as one contiguous array of host-order uint32 values.
+     *
+     * The filters compare 16 rows per step with SIMD and write the indices of the matching rows
+     * to a selection vector, which is the input of Gather() and of filters on other columns.
+     * Rows are indexed with uint32_t, so a column holds at most UINT32_MAX rows.
+     *
+     * Selection vectors and code arrays are caller-owned buffers, so they can be reused between
+     * batches without reallocation.
+     */
+    class IPv4AddressColumn
+    {
+    public:
+        /**
+         * @brief Maximum number of rows.
+         */
+        static constexpr size_t MAX_SIZE = UINT32_MAX;
+
+        /**
+         * @brief Default constructor. Creates an empty column.
+         */
+        IPv4AddressColumn() = default;
+
+        /**
+         * @brief Constructor for the IPv4AddressColumn class.
+         * @param cAddresses The addresses to store.
+         * @throws std::out_of_range If there are more than MAX_SIZE addresses.
+         */
+        explicit IPv4AddressColumn(const std::vector<IPv4Address> &cAddresses);
+
+        /**
+         * @brief Returns the number of rows.
+         * @return The number of rows.
+         */
+        size_t Size() const { return _values.size(); }
+
+        /**
+         * @brief Checks whether the column has no rows.
+         * @return `true` if the column is empty, `false` otherwise.
+         */
+        bool Empty() const { return _values.empty(); }
+
+        /**
+         * @brief Returns the raw values, one host-order uint32 per row.
+         * @return Pointer to the first value.
+         */
+        const uint32_t *Data() const { return _values.data(); }
+
+        /**
+         * @brief Reserves storage for a number of rows.
+         * @param cCapacity The number of rows.
+         */
+        void Reserve(const size_t &cCapacity) { _values.reserve(cCapacity); }
+
+        /**
+         * @brief Removes all rows.
+         */
+        void Clear() { _values.clear(); }
+
+        /**
+         * @brief Appends an address.
+         * @param cAddress The address.
+         * @throws std::out_of_range If the column already holds MAX_SIZE rows.
+         */
+        void PushBack(const IPv4Address &cAddress);
+
+        /**
+         * @brief Appends an array of addresses.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @throws std::invalid_argument If the pointer is null and cCount is not zero.
+         * @throws std::out_of_range If the column would exceed MAX_SIZE rows.
+         */
+        void Append(const IPv4Address *cAddresses, const size_t &cCount);
+
+        /**
+         * @brief Returns the address of a row.
+         * @param cRow The row index.
+         * @return The address.
+         * @throws std::out_of_range If the row does not exist.
+         */
+        IPv4Address Get(const size_t &cRow) const;
+
+        /**
+         * @brief Replaces the address of a row.
+         * @param cRow The row index.
+         * @param cAddress The new address.
+         * @throws std::out_of_range If the row does not exist.
+         */
+        void Set(const size_t &cRow, const IPv4Address &cAddress);
+
+        /**
+         * @brief Selects the rows equal to an address.
+         * @param cAddress The address to look for.
+         * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+         * @return The number of matching rows.
+         * @throws std::invalid_argument If the selection pointer is null and the column is not empty.
+         */
+        size_t FilterEqual(const IPv4Address &cAddress, uint32_t *selection) const;
+
+        /**
+         * @brief Selects the rows within a prefix.
+         * @param cPrefix The prefix.
+         * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+         * @return The number of matching rows.
+         * @throws std::invalid_argument If the selection pointer is null and the column is not empty.
+         */
+        size_t FilterPrefix(const IPv4Prefix &cPrefix, uint32_t *selection) const;
+
+        /**
+         * @brief Selects the rows within an inclusive address range.
+         * @param cRange The range.
+         * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+         * @return The number of matching rows.
+         * @throws std::invalid_argument If the selection pointer is null and the column is not empty.
+         */
+        size_t FilterRange(const IPv4Range &cRange, uint32_t *selection) const;
+
+        /**
+         * @brief Builds a column from selected rows.
+         * @param cIndices The row indices, e.g. a selection vector. Indices may repeat.
+         * @param cCount The number of indices.
+         * @return The column holding row cIndices[i] at row i.
+         * @throws std::invalid_argument If the index pointer is null and cCount is not zero.
+         * @throws std::out_of_range If an index does not exist.
+         */
+        IPv4AddressColumn Gather(const uint32_t *cIndices, const size_t &cCount) const;
+
+        /**
+         * @brief Writes the rows of another column to selected rows of this one.
+         * @param cIndices The target row indices, one per row of cValues.
+         * @param cValues The values to write.
+         * @throws std::invalid_argument If the index pointer is null and cValues is not empty.
+         * @throws std::out_of_range If an index does not exist. Rows before the bad index are written.
+         */
+        void Scatter(const uint32_t *cIndices, const IPv4AddressColumn &cValues);
+
+        /**
+         * @brief Dictionary-encodes the column.
+         *
+         * The dictionary holds every distinct address once, in order of first occurrence. The
+         * column is restored with dictionary.Gather(codes, Size()).
+         *
+         * @param codes Receives the dictionary index of every row, must have room for Size() codes.
+         * @return The dictionary.
+         * @throws std::invalid_argument If the code pointer is null and the column is not empty.
+         */
+        IPv4AddressColumn DictionaryEncode(uint32_t *codes) const;
+
+    private:
+        /**
+         * @brief The values, host byte order.
+         */
+        std::vector<uint32_t> _values;
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::IPv4AddressColumn] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a row index out of range.
+         */
+        static constexpr char ROW_OUT_OF_RANGE[]{"[EthernetParameter::IPv4AddressColumn] Row index out of range!"};
+
+        /**
+         * @brief Error message indicating that the column would exceed MAX_SIZE rows.
+         */
+        static constexpr char COLUMN_FULL[]{"[EthernetParameter::IPv4AddressColumn] Column exceeds maximum size!"};
+    }; /* class IPv4AddressColumn */
+}
+
+#endif /* IPV4ADDRESSCOLUMN_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
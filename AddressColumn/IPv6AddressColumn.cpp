@@ -0,0 +1,600 @@
+/**
+ * @file IPv6AddressColumn.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv6AddressColumn class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv6AddressColumn.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <stdexcept>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IPV6_ADDRESS_COLUMN_SSE2
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define IPV6_ADDRESS_COLUMN_AVX
+#define IPV6_ADDRESS_COLUMN_AVX2_TARGET __attribute__((target("avx2")))
+#define IPV6_ADDRESS_COLUMN_AVX512_TARGET __attribute__((target("avx512f,avx512vl")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define IPV6_ADDRESS_COLUMN_AVX
+#define IPV6_ADDRESS_COLUMN_AVX2_TARGET
+#define IPV6_ADDRESS_COLUMN_AVX512_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Returns the number of trailing zero bits.
+         * @param cWord The word to scan, must not be zero.
+         * @return The index of the lowest set bit.
+         */
+        inline uint32_t CountTrailingZeros(const uint32_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanForward(&index, cWord);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctz(cWord));
+#endif
+        }
+
+        /**
+         * @brief Appends the rows of a match bitmask to a selection vector.
+         * @param mask Bit i set if row cBase + i matches.
+         * @param cBase The row of bit 0.
+         * @param selection The selection vector position to write to.
+         * @return The number of rows written.
+         */
+        inline size_t AppendSelection(uint32_t mask, const uint32_t &cBase, uint32_t *selection)
+        {
+            size_t count{};
+            while (mask)
+            {
+                selection[count++] = cBase + CountTrailingZeros(mask);
+                mask &= mask - 1;
+            }
+            return count;
+        }
+
+#if defined(IPV6_ADDRESS_COLUMN_SSE2)
+        /**
+         * @brief Compares two 64-bit lanes for equality (SSE2 has no 64-bit compare).
+         */
+        inline __m128i CompareEqual64(const __m128i &cLeft, const __m128i &cRight)
+        {
+            const __m128i cEqual32 = _mm_cmpeq_epi32(cLeft, cRight);
+            return _mm_and_si128(cEqual32, _mm_shuffle_epi32(cEqual32, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+#endif
+
+#if defined(IPV6_ADDRESS_COLUMN_AVX)
+        /**
+         * @brief Returns the number of set bits of an 8-bit match mask.
+         */
+        inline uint32_t PopulationCount(const uint32_t &cMask)
+        {
+#if defined(_MSC_VER)
+            return static_cast<uint32_t>(__popcnt(cMask));
+#else
+            return static_cast<uint32_t>(__builtin_popcount(cMask));
+#endif
+        }
+#endif
+
+        /**
+         * @brief Selects the rows whose masked value equals a given value.
+         *
+         * Equality is a full mask, a prefix is the prefix mask with the network as the value. If
+         * the lower mask is zero (prefixes up to /64) the lower array is not read.
+         *
+         * This is the reference every SIMD variant must match; they call it for the rows left
+         * after their last full block.
+         *
+         * @param cUpper The upper halves.
+         * @param cLower The lower halves.
+         * @param cRow The first row to test.
+         * @param cCount The number of rows.
+         * @param cUpperMask The mask applied to the upper halves.
+         * @param cLowerMask The mask applied to the lower halves.
+         * @param cUpperValue The value the masked upper halves must equal.
+         * @param cLowerValue The value the masked lower halves must equal.
+         * @param selection Receives the matching row indices.
+         * @return The number of matching rows.
+         */
+        size_t SelectEqualScalar(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cRow, const size_t &cCount, const uint64_t &cUpperMask,
+                                 const uint64_t &cLowerMask, const uint64_t &cUpperValue, const uint64_t &cLowerValue, uint32_t *selection)
+        {
+            size_t count{};
+            const bool cUpperOnly = cLowerMask == 0;
+            for (size_t row = cRow; row < cCount; row++)
+            {
+                selection[count] = static_cast<uint32_t>(row);
+                count += (cUpper[row] & cUpperMask) == cUpperValue && (cUpperOnly || (cLower[row] & cLowerMask) == cLowerValue);
+            }
+            return count;
+        }
+
+#if defined(IPV6_ADDRESS_COLUMN_SSE2)
+        /**
+         * @brief SelectEqualScalar() for 8 rows per step with SSE2.
+         */
+        size_t SelectEqualSse2(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cRow, const size_t &cCount, const uint64_t &cUpperMask,
+                               const uint64_t &cLowerMask, const uint64_t &cUpperValue, const uint64_t &cLowerValue, uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            const bool cUpperOnly = cLowerMask == 0;
+            const __m128i cUpperMaskVector = _mm_set1_epi64x(static_cast<int64_t>(cUpperMask));
+            const __m128i cLowerMaskVector = _mm_set1_epi64x(static_cast<int64_t>(cLowerMask));
+            const __m128i cUpperVector = _mm_set1_epi64x(static_cast<int64_t>(cUpperValue));
+            const __m128i cLowerVector = _mm_set1_epi64x(static_cast<int64_t>(cLowerValue));
+
+            for (; row + 8 <= cCount; row += 8)
+            {
+                uint32_t matches{};
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const __m128i cUpperLane = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cUpper + row + 2 * i)), cUpperMaskVector);
+                    __m128i equal = CompareEqual64(cUpperLane, cUpperVector);
+                    if (!cUpperOnly)
+                    {
+                        const __m128i cLowerLane = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cLower + row + 2 * i)), cLowerMaskVector);
+                        equal = _mm_and_si128(equal, CompareEqual64(cLowerLane, cLowerVector));
+                    }
+                    matches |= static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(equal))) << (2 * i);
+                }
+                if (matches)
+                {
+                    count += AppendSelection(matches, static_cast<uint32_t>(row), selection + count);
+                }
+            }
+            return count + SelectEqualScalar(cUpper, cLower, row, cCount, cUpperMask, cLowerMask, cUpperValue, cLowerValue, selection + count);
+        }
+#endif
+
+#if defined(IPV6_ADDRESS_COLUMN_AVX)
+        /**
+         * @brief SelectEqualScalar() for 16 rows per step with AVX2 (it has a 64-bit compare).
+         */
+        IPV6_ADDRESS_COLUMN_AVX2_TARGET size_t SelectEqualAvx2(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cRow, const size_t &cCount,
+                                                               const uint64_t &cUpperMask, const uint64_t &cLowerMask, const uint64_t &cUpperValue,
+                                                               const uint64_t &cLowerValue, uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            const bool cUpperOnly = cLowerMask == 0;
+            const __m256i cUpperMaskVector = _mm256_set1_epi64x(static_cast<int64_t>(cUpperMask));
+            const __m256i cLowerMaskVector = _mm256_set1_epi64x(static_cast<int64_t>(cLowerMask));
+            const __m256i cUpperVector = _mm256_set1_epi64x(static_cast<int64_t>(cUpperValue));
+            const __m256i cLowerVector = _mm256_set1_epi64x(static_cast<int64_t>(cLowerValue));
+
+            for (; row + 16 <= cCount; row += 16)
+            {
+                uint32_t matches{};
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const __m256i cUpperLane = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(cUpper + row + 4 * i)), cUpperMaskVector);
+                    __m256i equal = _mm256_cmpeq_epi64(cUpperLane, cUpperVector);
+                    if (!cUpperOnly)
+                    {
+                        const __m256i cLowerLane = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(cLower + row + 4 * i)), cLowerMaskVector);
+                        equal = _mm256_and_si256(equal, _mm256_cmpeq_epi64(cLowerLane, cLowerVector));
+                    }
+                    matches |= static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(equal))) << (4 * i);
+                }
+                if (matches)
+                {
+                    count += AppendSelection(matches, static_cast<uint32_t>(row), selection + count);
+                }
+            }
+            return count + SelectEqualScalar(cUpper, cLower, row, cCount, cUpperMask, cLowerMask, cUpperValue, cLowerValue, selection + count);
+        }
+
+        /**
+         * @brief SelectEqualScalar() for 8 rows per step with AVX-512.
+         *
+         * The mask compares give the matching lanes directly and the compress instruction packs
+         * their row indices. The packed vector is stored whole: count <= row, so the 8 lanes stay
+         * within the cCount rows of the selection.
+         */
+        IPV6_ADDRESS_COLUMN_AVX512_TARGET size_t SelectEqualAvx512(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cRow, const size_t &cCount,
+                                                                   const uint64_t &cUpperMask, const uint64_t &cLowerMask, const uint64_t &cUpperValue,
+                                                                   const uint64_t &cLowerValue, uint32_t *selection)
+        {
+            size_t count{};
+            size_t row = cRow;
+            const bool cUpperOnly = cLowerMask == 0;
+            const __m512i cUpperMaskVector = _mm512_set1_epi64(static_cast<int64_t>(cUpperMask));
+            const __m512i cLowerMaskVector = _mm512_set1_epi64(static_cast<int64_t>(cLowerMask));
+            const __m512i cUpperVector = _mm512_set1_epi64(static_cast<int64_t>(cUpperValue));
+            const __m512i cLowerVector = _mm512_set1_epi64(static_cast<int64_t>(cLowerValue));
+            const __m256i cStep = _mm256_set1_epi32(8);
+            __m256i rows = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(row)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+            for (; row + 8 <= cCount; row += 8)
+            {
+                __mmask8 matches = _mm512_cmpeq_epu64_mask(_mm512_and_si512(_mm512_loadu_si512(cUpper + row), cUpperMaskVector), cUpperVector);
+                if (!cUpperOnly)
+                {
+                    matches = _mm512_mask_cmpeq_epu64_mask(matches, _mm512_and_si512(_mm512_loadu_si512(cLower + row), cLowerMaskVector), cLowerVector);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(selection + count), _mm256_maskz_compress_epi32(matches, rows));
+                count += PopulationCount(matches);
+                rows = _mm256_add_epi32(rows, cStep);
+            }
+            return count + SelectEqualScalar(cUpper, cLower, row, cCount, cUpperMask, cLowerMask, cUpperValue, cLowerValue, selection + count);
+        }
+#endif
+
+        /**
+         * @brief The signature shared by the variants of SelectEqualScalar().
+         */
+        using SelectEqualFunction = size_t (*)(const uint64_t *, const uint64_t *, const size_t &, const size_t &, const uint64_t &, const uint64_t &,
+                                               const uint64_t &, const uint64_t &, uint32_t *);
+
+        /**
+         * @brief Returns the variant of SelectEqualScalar() for a tier.
+         *
+         * Each tier without its own variant takes the one of the tier below it (the SSE4.1 64-bit
+         * compare saves one shuffle, not worth a variant of its own).
+         *
+         * @param cTier The tier.
+         * @return The variant.
+         */
+        SelectEqualFunction SelectEqualKernel(const CpuFeatures::Tier &cTier)
+        {
+            static const SelectEqualFunction cTable[CpuFeatures::TIER_COUNT]{
+                SelectEqualScalar,
+#if defined(IPV6_ADDRESS_COLUMN_SSE2)
+                SelectEqualSse2,
+                SelectEqualSse2,
+#else
+                SelectEqualScalar,
+                SelectEqualScalar,
+#endif
+#if defined(IPV6_ADDRESS_COLUMN_AVX)
+                SelectEqualAvx2,
+                SelectEqualAvx512,
+#elif defined(IPV6_ADDRESS_COLUMN_SSE2)
+                SelectEqualSse2,
+                SelectEqualSse2,
+#else
+                SelectEqualScalar,
+                SelectEqualScalar,
+#endif
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+
+        /**
+         * @brief Selects the rows whose masked value equals a given value.
+         *
+         * Calls the variant of the selected tier, which is looked up once.
+         */
+        size_t SelectEqual(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, const uint64_t &cUpperMask, const uint64_t &cLowerMask,
+                           const uint64_t &cUpperValue, const uint64_t &cLowerValue, uint32_t *selection)
+        {
+            static const SelectEqualFunction cSelectEqual = SelectEqualKernel(CpuFeatures::Selected());
+            return cSelectEqual(cUpper, cLower, 0, cCount, cUpperMask, cLowerMask, cUpperValue, cLowerValue, selection);
+        }
+
+        /**
+         * @brief Hashes an address to a slot of a power-of-two table.
+         */
+        inline size_t Slot(const uint64_t &cUpper, const uint64_t &cLower, const uint8_t &cShift)
+        {
+            return static_cast<size_t>(((cUpper ^ (cLower * 0xC2B2AE3D27D4EB4Full)) * 0x9E3779B97F4A7C15ull) >> cShift);
+        }
+    }
+
+    /**
+     * @brief Constructor for the IPv6AddressColumn class.
+     * @param cAddresses The addresses to store.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    IPv6AddressColumn::IPv6AddressColumn(const std::vector<IPv6Address> &cAddresses)
+    {
+        Append(cAddresses.data(), cAddresses.size());
+    } /* IPv6AddressColumn::IPv6AddressColumn(const std::vector<IPv6Address> &cAddresses) */
+
+    /**
+     * @brief Appends an address.
+     * @param cAddress The address.
+     * @throw std::out_of_range If the column already holds MAX_SIZE rows.
+     */
+    void IPv6AddressColumn::PushBack(const IPv6Address &cAddress)
+    {
+        if (_upper.size() >= MAX_SIZE)
+        {
+            throw std::out_of_range(COLUMN_FULL);
+        }
+        _upper.push_back(cAddress.GetUpper64());
+        _lower.push_back(cAddress.GetLower64());
+    } /* void IPv6AddressColumn::PushBack(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Appends an array of addresses.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @throw std::invalid_argument If the pointer is null and cCount is not zero.
+     * @throw std::out_of_range If the column would exceed MAX_SIZE rows.
+     */
+    void IPv6AddressColumn::Append(const IPv6Address *cAddresses, const size_t &cCount)
+    {
+        if (!cCount)
+        {
+            return;
+        }
+        if (!cAddresses)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (cCount > MAX_SIZE - _upper.size())
+        {
+            throw std::out_of_range(COLUMN_FULL);
+        }
+
+        const size_t cOffset = _upper.size();
+        _upper.resize(cOffset + cCount);
+        _lower.resize(cOffset + cCount);
+        uint64_t *const cUpper = _upper.data() + cOffset;
+        uint64_t *const cLower = _lower.data() + cOffset;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            cUpper[i] = cAddresses[i].GetUpper64();
+            cLower[i] = cAddresses[i].GetLower64();
+        }
+    } /* void IPv6AddressColumn::Append(const IPv6Address *cAddresses, const size_t &cCount) */
+
+    /**
+     * @brief Returns the address of a row.
+     * @param cRow The row index.
+     * @return The address.
+     * @throw std::out_of_range If the row does not exist.
+     */
+    IPv6Address IPv6AddressColumn::Get(const size_t &cRow) const
+    {
+        if (cRow >= _upper.size())
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        return IPv6Address::FromUint64(_upper[cRow], _lower[cRow]);
+    } /* IPv6Address IPv6AddressColumn::Get(const size_t &cRow) const */
+
+    /**
+     * @brief Replaces the address of a row.
+     * @param cRow The row index.
+     * @param cAddress The new address.
+     * @throw std::out_of_range If the row does not exist.
+     */
+    void IPv6AddressColumn::Set(const size_t &cRow, const IPv6Address &cAddress)
+    {
+        if (cRow >= _upper.size())
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        _upper[cRow] = cAddress.GetUpper64();
+        _lower[cRow] = cAddress.GetLower64();
+    } /* void IPv6AddressColumn::Set(const size_t &cRow, const IPv6Address &cAddress) */
+
+    /**
+     * @brief Selects the rows equal to an address.
+     * @param cAddress The address to look for.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv6AddressColumn::FilterEqual(const IPv6Address &cAddress, uint32_t *selection) const
+    {
+        if (!selection && !_upper.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        return SelectEqual(_upper.data(), _lower.data(), _upper.size(), UINT64_MAX, UINT64_MAX, cAddress.GetUpper64(), cAddress.GetLower64(), selection);
+    } /* size_t IPv6AddressColumn::FilterEqual(const IPv6Address &cAddress, uint32_t *selection) const */
+
+    /**
+     * @brief Selects the rows within a prefix.
+     * @param cPrefix The prefix.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv6AddressColumn::FilterPrefix(const IPv6Prefix &cPrefix, uint32_t *selection) const
+    {
+        if (!selection && !_upper.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        const IPv6Address cNetwork = cPrefix.GetAddress();
+        return SelectEqual(_upper.data(), _lower.data(), _upper.size(),
+                           IPv6Prefix::UpperMaskFromLength(cPrefix.GetLength()), IPv6Prefix::LowerMaskFromLength(cPrefix.GetLength()),
+                           cNetwork.GetUpper64(), cNetwork.GetLower64(), selection);
+    } /* size_t IPv6AddressColumn::FilterPrefix(const IPv6Prefix &cPrefix, uint32_t *selection) const */
+
+    /**
+     * @brief Selects the rows within an inclusive address range.
+     *
+     * Each bound is a 128-bit compare done as (upper, lower) lexicographic order with boolean
+     * arithmetic, so the loop has no data-dependent branches.
+     *
+     * @param cRange The range.
+     * @param selection Receives the matching row indices in ascending order, must have room for Size() indices.
+     * @return The number of matching rows.
+     * @throw std::invalid_argument If the selection pointer is null and the column is not empty.
+     */
+    size_t IPv6AddressColumn::FilterRange(const IPv6Range &cRange, uint32_t *selection) const
+    {
+        if (!selection && !_upper.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        const uint64_t cFirstUpper = cRange.GetFirst().GetUpper64();
+        const uint64_t cFirstLower = cRange.GetFirst().GetLower64();
+        const uint64_t cLastUpper = cRange.GetLast().GetUpper64();
+        const uint64_t cLastLower = cRange.GetLast().GetLower64();
+        const uint64_t *const cUpper = _upper.data();
+        const uint64_t *const cLower = _lower.data();
+
+        size_t count{};
+        for (size_t row = 0; row < _upper.size(); row++)
+        {
+            const uint64_t cRowUpper = cUpper[row];
+            const uint64_t cRowLower = cLower[row];
+            const bool cBelow = (cRowUpper < cFirstUpper) | ((cRowUpper == cFirstUpper) & (cRowLower < cFirstLower));
+            const bool cAbove = (cRowUpper > cLastUpper) | ((cRowUpper == cLastUpper) & (cRowLower > cLastLower));
+            selection[count] = static_cast<uint32_t>(row);
+            count += !(cBelow | cAbove);
+        }
+        return count;
+    } /* size_t IPv6AddressColumn::FilterRange(const IPv6Range &cRange, uint32_t *selection) const */
+
+    /**
+     * @brief Builds a column from selected rows.
+     * @param cIndices The row indices, e.g. a selection vector. Indices may repeat.
+     * @param cCount The number of indices.
+     * @return The column holding row cIndices[i] at row i.
+     * @throw std::invalid_argument If the index pointer is null and cCount is not zero.
+     * @throw std::out_of_range If an index does not exist.
+     */
+    IPv6AddressColumn IPv6AddressColumn::Gather(const uint32_t *cIndices, const size_t &cCount) const
+    {
+        if (!cIndices && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        IPv6AddressColumn gathered;
+        gathered._upper.resize(cCount);
+        gathered._lower.resize(cCount);
+        uint64_t *const cOutputUpper = gathered._upper.data();
+        uint64_t *const cOutputLower = gathered._lower.data();
+        const uint64_t *const cUpper = _upper.data();
+        const uint64_t *const cLower = _lower.data();
+        const size_t cSize = _upper.size();
+        // The bound check is folded into one flag so the loop body stays branch-free.
+        bool outOfRange{};
+        for (size_t i = 0; i < cCount; i++)
+        {
+            const uint32_t cIndex = cIndices[i];
+            outOfRange |= cIndex >= cSize;
+            const size_t cRow = cIndex < cSize ? cIndex : 0;
+            cOutputUpper[i] = cUpper[cRow];
+            cOutputLower[i] = cLower[cRow];
+        }
+        if (outOfRange)
+        {
+            throw std::out_of_range(ROW_OUT_OF_RANGE);
+        }
+        return gathered;
+    } /* IPv6AddressColumn IPv6AddressColumn::Gather(const uint32_t *cIndices, const size_t &cCount) const */
+
+    /**
+     * @brief Writes the rows of another column to selected rows of this one.
+     * @param cIndices The target row indices, one per row of cValues.
+     * @param cValues The values to write.
+     * @throw std::invalid_argument If the index pointer is null and cValues is not empty.
+     * @throw std::out_of_range If an index does not exist. Rows before the bad index are written.
+     */
+    void IPv6AddressColumn::Scatter(const uint32_t *cIndices, const IPv6AddressColumn &cValues)
+    {
+        if (!cIndices && !cValues.Empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        const size_t cSize = _upper.size();
+        for (size_t i = 0; i < cValues.Size(); i++)
+        {
+            if (cIndices[i] >= cSize)
+            {
+                throw std::out_of_range(ROW_OUT_OF_RANGE);
+            }
+            _upper[cIndices[i]] = cValues._upper[i];
+            _lower[cIndices[i]] = cValues._lower[i];
+        }
+    } /* void IPv6AddressColumn::Scatter(const uint32_t *cIndices, const IPv6AddressColumn &cValues) */
+
+    /**
+     * @brief Dictionary-encodes the column.
+     *
+     * Distinct values are found with an open-addressing hash table (linear probing, at most half
+     * full) that stores dictionary indices; the values themselves are read from the dictionary.
+     *
+     * @param codes Receives the dictionary index of every row, must have room for Size() codes.
+     * @return The dictionary.
+     * @throw std::invalid_argument If the code pointer is null and the column is not empty.
+     */
+    IPv6AddressColumn IPv6AddressColumn::DictionaryEncode(uint32_t *codes) const
+    {
+        if (!codes && !_upper.empty())
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        constexpr uint32_t cEmpty = UINT32_MAX;
+        IPv6AddressColumn dictionary;
+        uint8_t shift = 64 - 10;
+        std::vector<uint32_t> table(size_t{1} << (64 - shift), cEmpty);
+
+        for (size_t row = 0; row < _upper.size(); row++)
+        {
+            const uint64_t cUpper = _upper[row];
+            const uint64_t cLower = _lower[row];
+            size_t slot = Slot(cUpper, cLower, shift);
+            const size_t cMask = table.size() - 1;
+            while (table[slot] != cEmpty && (dictionary._upper[table[slot]] != cUpper || dictionary._lower[table[slot]] != cLower))
+            {
+                slot = (slot + 1) & cMask;
+            }
+
+            if (table[slot] == cEmpty)
+            {
+                table[slot] = static_cast<uint32_t>(dictionary._upper.size());
+                dictionary._upper.push_back(cUpper);
+                dictionary._lower.push_back(cLower);
+
+                if (2 * dictionary._upper.size() > table.size())
+                {
+                    shift--;
+                    table.assign(size_t{1} << (64 - shift), cEmpty);
+                    for (uint32_t code = 0; code < dictionary._upper.size(); code++)
+                    {
+                        size_t rehashed = Slot(dictionary._upper[code], dictionary._lower[code], shift);
+                        while (table[rehashed] != cEmpty)
+                        {
+                            rehashed = (rehashed + 1) & (table.size() - 1);
+                        }
+                        table[rehashed] = code;
+                    }
+                }
+                codes[row] = static_cast<uint32_t>(dictionary._upper.size() - 1);
+            }
+            else
+            {
+                codes[row] = table[slot];
+            }
+        }
+        return dictionary;
+    } /* IPv6AddressColumn IPv6AddressColumn::DictionaryEncode(uint32_t *codes) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
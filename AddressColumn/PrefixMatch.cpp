@@ -0,0 +1,393 @@
+/**
+ * @file PrefixMatch.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief PrefixMatch class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "PrefixMatch.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define PREFIX_MATCH_AVX
+#define PREFIX_MATCH_AVX2_TARGET __attribute__((target("avx2")))
+#define PREFIX_MATCH_AVX512_TARGET __attribute__((target("avx512f")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define PREFIX_MATCH_AVX
+#define PREFIX_MATCH_AVX2_TARGET
+#define PREFIX_MATCH_AVX512_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    // The kernels load the address arrays as raw words.
+    static_assert(sizeof(IPv4Address) == 4 && std::is_trivially_copyable<IPv4Address>::value, "IPv4Address arrays must be packed");
+    static_assert(sizeof(IPv6Address) == 16 && std::is_trivially_copyable<IPv6Address>::value, "IPv6Address arrays must be packed");
+
+    namespace
+    {
+        /**
+         * @brief The raw words of an IPv6 address, in memory order.
+         */
+        struct RawIPv6
+        {
+            uint64_t first;
+            uint64_t second;
+        };
+
+        /**
+         * @brief Returns the raw word of an IPv4 address, in memory order.
+         */
+        inline uint32_t Raw(const IPv4Address &cAddress)
+        {
+            uint32_t raw;
+            std::memcpy(&raw, &cAddress, sizeof(raw));
+            return raw;
+        }
+
+        /**
+         * @brief Returns the raw words of an IPv6 address, in memory order.
+         */
+        inline RawIPv6 Raw(const IPv6Address &cAddress)
+        {
+            RawIPv6 raw;
+            std::memcpy(&raw, &cAddress, sizeof(raw));
+            return raw;
+        }
+
+        /**
+         * @brief Returns the number of set bits of a word.
+         */
+        inline size_t PopulationCount(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<size_t>(__popcnt64(cWord));
+#elif defined(_MSC_VER)
+            return static_cast<size_t>(__popcnt(static_cast<uint32_t>(cWord)) + __popcnt(static_cast<uint32_t>(cWord >> 32)));
+#else
+            return static_cast<size_t>(__builtin_popcountll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Returns the number of set bits of a bitmask.
+         */
+        size_t CountMatches(const uint64_t *cMatches, const size_t &cCount)
+        {
+            size_t count{};
+            for (size_t word = 0; word < PrefixMatch::WordCount(cCount); word++)
+            {
+                count += PopulationCount(cMatches[word]);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Writes the match words of the entries from cBegin on, testing one entry at a time.
+         *
+         * This is the reference the SIMD kernels must match; they call it for the entries after
+         * their last full word.
+         *
+         * @param cAddresses The addresses.
+         * @param cBegin The first entry to test, a multiple of 64.
+         * @param cCount The number of addresses.
+         * @param cMask The raw prefix mask.
+         * @param cNetwork The raw prefix network.
+         * @param matches The bitmask.
+         */
+        void MatchScalar(const IPv4Address *cAddresses, const size_t &cBegin, const size_t &cCount, const uint32_t &cMask, const uint32_t &cNetwork, uint64_t *matches)
+        {
+            for (size_t word = cBegin / 64; word * 64 < cCount; word++)
+            {
+                const size_t cEnd = std::min(cCount, word * 64 + 64);
+                uint64_t bits{};
+                for (size_t i = word * 64; i < cEnd; i++)
+                {
+                    bits |= static_cast<uint64_t>((Raw(cAddresses[i]) & cMask) == cNetwork) << (i % 64);
+                }
+                matches[word] = bits;
+            }
+        }
+
+        /**
+         * @brief MatchScalar() for IPv6 addresses.
+         */
+        void MatchScalar(const IPv6Address *cAddresses, const size_t &cBegin, const size_t &cCount, const RawIPv6 &cMask, const RawIPv6 &cNetwork, uint64_t *matches)
+        {
+            for (size_t word = cBegin / 64; word * 64 < cCount; word++)
+            {
+                const size_t cEnd = std::min(cCount, word * 64 + 64);
+                uint64_t bits{};
+                for (size_t i = word * 64; i < cEnd; i++)
+                {
+                    const RawIPv6 cRaw = Raw(cAddresses[i]);
+                    const bool cMatch = (((cRaw.first & cMask.first) ^ cNetwork.first) | ((cRaw.second & cMask.second) ^ cNetwork.second)) == 0;
+                    bits |= static_cast<uint64_t>(cMatch) << (i % 64);
+                }
+                matches[word] = bits;
+            }
+        }
+
+        /**
+         * @brief MatchScalar() from the first entry.
+         */
+        template <typename Address, typename Word>
+        void MatchPortable(const Address *cAddresses, const size_t &cCount, const Word &cMask, const Word &cNetwork, uint64_t *matches)
+        {
+            MatchScalar(cAddresses, 0, cCount, cMask, cNetwork, matches);
+        }
+
+#if defined(PREFIX_MATCH_AVX)
+        /**
+         * @brief Folds the lane compare bits of IPv6 addresses (two 64-bit lanes each) to one bit per address.
+         * @param cLanes Bit 2j and 2j + 1 set if both lanes of address j match; up to 8 lanes.
+         * @return Bit j set if address j matches.
+         */
+        inline uint32_t FoldLanePairs(const uint32_t &cLanes)
+        {
+            uint32_t bits = cLanes & (cLanes >> 1) & 0x55;
+            bits = (bits | bits >> 1) & 0x33;
+            return (bits | bits >> 2) & 0x0F;
+        }
+
+        /**
+         * @brief MatchScalar() for 8 IPv4 addresses per compare with AVX2.
+         */
+        PREFIX_MATCH_AVX2_TARGET void MatchAvx2(const IPv4Address *cAddresses, const size_t &cCount, const uint32_t &cMask, const uint32_t &cNetwork, uint64_t *matches)
+        {
+            const __m256i cMaskVector = _mm256_set1_epi32(static_cast<int32_t>(cMask));
+            const __m256i cNetworkVector = _mm256_set1_epi32(static_cast<int32_t>(cNetwork));
+            size_t row{};
+            for (; row + 64 <= cCount; row += 64)
+            {
+                uint64_t bits{};
+                for (size_t i = 0; i < 8; i++)
+                {
+                    const __m256i cValue = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cAddresses + row + 8 * i));
+                    const __m256i cEqual = _mm256_cmpeq_epi32(_mm256_and_si256(cValue, cMaskVector), cNetworkVector);
+                    bits |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(cEqual)))) << (8 * i);
+                }
+                matches[row / 64] = bits;
+            }
+            MatchScalar(cAddresses, row, cCount, cMask, cNetwork, matches);
+        }
+
+        /**
+         * @brief MatchScalar() for 2 IPv6 addresses per compare with AVX2.
+         */
+        PREFIX_MATCH_AVX2_TARGET void MatchAvx2(const IPv6Address *cAddresses, const size_t &cCount, const RawIPv6 &cMask, const RawIPv6 &cNetwork, uint64_t *matches)
+        {
+            const __m256i cMaskVector = _mm256_setr_epi64x(static_cast<int64_t>(cMask.first), static_cast<int64_t>(cMask.second),
+                                                           static_cast<int64_t>(cMask.first), static_cast<int64_t>(cMask.second));
+            const __m256i cNetworkVector = _mm256_setr_epi64x(static_cast<int64_t>(cNetwork.first), static_cast<int64_t>(cNetwork.second),
+                                                              static_cast<int64_t>(cNetwork.first), static_cast<int64_t>(cNetwork.second));
+            size_t row{};
+            for (; row + 64 <= cCount; row += 64)
+            {
+                uint64_t bits{};
+                for (size_t i = 0; i < 32; i++)
+                {
+                    const __m256i cValue = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cAddresses + row + 2 * i));
+                    const __m256i cEqual = _mm256_cmpeq_epi64(_mm256_and_si256(cValue, cMaskVector), cNetworkVector);
+                    bits |= static_cast<uint64_t>(FoldLanePairs(static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(cEqual))))) << (2 * i);
+                }
+                matches[row / 64] = bits;
+            }
+            MatchScalar(cAddresses, row, cCount, cMask, cNetwork, matches);
+        }
+
+        /**
+         * @brief MatchScalar() for 16 IPv4 addresses per mask compare with AVX-512.
+         */
+        PREFIX_MATCH_AVX512_TARGET void MatchAvx512(const IPv4Address *cAddresses, const size_t &cCount, const uint32_t &cMask, const uint32_t &cNetwork, uint64_t *matches)
+        {
+            const __m512i cMaskVector = _mm512_set1_epi32(static_cast<int32_t>(cMask));
+            const __m512i cNetworkVector = _mm512_set1_epi32(static_cast<int32_t>(cNetwork));
+            size_t row{};
+            for (; row + 64 <= cCount; row += 64)
+            {
+                uint64_t bits{};
+                for (size_t i = 0; i < 4; i++)
+                {
+                    const __m512i cValue = _mm512_loadu_si512(cAddresses + row + 16 * i);
+                    bits |= static_cast<uint64_t>(_mm512_cmpeq_epi32_mask(_mm512_and_si512(cValue, cMaskVector), cNetworkVector)) << (16 * i);
+                }
+                matches[row / 64] = bits;
+            }
+            MatchScalar(cAddresses, row, cCount, cMask, cNetwork, matches);
+        }
+
+        /**
+         * @brief MatchScalar() for 4 IPv6 addresses per mask compare (16 per step) with AVX-512.
+         */
+        PREFIX_MATCH_AVX512_TARGET void MatchAvx512(const IPv6Address *cAddresses, const size_t &cCount, const RawIPv6 &cMask, const RawIPv6 &cNetwork, uint64_t *matches)
+        {
+            const __m512i cMaskVector = _mm512_set4_epi64(static_cast<int64_t>(cMask.second), static_cast<int64_t>(cMask.first), static_cast<int64_t>(cMask.second),
+                                                          static_cast<int64_t>(cMask.first));
+            const __m512i cNetworkVector = _mm512_set4_epi64(static_cast<int64_t>(cNetwork.second), static_cast<int64_t>(cNetwork.first), static_cast<int64_t>(cNetwork.second),
+                                                             static_cast<int64_t>(cNetwork.first));
+            size_t row{};
+            for (; row + 64 <= cCount; row += 64)
+            {
+                uint64_t bits{};
+                for (size_t i = 0; i < 16; i++)
+                {
+                    const __m512i cValue = _mm512_loadu_si512(cAddresses + row + 4 * i);
+                    const __mmask8 cEqual = _mm512_cmpeq_epi64_mask(_mm512_and_si512(cValue, cMaskVector), cNetworkVector);
+                    bits |= static_cast<uint64_t>(FoldLanePairs(cEqual)) << (4 * i);
+                }
+                matches[row / 64] = bits;
+            }
+            MatchScalar(cAddresses, row, cCount, cMask, cNetwork, matches);
+        }
+#endif
+
+        /**
+         * @brief Returns the kernel for the tier chosen by CpuFeatures.
+         *
+         * SSE2 and SSE4.2 take the scalar kernel, which the compiler may vectorise itself.
+         *
+         * @tparam Address IPv4Address or IPv6Address.
+         * @tparam Word The raw mask and network type.
+         * @param cTier The tier.
+         * @return The kernel.
+         */
+        template <typename Address, typename Word>
+        auto MatchKernel(const CpuFeatures::Tier &cTier)
+        {
+            using Kernel = void (*)(const Address *, const size_t &, const Word &, const Word &, uint64_t *);
+            static const Kernel cTable[CpuFeatures::TIER_COUNT]{
+                MatchPortable<Address, Word>,
+                MatchPortable<Address, Word>,
+                MatchPortable<Address, Word>,
+#if defined(PREFIX_MATCH_AVX)
+                MatchAvx2,
+                MatchAvx512,
+#else
+                MatchPortable<Address, Word>,
+                MatchPortable<Address, Word>,
+#endif
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+
+        /**
+         * @brief Writes the match words of a prefix array, one prefix at a time.
+         */
+        template <typename Address, typename Prefix>
+        void MatchPrefixes(const Address &cAddress, const Prefix *cPrefixes, const size_t &cCount, uint64_t *matches)
+        {
+            for (size_t word = 0; word * 64 < cCount; word++)
+            {
+                const size_t cEnd = std::min(cCount, word * 64 + 64);
+                uint64_t bits{};
+                for (size_t i = word * 64; i < cEnd; i++)
+                {
+                    bits |= static_cast<uint64_t>(cPrefixes[i].Contains(cAddress)) << (i % 64);
+                }
+                matches[word] = bits;
+            }
+        }
+    }
+
+    /**
+     * @brief Tests many addresses against one prefix.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @param cPrefix The prefix.
+     * @param matches Receives WordCount(cCount) words; bit i set if address i is in the prefix.
+     * @return The number of matching addresses.
+     * @throw std::invalid_argument If a pointer is null while cCount is not zero.
+     */
+    size_t PrefixMatch::Match(const IPv4Address *cAddresses, const size_t &cCount, const IPv4Prefix &cPrefix, uint64_t *matches)
+    {
+        CheckPointers(cAddresses, cCount, matches);
+        static const auto cMatch = MatchKernel<IPv4Address, uint32_t>(CpuFeatures::Selected());
+        cMatch(cAddresses, cCount, Raw(cPrefix.GetMask()), Raw(cPrefix.GetAddress()), matches);
+        return CountMatches(matches, cCount);
+    } /* size_t PrefixMatch::Match(const IPv4Address *cAddresses, const size_t &cCount, const IPv4Prefix &cPrefix, uint64_t *matches) */
+
+    /**
+     * @brief Tests many addresses against one prefix.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @param cPrefix The prefix.
+     * @param matches Receives WordCount(cCount) words; bit i set if address i is in the prefix.
+     * @return The number of matching addresses.
+     * @throw std::invalid_argument If a pointer is null while cCount is not zero.
+     */
+    size_t PrefixMatch::Match(const IPv6Address *cAddresses, const size_t &cCount, const IPv6Prefix &cPrefix, uint64_t *matches)
+    {
+        CheckPointers(cAddresses, cCount, matches);
+        static const auto cMatch = MatchKernel<IPv6Address, RawIPv6>(CpuFeatures::Selected());
+        cMatch(cAddresses, cCount, Raw(cPrefix.GetMask()), Raw(cPrefix.GetAddress()), matches);
+        return CountMatches(matches, cCount);
+    } /* size_t PrefixMatch::Match(const IPv6Address *cAddresses, const size_t &cCount, const IPv6Prefix &cPrefix, uint64_t *matches) */
+
+    /**
+     * @brief Tests one address against many prefixes.
+     * @param cAddress The address.
+     * @param cPrefixes The prefixes.
+     * @param cCount The number of prefixes.
+     * @param matches Receives WordCount(cCount) words; bit i set if prefix i contains the address.
+     * @return The number of matching prefixes.
+     * @throw std::invalid_argument If a pointer is null while cCount is not zero.
+     */
+    size_t PrefixMatch::Match(const IPv4Address &cAddress, const IPv4Prefix *cPrefixes, const size_t &cCount, uint64_t *matches)
+    {
+        CheckPointers(cPrefixes, cCount, matches);
+        MatchPrefixes(cAddress, cPrefixes, cCount, matches);
+        return CountMatches(matches, cCount);
+    } /* size_t PrefixMatch::Match(const IPv4Address &cAddress, const IPv4Prefix *cPrefixes, const size_t &cCount, uint64_t *matches) */
+
+    /**
+     * @brief Tests one address against many prefixes.
+     * @param cAddress The address.
+     * @param cPrefixes The prefixes.
+     * @param cCount The number of prefixes.
+     * @param matches Receives WordCount(cCount) words; bit i set if prefix i contains the address.
+     * @return The number of matching prefixes.
+     * @throw std::invalid_argument If a pointer is null while cCount is not zero.
+     */
+    size_t PrefixMatch::Match(const IPv6Address &cAddress, const IPv6Prefix *cPrefixes, const size_t &cCount, uint64_t *matches)
+    {
+        CheckPointers(cPrefixes, cCount, matches);
+        MatchPrefixes(cAddress, cPrefixes, cCount, matches);
+        return CountMatches(matches, cCount);
+    } /* size_t PrefixMatch::Match(const IPv6Address &cAddress, const IPv6Prefix *cPrefixes, const size_t &cCount, uint64_t *matches) */
+
+    // Private Methods.
+
+    /**
+     * @brief Throws if a pointer is null while the count is not zero.
+     * @param cInput The input array.
+     * @param cCount The number of entries.
+     * @param cMatches The bitmask.
+     * @throw std::invalid_argument If a pointer is null while cCount is not zero.
+     */
+    void PrefixMatch::CheckPointers(const void *cInput, const size_t &cCount, const void *cMatches)
+    {
+        if (cCount && (!cInput || !cMatches))
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+    } /* void PrefixMatch::CheckPointers(const void *cInput, const size_t &cCount, const void *cMatches) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
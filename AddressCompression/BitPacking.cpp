@@ -0,0 +1,502 @@
+/**
+ * @file BitPacking.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief BitPacking class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "BitPacking.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <array>
+#include <cstring>
+#include <utility>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BIT_PACKING_SSE2
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define BIT_PACKING_AVX2
+#define BIT_PACKING_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define BIT_PACKING_AVX2
+#define BIT_PACKING_AVX2_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Returns the number of leading zero bits.
+         * @param cWord The word to scan, must not be zero.
+         * @return The number of zero bits above the highest set bit.
+         */
+        inline uint32_t CountLeadingZeros(const uint32_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanReverse(&index, cWord);
+            return 31 - static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_clz(cWord));
+#endif
+        }
+
+        // Four lanes of uint32 values, one per interleaved lane of the block. The kernels below are
+        // written once against these operations and compiled for every set of them; with SSE2 a
+        // vector is one register.
+        struct ScalarLanes
+        {
+            struct Vector
+            {
+                uint32_t lane[4];
+            };
+
+            static Vector Load(const uint32_t *cSource) { return Vector{{cSource[0], cSource[1], cSource[2], cSource[3]}}; }
+            static void Store(uint32_t *destination, const Vector &cValue) { std::memcpy(destination, cValue.lane, sizeof(cValue.lane)); }
+            static Vector Broadcast(const uint32_t &cValue) { return Vector{{cValue, cValue, cValue, cValue}}; }
+
+            static Vector Or(const Vector &cLeft, const Vector &cRight)
+            {
+                return Vector{{cLeft.lane[0] | cRight.lane[0], cLeft.lane[1] | cRight.lane[1], cLeft.lane[2] | cRight.lane[2], cLeft.lane[3] | cRight.lane[3]}};
+            }
+
+            static Vector And(const Vector &cLeft, const Vector &cRight)
+            {
+                return Vector{{cLeft.lane[0] & cRight.lane[0], cLeft.lane[1] & cRight.lane[1], cLeft.lane[2] & cRight.lane[2], cLeft.lane[3] & cRight.lane[3]}};
+            }
+
+            static Vector Add(const Vector &cLeft, const Vector &cRight)
+            {
+                return Vector{{cLeft.lane[0] + cRight.lane[0], cLeft.lane[1] + cRight.lane[1], cLeft.lane[2] + cRight.lane[2], cLeft.lane[3] + cRight.lane[3]}};
+            }
+
+            template <uint32_t Shift>
+            static Vector ShiftLeft(const Vector &cValue)
+            {
+                return Vector{{cValue.lane[0] << Shift, cValue.lane[1] << Shift, cValue.lane[2] << Shift, cValue.lane[3] << Shift}};
+            }
+
+            template <uint32_t Shift>
+            static Vector ShiftRight(const Vector &cValue)
+            {
+                return Vector{{cValue.lane[0] >> Shift, cValue.lane[1] >> Shift, cValue.lane[2] >> Shift, cValue.lane[3] >> Shift}};
+            }
+
+            /**
+             * @brief Replaces four consecutive values by their running sums, continuing from carry.
+             * @param cValue The four values.
+             * @param carry The sum before the first value; receives the sum of all four.
+             * @return The four running sums.
+             */
+            static Vector PrefixSum(Vector value, Vector &carry)
+            {
+                value.lane[0] += carry.lane[0];
+                value.lane[1] += value.lane[0];
+                value.lane[2] += value.lane[1];
+                value.lane[3] += value.lane[2];
+                carry = Broadcast(value.lane[3]);
+                return value;
+            }
+        };
+
+#if defined(BIT_PACKING_SSE2)
+        struct Sse2Lanes
+        {
+            using Vector = __m128i;
+
+            static Vector Load(const uint32_t *cSource) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(cSource)); }
+            static void Store(uint32_t *destination, const Vector &cValue) { _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), cValue); }
+            static Vector Broadcast(const uint32_t &cValue) { return _mm_set1_epi32(static_cast<int>(cValue)); }
+            static Vector Or(const Vector &cLeft, const Vector &cRight) { return _mm_or_si128(cLeft, cRight); }
+            static Vector And(const Vector &cLeft, const Vector &cRight) { return _mm_and_si128(cLeft, cRight); }
+            static Vector Add(const Vector &cLeft, const Vector &cRight) { return _mm_add_epi32(cLeft, cRight); }
+
+            template <uint32_t Shift>
+            static Vector ShiftLeft(const Vector &cValue) { return _mm_slli_epi32(cValue, Shift); }
+
+            template <uint32_t Shift>
+            static Vector ShiftRight(const Vector &cValue) { return _mm_srli_epi32(cValue, Shift); }
+
+            static Vector PrefixSum(Vector value, Vector &carry)
+            {
+                value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+                value = _mm_add_epi32(value, _mm_slli_si128(value, 8));
+                value = _mm_add_epi32(value, carry);
+                carry = _mm_shuffle_epi32(value, 0xFF);
+                return value;
+            }
+        };
+#endif
+
+        /**
+         * @brief Number of values of every lane, and so the number of vectors of a block.
+         */
+        constexpr size_t LANE_VALUES = BitPacking::BLOCK_SIZE / 4;
+
+        /**
+         * @brief Extracts the vector of values 4 * Index .. 4 * Index + 3 from a packed block.
+         */
+        template <typename Lanes, uint32_t BitWidth, size_t Index>
+        inline typename Lanes::Vector UnpackVector(const uint32_t *cPacked)
+        {
+            if constexpr (BitWidth == 0)
+            {
+                return Lanes::Broadcast(0);
+            }
+            else
+            {
+                constexpr uint32_t cWord = static_cast<uint32_t>(Index) * BitWidth / 32;
+                constexpr uint32_t cShift = static_cast<uint32_t>(Index) * BitWidth % 32;
+                typename Lanes::Vector value = Lanes::template ShiftRight<cShift>(Lanes::Load(cPacked + 4 * cWord));
+                if constexpr (cShift + BitWidth > 32)
+                {
+                    value = Lanes::Or(value, Lanes::template ShiftLeft<32 - cShift>(Lanes::Load(cPacked + 4 * (cWord + 1))));
+                }
+                if constexpr (BitWidth < 32)
+                {
+                    value = Lanes::And(value, Lanes::Broadcast((1u << BitWidth) - 1));
+                }
+                return value;
+            }
+        }
+
+        /**
+         * @brief Adds the vector of values 4 * Index .. 4 * Index + 3 to a packed block.
+         */
+        template <typename Lanes, uint32_t BitWidth, size_t Index>
+        inline void PackVector(const uint32_t *cValues, uint32_t *packed)
+        {
+            constexpr uint32_t cWord = static_cast<uint32_t>(Index) * BitWidth / 32;
+            constexpr uint32_t cShift = static_cast<uint32_t>(Index) * BitWidth % 32;
+            const typename Lanes::Vector cValue = Lanes::Load(cValues + 4 * Index);
+            Lanes::Store(packed + 4 * cWord, Lanes::Or(Lanes::Load(packed + 4 * cWord), Lanes::template ShiftLeft<cShift>(cValue)));
+            if constexpr (cShift + BitWidth > 32)
+            {
+                Lanes::Store(packed + 4 * (cWord + 1), Lanes::template ShiftRight<32 - cShift>(cValue));
+            }
+        }
+
+        /**
+         * @brief Unpacks one vector, turns it into running sums and stores it.
+         */
+        template <typename Lanes, uint32_t BitWidth, size_t Index>
+        inline void UnpackPrefixSumVector(const uint32_t *cPacked, const typename Lanes::Vector &cIncrement, typename Lanes::Vector &carry, uint32_t *values)
+        {
+            Lanes::Store(values + 4 * Index, Lanes::PrefixSum(Lanes::Add(UnpackVector<Lanes, BitWidth, Index>(cPacked), cIncrement), carry));
+        }
+
+        // The index sequences unroll the 32 steps of a block, so every shift is a constant.
+        template <typename Lanes, uint32_t BitWidth, size_t... Index>
+        inline void UnpackSteps(const uint32_t *cPacked, uint32_t *values, std::index_sequence<Index...>)
+        {
+            (Lanes::Store(values + 4 * Index, UnpackVector<Lanes, BitWidth, Index>(cPacked)), ...);
+        }
+
+        template <typename Lanes, uint32_t BitWidth, size_t... Index>
+        inline void PackSteps(const uint32_t *cValues, uint32_t *packed, std::index_sequence<Index...>)
+        {
+            (PackVector<Lanes, BitWidth, Index>(cValues, packed), ...);
+        }
+
+        template <typename Lanes, uint32_t BitWidth, size_t... Index>
+        inline void UnpackPrefixSumSteps(const uint32_t *cPacked, const typename Lanes::Vector &cIncrement, typename Lanes::Vector &carry, uint32_t *values,
+                                         std::index_sequence<Index...>)
+        {
+            (UnpackPrefixSumVector<Lanes, BitWidth, Index>(cPacked, cIncrement, carry, values), ...);
+        }
+
+        template <typename Lanes, uint32_t BitWidth>
+        void UnpackBlock(const uint32_t *cPacked, uint32_t *values)
+        {
+            UnpackSteps<Lanes, BitWidth>(cPacked, values, std::make_index_sequence<LANE_VALUES>());
+        }
+
+        template <typename Lanes, uint32_t BitWidth>
+        void PackBlock(const uint32_t *cValues, uint32_t *packed)
+        {
+            std::memset(packed, 0, BitPacking::PackedWords(BitWidth) * sizeof(uint32_t));
+            if constexpr (BitWidth > 0)
+            {
+                PackSteps<Lanes, BitWidth>(cValues, packed, std::make_index_sequence<LANE_VALUES>());
+            }
+        }
+
+        template <typename Lanes, uint32_t BitWidth>
+        void UnpackPrefixSumBlock(const uint32_t *cPacked, const uint32_t &cStart, const uint32_t &cIncrement, uint32_t *values)
+        {
+            typename Lanes::Vector carry = Lanes::Broadcast(cStart);
+            UnpackPrefixSumSteps<Lanes, BitWidth>(cPacked, Lanes::Broadcast(cIncrement), carry, values, std::make_index_sequence<LANE_VALUES>());
+        }
+
+#if defined(BIT_PACKING_AVX2)
+        // AVX2 unpacks two steps of the four lanes per 256-bit register, the low half from step
+        // 2 * Pair and the high half from step 2 * Pair + 1. The halves need different shifts, so
+        // the variable shifts are used; a shift by 32 gives zero, which drops the spill-over word
+        // of a half that does not need one. Packing keeps the SSE2 code: it is not on the query path.
+
+        /**
+         * @brief Loads the packed words Low and High (four each) into the low and high half.
+         */
+        template <uint32_t Low, uint32_t High>
+        BIT_PACKING_AVX2_TARGET inline __m256i LoadHalves(const uint32_t *cPacked)
+        {
+            const __m128i cLow = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cPacked + 4 * Low));
+            if constexpr (Low == High)
+            {
+                return _mm256_broadcastsi128_si256(cLow);
+            }
+            else
+            {
+                return _mm256_inserti128_si256(_mm256_castsi128_si256(cLow), _mm_loadu_si128(reinterpret_cast<const __m128i *>(cPacked + 4 * High)), 1);
+            }
+        }
+
+        /**
+         * @brief Extracts the values 8 * Pair .. 8 * Pair + 7 from a packed block.
+         */
+        template <uint32_t BitWidth, size_t Pair>
+        BIT_PACKING_AVX2_TARGET inline __m256i UnpackPairAvx2(const uint32_t *cPacked)
+        {
+            if constexpr (BitWidth == 0)
+            {
+                return _mm256_setzero_si256();
+            }
+            else
+            {
+                constexpr uint32_t cLowWord = static_cast<uint32_t>(2 * Pair) * BitWidth / 32;
+                constexpr uint32_t cLowShift = static_cast<uint32_t>(2 * Pair) * BitWidth % 32;
+                constexpr uint32_t cHighWord = static_cast<uint32_t>(2 * Pair + 1) * BitWidth / 32;
+                constexpr uint32_t cHighShift = static_cast<uint32_t>(2 * Pair + 1) * BitWidth % 32;
+                constexpr bool cLowSpills = cLowShift + BitWidth > 32;
+                constexpr bool cHighSpills = cHighShift + BitWidth > 32;
+
+                __m256i value = _mm256_srlv_epi32(LoadHalves<cLowWord, cHighWord>(cPacked), _mm256_setr_epi32(cLowShift, cLowShift, cLowShift, cLowShift, cHighShift,
+                                                                                                                  cHighShift, cHighShift, cHighShift));
+                if constexpr (cLowSpills || cHighSpills)
+                {
+                    constexpr int cLowSpill = cLowSpills ? static_cast<int>(32 - cLowShift) : 32;
+                    constexpr int cHighSpill = cHighSpills ? static_cast<int>(32 - cHighShift) : 32;
+                    const __m256i cNext = LoadHalves<cLowSpills ? cLowWord + 1 : cLowWord, cHighSpills ? cHighWord + 1 : cHighWord>(cPacked);
+                    value = _mm256_or_si256(value, _mm256_sllv_epi32(cNext, _mm256_setr_epi32(cLowSpill, cLowSpill, cLowSpill, cLowSpill, cHighSpill, cHighSpill,
+                                                                                               cHighSpill, cHighSpill)));
+                }
+                if constexpr (BitWidth < 32)
+                {
+                    value = _mm256_and_si256(value, _mm256_set1_epi32(static_cast<int>((1u << BitWidth) - 1)));
+                }
+                return value;
+            }
+        }
+
+        /**
+         * @brief Replaces eight consecutive values by their running sums, continuing from carry.
+         */
+        BIT_PACKING_AVX2_TARGET inline __m256i PrefixSumAvx2(__m256i value, __m256i &carry)
+        {
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+            // Each half now holds its own running sums; the high half also needs the low half's total.
+            const __m256i cHalfTotals = _mm256_shuffle_epi32(value, 0xFF);
+            value = _mm256_add_epi32(value, _mm256_permute2x128_si256(cHalfTotals, cHalfTotals, 0x08));
+            value = _mm256_add_epi32(value, carry);
+            carry = _mm256_permutevar8x32_epi32(value, _mm256_set1_epi32(7));
+            return value;
+        }
+
+        template <uint32_t BitWidth, size_t... Pair>
+        BIT_PACKING_AVX2_TARGET inline void UnpackPairsAvx2(const uint32_t *cPacked, uint32_t *values, std::index_sequence<Pair...>)
+        {
+            (_mm256_storeu_si256(reinterpret_cast<__m256i *>(values + 8 * Pair), UnpackPairAvx2<BitWidth, Pair>(cPacked)), ...);
+        }
+
+        template <uint32_t BitWidth, size_t... Pair>
+        BIT_PACKING_AVX2_TARGET inline void UnpackPrefixSumPairsAvx2(const uint32_t *cPacked, const __m256i &cIncrement, __m256i &carry, uint32_t *values,
+                                                                     std::index_sequence<Pair...>)
+        {
+            (_mm256_storeu_si256(reinterpret_cast<__m256i *>(values + 8 * Pair), PrefixSumAvx2(_mm256_add_epi32(UnpackPairAvx2<BitWidth, Pair>(cPacked), cIncrement), carry)),
+             ...);
+        }
+
+        template <uint32_t BitWidth>
+        BIT_PACKING_AVX2_TARGET void UnpackBlockAvx2(const uint32_t *cPacked, uint32_t *values)
+        {
+            UnpackPairsAvx2<BitWidth>(cPacked, values, std::make_index_sequence<LANE_VALUES / 2>());
+        }
+
+        template <uint32_t BitWidth>
+        BIT_PACKING_AVX2_TARGET void UnpackPrefixSumBlockAvx2(const uint32_t *cPacked, const uint32_t &cStart, const uint32_t &cIncrement, uint32_t *values)
+        {
+            __m256i carry = _mm256_set1_epi32(static_cast<int>(cStart));
+            UnpackPrefixSumPairsAvx2<BitWidth>(cPacked, _mm256_set1_epi32(static_cast<int>(cIncrement)), carry, values, std::make_index_sequence<LANE_VALUES / 2>());
+        }
+#endif
+
+        using UnpackFunction = void (*)(const uint32_t *, uint32_t *);
+        using PackFunction = void (*)(const uint32_t *, uint32_t *);
+        using UnpackPrefixSumFunction = void (*)(const uint32_t *, const uint32_t &, const uint32_t &, uint32_t *);
+
+        /**
+         * @brief Number of bit widths, 0 to MAX_BIT_WIDTH.
+         */
+        constexpr size_t BIT_WIDTHS = BitPacking::MAX_BIT_WIDTH + 1;
+
+        /**
+         * @brief One specialised kernel per bit width, for each set of instructions.
+         */
+        template <typename Lanes, size_t... BitWidth>
+        constexpr std::array<UnpackFunction, BIT_WIDTHS> MakeUnpackTable(std::index_sequence<BitWidth...>)
+        {
+            return {{&UnpackBlock<Lanes, BitWidth>...}};
+        }
+
+        template <typename Lanes, size_t... BitWidth>
+        constexpr std::array<PackFunction, BIT_WIDTHS> MakePackTable(std::index_sequence<BitWidth...>)
+        {
+            return {{&PackBlock<Lanes, BitWidth>...}};
+        }
+
+        template <typename Lanes, size_t... BitWidth>
+        constexpr std::array<UnpackPrefixSumFunction, BIT_WIDTHS> MakeUnpackPrefixSumTable(std::index_sequence<BitWidth...>)
+        {
+            return {{&UnpackPrefixSumBlock<Lanes, BitWidth>...}};
+        }
+
+        constexpr std::array<UnpackFunction, BIT_WIDTHS> UNPACK_SCALAR{MakeUnpackTable<ScalarLanes>(std::make_index_sequence<BIT_WIDTHS>())};
+        constexpr std::array<PackFunction, BIT_WIDTHS> PACK_SCALAR{MakePackTable<ScalarLanes>(std::make_index_sequence<BIT_WIDTHS>())};
+        constexpr std::array<UnpackPrefixSumFunction, BIT_WIDTHS> UNPACK_PREFIX_SUM_SCALAR{MakeUnpackPrefixSumTable<ScalarLanes>(std::make_index_sequence<BIT_WIDTHS>())};
+#if defined(BIT_PACKING_SSE2)
+        constexpr std::array<UnpackFunction, BIT_WIDTHS> UNPACK_SSE2{MakeUnpackTable<Sse2Lanes>(std::make_index_sequence<BIT_WIDTHS>())};
+        constexpr std::array<PackFunction, BIT_WIDTHS> PACK_SSE2{MakePackTable<Sse2Lanes>(std::make_index_sequence<BIT_WIDTHS>())};
+        constexpr std::array<UnpackPrefixSumFunction, BIT_WIDTHS> UNPACK_PREFIX_SUM_SSE2{MakeUnpackPrefixSumTable<Sse2Lanes>(std::make_index_sequence<BIT_WIDTHS>())};
+#else
+        constexpr const std::array<UnpackFunction, BIT_WIDTHS> &UNPACK_SSE2 = UNPACK_SCALAR;
+        constexpr const std::array<PackFunction, BIT_WIDTHS> &PACK_SSE2 = PACK_SCALAR;
+        constexpr const std::array<UnpackPrefixSumFunction, BIT_WIDTHS> &UNPACK_PREFIX_SUM_SSE2 = UNPACK_PREFIX_SUM_SCALAR;
+#endif
+#if defined(BIT_PACKING_AVX2)
+        template <size_t... BitWidth>
+        constexpr std::array<UnpackFunction, BIT_WIDTHS> MakeUnpackTableAvx2(std::index_sequence<BitWidth...>)
+        {
+            return {{&UnpackBlockAvx2<BitWidth>...}};
+        }
+
+        template <size_t... BitWidth>
+        constexpr std::array<UnpackPrefixSumFunction, BIT_WIDTHS> MakeUnpackPrefixSumTableAvx2(std::index_sequence<BitWidth...>)
+        {
+            return {{&UnpackPrefixSumBlockAvx2<BitWidth>...}};
+        }
+
+        constexpr std::array<UnpackFunction, BIT_WIDTHS> UNPACK_AVX2{MakeUnpackTableAvx2(std::make_index_sequence<BIT_WIDTHS>())};
+        constexpr std::array<UnpackPrefixSumFunction, BIT_WIDTHS> UNPACK_PREFIX_SUM_AVX2{MakeUnpackPrefixSumTableAvx2(std::make_index_sequence<BIT_WIDTHS>())};
+#else
+        constexpr const std::array<UnpackFunction, BIT_WIDTHS> &UNPACK_AVX2 = UNPACK_SSE2;
+        constexpr const std::array<UnpackPrefixSumFunction, BIT_WIDTHS> &UNPACK_PREFIX_SUM_AVX2 = UNPACK_PREFIX_SUM_SSE2;
+#endif
+
+        /**
+         * @brief The kernels of one tier.
+         */
+        struct Kernels
+        {
+            const UnpackFunction *unpack;
+            const PackFunction *pack;
+            const UnpackPrefixSumFunction *unpackPrefixSum;
+        };
+
+        /**
+         * @brief Returns the kernels for a tier.
+         *
+         * Each tier without its own variant takes the one of the tier below it: SSE4.2 adds
+         * nothing these kernels use, AVX-512 runs the AVX2 kernels, and packing stays on SSE2.
+         *
+         * @param cTier The tier.
+         * @return The kernels.
+         */
+        Kernels SelectKernels(const CpuFeatures::Tier &cTier)
+        {
+            static const Kernels cTable[CpuFeatures::TIER_COUNT]{
+                {UNPACK_SCALAR.data(), PACK_SCALAR.data(), UNPACK_PREFIX_SUM_SCALAR.data()},
+                {UNPACK_SSE2.data(), PACK_SSE2.data(), UNPACK_PREFIX_SUM_SSE2.data()},
+                {UNPACK_SSE2.data(), PACK_SSE2.data(), UNPACK_PREFIX_SUM_SSE2.data()},
+                {UNPACK_AVX2.data(), PACK_SSE2.data(), UNPACK_PREFIX_SUM_AVX2.data()},
+                {UNPACK_AVX2.data(), PACK_SSE2.data(), UNPACK_PREFIX_SUM_AVX2.data()},
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+
+        /**
+         * @brief Returns the kernels of the selected tier, looked up once.
+         */
+        const Kernels &SelectedKernels()
+        {
+            static const Kernels cKernels = SelectKernels(CpuFeatures::Selected());
+            return cKernels;
+        }
+    }
+
+    /**
+     * @brief Returns the number of bits needed by the largest value of a block.
+     * @param cValues The BLOCK_SIZE values.
+     * @return The bit width, 0 if all values are zero.
+     */
+    uint32_t BitPacking::BitWidth(const uint32_t *cValues)
+    {
+        uint32_t bits{};
+        for (size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            bits |= cValues[i];
+        }
+        return bits ? 32 - CountLeadingZeros(bits) : 0;
+    } /* uint32_t BitPacking::BitWidth(const uint32_t *cValues) */
+
+    /**
+     * @brief Packs a block.
+     * @param cValues The BLOCK_SIZE values, each below 2^cBitWidth.
+     * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+     * @param packed Receives PackedWords(cBitWidth) words.
+     */
+    void BitPacking::Pack(const uint32_t *cValues, const uint32_t &cBitWidth, uint32_t *packed)
+    {
+        SelectedKernels().pack[cBitWidth](cValues, packed);
+    } /* void BitPacking::Pack(const uint32_t *cValues, const uint32_t &cBitWidth, uint32_t *packed) */
+
+    /**
+     * @brief Unpacks a block.
+     * @param cPacked The packed words.
+     * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+     * @param values Receives the BLOCK_SIZE values.
+     */
+    void BitPacking::Unpack(const uint32_t *cPacked, const uint32_t &cBitWidth, uint32_t *values)
+    {
+        SelectedKernels().unpack[cBitWidth](cPacked, values);
+    } /* void BitPacking::Unpack(const uint32_t *cPacked, const uint32_t &cBitWidth, uint32_t *values) */
+
+    /**
+     * @brief Unpacks a block of deltas and turns it into the running sums.
+     * @param cPacked The packed words.
+     * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+     * @param cStart The value before the first one.
+     * @param cIncrement The value added to every packed delta (frame of reference).
+     * @param values Receives the BLOCK_SIZE values.
+     */
+    void BitPacking::UnpackPrefixSum(const uint32_t *cPacked, const uint32_t &cBitWidth, const uint32_t &cStart, const uint32_t &cIncrement, uint32_t *values)
+    {
+        SelectedKernels().unpackPrefixSum[cBitWidth](cPacked, cStart, cIncrement, values);
+    } /* void BitPacking::UnpackPrefixSum(const uint32_t *cPacked, const uint32_t &cBitWidth, const uint32_t &cStart, const uint32_t &cIncrement, uint32_t *values) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,96 @@
+/**
+ * @file BitPacking.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief BitPacking (SIMD bit-packing of 128 value blocks) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef BITPACKING_H
+#define BITPACKING_H
+#include <cstddef>
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class BitPacking
+     * @brief Packs blocks of 128 uint32 values with a common bit width (SIMD-BP128 layout).
+     *
+     * The block is split into four interleaved lanes: value i belongs to lane i % 4, and every
+     * lane packs its 32 values into bit-width consecutive words. The packed words of the lanes
+     * are interleaved too, so one 128-bit load feeds all four lanes and unpacking is a fixed
+     * sequence of shifts and masks per bit width, without any data-dependent branch.
+     *
+     * A block of bit width b takes 4 * b words (16 * b bytes). The kernels are picked per
+     * CpuFeatures tier; every tier produces and reads the same layout.
+     */
+    class BitPacking
+    {
+    public:
+        /**
+         * @brief Number of values of a block.
+         */
+        static constexpr size_t BLOCK_SIZE = 128;
+
+        /**
+         * @brief Largest bit width.
+         */
+        static constexpr uint32_t MAX_BIT_WIDTH = 32;
+
+        /**
+         * @brief Returns the number of bits needed by the largest value of a block.
+         * @param cValues The BLOCK_SIZE values.
+         * @return The bit width, 0 if all values are zero.
+         */
+        static uint32_t BitWidth(const uint32_t *cValues);
+
+        /**
+         * @brief Returns the number of packed words of a block.
+         * @param cBitWidth The bit width.
+         * @return The number of uint32 words.
+         */
+        static constexpr size_t PackedWords(const uint32_t &cBitWidth) { return 4 * static_cast<size_t>(cBitWidth); }
+
+        /**
+         * @brief Packs a block.
+         * @param cValues The BLOCK_SIZE values, each below 2^cBitWidth.
+         * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+         * @param packed Receives PackedWords(cBitWidth) words.
+         */
+        static void Pack(const uint32_t *cValues, const uint32_t &cBitWidth, uint32_t *packed);
+
+        /**
+         * @brief Unpacks a block.
+         * @param cPacked The packed words.
+         * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+         * @param values Receives the BLOCK_SIZE values.
+         */
+        static void Unpack(const uint32_t *cPacked, const uint32_t &cBitWidth, uint32_t *values);
+
+        /**
+         * @brief Unpacks a block of deltas and turns it into the running sums.
+         *
+         * values[i] = cStart + (cPacked[0] + cIncrement) + ... + (cPacked[i] + cIncrement),
+         * computed modulo 2^32 in the same pass as the unpacking.
+         *
+         * @param cPacked The packed words.
+         * @param cBitWidth The bit width, at most MAX_BIT_WIDTH.
+         * @param cStart The value before the first one.
+         * @param cIncrement The value added to every packed delta (frame of reference).
+         * @param values Receives the BLOCK_SIZE values.
+         */
+        static void UnpackPrefixSum(const uint32_t *cPacked, const uint32_t &cBitWidth, const uint32_t &cStart, const uint32_t &cIncrement, uint32_t *values);
+    }; /* class BitPacking */
+}
+
+#endif /* BITPACKING_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
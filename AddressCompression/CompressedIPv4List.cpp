@@ -0,0 +1,333 @@
+/**
+ * @file CompressedIPv4List.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CompressedIPv4List class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "CompressedIPv4List.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief First word of a serialized list ("EPL4" in memory on little-endian machines).
+         */
+        constexpr uint32_t MAGIC = 0x344C5045;
+
+        /**
+         * @brief Version of the serialized format.
+         */
+        constexpr uint32_t FORMAT_VERSION = 1;
+
+        /**
+         * @struct Header
+         * @brief Start of a serialized list, followed by the firsts, the minimum gaps, the offsets and the packed words.
+         */
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t size;
+            uint64_t blocks;
+            uint64_t packedWords;
+        };
+
+        /**
+         * @brief Appends the bytes of an array to a buffer.
+         */
+        template <typename Type>
+        void AppendArray(const Type *cValues, const size_t &cCount, std::vector<uint8_t> &bytes)
+        {
+            const uint8_t *const cBytes = reinterpret_cast<const uint8_t *>(cValues);
+            bytes.insert(bytes.end(), cBytes, cBytes + cCount * sizeof(Type));
+        }
+
+        /**
+         * @brief Copies an array out of serialized bytes and advances the position.
+         */
+        template <typename Type>
+        void ReadArray(const uint8_t *cData, const size_t &cCount, size_t &position, std::vector<Type> &values)
+        {
+            values.resize(cCount);
+            std::memcpy(values.data(), cData + position, cCount * sizeof(Type));
+            position += cCount * sizeof(Type);
+        }
+    }
+
+    /**
+     * @brief Constructor for the CompressedIPv4List class.
+     * @param cAddresses The addresses in ascending order, duplicates allowed.
+     * @throw std::invalid_argument If the addresses are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    CompressedIPv4List::CompressedIPv4List(const std::vector<IPv4Address> &cAddresses)
+    {
+        std::vector<uint32_t> values(cAddresses.size());
+        std::transform(cAddresses.begin(), cAddresses.end(), values.begin(), [](const IPv4Address &cAddress)
+                       { return cAddress.ToUint32(); });
+        Encode(values.data(), values.size());
+    } /* CompressedIPv4List::CompressedIPv4List(const std::vector<IPv4Address> &cAddresses) */
+
+    /**
+     * @brief Constructor for the CompressedIPv4List class.
+     * @param cValues The host-order values in ascending order, duplicates allowed.
+     * @param cCount The number of values.
+     * @throw std::invalid_argument If the pointer is null and cCount is not zero, or the values are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE values.
+     */
+    CompressedIPv4List::CompressedIPv4List(const uint32_t *cValues, const size_t &cCount)
+    {
+        if (!cValues && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        Encode(cValues, cCount);
+    } /* CompressedIPv4List::CompressedIPv4List(const uint32_t *cValues, const size_t &cCount) */
+
+    /**
+     * @brief Returns the number of bytes of the block directory and the packed words.
+     * @return The compressed size in bytes.
+     */
+    size_t CompressedIPv4List::CompressedSize() const
+    {
+        return (_firsts.size() + _minimumGaps.size() + _offsets.size() + _packed.size()) * sizeof(uint32_t);
+    } /* size_t CompressedIPv4List::CompressedSize() const */
+
+    /**
+     * @brief Decodes one block.
+     * @param cBlock The block index.
+     * @param values Receives the host-order values, must have room for BLOCK_SIZE values.
+     * @return The number of values of the block; only the last block may be shorter than BLOCK_SIZE.
+     * @throw std::out_of_range If the block does not exist.
+     */
+    size_t CompressedIPv4List::DecodeBlock(const size_t &cBlock, uint32_t *values) const
+    {
+        if (cBlock >= _firsts.size())
+        {
+            throw std::out_of_range(BLOCK_OUT_OF_RANGE);
+        }
+
+        // The first packed gap is zero, so starting one minimum gap below the first value makes
+        // the running sum hit it exactly; unsigned wrap-around keeps this valid for any values.
+        BitPacking::UnpackPrefixSum(_packed.data() + 4 * static_cast<size_t>(_offsets[cBlock]), _offsets[cBlock + 1] - _offsets[cBlock],
+                                    _firsts[cBlock] - _minimumGaps[cBlock], _minimumGaps[cBlock], values);
+        return std::min(BLOCK_SIZE, _size - cBlock * BLOCK_SIZE);
+    } /* size_t CompressedIPv4List::DecodeBlock(const size_t &cBlock, uint32_t *values) const */
+
+    /**
+     * @brief Decodes the whole list.
+     * @param values Receives the host-order values, must have room for Size() values.
+     * @throw std::invalid_argument If the pointer is null and the list is not empty.
+     */
+    void CompressedIPv4List::Decode(uint32_t *values) const
+    {
+        if (!values && _size)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        const size_t cFullBlocks = _size / BLOCK_SIZE;
+        for (size_t block = 0; block < cFullBlocks; block++)
+        {
+            DecodeBlock(block, values + block * BLOCK_SIZE);
+        }
+        if (cFullBlocks < _firsts.size())
+        {
+            uint32_t last[BLOCK_SIZE];
+            const size_t cCount = DecodeBlock(cFullBlocks, last);
+            std::copy(last, last + cCount, values + cFullBlocks * BLOCK_SIZE);
+        }
+    } /* void CompressedIPv4List::Decode(uint32_t *values) const */
+
+    /**
+     * @brief Decodes the whole list.
+     * @return The addresses in ascending order.
+     */
+    std::vector<IPv4Address> CompressedIPv4List::Decode() const
+    {
+        std::vector<uint32_t> values(_size);
+        Decode(values.data());
+        std::vector<IPv4Address> addresses(_size);
+        std::transform(values.begin(), values.end(), addresses.begin(), IPv4Address::FromUint32);
+        return addresses;
+    } /* std::vector<IPv4Address> CompressedIPv4List::Decode() const */
+
+    /**
+     * @brief Returns the address at a position.
+     * @param cIndex The position.
+     * @return The address.
+     * @throw std::out_of_range If the position does not exist.
+     */
+    IPv4Address CompressedIPv4List::Get(const size_t &cIndex) const
+    {
+        if (cIndex >= _size)
+        {
+            throw std::out_of_range(INDEX_OUT_OF_RANGE);
+        }
+
+        uint32_t values[BLOCK_SIZE];
+        DecodeBlock(cIndex / BLOCK_SIZE, values);
+        return IPv4Address::FromUint32(values[cIndex % BLOCK_SIZE]);
+    } /* IPv4Address CompressedIPv4List::Get(const size_t &cIndex) const */
+
+    /**
+     * @brief Checks whether the list contains an address. Decodes at most one block.
+     * @param cAddress The address to look for.
+     * @return `true` if the address is in the list, `false` otherwise.
+     */
+    bool CompressedIPv4List::Contains(const IPv4Address &cAddress) const
+    {
+        const uint32_t cValue = cAddress.ToUint32();
+        // The last block whose first value is not above the address is the only candidate.
+        const auto cNext = std::upper_bound(_firsts.begin(), _firsts.end(), cValue);
+        if (cNext == _firsts.begin())
+        {
+            return false;
+        }
+
+        const size_t cBlock = static_cast<size_t>(cNext - _firsts.begin()) - 1;
+        if (_firsts[cBlock] == cValue)
+        {
+            return true;
+        }
+        uint32_t values[BLOCK_SIZE];
+        const size_t cCount = DecodeBlock(cBlock, values);
+        return std::binary_search(values, values + cCount, cValue);
+    } /* bool CompressedIPv4List::Contains(const IPv4Address &cAddress) const */
+
+    /**
+     * @brief Serializes the list.
+     * @return The bytes, readable by Deserialize() on a machine of the same byte order.
+     */
+    std::vector<uint8_t> CompressedIPv4List::Serialize() const
+    {
+        const Header cHeader{MAGIC, FORMAT_VERSION, _size, _firsts.size(), _packed.size()};
+        std::vector<uint8_t> bytes;
+        bytes.reserve(sizeof(cHeader) + CompressedSize());
+        AppendArray(&cHeader, 1, bytes);
+        AppendArray(_firsts.data(), _firsts.size(), bytes);
+        AppendArray(_minimumGaps.data(), _minimumGaps.size(), bytes);
+        AppendArray(_offsets.data(), _offsets.size(), bytes);
+        AppendArray(_packed.data(), _packed.size(), bytes);
+        return bytes;
+    } /* std::vector<uint8_t> CompressedIPv4List::Serialize() const */
+
+    /**
+     * @brief Restores a list written by Serialize().
+     * @param cData The bytes.
+     * @param cSize The number of bytes.
+     * @return The list.
+     * @throw std::invalid_argument If the pointer is null or the bytes are not a valid list.
+     */
+    CompressedIPv4List CompressedIPv4List::Deserialize(const uint8_t *cData, const size_t &cSize)
+    {
+        if (!cData)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        Header header{};
+        if (cSize < sizeof(header))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        std::memcpy(&header, cData, sizeof(header));
+        // Every count is bounded before it is multiplied, so the size check cannot overflow.
+        if (header.magic != MAGIC || header.version != FORMAT_VERSION || header.size > MAX_SIZE ||
+            header.blocks != (header.size + BLOCK_SIZE - 1) / BLOCK_SIZE || header.packedWords > header.blocks * BitPacking::PackedWords(BitPacking::MAX_BIT_WIDTH) ||
+            cSize != sizeof(header) + (3 * header.blocks + 1 + header.packedWords) * sizeof(uint32_t))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        CompressedIPv4List list;
+        size_t position = sizeof(header);
+        list._size = static_cast<size_t>(header.size);
+        ReadArray(cData, static_cast<size_t>(header.blocks), position, list._firsts);
+        ReadArray(cData, static_cast<size_t>(header.blocks), position, list._minimumGaps);
+        ReadArray(cData, static_cast<size_t>(header.blocks + 1), position, list._offsets);
+        ReadArray(cData, static_cast<size_t>(header.packedWords), position, list._packed);
+
+        // Decoding trusts the offsets, so every block must stay inside the packed words.
+        if (list._offsets.front() != 0 || 4 * static_cast<uint64_t>(list._offsets.back()) != header.packedWords)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        for (size_t block = 0; block < list._firsts.size(); block++)
+        {
+            if (list._offsets[block + 1] < list._offsets[block] || list._offsets[block + 1] - list._offsets[block] > BitPacking::MAX_BIT_WIDTH)
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+        }
+        return list;
+    } /* CompressedIPv4List CompressedIPv4List::Deserialize(const uint8_t *cData, const size_t &cSize) */
+
+    // Private Methods.
+
+    /**
+     * @brief Compresses sorted values into the empty list.
+     * @param cValues The host-order values.
+     * @param cCount The number of values.
+     * @throw std::invalid_argument If the values are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE values.
+     */
+    void CompressedIPv4List::Encode(const uint32_t *cValues, const size_t &cCount)
+    {
+        if (cCount > MAX_SIZE)
+        {
+            throw std::out_of_range(LIST_TOO_LARGE);
+        }
+        if (!std::is_sorted(cValues, cValues + cCount))
+        {
+            throw std::invalid_argument(NOT_SORTED);
+        }
+
+        const size_t cBlocks = (cCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        _size = cCount;
+        _firsts.reserve(cBlocks);
+        _minimumGaps.reserve(cBlocks);
+        _offsets.reserve(cBlocks + 1);
+        uint32_t gaps[BLOCK_SIZE];
+        for (size_t start = 0; start < cCount; start += BLOCK_SIZE)
+        {
+            const size_t cLength = std::min(BLOCK_SIZE, cCount - start);
+            const uint32_t *const cBlock = cValues + start;
+            uint32_t minimumGap = cLength > 1 ? UINT32_MAX : 0;
+            for (size_t i = 1; i < cLength; i++)
+            {
+                minimumGap = std::min(minimumGap, cBlock[i] - cBlock[i - 1]);
+            }
+
+            // The first value lives in the directory and the padding decodes to garbage that is
+            // never returned, so both are packed as zero.
+            std::fill(gaps, gaps + BLOCK_SIZE, 0);
+            for (size_t i = 1; i < cLength; i++)
+            {
+                gaps[i] = cBlock[i] - cBlock[i - 1] - minimumGap;
+            }
+            const uint32_t cBitWidth = BitPacking::BitWidth(gaps);
+            _packed.resize(_packed.size() + BitPacking::PackedWords(cBitWidth));
+            BitPacking::Pack(gaps, cBitWidth, _packed.data() + _packed.size() - BitPacking::PackedWords(cBitWidth));
+
+            _firsts.push_back(cBlock[0]);
+            _minimumGaps.push_back(minimumGap);
+            _offsets.push_back(_offsets.back() + cBitWidth);
+        }
+    } /* void CompressedIPv4List::Encode(const uint32_t *cValues, const size_t &cCount) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
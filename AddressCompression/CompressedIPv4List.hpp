@@ -0,0 +1,222 @@
+/**
+ * @file CompressedIPv4List.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CompressedIPv4List (delta + bit-packed sorted IPv4 address list) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef COMPRESSEDIPV4LIST_H
+#define COMPRESSEDIPV4LIST_H
+#include "BitPacking.hpp"
+#include "IPv4Address/IPv4Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class CompressedIPv4List
+     * @brief An immutable sorted list of IPv4 addresses stored as bit-packed deltas.
+     *
+     * The list is cut into blocks of BLOCK_SIZE addresses. A block keeps its first address and
+     * the smallest gap between two of its neighbouring addresses (frame of reference) in the
+     * block directory; the gaps minus that minimum are bit-packed with BitPacking. A block of a
+     * contiguous range therefore packs to nothing, and a sorted blocklist of /24 clients takes
+     * well under one byte per address.
+     *
+     * Blocks decode independently: DecodeBlock() unpacks and prefix-sums one block in a single
+     * SIMD pass, Get() and Contains() decode only the block the address is in. The values are
+     * host-order uint32, the same as IPv4AddressColumn::Data().
+     *
+     * Serialize() writes the directory and the packed words in native byte order.
+     */
+    class CompressedIPv4List
+    {
+    public:
+        /**
+         * @brief Number of addresses of a block.
+         */
+        static constexpr size_t BLOCK_SIZE = BitPacking::BLOCK_SIZE;
+
+        /**
+         * @brief Maximum number of addresses.
+         */
+        static constexpr size_t MAX_SIZE = UINT32_MAX;
+
+        /**
+         * @brief Default constructor. Creates an empty list.
+         */
+        CompressedIPv4List() = default;
+
+        /**
+         * @brief Constructor for the CompressedIPv4List class.
+         * @param cAddresses The addresses in ascending order, duplicates allowed.
+         * @throws std::invalid_argument If the addresses are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE addresses.
+         */
+        explicit CompressedIPv4List(const std::vector<IPv4Address> &cAddresses);
+
+        /**
+         * @brief Constructor for the CompressedIPv4List class.
+         * @param cValues The host-order values in ascending order, duplicates allowed.
+         * @param cCount The number of values.
+         * @throws std::invalid_argument If the pointer is null and cCount is not zero, or the values are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE values.
+         */
+        CompressedIPv4List(const uint32_t *cValues, const size_t &cCount);
+
+        /**
+         * @brief Returns the number of addresses.
+         * @return The number of addresses.
+         */
+        size_t Size() const { return _size; }
+
+        /**
+         * @brief Checks whether the list has no addresses.
+         * @return `true` if the list is empty, `false` otherwise.
+         */
+        bool Empty() const { return _size == 0; }
+
+        /**
+         * @brief Returns the number of blocks.
+         * @return The number of blocks.
+         */
+        size_t BlockCount() const { return _firsts.size(); }
+
+        /**
+         * @brief Returns the number of bytes of the block directory and the packed words.
+         * @return The compressed size in bytes.
+         */
+        size_t CompressedSize() const;
+
+        /**
+         * @brief Decodes one block.
+         * @param cBlock The block index.
+         * @param values Receives the host-order values, must have room for BLOCK_SIZE values.
+         * @return The number of values of the block; only the last block may be shorter than BLOCK_SIZE.
+         * @throws std::out_of_range If the block does not exist.
+         */
+        size_t DecodeBlock(const size_t &cBlock, uint32_t *values) const;
+
+        /**
+         * @brief Decodes the whole list.
+         * @param values Receives the host-order values, must have room for Size() values.
+         * @throws std::invalid_argument If the pointer is null and the list is not empty.
+         */
+        void Decode(uint32_t *values) const;
+
+        /**
+         * @brief Decodes the whole list.
+         * @return The addresses in ascending order.
+         */
+        std::vector<IPv4Address> Decode() const;
+
+        /**
+         * @brief Returns the address at a position.
+         * @param cIndex The position.
+         * @return The address.
+         * @throws std::out_of_range If the position does not exist.
+         */
+        IPv4Address Get(const size_t &cIndex) const;
+
+        /**
+         * @brief Checks whether the list contains an address. Decodes at most one block.
+         * @param cAddress The address to look for.
+         * @return `true` if the address is in the list, `false` otherwise.
+         */
+        bool Contains(const IPv4Address &cAddress) const;
+
+        /**
+         * @brief Serializes the list.
+         * @return The bytes, readable by Deserialize() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const;
+
+        /**
+         * @brief Restores a list written by Serialize().
+         * @param cData The bytes.
+         * @param cSize The number of bytes.
+         * @return The list.
+         * @throws std::invalid_argument If the pointer is null or the bytes are not a valid list.
+         */
+        static CompressedIPv4List Deserialize(const uint8_t *cData, const size_t &cSize);
+
+    private:
+        /**
+         * @brief Number of addresses.
+         */
+        size_t _size{};
+
+        /**
+         * @brief First value of every block.
+         */
+        std::vector<uint32_t> _firsts;
+
+        /**
+         * @brief Smallest gap between neighbouring values of every block.
+         */
+        std::vector<uint32_t> _minimumGaps;
+
+        /**
+         * @brief Offset of every block in _packed in units of 4 words, followed by the total; block b has bit width offset[b + 1] - offset[b].
+         */
+        std::vector<uint32_t> _offsets{0};
+
+        /**
+         * @brief The packed gaps of all blocks.
+         */
+        std::vector<uint32_t> _packed;
+
+        /**
+         * @brief Compresses sorted values into the empty list.
+         * @param cValues The host-order values.
+         * @param cCount The number of values.
+         * @throws std::invalid_argument If the values are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE values.
+         */
+        void Encode(const uint32_t *cValues, const size_t &cCount);
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::CompressedIPv4List] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating unsorted input.
+         */
+        static constexpr char NOT_SORTED[]{"[EthernetParameter::CompressedIPv4List] Addresses are not sorted!"};
+
+        /**
+         * @brief Error message indicating too many addresses.
+         */
+        static constexpr char LIST_TOO_LARGE[]{"[EthernetParameter::CompressedIPv4List] List exceeds maximum size!"};
+
+        /**
+         * @brief Error message indicating a missing block.
+         */
+        static constexpr char BLOCK_OUT_OF_RANGE[]{"[EthernetParameter::CompressedIPv4List] Block index out of range!"};
+
+        /**
+         * @brief Error message indicating a missing position.
+         */
+        static constexpr char INDEX_OUT_OF_RANGE[]{"[EthernetParameter::CompressedIPv4List] Index out of range!"};
+
+        /**
+         * @brief Error message indicating malformed serialized data.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::CompressedIPv4List] Invalid serialized data!"};
+    }; /* class CompressedIPv4List */
+}
+
+#endif /* COMPRESSEDIPV4LIST_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
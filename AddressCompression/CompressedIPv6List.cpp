@@ -0,0 +1,472 @@
+/**
+ * @file CompressedIPv6List.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CompressedIPv6List class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "CompressedIPv6List.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief First word of a serialized list ("EPL6" in memory on little-endian machines).
+         */
+        constexpr uint32_t MAGIC = 0x364C5045;
+
+        /**
+         * @brief Version of the serialized format.
+         */
+        constexpr uint32_t FORMAT_VERSION = 1;
+
+        /**
+         * @brief Number of 32-bit limbs of a 128-bit gap.
+         */
+        constexpr size_t LIMBS = 4;
+
+        /**
+         * @brief Largest limb width whose 127 gaps always add up to less than 2^32.
+         */
+        constexpr uint32_t SINGLE_LIMB_MAX_WIDTH = 25;
+
+        /**
+         * @struct Header
+         * @brief Start of a serialized list, followed by the first uppers, the first lowers, the widths, the offsets and the packed words.
+         */
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t size;
+            uint64_t blocks;
+            uint64_t packedWords;
+        };
+
+        /**
+         * @brief Returns the bit width of one limb from the packed widths of a block.
+         */
+        inline uint32_t LimbWidth(const uint32_t &cWidths, const size_t &cLimb)
+        {
+            return (cWidths >> (8 * cLimb)) & 0xFF;
+        }
+
+        /**
+         * @brief Compares two addresses given as halves.
+         */
+        inline bool Less(const uint64_t &cLeftUpper, const uint64_t &cLeftLower, const uint64_t &cRightUpper, const uint64_t &cRightLower)
+        {
+            return cLeftUpper < cRightUpper || (cLeftUpper == cRightUpper && cLeftLower < cRightLower);
+        }
+
+        /**
+         * @brief Appends the bytes of an array to a buffer.
+         */
+        template <typename Type>
+        void AppendArray(const Type *cValues, const size_t &cCount, std::vector<uint8_t> &bytes)
+        {
+            const uint8_t *const cBytes = reinterpret_cast<const uint8_t *>(cValues);
+            bytes.insert(bytes.end(), cBytes, cBytes + cCount * sizeof(Type));
+        }
+
+        /**
+         * @brief Copies an array out of serialized bytes and advances the position.
+         */
+        template <typename Type>
+        void ReadArray(const uint8_t *cData, const size_t &cCount, size_t &position, std::vector<Type> &values)
+        {
+            values.resize(cCount);
+            std::memcpy(values.data(), cData + position, cCount * sizeof(Type));
+            position += cCount * sizeof(Type);
+        }
+    }
+
+    /**
+     * @brief Constructor for the CompressedIPv6List class.
+     * @param cAddresses The addresses in ascending order, duplicates allowed.
+     * @throw std::invalid_argument If the addresses are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    CompressedIPv6List::CompressedIPv6List(const std::vector<IPv6Address> &cAddresses)
+    {
+        std::vector<uint64_t> upper(cAddresses.size());
+        std::vector<uint64_t> lower(cAddresses.size());
+        for (size_t i = 0; i < cAddresses.size(); i++)
+        {
+            upper[i] = cAddresses[i].GetUpper64();
+            lower[i] = cAddresses[i].GetLower64();
+        }
+        Encode(upper.data(), lower.data(), cAddresses.size());
+    } /* CompressedIPv6List::CompressedIPv6List(const std::vector<IPv6Address> &cAddresses) */
+
+    /**
+     * @brief Constructor for the CompressedIPv6List class.
+     * @param cUpper The host-order upper halves.
+     * @param cLower The host-order lower halves.
+     * @param cCount The number of addresses, in ascending order, duplicates allowed.
+     * @throw std::invalid_argument If a pointer is null and cCount is not zero, or the addresses are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    CompressedIPv6List::CompressedIPv6List(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount)
+    {
+        if ((!cUpper || !cLower) && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        Encode(cUpper, cLower, cCount);
+    } /* CompressedIPv6List::CompressedIPv6List(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount) */
+
+    /**
+     * @brief Returns the number of bytes of the block directory and the packed words.
+     * @return The compressed size in bytes.
+     */
+    size_t CompressedIPv6List::CompressedSize() const
+    {
+        return (_firstUppers.size() + _firstLowers.size() + _offsets.size()) * sizeof(uint64_t) + (_widths.size() + _packed.size()) * sizeof(uint32_t);
+    } /* size_t CompressedIPv6List::CompressedSize() const */
+
+    /**
+     * @brief Decodes one block.
+     * @param cBlock The block index.
+     * @param upper Receives the host-order upper halves, must have room for BLOCK_SIZE values.
+     * @param lower Receives the host-order lower halves, must have room for BLOCK_SIZE values.
+     * @return The number of addresses of the block; only the last block may be shorter than BLOCK_SIZE.
+     * @throw std::out_of_range If the block does not exist.
+     */
+    size_t CompressedIPv6List::DecodeBlock(const size_t &cBlock, uint64_t *upper, uint64_t *lower) const
+    {
+        if (cBlock >= _firstUppers.size())
+        {
+            throw std::out_of_range(BLOCK_OUT_OF_RANGE);
+        }
+
+        const uint32_t cWidths = _widths[cBlock];
+        const uint64_t cFirstUpper = _firstUppers[cBlock];
+        const uint64_t cFirstLower = _firstLowers[cBlock];
+        const uint32_t *packed = _packed.data() + _offsets[cBlock];
+
+        // Fast paths for the common blocks where only one limb is used and the block spans less
+        // than 2^32: hosts of one network (lowest limb) and sorted /64 prefixes (third limb). The
+        // 32-bit running sums come from the SIMD prefix sum and only need to be added to the first
+        // address, which vectorizes instead of running a 128-step carry chain.
+        uint32_t sums[BLOCK_SIZE];
+        if (cWidths <= SINGLE_LIMB_MAX_WIDTH)
+        {
+            BitPacking::UnpackPrefixSum(packed, cWidths, 0, 0, sums);
+            // The sums only grow, so the lower half carries into the upper one nowhere if not at the end.
+            const bool cCarries = cFirstLower + sums[BLOCK_SIZE - 1] < cFirstLower;
+            for (size_t i = 0; i < BLOCK_SIZE; i++)
+            {
+                lower[i] = cFirstLower + sums[i];
+                upper[i] = cFirstUpper;
+            }
+            for (size_t i = 0; cCarries && i < BLOCK_SIZE; i++)
+            {
+                upper[i] += lower[i] < cFirstLower;
+            }
+            return std::min(BLOCK_SIZE, _size - cBlock * BLOCK_SIZE);
+        }
+        if ((cWidths & 0xFF00FFFF) == 0 && LimbWidth(cWidths, 2) <= SINGLE_LIMB_MAX_WIDTH)
+        {
+            BitPacking::UnpackPrefixSum(packed, LimbWidth(cWidths, 2), 0, 0, sums);
+            for (size_t i = 0; i < BLOCK_SIZE; i++)
+            {
+                upper[i] = cFirstUpper + sums[i];
+                lower[i] = cFirstLower;
+            }
+            return std::min(BLOCK_SIZE, _size - cBlock * BLOCK_SIZE);
+        }
+
+        uint32_t limbs[LIMBS][BLOCK_SIZE];
+        for (size_t limb = 0; limb < LIMBS; limb++)
+        {
+            const uint32_t cWidth = LimbWidth(cWidths, limb);
+            BitPacking::Unpack(packed, cWidth, limbs[limb]);
+            packed += BitPacking::PackedWords(cWidth);
+        }
+
+        // Joining the limbs first keeps the carry chain below down to one add and one add with carry.
+        uint64_t gapsLower[BLOCK_SIZE];
+        uint64_t gapsUpper[BLOCK_SIZE];
+        for (size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            gapsLower[i] = static_cast<uint64_t>(limbs[1][i]) << 32 | limbs[0][i];
+            gapsUpper[i] = static_cast<uint64_t>(limbs[3][i]) << 32 | limbs[2][i];
+        }
+
+        // The first gap is zero; the others are added with the carry from the lower half.
+        uint64_t currentUpper = cFirstUpper;
+        uint64_t currentLower = cFirstLower;
+        for (size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            currentLower += gapsLower[i];
+            currentUpper += gapsUpper[i] + (currentLower < gapsLower[i]);
+            upper[i] = currentUpper;
+            lower[i] = currentLower;
+        }
+        return std::min(BLOCK_SIZE, _size - cBlock * BLOCK_SIZE);
+    } /* size_t CompressedIPv6List::DecodeBlock(const size_t &cBlock, uint64_t *upper, uint64_t *lower) const */
+
+    /**
+     * @brief Decodes the whole list.
+     * @param upper Receives the host-order upper halves, must have room for Size() values.
+     * @param lower Receives the host-order lower halves, must have room for Size() values.
+     * @throw std::invalid_argument If a pointer is null and the list is not empty.
+     */
+    void CompressedIPv6List::Decode(uint64_t *upper, uint64_t *lower) const
+    {
+        if ((!upper || !lower) && _size)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        const size_t cFullBlocks = _size / BLOCK_SIZE;
+        for (size_t block = 0; block < cFullBlocks; block++)
+        {
+            DecodeBlock(block, upper + block * BLOCK_SIZE, lower + block * BLOCK_SIZE);
+        }
+        if (cFullBlocks < _firstUppers.size())
+        {
+            uint64_t lastUpper[BLOCK_SIZE];
+            uint64_t lastLower[BLOCK_SIZE];
+            const size_t cCount = DecodeBlock(cFullBlocks, lastUpper, lastLower);
+            std::copy(lastUpper, lastUpper + cCount, upper + cFullBlocks * BLOCK_SIZE);
+            std::copy(lastLower, lastLower + cCount, lower + cFullBlocks * BLOCK_SIZE);
+        }
+    } /* void CompressedIPv6List::Decode(uint64_t *upper, uint64_t *lower) const */
+
+    /**
+     * @brief Decodes the whole list.
+     * @return The addresses in ascending order.
+     */
+    std::vector<IPv6Address> CompressedIPv6List::Decode() const
+    {
+        std::vector<uint64_t> upper(_size);
+        std::vector<uint64_t> lower(_size);
+        Decode(upper.data(), lower.data());
+        std::vector<IPv6Address> addresses(_size);
+        for (size_t i = 0; i < _size; i++)
+        {
+            addresses[i] = IPv6Address::FromUint64(upper[i], lower[i]);
+        }
+        return addresses;
+    } /* std::vector<IPv6Address> CompressedIPv6List::Decode() const */
+
+    /**
+     * @brief Returns the address at a position.
+     * @param cIndex The position.
+     * @return The address.
+     * @throw std::out_of_range If the position does not exist.
+     */
+    IPv6Address CompressedIPv6List::Get(const size_t &cIndex) const
+    {
+        if (cIndex >= _size)
+        {
+            throw std::out_of_range(INDEX_OUT_OF_RANGE);
+        }
+
+        uint64_t upper[BLOCK_SIZE];
+        uint64_t lower[BLOCK_SIZE];
+        DecodeBlock(cIndex / BLOCK_SIZE, upper, lower);
+        return IPv6Address::FromUint64(upper[cIndex % BLOCK_SIZE], lower[cIndex % BLOCK_SIZE]);
+    } /* IPv6Address CompressedIPv6List::Get(const size_t &cIndex) const */
+
+    /**
+     * @brief Checks whether the list contains an address. Decodes at most one block.
+     * @param cAddress The address to look for.
+     * @return `true` if the address is in the list, `false` otherwise.
+     */
+    bool CompressedIPv6List::Contains(const IPv6Address &cAddress) const
+    {
+        const uint64_t cUpper = cAddress.GetUpper64();
+        const uint64_t cLower = cAddress.GetLower64();
+        // The last block whose first address is not above the address is the only candidate.
+        size_t low{};
+        size_t high = _firstUppers.size();
+        while (low < high)
+        {
+            const size_t cMiddle = low + (high - low) / 2;
+            if (Less(cUpper, cLower, _firstUppers[cMiddle], _firstLowers[cMiddle]))
+            {
+                high = cMiddle;
+            }
+            else
+            {
+                low = cMiddle + 1;
+            }
+        }
+        if (low == 0)
+        {
+            return false;
+        }
+
+        const size_t cBlock = low - 1;
+        uint64_t upper[BLOCK_SIZE];
+        uint64_t lower[BLOCK_SIZE];
+        const size_t cCount = DecodeBlock(cBlock, upper, lower);
+        for (size_t i = 0; i < cCount; i++)
+        {
+            if (upper[i] == cUpper && lower[i] == cLower)
+            {
+                return true;
+            }
+        }
+        return false;
+    } /* bool CompressedIPv6List::Contains(const IPv6Address &cAddress) const */
+
+    /**
+     * @brief Serializes the list.
+     * @return The bytes, readable by Deserialize() on a machine of the same byte order.
+     */
+    std::vector<uint8_t> CompressedIPv6List::Serialize() const
+    {
+        const Header cHeader{MAGIC, FORMAT_VERSION, _size, _firstUppers.size(), _packed.size()};
+        std::vector<uint8_t> bytes;
+        bytes.reserve(sizeof(cHeader) + CompressedSize());
+        AppendArray(&cHeader, 1, bytes);
+        AppendArray(_firstUppers.data(), _firstUppers.size(), bytes);
+        AppendArray(_firstLowers.data(), _firstLowers.size(), bytes);
+        AppendArray(_widths.data(), _widths.size(), bytes);
+        AppendArray(_offsets.data(), _offsets.size(), bytes);
+        AppendArray(_packed.data(), _packed.size(), bytes);
+        return bytes;
+    } /* std::vector<uint8_t> CompressedIPv6List::Serialize() const */
+
+    /**
+     * @brief Restores a list written by Serialize().
+     * @param cData The bytes.
+     * @param cSize The number of bytes.
+     * @return The list.
+     * @throw std::invalid_argument If the pointer is null or the bytes are not a valid list.
+     */
+    CompressedIPv6List CompressedIPv6List::Deserialize(const uint8_t *cData, const size_t &cSize)
+    {
+        if (!cData)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        Header header{};
+        if (cSize < sizeof(header))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        std::memcpy(&header, cData, sizeof(header));
+        // Every count is bounded before it is multiplied, so the size check cannot overflow.
+        if (header.magic != MAGIC || header.version != FORMAT_VERSION || header.size > MAX_SIZE ||
+            header.blocks != (header.size + BLOCK_SIZE - 1) / BLOCK_SIZE || header.packedWords > header.blocks * LIMBS * BitPacking::PackedWords(BitPacking::MAX_BIT_WIDTH) ||
+            cSize != sizeof(header) + (3 * header.blocks + 1) * sizeof(uint64_t) + (header.blocks + header.packedWords) * sizeof(uint32_t))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        CompressedIPv6List list;
+        size_t position = sizeof(header);
+        list._size = static_cast<size_t>(header.size);
+        ReadArray(cData, static_cast<size_t>(header.blocks), position, list._firstUppers);
+        ReadArray(cData, static_cast<size_t>(header.blocks), position, list._firstLowers);
+        ReadArray(cData, static_cast<size_t>(header.blocks), position, list._widths);
+        ReadArray(cData, static_cast<size_t>(header.blocks + 1), position, list._offsets);
+        ReadArray(cData, static_cast<size_t>(header.packedWords), position, list._packed);
+
+        // Decoding trusts the widths and offsets, so every block must stay inside the packed words.
+        if (list._offsets.front() != 0 || list._offsets.back() != header.packedWords)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        for (size_t block = 0; block < list._widths.size(); block++)
+        {
+            uint64_t words{};
+            for (size_t limb = 0; limb < LIMBS; limb++)
+            {
+                if (LimbWidth(list._widths[block], limb) > BitPacking::MAX_BIT_WIDTH)
+                {
+                    throw std::invalid_argument(INVALID_DATA);
+                }
+                words += BitPacking::PackedWords(LimbWidth(list._widths[block], limb));
+            }
+            if (list._offsets[block + 1] < list._offsets[block] || list._offsets[block + 1] - list._offsets[block] != words)
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+        }
+        return list;
+    } /* CompressedIPv6List CompressedIPv6List::Deserialize(const uint8_t *cData, const size_t &cSize) */
+
+    // Private Methods.
+
+    /**
+     * @brief Compresses sorted addresses into the empty list.
+     * @param cUpper The host-order upper halves.
+     * @param cLower The host-order lower halves.
+     * @param cCount The number of addresses.
+     * @throw std::invalid_argument If the addresses are not sorted.
+     * @throw std::out_of_range If there are more than MAX_SIZE addresses.
+     */
+    void CompressedIPv6List::Encode(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount)
+    {
+        if (cCount > MAX_SIZE)
+        {
+            throw std::out_of_range(LIST_TOO_LARGE);
+        }
+        for (size_t i = 1; i < cCount; i++)
+        {
+            if (Less(cUpper[i], cLower[i], cUpper[i - 1], cLower[i - 1]))
+            {
+                throw std::invalid_argument(NOT_SORTED);
+            }
+        }
+
+        const size_t cBlocks = (cCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        _size = cCount;
+        _firstUppers.reserve(cBlocks);
+        _firstLowers.reserve(cBlocks);
+        _widths.reserve(cBlocks);
+        _offsets.reserve(cBlocks + 1);
+        uint32_t limbs[LIMBS][BLOCK_SIZE];
+        for (size_t start = 0; start < cCount; start += BLOCK_SIZE)
+        {
+            const size_t cLength = std::min(BLOCK_SIZE, cCount - start);
+            // The first address lives in the directory and the padding decodes to garbage that
+            // is never returned, so both are packed as zero.
+            std::memset(limbs, 0, sizeof(limbs));
+            for (size_t i = start + 1; i < start + cLength; i++)
+            {
+                const uint64_t cGapLower = cLower[i] - cLower[i - 1];
+                const uint64_t cGapUpper = cUpper[i] - cUpper[i - 1] - (cLower[i] < cLower[i - 1]);
+                limbs[0][i - start] = static_cast<uint32_t>(cGapLower);
+                limbs[1][i - start] = static_cast<uint32_t>(cGapLower >> 32);
+                limbs[2][i - start] = static_cast<uint32_t>(cGapUpper);
+                limbs[3][i - start] = static_cast<uint32_t>(cGapUpper >> 32);
+            }
+
+            uint32_t widths{};
+            for (size_t limb = 0; limb < LIMBS; limb++)
+            {
+                const uint32_t cWidth = BitPacking::BitWidth(limbs[limb]);
+                _packed.resize(_packed.size() + BitPacking::PackedWords(cWidth));
+                BitPacking::Pack(limbs[limb], cWidth, _packed.data() + _packed.size() - BitPacking::PackedWords(cWidth));
+                widths |= cWidth << (8 * limb);
+            }
+
+            _firstUppers.push_back(cUpper[start]);
+            _firstLowers.push_back(cLower[start]);
+            _widths.push_back(widths);
+            _offsets.push_back(_packed.size());
+        }
+    } /* void CompressedIPv6List::Encode(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
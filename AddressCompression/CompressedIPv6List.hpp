@@ -0,0 +1,232 @@
+/**
+ * @file CompressedIPv6List.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CompressedIPv6List (128-bit delta + bit-packed sorted IPv6 address list) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef COMPRESSEDIPV6LIST_H
+#define COMPRESSEDIPV6LIST_H
+#include "BitPacking.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class CompressedIPv6List
+     * @brief An immutable sorted list of IPv6 addresses stored as bit-packed 128-bit deltas.
+     *
+     * The list is cut into blocks of BLOCK_SIZE addresses. A block keeps its first address in the
+     * block directory; the 128-bit gaps to the previous address are split into four 32-bit limbs
+     * and every limb is bit-packed with BitPacking at its own width. Gaps between hosts of one
+     * /64 only fill the low limbs, gaps between sorted /64 prefixes only the high ones, and the
+     * limbs that are zero in the whole block take no space.
+     *
+     * Blocks decode independently: DecodeBlock() unpacks the limbs and adds the gaps up with a
+     * 128-bit carry, Get() and Contains() decode only the block the address is in. The values
+     * are host-order upper and lower halves, the same as IPv6AddressColumn::UpperData() and
+     * IPv6AddressColumn::LowerData().
+     *
+     * Serialize() writes the directory and the packed words in native byte order.
+     */
+    class CompressedIPv6List
+    {
+    public:
+        /**
+         * @brief Number of addresses of a block.
+         */
+        static constexpr size_t BLOCK_SIZE = BitPacking::BLOCK_SIZE;
+
+        /**
+         * @brief Maximum number of addresses.
+         */
+        static constexpr size_t MAX_SIZE = UINT32_MAX;
+
+        /**
+         * @brief Default constructor. Creates an empty list.
+         */
+        CompressedIPv6List() = default;
+
+        /**
+         * @brief Constructor for the CompressedIPv6List class.
+         * @param cAddresses The addresses in ascending order, duplicates allowed.
+         * @throws std::invalid_argument If the addresses are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE addresses.
+         */
+        explicit CompressedIPv6List(const std::vector<IPv6Address> &cAddresses);
+
+        /**
+         * @brief Constructor for the CompressedIPv6List class.
+         * @param cUpper The host-order upper halves.
+         * @param cLower The host-order lower halves.
+         * @param cCount The number of addresses, in ascending order, duplicates allowed.
+         * @throws std::invalid_argument If a pointer is null and cCount is not zero, or the addresses are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE addresses.
+         */
+        CompressedIPv6List(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount);
+
+        /**
+         * @brief Returns the number of addresses.
+         * @return The number of addresses.
+         */
+        size_t Size() const { return _size; }
+
+        /**
+         * @brief Checks whether the list has no addresses.
+         * @return `true` if the list is empty, `false` otherwise.
+         */
+        bool Empty() const { return _size == 0; }
+
+        /**
+         * @brief Returns the number of blocks.
+         * @return The number of blocks.
+         */
+        size_t BlockCount() const { return _firstUppers.size(); }
+
+        /**
+         * @brief Returns the number of bytes of the block directory and the packed words.
+         * @return The compressed size in bytes.
+         */
+        size_t CompressedSize() const;
+
+        /**
+         * @brief Decodes one block.
+         * @param cBlock The block index.
+         * @param upper Receives the host-order upper halves, must have room for BLOCK_SIZE values.
+         * @param lower Receives the host-order lower halves, must have room for BLOCK_SIZE values.
+         * @return The number of addresses of the block; only the last block may be shorter than BLOCK_SIZE.
+         * @throws std::out_of_range If the block does not exist.
+         */
+        size_t DecodeBlock(const size_t &cBlock, uint64_t *upper, uint64_t *lower) const;
+
+        /**
+         * @brief Decodes the whole list.
+         * @param upper Receives the host-order upper halves, must have room for Size() values.
+         * @param lower Receives the host-order lower halves, must have room for Size() values.
+         * @throws std::invalid_argument If a pointer is null and the list is not empty.
+         */
+        void Decode(uint64_t *upper, uint64_t *lower) const;
+
+        /**
+         * @brief Decodes the whole list.
+         * @return The addresses in ascending order.
+         */
+        std::vector<IPv6Address> Decode() const;
+
+        /**
+         * @brief Returns the address at a position.
+         * @param cIndex The position.
+         * @return The address.
+         * @throws std::out_of_range If the position does not exist.
+         */
+        IPv6Address Get(const size_t &cIndex) const;
+
+        /**
+         * @brief Checks whether the list contains an address. Decodes at most one block.
+         * @param cAddress The address to look for.
+         * @return `true` if the address is in the list, `false` otherwise.
+         */
+        bool Contains(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Serializes the list.
+         * @return The bytes, readable by Deserialize() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const;
+
+        /**
+         * @brief Restores a list written by Serialize().
+         * @param cData The bytes.
+         * @param cSize The number of bytes.
+         * @return The list.
+         * @throws std::invalid_argument If the pointer is null or the bytes are not a valid list.
+         */
+        static CompressedIPv6List Deserialize(const uint8_t *cData, const size_t &cSize);
+
+    private:
+        /**
+         * @brief Number of addresses.
+         */
+        size_t _size{};
+
+        /**
+         * @brief Upper half of the first address of every block.
+         */
+        std::vector<uint64_t> _firstUppers;
+
+        /**
+         * @brief Lower half of the first address of every block.
+         */
+        std::vector<uint64_t> _firstLowers;
+
+        /**
+         * @brief Bit widths of the four gap limbs of every block, one byte per limb, lowest limb first.
+         */
+        std::vector<uint32_t> _widths;
+
+        /**
+         * @brief Word offset of every block in _packed, followed by the total.
+         */
+        std::vector<uint64_t> _offsets{0};
+
+        /**
+         * @brief The packed gap limbs of all blocks.
+         */
+        std::vector<uint32_t> _packed;
+
+        /**
+         * @brief Compresses sorted addresses into the empty list.
+         * @param cUpper The host-order upper halves.
+         * @param cLower The host-order lower halves.
+         * @param cCount The number of addresses.
+         * @throws std::invalid_argument If the addresses are not sorted.
+         * @throws std::out_of_range If there are more than MAX_SIZE addresses.
+         */
+        void Encode(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount);
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::CompressedIPv6List] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating unsorted input.
+         */
+        static constexpr char NOT_SORTED[]{"[EthernetParameter::CompressedIPv6List] Addresses are not sorted!"};
+
+        /**
+         * @brief Error message indicating too many addresses.
+         */
+        static constexpr char LIST_TOO_LARGE[]{"[EthernetParameter::CompressedIPv6List] List exceeds maximum size!"};
+
+        /**
+         * @brief Error message indicating a missing block.
+         */
+        static constexpr char BLOCK_OUT_OF_RANGE[]{"[EthernetParameter::CompressedIPv6List] Block index out of range!"};
+
+        /**
+         * @brief Error message indicating a missing position.
+         */
+        static constexpr char INDEX_OUT_OF_RANGE[]{"[EthernetParameter::CompressedIPv6List] Index out of range!"};
+
+        /**
+         * @brief Error message indicating malformed serialized data.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::CompressedIPv6List] Invalid serialized data!"};
+    }; /* class CompressedIPv6List */
+}
+
+#endif /* COMPRESSEDIPV6LIST_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
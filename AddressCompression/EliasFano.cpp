@@ -0,0 +1,533 @@
+/**
+ * @file EliasFano.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFano class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "EliasFano.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief First word of the words: "EPEF" and the format version 1.
+         */
+        constexpr uint64_t MAGIC = 0x0000000146455045ull;
+
+        /**
+         * @brief Returns the number of set bits of a word.
+         */
+        inline uint32_t PopCount(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            return static_cast<uint32_t>(__popcnt64(cWord));
+#else
+            return static_cast<uint32_t>(__builtin_popcountll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Returns the index of the highest set bit of a word, which must not be zero.
+         */
+        inline uint32_t HighestBit(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanReverse64(&index, cWord);
+            return static_cast<uint32_t>(index);
+#else
+            return 63 - static_cast<uint32_t>(__builtin_clzll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Returns the position of a set bit of a word.
+         * @param word The word, with more than cRank set bits.
+         * @param rank The number of set bits below the wanted one.
+         * @return The bit position.
+         */
+        inline uint32_t SelectInWord(uint64_t word, uint32_t rank)
+        {
+            // Halve the search range with popcounts down to a byte, then walk the byte.
+            uint32_t position{};
+            for (const uint32_t &cWidth : {32u, 16u, 8u})
+            {
+                const uint32_t cCount = PopCount(word & ((1ull << cWidth) - 1));
+                if (rank >= cCount)
+                {
+                    rank -= cCount;
+                    word >>= cWidth;
+                    position += cWidth;
+                }
+            }
+            for (;; word >>= 1, position++)
+            {
+                if (word & 1)
+                {
+                    if (rank == 0)
+                    {
+                        return position;
+                    }
+                    rank--;
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the number of low bits per value, floor(log2(cMaximum / cCount)) or zero.
+         */
+        inline uint64_t LowBitCount(const uint64_t &cMaximum, const uint64_t &cCount)
+        {
+            return cCount && cMaximum / cCount ? HighestBit(cMaximum / cCount) : 0;
+        }
+
+        /**
+         * @brief Returns the number of 64-bit words holding a number of bits.
+         */
+        constexpr uint64_t WordsForBits(const uint64_t &cBits)
+        {
+            return (cBits + 63) / 64;
+        }
+
+        /**
+         * @brief Records the position of every cRate-th one and zero bit of a bit vector.
+         * @param cBits The bit vector.
+         * @param cBitCount The number of bits.
+         * @param cRate The sampling rate.
+         * @param ones Receives the one samples.
+         * @param zeros Receives the zero samples.
+         */
+        void BuildSamples(const uint64_t *cBits, const uint64_t &cBitCount, const uint64_t &cRate, uint64_t *ones, uint64_t *zeros)
+        {
+            uint64_t onesSeen{};
+            uint64_t zerosSeen{};
+            for (uint64_t word = 0; word < WordsForBits(cBitCount); word++)
+            {
+                const uint64_t cValidBits = std::min<uint64_t>(64, cBitCount - 64 * word);
+                const uint64_t cValidMask = cValidBits == 64 ? ~0ull : (1ull << cValidBits) - 1;
+                const uint64_t cOnes = cBits[word] & cValidMask;
+                const uint64_t cZeros = ~cBits[word] & cValidMask;
+                // The next sample of each kind is the first one at a multiple of the rate.
+                for (uint64_t next = (onesSeen + cRate - 1) / cRate * cRate; next < onesSeen + PopCount(cOnes); next += cRate)
+                {
+                    ones[next / cRate] = 64 * word + SelectInWord(cOnes, static_cast<uint32_t>(next - onesSeen));
+                }
+                for (uint64_t next = (zerosSeen + cRate - 1) / cRate * cRate; next < zerosSeen + PopCount(cZeros); next += cRate)
+                {
+                    zeros[next / cRate] = 64 * word + SelectInWord(cZeros, static_cast<uint32_t>(next - zerosSeen));
+                }
+                onesSeen += PopCount(cOnes);
+                zerosSeen += PopCount(cZeros);
+            }
+        }
+    }
+
+    /**
+     * @brief Default constructor. Creates an empty sequence.
+     */
+    EliasFano::EliasFano() : EliasFano(nullptr, 0)
+    {
+    } /* EliasFano::EliasFano() */
+
+    /**
+     * @brief Constructor for the EliasFano class.
+     * @param cValues The values in ascending order, duplicates allowed.
+     * @param cCount The number of values.
+     * @throw std::invalid_argument If the pointer is null and cCount is not zero, or the values are not sorted.
+     */
+    EliasFano::EliasFano(const uint64_t *cValues, const size_t &cCount)
+    {
+        if (!cValues && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (!std::is_sorted(cValues, cValues + cCount))
+        {
+            throw std::invalid_argument(NOT_SORTED);
+        }
+
+        const uint64_t cBase = cCount ? cValues[0] : 0;
+        const uint64_t cRange = cCount ? cValues[cCount - 1] - cBase : 0;
+        const uint64_t cLowBits = LowBitCount(cRange, cCount);
+        const uint64_t cUpperBits = cCount + (cRange >> cLowBits) + 1;
+        uint64_t header[HEADER_WORDS];
+        FillHeader(cCount, cBase, cLowBits, cUpperBits, header);
+
+        _storage.assign(static_cast<size_t>(header[TOTAL_WORDS_WORD]), 0);
+        std::copy(header, header + HEADER_WORDS, _storage.begin());
+        uint64_t *const cLower = _storage.data() + header[LOWER_OFFSET_WORD];
+        uint64_t *const cUpper = _storage.data() + header[UPPER_OFFSET_WORD];
+        for (size_t i = 0; i < cCount; i++)
+        {
+            const uint64_t cValue = cValues[i] - cBase;
+            const uint64_t cLow = cLowBits ? cValue & ((1ull << cLowBits) - 1) : 0;
+            const uint64_t cBit = i * cLowBits;
+            cLower[cBit / 64] |= cLow << (cBit % 64);
+            if (cBit % 64 + cLowBits > 64)
+            {
+                cLower[cBit / 64 + 1] |= cLow >> (64 - cBit % 64);
+            }
+
+            const uint64_t cHighBit = (cValue >> cLowBits) + i;
+            cUpper[cHighBit / 64] |= 1ull << (cHighBit % 64);
+        }
+        BuildSamples(cUpper, cUpperBits, SAMPLE_RATE, _storage.data() + header[ONE_SAMPLES_OFFSET_WORD], _storage.data() + header[ZERO_SAMPLES_OFFSET_WORD]);
+    } /* EliasFano::EliasFano(const uint64_t *cValues, const size_t &cCount) */
+
+    /**
+     * @brief Returns a value by position.
+     * @param cIndex The position, below Size().
+     * @return The value.
+     * @throw std::out_of_range If the position does not exist.
+     */
+    uint64_t EliasFano::Select(const size_t &cIndex) const
+    {
+        if (cIndex >= Size())
+        {
+            throw std::out_of_range(INDEX_OUT_OF_RANGE);
+        }
+        return Words()[BASE_WORD] + ((SelectBit(cIndex, true) - cIndex) << Words()[LOW_BITS_WORD] | LowBits(cIndex));
+    } /* uint64_t EliasFano::Select(const size_t &cIndex) const */
+
+    /**
+     * @brief Counts the values below a value.
+     * @param cValue The value.
+     * @return The number of values less than cValue, which is also the position of its first occurrence.
+     */
+    size_t EliasFano::Rank(const uint64_t &cValue) const
+    {
+        size_t bucketBegin{};
+        return CountBelow(cValue, false, bucketBegin);
+    } /* size_t EliasFano::Rank(const uint64_t &cValue) const */
+
+    /**
+     * @brief Checks whether the sequence contains a value.
+     * @param cValue The value to look for.
+     * @return `true` if the value is in the sequence, `false` otherwise.
+     */
+    bool EliasFano::Contains(const uint64_t &cValue) const
+    {
+        // The last value not above cValue is cValue exactly when it shares its bucket and low bits.
+        size_t bucketBegin{};
+        const size_t cCount = CountBelow(cValue, true, bucketBegin);
+        const uint64_t cLowBits = Words()[LOW_BITS_WORD];
+        return cCount > bucketBegin && (!cLowBits || LowBits(cCount - 1) == ((cValue - Words()[BASE_WORD]) & ((1ull << cLowBits) - 1)));
+    } /* bool EliasFano::Contains(const uint64_t &cValue) const */
+
+    /**
+     * @brief Finds the greatest value not above a value.
+     * @param cValue The value.
+     * @param predecessor Receives the predecessor, if there is one.
+     * @return `true` if some value is less than or equal to cValue, `false` otherwise.
+     */
+    bool EliasFano::Predecessor(const uint64_t &cValue, uint64_t &predecessor) const
+    {
+        size_t bucketBegin{};
+        const size_t cCount = CountBelow(cValue, true, bucketBegin);
+        if (cCount == 0)
+        {
+            return false;
+        }
+        if (cCount == bucketBegin)
+        {
+            predecessor = Select(cCount - 1);
+            return true;
+        }
+
+        // The predecessor is in the bucket of cValue, so only its low bits differ.
+        const uint64_t cLowBits = Words()[LOW_BITS_WORD];
+        const uint64_t cOffset = cValue - Words()[BASE_WORD];
+        predecessor = Words()[BASE_WORD] + ((cOffset >> cLowBits) << cLowBits | LowBits(cCount - 1));
+        return true;
+    } /* bool EliasFano::Predecessor(const uint64_t &cValue, uint64_t &predecessor) const */
+
+    /**
+     * @brief Serializes the sequence.
+     * @return The words of the sequence as bytes, readable by View() on a machine of the same byte order.
+     */
+    std::vector<uint8_t> EliasFano::Serialize() const
+    {
+        const uint8_t *const cBytes = reinterpret_cast<const uint8_t *>(Words());
+        return std::vector<uint8_t>(cBytes, cBytes + SizeInBytes());
+    } /* std::vector<uint8_t> EliasFano::Serialize() const */
+
+    /**
+     * @brief Creates a sequence that queries serialized bytes in place.
+     * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the sequence and its copies.
+     * @param cSize The number of bytes.
+     * @return The sequence.
+     * @throw std::invalid_argument If the pointer is null or misaligned, or the header does not match the size.
+     */
+    EliasFano EliasFano::View(const uint8_t *cData, const size_t &cSize)
+    {
+        if (!cData)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (reinterpret_cast<uintptr_t>(cData) % alignof(uint64_t) || cSize % sizeof(uint64_t) || cSize < HEADER_WORDS * sizeof(uint64_t))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        // The header must be exactly what the constructor writes for its size fields; the counts
+        // are bounded first, so computing the expected layout cannot overflow.
+        const uint64_t *const cWords = reinterpret_cast<const uint64_t *>(cData);
+        const uint64_t cTotalWords = cSize / sizeof(uint64_t);
+        uint64_t expected[HEADER_WORDS];
+        if (cWords[MAGIC_WORD] != MAGIC || cWords[LOW_BITS_WORD] > 63 || cWords[SIZE_WORD] >= cTotalWords * 64 || cWords[UPPER_BITS_WORD] <= cWords[SIZE_WORD] ||
+            cWords[UPPER_BITS_WORD] >= cTotalWords * 64)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        FillHeader(cWords[SIZE_WORD], cWords[BASE_WORD], cWords[LOW_BITS_WORD], cWords[UPPER_BITS_WORD], expected);
+        if (!std::equal(expected, expected + HEADER_WORDS, cWords) || expected[TOTAL_WORDS_WORD] != cTotalWords)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        // Only the header is read, so opening a memory-mapped image touches a single page;
+        // Validate() checks the bits and the samples when the image is not trusted.
+        EliasFano sequence;
+        sequence._storage.clear();
+        sequence._view = cWords;
+        return sequence;
+    } /* EliasFano EliasFano::View(const uint8_t *cData, const size_t &cSize) */
+
+    /**
+     * @brief Checks that the words are exactly what the constructor writes for the values they hold.
+     *
+     * Queries scan the high bits trusting the samples and the counts, so this checks the right
+     * number of ones, a zero in the last bit and the samples a fresh build would write, then that
+     * the base and the shape are the ones the constructor picks for the smallest and the largest
+     * value, so that equal sets always have equal images. Reads every word of the sequence and
+     * allocates the samples once.
+     *
+     * @throw std::invalid_argument If the words are not a valid sequence.
+     */
+    void EliasFano::Validate() const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t cTotalWords = cWords[TOTAL_WORDS_WORD];
+        const uint64_t *const cUpper = cWords + cWords[UPPER_OFFSET_WORD];
+        const uint64_t cUpperBits = cWords[UPPER_BITS_WORD];
+        uint64_t ones{};
+        for (uint64_t word = 0; word < WordsForBits(cUpperBits); word++)
+        {
+            ones += PopCount(cUpper[word]);
+        }
+        const uint64_t cLastBit = cUpperBits - 1;
+        if (ones != cWords[SIZE_WORD] || (cUpper[cLastBit / 64] >> (cLastBit % 64)) != 0)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        std::vector<uint64_t> samples(static_cast<size_t>(cTotalWords - cWords[ONE_SAMPLES_OFFSET_WORD]));
+        BuildSamples(cUpper, cUpperBits, SAMPLE_RATE, samples.data(), samples.data() + (cWords[ZERO_SAMPLES_OFFSET_WORD] - cWords[ONE_SAMPLES_OFFSET_WORD]));
+        if (!std::equal(samples.begin(), samples.end(), cWords + cWords[ONE_SAMPLES_OFFSET_WORD]))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        const uint64_t cCount = cWords[SIZE_WORD];
+        const uint64_t cBase = cWords[BASE_WORD];
+        const uint64_t cRange = cCount ? Select(static_cast<size_t>(cCount - 1)) - cBase : 0;
+        const uint64_t cLowBits = LowBitCount(cRange, cCount);
+        if ((cCount ? Select(0) != cBase : cBase != 0) || cWords[LOW_BITS_WORD] != cLowBits || cUpperBits != cCount + (cRange >> cLowBits) + 1)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+    } /* void EliasFano::Validate() const */
+
+    // Private Methods.
+
+    /**
+     * @brief Fills the header of the words from the shape of the sequence.
+     * @param cSize The number of values.
+     * @param cBase The smallest value.
+     * @param cLowBits The number of low bits per value.
+     * @param cUpperBits The number of bits of the high bit vector.
+     * @param header Receives HEADER_WORDS words.
+     */
+    void EliasFano::FillHeader(const uint64_t &cSize, const uint64_t &cBase, const uint64_t &cLowBits, const uint64_t &cUpperBits, uint64_t *header)
+    {
+        const uint64_t cZeros = cUpperBits - cSize;
+        header[MAGIC_WORD] = MAGIC;
+        header[SIZE_WORD] = cSize;
+        header[BASE_WORD] = cBase;
+        header[LOW_BITS_WORD] = cLowBits;
+        header[UPPER_BITS_WORD] = cUpperBits;
+        header[LOWER_OFFSET_WORD] = HEADER_WORDS;
+        header[UPPER_OFFSET_WORD] = header[LOWER_OFFSET_WORD] + WordsForBits(cSize * cLowBits);
+        header[ONE_SAMPLES_OFFSET_WORD] = header[UPPER_OFFSET_WORD] + WordsForBits(cUpperBits);
+        header[ZERO_SAMPLES_OFFSET_WORD] = header[ONE_SAMPLES_OFFSET_WORD] + (cSize + SAMPLE_RATE - 1) / SAMPLE_RATE;
+        header[TOTAL_WORDS_WORD] = header[ZERO_SAMPLES_OFFSET_WORD] + (cZeros + SAMPLE_RATE - 1) / SAMPLE_RATE;
+    } /* void EliasFano::FillHeader(const uint64_t &cSize, const uint64_t &cBase, const uint64_t &cLowBits, const uint64_t &cUpperBits, uint64_t *header) */
+
+    /**
+     * @brief Returns the low bits of a value.
+     * @param cIndex The position of the value.
+     * @return The low bits.
+     */
+    uint64_t EliasFano::LowBits(const size_t &cIndex) const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t cLowBits = cWords[LOW_BITS_WORD];
+        if (cLowBits == 0)
+        {
+            return 0;
+        }
+
+        const uint64_t *const cLower = cWords + cWords[LOWER_OFFSET_WORD];
+        const uint64_t cBit = cIndex * cLowBits;
+        uint64_t low = cLower[cBit / 64] >> (cBit % 64);
+        if (cBit % 64 + cLowBits > 64)
+        {
+            low |= cLower[cBit / 64 + 1] << (64 - cBit % 64);
+        }
+        return low & ((1ull << cLowBits) - 1);
+    } /* uint64_t EliasFano::LowBits(const size_t &cIndex) const */
+
+    /**
+     * @brief Returns the position of a one or zero bit of the high bits.
+     * @param cRank The number of bits of the same kind before it.
+     * @param cOne `true` to look for a one bit, `false` for a zero bit.
+     * @return The bit position.
+     */
+    uint64_t EliasFano::SelectBit(const size_t &cRank, const bool &cOne) const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t *const cUpper = cWords + cWords[UPPER_OFFSET_WORD];
+        const uint64_t *const cSame = cWords + cWords[cOne ? ONE_SAMPLES_OFFSET_WORD : ZERO_SAMPLES_OFFSET_WORD];
+        const uint64_t *const cOther = cWords + cWords[cOne ? ZERO_SAMPLES_OFFSET_WORD : ONE_SAMPLES_OFFSET_WORD];
+
+        // Scan from the sample of the same kind: the wanted bit is usually a word or two away.
+        const uint64_t cSample = cSame[cRank / SAMPLE_RATE];
+        uint64_t rank = cRank % SAMPLE_RATE;
+        uint64_t word = cSample / 64;
+        uint64_t bits = (cOne ? cUpper[word] : ~cUpper[word]) & (~0ull << (cSample % 64));
+        for (size_t scanned = 0; scanned < SHORT_SCAN_WORDS; scanned++)
+        {
+            const uint32_t cCount = PopCount(bits);
+            if (rank < cCount)
+            {
+                return 64 * word + SelectInWord(bits, static_cast<uint32_t>(rank));
+            }
+            rank -= cCount;
+            word++;
+            bits = cOne ? cUpper[word] : ~cUpper[word];
+        }
+
+        // A long run of the other kind is in the way: skip it with the samples of the other kind
+        // that precede the wanted bit (galloping, then bisecting). Other sample j sits after
+        // j * SAMPLE_RATE bits of its kind, so at most SAMPLE_RATE bits of each kind remain.
+        const uint64_t cOtherCount = cOne ? cWords[UPPER_BITS_WORD] - cWords[SIZE_WORD] : cWords[SIZE_WORD];
+        const uint64_t cSamples = (cOtherCount + SAMPLE_RATE - 1) / SAMPLE_RATE;
+        const uint64_t cBefore = cRank - rank;
+        const uint64_t cFirst = (64 * word - cBefore + SAMPLE_RATE - 1) / SAMPLE_RATE;
+        uint64_t low = cFirst;
+        uint64_t high = cFirst;
+        for (uint64_t step = 1; high < cSamples && cOther[high] - SAMPLE_RATE * high <= cRank; step *= 2)
+        {
+            low = high + 1;
+            high += step;
+        }
+        high = std::min(high, cSamples);
+        while (low < high)
+        {
+            const uint64_t cMiddle = low + (high - low) / 2;
+            if (cOther[cMiddle] - SAMPLE_RATE * cMiddle <= cRank)
+            {
+                low = cMiddle + 1;
+            }
+            else
+            {
+                high = cMiddle;
+            }
+        }
+        if (low > cFirst)
+        {
+            const uint64_t cPosition = cOther[low - 1];
+            rank = cRank - (cPosition - SAMPLE_RATE * (low - 1));
+            word = cPosition / 64;
+            bits = (cOne ? cUpper[word] : ~cUpper[word]) & (~0ull << (cPosition % 64));
+        }
+        for (uint32_t count = PopCount(bits); rank >= count; count = PopCount(bits))
+        {
+            rank -= count;
+            word++;
+            bits = cOne ? cUpper[word] : ~cUpper[word];
+        }
+        return 64 * word + SelectInWord(bits, static_cast<uint32_t>(rank));
+    } /* uint64_t EliasFano::SelectBit(const size_t &cRank, const bool &cOne) const */
+
+    /**
+     * @brief Counts the values below (or not above) a value.
+     * @param cValue The value.
+     * @param cInclusive `true` to count values equal to cValue too.
+     * @param bucketBegin Receives the position of the first value with the same high bits as cValue.
+     * @return The number of values less than (or not greater than) cValue.
+     */
+    size_t EliasFano::CountBelow(const uint64_t &cValue, const bool &cInclusive, size_t &bucketBegin) const
+    {
+        const uint64_t *const cWords = Words();
+        const size_t cSize = Size();
+        bucketBegin = 0;
+        if (cSize == 0 || cValue < cWords[BASE_WORD])
+        {
+            return 0;
+        }
+
+        const uint64_t cOffset = cValue - cWords[BASE_WORD];
+        const uint64_t cLowBits = cWords[LOW_BITS_WORD];
+        const uint64_t cHigh = cOffset >> cLowBits;
+        // Zero h of the high bits ends bucket h, so values with a higher bucket than the last
+        // terminator are above every value.
+        if (cHigh >= cWords[UPPER_BITS_WORD] - cSize)
+        {
+            bucketBegin = cSize;
+            return cSize;
+        }
+
+        // Bucket h holds the values between zero h - 1 and zero h; its low bits are sorted. The
+        // end is usually in the same word as the start, else it takes a second select.
+        const uint64_t *const cUpper = cWords + cWords[UPPER_OFFSET_WORD];
+        const uint64_t cStart = cHigh ? SelectBit(static_cast<size_t>(cHigh - 1), false) + 1 : 0;
+        const uint64_t cZeros = ~cUpper[cStart / 64] & (~0ull << (cStart % 64));
+        const uint64_t cEnd = cZeros ? 64 * (cStart / 64) + HighestBit(cZeros & (0 - cZeros)) : SelectBit(static_cast<size_t>(cHigh), false);
+        size_t first = static_cast<size_t>(cStart - cHigh);
+        size_t last = static_cast<size_t>(cEnd - cHigh);
+        bucketBegin = first;
+        const uint64_t cLow = cLowBits ? cOffset & ((1ull << cLowBits) - 1) : 0;
+        while (first < last)
+        {
+            const size_t cMiddle = first + (last - first) / 2;
+            const uint64_t cMiddleLow = LowBits(cMiddle);
+            if (cMiddleLow < cLow || (cInclusive && cMiddleLow == cLow))
+            {
+                first = cMiddle + 1;
+            }
+            else
+            {
+                last = cMiddle;
+            }
+        }
+        return first;
+    } /* size_t EliasFano::CountBelow(const uint64_t &cValue, const bool &cInclusive, size_t &bucketBegin) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
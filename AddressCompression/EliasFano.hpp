@@ -0,0 +1,219 @@
+/**
+ * @file EliasFano.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFano (static monotone sequence with rank and select) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ELIASFANO_H
+#define ELIASFANO_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class EliasFano
+     * @brief A static sorted sequence of uint64 values in Elias-Fano encoding.
+     *
+     * Every value, less the smallest one, is split into its low L bits, stored verbatim in a
+     * packed array, and its high bits, stored in unary in a bit vector: value i sets bit
+     * (value >> L) + i. With L chosen as floor(log2(range / n)) the sequence takes at most
+     * 2 + L bits per value, within half a bit of the information-theoretic minimum for a sorted
+     * set. The positions of every 256th one and zero bit are sampled; a select starts at the
+     * nearest sample of either kind, so it scans at most a few words however the values cluster.
+     *
+     * All data lives in one array of 64-bit words that Serialize() writes as is. View() runs
+     * queries straight on such an image, e.g. a memory-mapped file, without copying it. View()
+     * only checks the header against the size, in constant time; an image from an untrusted
+     * source must also pass Validate(), which reads all of it, before it is queried.
+     */
+    class EliasFano
+    {
+    public:
+        /**
+         * @brief Default constructor. Creates an empty sequence.
+         */
+        EliasFano();
+
+        /**
+         * @brief Constructor for the EliasFano class.
+         * @param cValues The values in ascending order, duplicates allowed.
+         * @param cCount The number of values.
+         * @throws std::invalid_argument If the pointer is null and cCount is not zero, or the values are not sorted.
+         */
+        EliasFano(const uint64_t *cValues, const size_t &cCount);
+
+        /**
+         * @brief Returns the number of values.
+         * @return The number of values.
+         */
+        size_t Size() const { return static_cast<size_t>(Words()[SIZE_WORD]); }
+
+        /**
+         * @brief Returns the number of bytes of the encoded sequence, the same as the size of Serialize().
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return static_cast<size_t>(Words()[TOTAL_WORDS_WORD]) * sizeof(uint64_t); }
+
+        /**
+         * @brief Returns a value by position.
+         * @param cIndex The position, below Size().
+         * @return The value.
+         * @throws std::out_of_range If the position does not exist.
+         */
+        uint64_t Select(const size_t &cIndex) const;
+
+        /**
+         * @brief Counts the values below a value.
+         * @param cValue The value.
+         * @return The number of values less than cValue, which is also the position of its first occurrence.
+         */
+        size_t Rank(const uint64_t &cValue) const;
+
+        /**
+         * @brief Checks whether the sequence contains a value.
+         * @param cValue The value to look for.
+         * @return `true` if the value is in the sequence, `false` otherwise.
+         */
+        bool Contains(const uint64_t &cValue) const;
+
+        /**
+         * @brief Finds the greatest value not above a value.
+         * @param cValue The value.
+         * @param predecessor Receives the predecessor, if there is one.
+         * @return `true` if some value is less than or equal to cValue, `false` otherwise.
+         */
+        bool Predecessor(const uint64_t &cValue, uint64_t &predecessor) const;
+
+        /**
+         * @brief Serializes the sequence.
+         * @return The words of the sequence as bytes, readable by View() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const;
+
+        /**
+         * @brief Creates a sequence that queries serialized bytes in place.
+         * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the sequence and its copies.
+         * @param cSize The number of bytes.
+         * @return The sequence.
+         * @throws std::invalid_argument If the pointer is null or misaligned, or the header does not match the size.
+         */
+        static EliasFano View(const uint8_t *cData, const size_t &cSize);
+
+        /**
+         * @brief Checks the whole encoding: the bits, the samples and the shape. Linear in the size.
+         * @throws std::invalid_argument If the words are not what the constructor writes for their values.
+         */
+        void Validate() const;
+
+    private:
+        /**
+         * @brief Word indices of the header fields at the start of the words.
+         */
+        static constexpr size_t MAGIC_WORD = 0;
+        static constexpr size_t SIZE_WORD = 1;
+        static constexpr size_t BASE_WORD = 2;
+        static constexpr size_t LOW_BITS_WORD = 3;
+        static constexpr size_t UPPER_BITS_WORD = 4;
+        static constexpr size_t LOWER_OFFSET_WORD = 5;
+        static constexpr size_t UPPER_OFFSET_WORD = 6;
+        static constexpr size_t ONE_SAMPLES_OFFSET_WORD = 7;
+        static constexpr size_t ZERO_SAMPLES_OFFSET_WORD = 8;
+        static constexpr size_t TOTAL_WORDS_WORD = 9;
+        static constexpr size_t HEADER_WORDS = 10;
+
+        /**
+         * @brief Number of one (zero) bits between two samples of their positions.
+         */
+        static constexpr size_t SAMPLE_RATE = 256;
+
+        /**
+         * @brief Number of words a select scans before it skips ahead with the samples of the other kind.
+         */
+        static constexpr size_t SHORT_SCAN_WORDS = 4;
+
+        /**
+         * @brief The words of an owned sequence.
+         */
+        std::vector<uint64_t> _storage;
+
+        /**
+         * @brief The words of a viewed sequence, nullptr for an owned one.
+         */
+        const uint64_t *_view{};
+
+        /**
+         * @brief Returns the words of the sequence.
+         * @return The header, the low bits, the high bits and the samples.
+         */
+        const uint64_t *Words() const { return _view ? _view : _storage.data(); }
+
+        /**
+         * @brief Fills the header of the words from the shape of the sequence.
+         * @param cSize The number of values.
+         * @param cBase The smallest value.
+         * @param cLowBits The number of low bits per value.
+         * @param cUpperBits The number of bits of the high bit vector.
+         * @param header Receives HEADER_WORDS words.
+         */
+        static void FillHeader(const uint64_t &cSize, const uint64_t &cBase, const uint64_t &cLowBits, const uint64_t &cUpperBits, uint64_t *header);
+
+        /**
+         * @brief Returns the low bits of a value.
+         * @param cIndex The position of the value.
+         * @return The low bits.
+         */
+        uint64_t LowBits(const size_t &cIndex) const;
+
+        /**
+         * @brief Returns the position of a one or zero bit of the high bits.
+         * @param cRank The number of bits of the same kind before it.
+         * @param cOne `true` to look for a one bit, `false` for a zero bit.
+         * @return The bit position.
+         */
+        uint64_t SelectBit(const size_t &cRank, const bool &cOne) const;
+
+        /**
+         * @brief Counts the values below (or not above) a value.
+         * @param cValue The value.
+         * @param cInclusive `true` to count values equal to cValue too.
+         * @param bucketBegin Receives the position of the first value with the same high bits as cValue.
+         * @return The number of values less than (or not greater than) cValue.
+         */
+        size_t CountBelow(const uint64_t &cValue, const bool &cInclusive, size_t &bucketBegin) const;
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::EliasFano] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating unsorted input.
+         */
+        static constexpr char NOT_SORTED[]{"[EthernetParameter::EliasFano] Values are not sorted!"};
+
+        /**
+         * @brief Error message indicating a missing position.
+         */
+        static constexpr char INDEX_OUT_OF_RANGE[]{"[EthernetParameter::EliasFano] Index out of range!"};
+
+        /**
+         * @brief Error message indicating malformed serialized data.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::EliasFano] Invalid serialized data!"};
+    }; /* class EliasFano */
+}
+
+#endif /* ELIASFANO_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,91 @@
+/**
+ * @file EliasFanoIPv4Set.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFanoIPv4Set class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "EliasFanoIPv4Set.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the EliasFanoIPv4Set class.
+     * @param cAddresses The addresses in any order; duplicates are dropped.
+     */
+    EliasFanoIPv4Set::EliasFanoIPv4Set(const std::vector<IPv4Address> &cAddresses)
+    {
+        std::vector<uint64_t> values(cAddresses.size());
+        std::transform(cAddresses.begin(), cAddresses.end(), values.begin(), [](const IPv4Address &cAddress) { return cAddress.ToUint32(); });
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        _sequence = EliasFano(values.data(), values.size());
+    } /* EliasFanoIPv4Set::EliasFanoIPv4Set(const std::vector<IPv4Address> &cAddresses) */
+
+    /**
+     * @brief Returns an address by position in ascending order.
+     * @param cIndex The position, below Size().
+     * @return The address.
+     * @throw std::out_of_range If the position does not exist.
+     */
+    IPv4Address EliasFanoIPv4Set::Select(const size_t &cIndex) const
+    {
+        return IPv4Address::FromUint32(static_cast<uint32_t>(_sequence.Select(cIndex)));
+    } /* IPv4Address EliasFanoIPv4Set::Select(const size_t &cIndex) const */
+
+    /**
+     * @brief Finds the greatest address not above an address.
+     * @param cAddress The address.
+     * @param predecessor Receives the predecessor, if there is one.
+     * @return `true` if some address is less than or equal to cAddress, `false` otherwise.
+     */
+    bool EliasFanoIPv4Set::Predecessor(const IPv4Address &cAddress, IPv4Address &predecessor) const
+    {
+        uint64_t value{};
+        if (!_sequence.Predecessor(cAddress.ToUint32(), value))
+        {
+            return false;
+        }
+        predecessor = IPv4Address::FromUint32(static_cast<uint32_t>(value));
+        return true;
+    } /* bool EliasFanoIPv4Set::Predecessor(const IPv4Address &cAddress, IPv4Address &predecessor) const */
+
+    /**
+     * @brief Creates a set that queries serialized bytes in place.
+     * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the set and its copies.
+     * @param cSize The number of bytes.
+     * @return The set.
+     * @throw std::invalid_argument If the pointer is null or misaligned, or the header does not match the size.
+     */
+    EliasFanoIPv4Set EliasFanoIPv4Set::View(const uint8_t *cData, const size_t &cSize)
+    {
+        EliasFanoIPv4Set set;
+        set._sequence = EliasFano::View(cData, cSize);
+        return set;
+    } /* EliasFanoIPv4Set EliasFanoIPv4Set::View(const uint8_t *cData, const size_t &cSize) */
+
+    /**
+     * @brief Checks the whole encoding and that every value fits into 32 bits.
+     * @throw std::invalid_argument If the set is not a valid IPv4 set.
+     */
+    void EliasFanoIPv4Set::Validate() const
+    {
+        _sequence.Validate();
+        if (Size() && _sequence.Select(Size() - 1) > UINT32_MAX)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+    } /* void EliasFanoIPv4Set::Validate() const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
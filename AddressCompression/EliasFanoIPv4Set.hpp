@@ -0,0 +1,130 @@
+/**
+ * @file EliasFanoIPv4Set.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFanoIPv4Set (static IPv4 address set with rank and select) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ELIASFANOIPV4SET_H
+#define ELIASFANOIPV4SET_H
+#include "EliasFano.hpp"
+#include "IPv4Address/IPv4Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class EliasFanoIPv4Set
+     * @brief An immutable set of IPv4 addresses in Elias-Fano encoding.
+     *
+     * Unlike CompressedIPv4List, which decodes a whole block per lookup, the set answers
+     * Contains(), Rank(), Select() and Predecessor() straight on the encoded bits. A set of n
+     * addresses takes about 2 + log2(2^32 / n) bits per address, e.g. 10 bits for a million.
+     *
+     * Serialize() writes one flat image of 64-bit words; View() queries such an image in place,
+     * so a set can be memory-mapped from a file and used without loading it. View() only checks
+     * the header; call Validate() before querying an image from an untrusted source.
+     */
+    class EliasFanoIPv4Set
+    {
+    public:
+        /**
+         * @brief Default constructor. Creates an empty set.
+         */
+        EliasFanoIPv4Set() = default;
+
+        /**
+         * @brief Constructor for the EliasFanoIPv4Set class.
+         * @param cAddresses The addresses in any order; duplicates are dropped.
+         */
+        explicit EliasFanoIPv4Set(const std::vector<IPv4Address> &cAddresses);
+
+        /**
+         * @brief Returns the number of addresses.
+         * @return The number of addresses.
+         */
+        size_t Size() const { return _sequence.Size(); }
+
+        /**
+         * @brief Returns the number of bytes of the encoded set, the same as the size of Serialize().
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return _sequence.SizeInBytes(); }
+
+        /**
+         * @brief Checks whether the set contains an address.
+         * @param cAddress The address to look for.
+         * @return `true` if the address is in the set, `false` otherwise.
+         */
+        bool Contains(const IPv4Address &cAddress) const { return _sequence.Contains(cAddress.ToUint32()); }
+
+        /**
+         * @brief Counts the addresses below an address.
+         * @param cAddress The address.
+         * @return The number of addresses less than cAddress.
+         */
+        size_t Rank(const IPv4Address &cAddress) const { return _sequence.Rank(cAddress.ToUint32()); }
+
+        /**
+         * @brief Returns an address by position in ascending order.
+         * @param cIndex The position, below Size().
+         * @return The address.
+         * @throws std::out_of_range If the position does not exist.
+         */
+        IPv4Address Select(const size_t &cIndex) const;
+
+        /**
+         * @brief Finds the greatest address not above an address.
+         * @param cAddress The address.
+         * @param predecessor Receives the predecessor, if there is one.
+         * @return `true` if some address is less than or equal to cAddress, `false` otherwise.
+         */
+        bool Predecessor(const IPv4Address &cAddress, IPv4Address &predecessor) const;
+
+        /**
+         * @brief Serializes the set.
+         * @return The encoded set as bytes, readable by View() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const { return _sequence.Serialize(); }
+
+        /**
+         * @brief Creates a set that queries serialized bytes in place.
+         * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the set and its copies.
+         * @param cSize The number of bytes.
+         * @return The set.
+         * @throws std::invalid_argument If the pointer is null or misaligned, or the header does not match the size.
+         */
+        static EliasFanoIPv4Set View(const uint8_t *cData, const size_t &cSize);
+
+        /**
+         * @brief Checks the whole encoding, see EliasFano::Validate(), and that every value fits into 32 bits.
+         * @throws std::invalid_argument If the set is not a valid IPv4 set.
+         */
+        void Validate() const;
+
+    private:
+        /**
+         * @brief The addresses as host-order integers.
+         */
+        EliasFano _sequence;
+
+        /**
+         * @brief Error message indicating a sequence that is not an IPv4 set.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::EliasFanoIPv4Set] Invalid serialized data!"};
+    }; /* class EliasFanoIPv4Set */
+}
+
+#endif /* ELIASFANOIPV4SET_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
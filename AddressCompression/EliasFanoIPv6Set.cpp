@@ -0,0 +1,77 @@
+/**
+ * @file EliasFanoIPv6Set.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFanoIPv6Set class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "EliasFanoIPv6Set.hpp"
+#include <algorithm>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the EliasFanoIPv6Set class.
+     * @param cAddresses The addresses in any order; only their /64 networks are kept, once each.
+     */
+    EliasFanoIPv6Set::EliasFanoIPv6Set(const std::vector<IPv6Address> &cAddresses)
+    {
+        std::vector<uint64_t> values(cAddresses.size());
+        std::transform(cAddresses.begin(), cAddresses.end(), values.begin(), [](const IPv6Address &cAddress) { return cAddress.GetUpper64(); });
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        _sequence = EliasFano(values.data(), values.size());
+    } /* EliasFanoIPv6Set::EliasFanoIPv6Set(const std::vector<IPv6Address> &cAddresses) */
+
+    /**
+     * @brief Returns a network by position in ascending order.
+     * @param cIndex The position, below Size().
+     * @return The network address, with the lower 64 bits zero.
+     * @throw std::out_of_range If the position does not exist.
+     */
+    IPv6Address EliasFanoIPv6Set::Select(const size_t &cIndex) const
+    {
+        return IPv6Address::FromUint64(_sequence.Select(cIndex), 0);
+    } /* IPv6Address EliasFanoIPv6Set::Select(const size_t &cIndex) const */
+
+    /**
+     * @brief Finds the greatest network not above the /64 network of an address.
+     * @param cAddress The address.
+     * @param predecessor Receives the predecessor network address, if there is one.
+     * @return `true` if some network is less than or equal to that of cAddress, `false` otherwise.
+     */
+    bool EliasFanoIPv6Set::Predecessor(const IPv6Address &cAddress, IPv6Address &predecessor) const
+    {
+        uint64_t value{};
+        if (!_sequence.Predecessor(cAddress.GetUpper64(), value))
+        {
+            return false;
+        }
+        predecessor = IPv6Address::FromUint64(value, 0);
+        return true;
+    } /* bool EliasFanoIPv6Set::Predecessor(const IPv6Address &cAddress, IPv6Address &predecessor) const */
+
+    /**
+     * @brief Creates a set that queries serialized bytes in place.
+     * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the set and its copies.
+     * @param cSize The number of bytes.
+     * @return The set.
+     * @throw std::invalid_argument If the pointer is null or misaligned, or the bytes are not a valid sequence.
+     */
+    EliasFanoIPv6Set EliasFanoIPv6Set::View(const uint8_t *cData, const size_t &cSize)
+    {
+        EliasFanoIPv6Set set;
+        set._sequence = EliasFano::View(cData, cSize);
+        return set;
+    } /* EliasFanoIPv6Set EliasFanoIPv6Set::View(const uint8_t *cData, const size_t &cSize) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,127 @@
+/**
+ * @file EliasFanoIPv6Set.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EliasFanoIPv6Set (static set of IPv6 /64 networks with rank and select) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ELIASFANOIPV6SET_H
+#define ELIASFANOIPV6SET_H
+#include "EliasFano.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class EliasFanoIPv6Set
+     * @brief An immutable set of IPv6 /64 networks in Elias-Fano encoding.
+     *
+     * The keys are the upper 64 bits of the addresses, which is what routing, blocklists and
+     * rate limits key IPv6 on: Contains() tells whether the /64 of an address is in the set, and
+     * Select() and Predecessor() return networks with the interface identifier cleared. The
+     * queries run straight on the encoded bits; a set of n networks takes about
+     * 2 + log2(max / n) bits per network, e.g. 14 bits for a million /64s spread over a /32.
+     *
+     * Serialize() writes one flat image of 64-bit words; View() queries such an image in place,
+     * so a set can be memory-mapped from a file and used without loading it. View() only checks
+     * the header; call Validate() before querying an image from an untrusted source.
+     */
+    class EliasFanoIPv6Set
+    {
+    public:
+        /**
+         * @brief Default constructor. Creates an empty set.
+         */
+        EliasFanoIPv6Set() = default;
+
+        /**
+         * @brief Constructor for the EliasFanoIPv6Set class.
+         * @param cAddresses The addresses in any order; only their /64 networks are kept, once each.
+         */
+        explicit EliasFanoIPv6Set(const std::vector<IPv6Address> &cAddresses);
+
+        /**
+         * @brief Returns the number of networks.
+         * @return The number of networks.
+         */
+        size_t Size() const { return _sequence.Size(); }
+
+        /**
+         * @brief Returns the number of bytes of the encoded set, the same as the size of Serialize().
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return _sequence.SizeInBytes(); }
+
+        /**
+         * @brief Checks whether the set contains the /64 network of an address.
+         * @param cAddress The address to look for.
+         * @return `true` if its network is in the set, `false` otherwise.
+         */
+        bool Contains(const IPv6Address &cAddress) const { return _sequence.Contains(cAddress.GetUpper64()); }
+
+        /**
+         * @brief Counts the networks below the /64 network of an address.
+         * @param cAddress The address.
+         * @return The number of networks less than its network.
+         */
+        size_t Rank(const IPv6Address &cAddress) const { return _sequence.Rank(cAddress.GetUpper64()); }
+
+        /**
+         * @brief Returns a network by position in ascending order.
+         * @param cIndex The position, below Size().
+         * @return The network address, with the lower 64 bits zero.
+         * @throws std::out_of_range If the position does not exist.
+         */
+        IPv6Address Select(const size_t &cIndex) const;
+
+        /**
+         * @brief Finds the greatest network not above the /64 network of an address.
+         * @param cAddress The address.
+         * @param predecessor Receives the predecessor network address, if there is one.
+         * @return `true` if some network is less than or equal to that of cAddress, `false` otherwise.
+         */
+        bool Predecessor(const IPv6Address &cAddress, IPv6Address &predecessor) const;
+
+        /**
+         * @brief Serializes the set.
+         * @return The encoded set as bytes, readable by View() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const { return _sequence.Serialize(); }
+
+        /**
+         * @brief Creates a set that queries serialized bytes in place.
+         * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the set and its copies.
+         * @param cSize The number of bytes.
+         * @return The set.
+         * @throws std::invalid_argument If the pointer is null or misaligned, or the header does not match the size.
+         */
+        static EliasFanoIPv6Set View(const uint8_t *cData, const size_t &cSize);
+
+        /**
+         * @brief Checks the whole encoding, see EliasFano::Validate().
+         * @throws std::invalid_argument If the set is not a valid encoding.
+         */
+        void Validate() const { _sequence.Validate(); }
+
+    private:
+        /**
+         * @brief The upper 64 bits of the networks.
+         */
+        EliasFano _sequence;
+    }; /* class EliasFanoIPv6Set */
+}
+
+#endif /* ELIASFANOIPV6SET_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,200 @@
+/**
+ * @file AddressFormat.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressFormat (format specs and allocation-free address text) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressFormat.hpp"
+#include <array>
+#include <cstring>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Hex digits in both cases.
+         */
+        constexpr char LOWER_HEX_DIGITS[]{"0123456789abcdef"};
+        constexpr char UPPER_HEX_DIGITS[]{"0123456789ABCDEF"};
+
+        /**
+         * @brief Text of one octet: the digits without leading zeros followed by a dot, and their count.
+         */
+        struct DecimalOctet
+        {
+            char text[4];
+            uint8_t length;
+        };
+
+        /**
+         * @brief Builds the octet texts for 0-255.
+         * @return The table.
+         */
+        constexpr std::array<DecimalOctet, 256> MakeDecimalOctets()
+        {
+            std::array<DecimalOctet, 256> table{};
+            for (size_t i = 0; i < 256; i++)
+            {
+                DecimalOctet &octet = table[i];
+                const char cDigits[3]{static_cast<char>('0' + i / 100), static_cast<char>('0' + i / 10 % 10), static_cast<char>('0' + i % 10)};
+                const size_t cSkipped = i < 10 ? 2 : i < 100 ? 1 : 0;
+                for (size_t digit = cSkipped; digit < 3; digit++)
+                {
+                    octet.text[octet.length++] = cDigits[digit];
+                }
+                octet.text[octet.length] = '.';
+            }
+            return table;
+        }
+
+        /**
+         * @brief The octet texts, so an octet takes one 4-byte copy.
+         */
+        constexpr std::array<DecimalOctet, 256> DECIMAL_OCTETS = MakeDecimalOctets();
+
+        /**
+         * @brief Writes one 16-bit group in hex.
+         * @param cGroup The group.
+         * @param cPadded `true` to write four digits, otherwise no leading zeros.
+         * @param cDigits The hex digits, lower or upper case.
+         * @param output Receives the digits.
+         * @return The end of the digits.
+         */
+        char *WriteGroup(const uint16_t &cGroup, const bool &cPadded, const char *cDigits, char *output)
+        {
+            int shift = 12;
+            if (!cPadded)
+            {
+                while (shift > 0 && !(cGroup >> shift))
+                {
+                    shift -= 4;
+                }
+            }
+            for (; shift >= 0; shift -= 4)
+            {
+                *output++ = cDigits[cGroup >> shift & 0xF];
+            }
+            return output;
+        }
+    }
+
+    /**
+     * @brief Writes the text of an IPv4 address, without the width padding.
+     * @param cAddress The address.
+     * @param cSpec The spec.
+     * @param output Receives the text; at least MAX_LENGTH bytes.
+     * @return The length of the text.
+     */
+    size_t AddressFormat::Write(const IPv4Address &cAddress, const Spec &cSpec, char *output)
+    {
+        const uint32_t cValue = cAddress.ToUint32();
+        char *end = output;
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            const uint8_t cOctet = static_cast<uint8_t>(cValue >> shift);
+            if (cSpec.padded)
+            {
+                end[0] = static_cast<char>('0' + cOctet / 100);
+                end[1] = static_cast<char>('0' + cOctet / 10 % 10);
+                end[2] = static_cast<char>('0' + cOctet % 10);
+                end[3] = '.';
+                end += 4;
+            }
+            else
+            {
+                // The copy may store past the text; the last dot is at most the 15th of MAX_LENGTH bytes.
+                const DecimalOctet &cText = DECIMAL_OCTETS[cOctet];
+                std::memcpy(end, cText.text, sizeof(cText.text));
+                end += cText.length + 1;
+            }
+        }
+        return static_cast<size_t>(end - output) - 1;
+    } /* size_t AddressFormat::Write(const IPv4Address &cAddress, const Spec &cSpec, char *output) */
+
+    /**
+     * @brief Writes the text of an IPv6 address, without the width padding.
+     *
+     * The compressed form follows RFC 5952: no leading zeros, the longest run of two or more zero
+     * groups (the first of equal runs) replaced by "::", and IPv4-mapped addresses written with the
+     * embedded IPv4 address in dotted decimal ("::ffff:192.0.2.1", section 5).
+     *
+     * @param cAddress The address.
+     * @param cSpec The spec.
+     * @param output Receives the text; at least MAX_LENGTH bytes.
+     * @return The length of the text.
+     */
+    size_t AddressFormat::Write(const IPv6Address &cAddress, const Spec &cSpec, char *output)
+    {
+        const uint64_t cHalves[2]{cAddress.GetUpper64(), cAddress.GetLower64()};
+        uint16_t groups[8];
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            groups[i] = static_cast<uint16_t>(cHalves[i / 4] >> (48 - 16 * (i % 4)));
+        }
+        const char *cDigits = cSpec.uppercase ? UPPER_HEX_DIGITS : LOWER_HEX_DIGITS;
+
+        if (cSpec.compressed && !cHalves[0] && cHalves[1] >> 32 == 0xFFFF)
+        {
+            char *end = output;
+            *end++ = ':';
+            *end++ = ':';
+            end = WriteGroup(0xFFFF, false, cDigits, end);
+            *end++ = ':';
+            return static_cast<size_t>(end - output) + Write(IPv4Address::FromUint32(static_cast<uint32_t>(cHalves[1])), Spec{}, end);
+        }
+
+        // The run of zero groups to replace by "::"; none in the expanded form.
+        uint8_t runStart{8};
+        uint8_t runLength{1};
+        if (cSpec.compressed)
+        {
+            for (uint8_t i = 0; i < 8;)
+            {
+                uint8_t length{};
+                while (i + length < 8 && !groups[i + length])
+                {
+                    length++;
+                }
+                if (length > runLength)
+                {
+                    runStart = i;
+                    runLength = length;
+                }
+                i = static_cast<uint8_t>(i + (length ? length : 1));
+            }
+        }
+
+        char *end = output;
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            if (i == runStart)
+            {
+                *end++ = ':';
+                i = static_cast<uint8_t>(i + runLength - 1);
+                if (i == 7)
+                {
+                    *end++ = ':';
+                }
+                continue;
+            }
+            if (i)
+            {
+                *end++ = ':';
+            }
+            end = WriteGroup(groups[i], !cSpec.compressed, cDigits, end);
+        }
+        return static_cast<size_t>(end - output);
+    } /* size_t AddressFormat::Write(const IPv6Address &cAddress, const Spec &cSpec, char *output) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,221 @@
+/**
+ * @file AddressFormat.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressFormat (format specs and allocation-free address text) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSFORMAT_H
+#define ADDRESSFORMAT_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressFormat
+     * @brief Parses format specs and writes address text into a caller's buffer, for the formatters in AddressFormatter.hpp.
+     *
+     * A spec is `[[fill]align][width][flags]` as in std::format: align is '<', '>' or '^' (left
+     * by default), width pads the text with the fill character (space by default). The flags are
+     *
+     * - IPv4Address: 'p' padded, every octet written with three digits ("010.000.000.001").
+     * - IPv6Address: 'e' expanded, eight groups of four digits as ToString() writes them (the
+     *   default); 'c' compressed as RFC 5952 recommends ("2001:db8::1", IPv4-mapped addresses as
+     *   "::ffff:192.0.2.1"); 'U' uppercase hex.
+     *
+     * Without flags the text is the same as operator<< writes.
+     */
+    class AddressFormat
+    {
+    public:
+        /**
+         * @brief Alignment of the text within the width.
+         */
+        enum class Align : uint8_t
+        {
+            Left,
+            Right,
+            Center
+        };
+
+        /**
+         * @brief A parsed format spec.
+         */
+        struct Spec
+        {
+            char fill{' '};
+            Align align{Align::Left};
+            size_t width{};
+            bool padded{};
+            bool compressed{};
+            bool uppercase{};
+        };
+
+        /**
+         * @brief Longest address text, without the width padding.
+         */
+        static constexpr size_t MAX_LENGTH = 39;
+
+        /**
+         * @brief Flags accepted for IPv4Address.
+         */
+        static constexpr char IPV4_FLAGS[]{"p"};
+
+        /**
+         * @brief Flags accepted for IPv6Address.
+         */
+        static constexpr char IPV6_FLAGS[]{"ecU"};
+
+        /**
+         * @brief Parses a format spec, up to the closing '}' or the end.
+         *
+         * Usable in constant expressions, so std::format can check the spec at compile time.
+         *
+         * @tparam Iterator The character iterator of the format string.
+         * @param position The start of the spec; receives the position of the closing '}' or the end.
+         * @param cEnd The end of the format string.
+         * @param cFlags The accepted flags, IPV4_FLAGS or IPV6_FLAGS.
+         * @param spec Receives the spec.
+         * @return nullptr on success, otherwise the error message.
+         */
+        template <typename Iterator>
+        static constexpr const char *Parse(Iterator &position, const Iterator &cEnd, const char *cFlags, Spec &spec);
+
+        /**
+         * @brief Writes the text of an IPv4 address, without the width padding.
+         * @param cAddress The address.
+         * @param cSpec The spec.
+         * @param output Receives the text; at least MAX_LENGTH bytes.
+         * @return The length of the text.
+         */
+        static size_t Write(const IPv4Address &cAddress, const Spec &cSpec, char *output);
+
+        /**
+         * @brief Writes the text of an IPv6 address, without the width padding.
+         * @param cAddress The address.
+         * @param cSpec The spec.
+         * @param output Receives the text; at least MAX_LENGTH bytes.
+         * @return The length of the text.
+         */
+        static size_t Write(const IPv6Address &cAddress, const Spec &cSpec, char *output);
+
+        /**
+         * @brief Writes text to an output iterator, padded to the width of a spec.
+         * @tparam OutputIt The output iterator.
+         * @tparam Text Callable writing the text to an OutputIt and returning the iterator past it.
+         * @param output The output iterator.
+         * @param cLength The length of the text.
+         * @param cSpec The spec.
+         * @param cText Writes the text.
+         * @return The output iterator past the padded text.
+         */
+        template <typename OutputIt, typename Text>
+        static OutputIt Pad(OutputIt output, const size_t &cLength, const Spec &cSpec, const Text &cText);
+
+    private:
+        /**
+         * @brief Returns whether a character is in a null-terminated list.
+         * @param cCharacter The character.
+         * @param cList The list.
+         * @return `true` if it is.
+         */
+        static constexpr bool Contains(const char &cCharacter, const char *cList);
+
+        /**
+         * @brief Error message indicating a flag the address type does not accept.
+         */
+        static constexpr char INVALID_FLAG[]{"[EthernetParameter::AddressFormat] Invalid format flag!"};
+
+        /**
+         * @brief Error message indicating flags that exclude each other.
+         */
+        static constexpr char CONFLICTING_FLAGS[]{"[EthernetParameter::AddressFormat] Conflicting format flags!"};
+
+        /**
+         * @brief Error message indicating a width that does not fit.
+         */
+        static constexpr char INVALID_WIDTH[]{"[EthernetParameter::AddressFormat] Invalid format width!"};
+    }; /* class AddressFormat */
+
+    template <typename Iterator>
+    constexpr const char *AddressFormat::Parse(Iterator &position, const Iterator &cEnd, const char *cFlags, Spec &spec)
+    {
+        spec = Spec{};
+        const auto cAlign = [](const char &cCharacter, Align &align) {
+            align = cCharacter == '>' ? Align::Right : cCharacter == '^' ? Align::Center : Align::Left;
+            return cCharacter == '<' || cCharacter == '>' || cCharacter == '^';
+        };
+
+        // A fill character is only recognised in front of an align character.
+        Iterator next = position;
+        if (position != cEnd && ++next != cEnd && *position != '{' && *position != '}' && cAlign(*next, spec.align))
+        {
+            spec.fill = *position;
+            position = ++next;
+        }
+        else if (position != cEnd && cAlign(*position, spec.align))
+        {
+            ++position;
+        }
+
+        for (; position != cEnd && *position >= '0' && *position <= '9'; ++position)
+        {
+            if (spec.width > 0xFFFF)
+            {
+                return INVALID_WIDTH;
+            }
+            spec.width = spec.width * 10 + static_cast<size_t>(*position - '0');
+        }
+
+        bool expanded{};
+        for (; position != cEnd && *position != '}'; ++position)
+        {
+            if (!Contains(*position, cFlags))
+            {
+                return INVALID_FLAG;
+            }
+            spec.padded |= *position == 'p';
+            expanded |= *position == 'e';
+            spec.compressed |= *position == 'c';
+            spec.uppercase |= *position == 'U';
+        }
+        return spec.compressed && expanded ? CONFLICTING_FLAGS : nullptr;
+    } /* const char *AddressFormat::Parse(Iterator &position, const Iterator &cEnd, const char *cFlags, Spec &spec) */
+
+    template <typename OutputIt, typename Text>
+    OutputIt AddressFormat::Pad(OutputIt output, const size_t &cLength, const Spec &cSpec, const Text &cText)
+    {
+        const size_t cPadding = cSpec.width > cLength ? cSpec.width - cLength : 0;
+        const size_t cBefore = cSpec.align == Align::Right ? cPadding : cSpec.align == Align::Center ? cPadding / 2 : 0;
+        output = cText(std::fill_n(output, cBefore, cSpec.fill));
+        return std::fill_n(output, cPadding - cBefore, cSpec.fill);
+    } /* OutputIt AddressFormat::Pad(OutputIt output, const size_t &cLength, const Spec &cSpec, const Text &cText) */
+
+    constexpr bool AddressFormat::Contains(const char &cCharacter, const char *cList)
+    {
+        for (; *cList; cList++)
+        {
+            if (*cList == cCharacter)
+            {
+                return true;
+            }
+        }
+        return false;
+    } /* bool AddressFormat::Contains(const char &cCharacter, const char *cList) */
+}
+
+#endif /* ADDRESSFORMAT_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,135 @@
+/**
+ * @file AddressFormatter.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief std::formatter and fmt::formatter specialisations for IPv4Address and IPv6Address.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * The std::formatter specialisations are defined when the standard library has <format>
+ * (C++20); the fmt::formatter ones when ETHERNET_PARAMETER_WITH_FMT is defined, which the
+ * ADDRESS_FORMAT_LIBRARY target does when CMake finds {fmt}. Both write the text straight to
+ * the output iterator; see AddressFormat for the spec syntax.
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSFORMATTER_H
+#define ADDRESSFORMATTER_H
+#include "AddressFormat.hpp"
+#include <string_view>
+#include <type_traits>
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+#if defined(ETHERNET_PARAMETER_WITH_FMT)
+#include <fmt/format.h>
+#endif
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressFormatter
+     * @brief The parse() and format() members shared by the std and fmt formatters.
+     *
+     * The text goes out through the string formatter of the library, which appends it to a
+     * contiguous buffer at once instead of one character at a time.
+     *
+     * @tparam Address IPv4Address or IPv6Address.
+     * @tparam Error The exception type of the formatting library.
+     * @tparam TextFormatter The std::string_view formatter of the formatting library.
+     */
+    template <typename Address, typename Error, typename TextFormatter>
+    class AddressFormatter
+    {
+    public:
+        /**
+         * @brief Parses the format spec.
+         * @tparam ParseContext The parse context of the formatting library.
+         * @param ctx The parse context.
+         * @return The position of the closing '}'.
+         * @throws Error If the spec is invalid.
+         */
+        template <typename ParseContext>
+        constexpr auto parse(ParseContext &ctx)
+        {
+            auto position = ctx.begin();
+            const char *cError = AddressFormat::Parse(position, ctx.end(), FLAGS, _spec);
+            if (cError)
+            {
+                throw Error(cError);
+            }
+            return position;
+        }
+
+        /**
+         * @brief Writes the address to the output of the format context.
+         * @tparam FormatContext The format context of the formatting library.
+         * @param cAddress The address.
+         * @param ctx The format context.
+         * @return The output iterator past the text.
+         */
+        template <typename FormatContext>
+        auto format(const Address &cAddress, FormatContext &ctx) const
+        {
+            char text[AddressFormat::MAX_LENGTH];
+            const size_t cLength = AddressFormat::Write(cAddress, _spec, text);
+            return AddressFormat::Pad(ctx.out(), cLength, _spec, [&](const auto &cOutput) {
+                ctx.advance_to(cOutput);
+                return TextFormatter().format(std::string_view(text, cLength), ctx);
+            });
+        }
+
+    private:
+        /**
+         * @brief The flags of the address type.
+         */
+        static constexpr const char *FLAGS = std::is_same<Address, IPv4Address>::value ? AddressFormat::IPV4_FLAGS : AddressFormat::IPV6_FLAGS;
+
+        /**
+         * @brief The parsed spec.
+         */
+        AddressFormat::Spec _spec{};
+    }; /* class AddressFormatter */
+}
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+    template <>
+    struct formatter<EthernetParameter::IPv4Address, char> : EthernetParameter::AddressFormatter<EthernetParameter::IPv4Address, std::format_error, std::formatter<std::string_view, char>>
+    {
+    };
+
+    template <>
+    struct formatter<EthernetParameter::IPv6Address, char> : EthernetParameter::AddressFormatter<EthernetParameter::IPv6Address, std::format_error, std::formatter<std::string_view, char>>
+    {
+    };
+}
+#endif
+
+#if defined(ETHERNET_PARAMETER_WITH_FMT)
+namespace fmt
+{
+    template <>
+    struct formatter<EthernetParameter::IPv4Address, char> : EthernetParameter::AddressFormatter<EthernetParameter::IPv4Address, fmt::format_error, fmt::formatter<std::string_view, char>>
+    {
+    };
+
+    template <>
+    struct formatter<EthernetParameter::IPv6Address, char> : EthernetParameter::AddressFormatter<EthernetParameter::IPv6Address, fmt::format_error, fmt::formatter<std::string_view, char>>
+    {
+    };
+}
+#endif
+
+#endif /* ADDRESSFORMATTER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,518 @@
+/**
+ * @file AddressSetOperations.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressSetOperations class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressSetOperations.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ADDRESS_SET_OPERATIONS_SSE2
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ADDRESS_SET_OPERATIONS_AVX2
+#define ADDRESS_SET_OPERATIONS_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define ADDRESS_SET_OPERATIONS_AVX2
+#define ADDRESS_SET_OPERATIONS_AVX2_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Addresses per thread below which an operation runs on the calling thread only.
+         */
+        constexpr size_t MIN_ADDRESSES_PER_THREAD = 1u << 16;
+
+        /**
+         * @brief The set operations.
+         */
+        enum class Operation : uint8_t
+        {
+            INTERSECTION,
+            DIFFERENCE,
+            UNION
+        };
+
+        /**
+         * @brief Returns the number of threads for an operation.
+         * @param cThreads The requested number of threads, 0 for the number of hardware threads.
+         * @param cCount The number of addresses of both inputs.
+         * @return The number of threads, at least 1.
+         */
+        size_t ThreadCount(const size_t &cThreads, const size_t &cCount)
+        {
+            const size_t cWanted = cThreads != 0 ? cThreads : (std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1);
+            return std::max<size_t>(1, std::min(cWanted, cCount / MIN_ADDRESSES_PER_THREAD));
+        }
+
+        /**
+         * @brief Merges two strictly increasing arrays with the standard algorithm of an operation.
+         * @tparam Op The operation.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result.
+         * @return The number of addresses written.
+         */
+        template <Operation Op, typename Address>
+        size_t Merge(const Address *cLeft, const size_t &cLeftCount, const Address *cRight, const size_t &cRightCount, Address *output)
+        {
+            if (Op == Operation::INTERSECTION)
+            {
+                return static_cast<size_t>(std::set_intersection(cLeft, cLeft + cLeftCount, cRight, cRight + cRightCount, output) - output);
+            }
+            if (Op == Operation::DIFFERENCE)
+            {
+                return static_cast<size_t>(std::set_difference(cLeft, cLeft + cLeftCount, cRight, cRight + cRightCount, output) - output);
+            }
+            return static_cast<size_t>(std::set_union(cLeft, cLeft + cLeftCount, cRight, cRight + cRightCount, output) - output);
+        }
+
+        /**
+         * @brief Writes the addresses of a finished left block that the operation keeps.
+         * @tparam Op Operation::INTERSECTION or Operation::DIFFERENCE.
+         * @tparam Block The number of addresses of the block.
+         * @param cBlock The block.
+         * @param cMatched Bit i set if address i of the block is in the right input.
+         * @param output Receives the addresses.
+         * @return The number of addresses written.
+         */
+        template <Operation Op, size_t Block>
+        inline size_t WriteBlock(const IPv4Address *cBlock, const uint32_t &cMatched, IPv4Address *output)
+        {
+            const uint32_t cKeep = Op == Operation::INTERSECTION ? cMatched : ~cMatched;
+            size_t count{};
+            for (size_t i = 0; i < Block; i++)
+            {
+                output[count] = cBlock[i];
+                count += (cKeep >> i) & 1;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Finishes a left block still open when the right blocks ran out.
+         *
+         * Its earlier matches stand, the rest of its addresses are looked up in the remaining
+         * right addresses. Without earlier matches the scalar merge gives the same result, so the
+         * block is left to it.
+         *
+         * @tparam Op Operation::INTERSECTION or Operation::DIFFERENCE.
+         * @tparam Block The number of addresses of the block.
+         * @param cLeft The first input.
+         * @param left The index of the open block; moves past it.
+         * @param cRight The second input.
+         * @param right The index of the first right address not yet passed; moves on.
+         * @param cRightEnd The number of addresses of the second input.
+         * @param cMatched The matches of the block so far.
+         * @param output Receives the addresses.
+         * @return The number of addresses written.
+         */
+        template <Operation Op, size_t Block>
+        size_t FinishOpenBlock(const IPv4Address *cLeft, size_t &left, const IPv4Address *cRight, size_t &right, const size_t &cRightEnd, const uint32_t &cMatched,
+                               IPv4Address *output)
+        {
+            if (cMatched == 0)
+            {
+                return 0;
+            }
+            size_t count{};
+            for (size_t i = 0; i < Block; i++)
+            {
+                const uint32_t cValue = cLeft[left + i].ToUint32();
+                bool found = (cMatched >> i) & 1;
+                if (!found)
+                {
+                    while (right < cRightEnd && cRight[right].ToUint32() < cValue)
+                    {
+                        right++;
+                    }
+                    found = right < cRightEnd && cRight[right].ToUint32() == cValue;
+                }
+                output[count] = cLeft[left + i];
+                count += Op == Operation::INTERSECTION ? found : !found;
+            }
+            left += Block;
+            return count;
+        }
+
+        /**
+         * @brief Intersection or difference of strictly increasing IPv4 arrays.
+         *
+         * This is the reference every SIMD variant must match: the standard algorithm.
+         */
+        template <Operation Op>
+        size_t MergeIPv4Scalar(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output)
+        {
+            return Merge<Op>(cLeft, cLeftCount, cRight, cRightCount, output);
+        }
+
+#if defined(ADDRESS_SET_OPERATIONS_SSE2)
+        /**
+         * @brief Intersection or difference of strictly increasing IPv4 arrays, four by four addresses.
+         *
+         * Blocks of four addresses of both inputs are compared all against all: the right block is
+         * compared with the left block in four rotations. Equality does not depend on the byte
+         * order, so the addresses are compared as loaded. The matches of a left block accumulate
+         * over the right blocks until the block with the larger last address moves on; the block
+         * whose last address is not larger is done and advances.
+         *
+         * @tparam Op Operation::INTERSECTION or Operation::DIFFERENCE.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result.
+         * @return The number of addresses written.
+         */
+        template <Operation Op>
+        size_t MergeIPv4Sse2(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output)
+        {
+            static_assert(sizeof(IPv4Address) == sizeof(uint32_t), "IPv4Address must be four octets");
+            // Addresses are stored as bytes, so every output write could alias a referenced count.
+            const size_t cLeftEnd = cLeftCount;
+            const size_t cRightEnd = cRightCount;
+            size_t left{};
+            size_t right{};
+            size_t count{};
+            uint32_t matched{};
+            while (left + 4 <= cLeftEnd && right + 4 <= cRightEnd)
+            {
+                const __m128i cLeftBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cLeft + left));
+                const __m128i cRightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cRight + right));
+                const __m128i cEqual = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(cLeftBlock, cRightBlock),
+                                                                 _mm_cmpeq_epi32(cLeftBlock, _mm_shuffle_epi32(cRightBlock, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                                    _mm_or_si128(_mm_cmpeq_epi32(cLeftBlock, _mm_shuffle_epi32(cRightBlock, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                                 _mm_cmpeq_epi32(cLeftBlock, _mm_shuffle_epi32(cRightBlock, _MM_SHUFFLE(2, 1, 0, 3)))));
+                matched |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(cEqual)));
+
+                const uint32_t cLeftLast = cLeft[left + 3].ToUint32();
+                const uint32_t cRightLast = cRight[right + 3].ToUint32();
+                if (cLeftLast <= cRightLast)
+                {
+                    count += WriteBlock<Op, 4>(cLeft + left, matched, output + count);
+                    left += 4;
+                    matched = 0;
+                }
+                right += cRightLast <= cLeftLast ? 4 : 0;
+            }
+            count += FinishOpenBlock<Op, 4>(cLeft, left, cRight, right, cRightEnd, matched, output + count);
+            return count + Merge<Op>(cLeft + left, cLeftEnd - left, cRight + right, cRightEnd - right, output + count);
+        }
+#endif
+
+#if defined(ADDRESS_SET_OPERATIONS_AVX2)
+        /**
+         * @brief MergeIPv4Sse2() with blocks of eight addresses.
+         *
+         * Each address of the right block is broadcast and compared with the whole left block,
+         * all 64 pairs in eight compares.
+         */
+        template <Operation Op>
+        ADDRESS_SET_OPERATIONS_AVX2_TARGET size_t MergeIPv4Avx2(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount,
+                                                                IPv4Address *output)
+        {
+            const size_t cLeftEnd = cLeftCount;
+            const size_t cRightEnd = cRightCount;
+            const int *const cRightWords = reinterpret_cast<const int *>(cRight);
+            size_t left{};
+            size_t right{};
+            size_t count{};
+            uint32_t matched{};
+            while (left + 8 <= cLeftEnd && right + 8 <= cRightEnd)
+            {
+                const __m256i cLeftBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cLeft + left));
+                __m256i equal = _mm256_setzero_si256();
+                for (size_t i = 0; i < 8; i++)
+                {
+                    int word;
+                    std::memcpy(&word, cRightWords + right + i, sizeof(word));
+                    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(cLeftBlock, _mm256_set1_epi32(word)));
+                }
+                matched |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+
+                const uint32_t cLeftLast = cLeft[left + 7].ToUint32();
+                const uint32_t cRightLast = cRight[right + 7].ToUint32();
+                if (cLeftLast <= cRightLast)
+                {
+                    count += WriteBlock<Op, 8>(cLeft + left, matched, output + count);
+                    left += 8;
+                    matched = 0;
+                }
+                right += cRightLast <= cLeftLast ? 8 : 0;
+            }
+            count += FinishOpenBlock<Op, 8>(cLeft, left, cRight, right, cRightEnd, matched, output + count);
+            return count + Merge<Op>(cLeft + left, cLeftEnd - left, cRight + right, cRightEnd - right, output + count);
+        }
+#endif
+
+        /**
+         * @brief The signature shared by the variants of MergeIPv4Scalar().
+         */
+        using MergeIPv4Function = size_t (*)(const IPv4Address *, const size_t &, const IPv4Address *, const size_t &, IPv4Address *);
+
+        /**
+         * @brief Returns the variant of MergeIPv4Scalar() for a tier.
+         *
+         * Each tier without its own variant takes the one of the tier below it (AVX-512 would only
+         * widen the block further, which matches less often before a block is done).
+         *
+         * @tparam Op Operation::INTERSECTION or Operation::DIFFERENCE.
+         * @param cTier The tier.
+         * @return The variant.
+         */
+        template <Operation Op>
+        MergeIPv4Function MergeIPv4Kernel(const CpuFeatures::Tier &cTier)
+        {
+            static const MergeIPv4Function cTable[CpuFeatures::TIER_COUNT]{
+                MergeIPv4Scalar<Op>,
+#if defined(ADDRESS_SET_OPERATIONS_SSE2)
+                MergeIPv4Sse2<Op>,
+                MergeIPv4Sse2<Op>,
+#else
+                MergeIPv4Scalar<Op>,
+                MergeIPv4Scalar<Op>,
+#endif
+#if defined(ADDRESS_SET_OPERATIONS_AVX2)
+                MergeIPv4Avx2<Op>,
+                MergeIPv4Avx2<Op>,
+#elif defined(ADDRESS_SET_OPERATIONS_SSE2)
+                MergeIPv4Sse2<Op>,
+                MergeIPv4Sse2<Op>,
+#else
+                MergeIPv4Scalar<Op>,
+                MergeIPv4Scalar<Op>,
+#endif
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+
+        /**
+         * @brief Returns the variant of MergeIPv4Scalar() of the selected tier, looked up once.
+         */
+        template <Operation Op>
+        MergeIPv4Function MergeIPv4()
+        {
+            static const MergeIPv4Function cMerge = MergeIPv4Kernel<Op>(CpuFeatures::Selected());
+            return cMerge;
+        }
+
+        /**
+         * @brief Runs a merge over splitter-delimited parts of the inputs on several threads.
+         * @tparam Op The operation.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result.
+         * @param cThreads The requested number of threads.
+         * @param merge Called as merge(left, leftCount, right, rightCount, output), returns the number of addresses written.
+         * @return The number of addresses written.
+         */
+        template <Operation Op, typename Address, typename Function>
+        size_t Run(const Address *cLeft, const size_t &cLeftCount, const Address *cRight, const size_t &cRightCount, Address *output, const size_t &cThreads,
+                   Function merge)
+        {
+            const size_t cThreadCount = ThreadCount(cThreads, cLeftCount + cRightCount);
+            if (cThreadCount == 1)
+            {
+                return merge(cLeft, cLeftCount, cRight, cRightCount, output);
+            }
+
+            // Part p holds the addresses from splitter p on, up to splitter p + 1. The splitters
+            // are spread evenly over the larger input, so both inputs split at the same values.
+            const Address *const cLarger = cLeftCount >= cRightCount ? cLeft : cRight;
+            const size_t cLargerCount = std::max(cLeftCount, cRightCount);
+            std::vector<size_t> leftBegin(cThreadCount + 1, cLeftCount);
+            std::vector<size_t> rightBegin(cThreadCount + 1, cRightCount);
+            leftBegin[0] = 0;
+            rightBegin[0] = 0;
+            for (size_t part = 1; part < cThreadCount; part++)
+            {
+                const Address &cSplitter = cLarger[cLargerCount * part / cThreadCount];
+                leftBegin[part] = static_cast<size_t>(std::lower_bound(cLeft, cLeft + cLeftCount, cSplitter) - cLeft);
+                rightBegin[part] = static_cast<size_t>(std::lower_bound(cRight, cRight + cRightCount, cSplitter) - cRight);
+            }
+
+            // Every part writes where its result cannot reach the next part's region, then the
+            // results move down in order, which never overwrites a result not yet moved.
+            const auto cOutputBegin = [&](const size_t &cPart) { return leftBegin[cPart] + (Op == Operation::UNION ? rightBegin[cPart] : 0); };
+            std::vector<size_t> counts(cThreadCount);
+            const auto cWork = [&](const size_t cPart) {
+                counts[cPart] = merge(cLeft + leftBegin[cPart], leftBegin[cPart + 1] - leftBegin[cPart], cRight + rightBegin[cPart],
+                                      rightBegin[cPart + 1] - rightBegin[cPart], output + cOutputBegin(cPart));
+            };
+            std::vector<std::thread> threads;
+            for (size_t part = 1; part < cThreadCount; part++)
+            {
+                threads.emplace_back(cWork, part);
+            }
+            cWork(0);
+            for (std::thread &thread : threads)
+            {
+                thread.join();
+            }
+
+            size_t count = counts[0];
+            for (size_t part = 1; part < cThreadCount; part++)
+            {
+                const Address *const cResult = output + cOutputBegin(part);
+                std::copy(cResult, cResult + counts[part], output + count);
+                count += counts[part];
+            }
+            return count;
+        }
+    }
+
+    /**
+     * @brief Computes the addresses present in both inputs.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Intersection(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount,
+                                              IPv4Address *output, const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount);
+        return Run<Operation::INTERSECTION>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, MergeIPv4<Operation::INTERSECTION>());
+    } /* size_t AddressSetOperations::Intersection(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output, const size_t &cThreads) */
+
+    /**
+     * @brief Computes the addresses present in both inputs.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Intersection(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount,
+                                              IPv6Address *output, const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount);
+        return Run<Operation::INTERSECTION>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, Merge<Operation::INTERSECTION, IPv6Address>);
+    } /* size_t AddressSetOperations::Intersection(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output, const size_t &cThreads) */
+
+    /**
+     * @brief Computes the addresses of the first input missing from the second one.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Difference(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount,
+                                            IPv4Address *output, const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount);
+        return Run<Operation::DIFFERENCE>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, MergeIPv4<Operation::DIFFERENCE>());
+    } /* size_t AddressSetOperations::Difference(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output, const size_t &cThreads) */
+
+    /**
+     * @brief Computes the addresses of the first input missing from the second one.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Difference(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount,
+                                            IPv6Address *output, const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount);
+        return Run<Operation::DIFFERENCE>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, Merge<Operation::DIFFERENCE, IPv6Address>);
+    } /* size_t AddressSetOperations::Difference(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output, const size_t &cThreads) */
+
+    /**
+     * @brief Computes the addresses present in either input.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount + cRightCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Union(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output,
+                                       const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount + cRightCount);
+        return Run<Operation::UNION>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, Merge<Operation::UNION, IPv4Address>);
+    } /* size_t AddressSetOperations::Union(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output, const size_t &cThreads) */
+
+    /**
+     * @brief Computes the addresses present in either input.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param output Receives the result in ascending order; room for cLeftCount + cRightCount addresses, not overlapping the inputs.
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @return The number of addresses written.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    size_t AddressSetOperations::Union(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output,
+                                       const size_t &cThreads)
+    {
+        CheckPointers(cLeft, cLeftCount, cRight, cRightCount, output, cLeftCount + cRightCount);
+        return Run<Operation::UNION>(cLeft, cLeftCount, cRight, cRightCount, output, cThreads, Merge<Operation::UNION, IPv6Address>);
+    } /* size_t AddressSetOperations::Union(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output, const size_t &cThreads) */
+
+    // Private Methods.
+
+    /**
+     * @brief Throws if a pointer is null while its count is not zero.
+     * @param cLeft The first input.
+     * @param cLeftCount The number of addresses of the first input.
+     * @param cRight The second input.
+     * @param cRightCount The number of addresses of the second input.
+     * @param cOutput The output.
+     * @param cOutputCount The capacity the output needs.
+     * @throw std::invalid_argument If a pointer is null while its count is not zero.
+     */
+    void AddressSetOperations::CheckPointers(const void *cLeft, const size_t &cLeftCount, const void *cRight, const size_t &cRightCount, const void *cOutput,
+                                             const size_t &cOutputCount)
+    {
+        if ((!cLeft && cLeftCount) || (!cRight && cRightCount) || (!cOutput && cOutputCount))
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+    } /* void AddressSetOperations::CheckPointers(const void *cLeft, const size_t &cLeftCount, const void *cRight, const size_t &cRightCount, const void *cOutput, const size_t &cOutputCount) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
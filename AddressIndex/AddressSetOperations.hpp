@@ -0,0 +1,111 @@
+/**
+ * @file AddressSetOperations.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressSetOperations (parallel set algebra on sorted address arrays) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSSETOPERATIONS_H
+#define ADDRESSSETOPERATIONS_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressSetOperations
+     * @brief Intersection, difference and union of sorted address arrays, e.g. of two daily snapshots.
+     *
+     * The inputs must be strictly increasing (sorted, without duplicates); otherwise the result
+     * is unspecified, as with std::set_intersection. The work is split between threads by
+     * splitter values taken evenly from the larger input: every thread merges the parts of both
+     * inputs between two splitters into its own region of the output, and the regions are then
+     * moved together. The result does not depend on the number of threads.
+     *
+     * IPv4 intersection and difference compare blocks of addresses of each input all against
+     * all, four by four with SSE2 and eight by eight with AVX2, picked per CpuFeatures tier; the
+     * other cases merge each part with the matching std::set_* algorithm.
+     */
+    class AddressSetOperations
+    {
+    public:
+        /**
+         * @brief Computes the addresses present in both inputs.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+         * @param cThreads The number of threads, 0 for the number of hardware threads.
+         * @return The number of addresses written.
+         * @throws std::invalid_argument If a pointer is null while its count is not zero.
+         */
+        static size_t Intersection(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output,
+                                   const size_t &cThreads = 0);
+        static size_t Intersection(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output,
+                                   const size_t &cThreads = 0);
+
+        /**
+         * @brief Computes the addresses of the first input missing from the second one.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result in ascending order; room for cLeftCount addresses, not overlapping the inputs.
+         * @param cThreads The number of threads, 0 for the number of hardware threads.
+         * @return The number of addresses written.
+         * @throws std::invalid_argument If a pointer is null while its count is not zero.
+         */
+        static size_t Difference(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output,
+                                 const size_t &cThreads = 0);
+        static size_t Difference(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output,
+                                 const size_t &cThreads = 0);
+
+        /**
+         * @brief Computes the addresses present in either input.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param output Receives the result in ascending order; room for cLeftCount + cRightCount addresses, not overlapping the inputs.
+         * @param cThreads The number of threads, 0 for the number of hardware threads.
+         * @return The number of addresses written.
+         * @throws std::invalid_argument If a pointer is null while its count is not zero.
+         */
+        static size_t Union(const IPv4Address *cLeft, const size_t &cLeftCount, const IPv4Address *cRight, const size_t &cRightCount, IPv4Address *output,
+                            const size_t &cThreads = 0);
+        static size_t Union(const IPv6Address *cLeft, const size_t &cLeftCount, const IPv6Address *cRight, const size_t &cRightCount, IPv6Address *output,
+                            const size_t &cThreads = 0);
+
+    private:
+        /**
+         * @brief Throws if a pointer is null while its count is not zero.
+         * @param cLeft The first input.
+         * @param cLeftCount The number of addresses of the first input.
+         * @param cRight The second input.
+         * @param cRightCount The number of addresses of the second input.
+         * @param cOutput The output.
+         * @param cOutputCount The capacity the output needs.
+         */
+        static void CheckPointers(const void *cLeft, const size_t &cLeftCount, const void *cRight, const size_t &cRightCount, const void *cOutput, const size_t &cOutputCount);
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::AddressSetOperations] Null pointer encountered!"};
+    }; /* class AddressSetOperations */
+}
+
+#endif /* ADDRESSSETOPERATIONS_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,279 @@
+/**
+ * @file EytzingerAddressSet.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EytzingerAddressSet (static sorted address set in breadth-first layout) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef EYTZINGERADDRESSSET_H
+#define EYTZINGERADDRESSSET_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    /**
+     * @class EytzingerAddressSet
+     * @brief A static set of IPv4 or IPv6 addresses with branchless lower bound and predecessor search.
+     *
+     * The sorted addresses are stored in Eytzinger (breadth-first) order: the root of the
+     * implicit search tree at index 1 and the children of node k at 2k and 2k + 1. A search
+     * descends one level per step with a comparison result added to the index instead of a
+     * branch, and prefetches the 16 descendants of the node four levels down (one cache line of
+     * IPv4 keys, four of IPv6 keys), so the misses of consecutive levels overlap. The array is
+     * aligned so that those descendants start a cache line.
+     *
+     * @tparam Address IPv4Address or IPv6Address.
+     */
+    template <typename Address>
+    class EytzingerAddressSet
+    {
+        static_assert(std::is_same<Address, IPv4Address>::value || std::is_same<Address, IPv6Address>::value, "Keys must be IPv4Address or IPv6Address");
+
+    public:
+        /**
+         * @brief Default constructor. Creates an empty set.
+         */
+        EytzingerAddressSet() = default;
+
+        /**
+         * @brief Constructor for the EytzingerAddressSet class.
+         * @param cAddresses The addresses, in any order, duplicates allowed.
+         */
+        explicit EytzingerAddressSet(const std::vector<Address> &cAddresses)
+        {
+            std::vector<Key> sorted(cAddresses.size());
+            for (size_t i = 0; i < sorted.size(); i++)
+            {
+                sorted[i] = ToKey(cAddresses[i]);
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const Key &cLeft, const Key &cRight) { return Less(cLeft, cRight); });
+            sorted.erase(std::unique(sorted.begin(), sorted.end(), [](const Key &cLeft, const Key &cRight) { return !Less(cLeft, cRight) && !Less(cRight, cLeft); }),
+                         sorted.end());
+
+            _size = sorted.size();
+            _lines.resize((_size + KEYS_PER_LINE) / KEYS_PER_LINE);
+            size_t next{};
+            Fill(sorted, 1, next);
+        }
+
+        /**
+         * @brief Returns the number of distinct addresses.
+         * @return The number of addresses.
+         */
+        size_t Size() const { return _size; }
+
+        /**
+         * @brief Returns the number of bytes of the search array.
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return _lines.size() * sizeof(CacheLine); }
+
+        /**
+         * @brief Checks whether the set contains an address.
+         * @param cAddress The address to look for.
+         * @return `true` if the address is in the set, `false` otherwise.
+         */
+        bool Contains(const Address &cAddress) const
+        {
+            const Key cKey = ToKey(cAddress);
+            const size_t cNode = LowerBoundNode(cKey);
+            return cNode != 0 && !Less(cKey, Keys()[cNode]);
+        }
+
+        /**
+         * @brief Finds the smallest address not below an address.
+         * @param cAddress The address.
+         * @param lowerBound Receives the lower bound, if there is one.
+         * @return `true` if some address is greater than or equal to cAddress, `false` otherwise.
+         */
+        bool LowerBound(const Address &cAddress, Address &lowerBound) const
+        {
+            const size_t cNode = LowerBoundNode(ToKey(cAddress));
+            if (cNode == 0)
+            {
+                return false;
+            }
+            lowerBound = ToAddress(Keys()[cNode]);
+            return true;
+        }
+
+        /**
+         * @brief Finds the greatest address not above an address, e.g. the start of the range holding it.
+         * @param cAddress The address.
+         * @param predecessor Receives the predecessor, if there is one.
+         * @return `true` if some address is less than or equal to cAddress, `false` otherwise.
+         */
+        bool Predecessor(const Address &cAddress, Address &predecessor) const
+        {
+            const Key cKey = ToKey(cAddress);
+            const Key *const cKeys = Keys();
+            size_t node = 1;
+            while (node <= _size)
+            {
+                Prefetch(node);
+                node = 2 * node + static_cast<size_t>(!Less(cKey, cKeys[node]));
+            }
+            // The predecessor is the last node the search went right from, i.e. drop the trailing
+            // left turns (zero bits) and the right turn before them.
+            node >>= TrailingZeros(node) + 1;
+            if (node == 0)
+            {
+                return false;
+            }
+            predecessor = ToAddress(cKeys[node]);
+            return true;
+        }
+
+    private:
+        /**
+         * @brief A stored key: the host-order IPv4 value, or the two IPv6 halves.
+         */
+        struct Key128
+        {
+            uint64_t upper;
+            uint64_t lower;
+        };
+        using Key = typename std::conditional<std::is_same<Address, IPv4Address>::value, uint32_t, Key128>::type;
+
+        /**
+         * @brief Number of keys of a cache line.
+         */
+        static constexpr size_t KEYS_PER_LINE = 64 / sizeof(Key);
+
+        /**
+         * @brief Number of descendants four levels below a node, prefetched by a search step.
+         */
+        static constexpr size_t PREFETCH_KEYS = 16;
+
+        /**
+         * @brief One cache line of the search array.
+         */
+        struct alignas(64) CacheLine
+        {
+            Key keys[KEYS_PER_LINE];
+        };
+
+        /**
+         * @brief Number of distinct keys.
+         */
+        size_t _size{};
+
+        /**
+         * @brief The keys in Eytzinger order from index 1; index 0 is unused, so the PREFETCH_KEYS
+         *        descendants of node k, from 16k on, start a cache line.
+         */
+        std::vector<CacheLine> _lines;
+
+        /**
+         * @brief Returns the keys of the search array.
+         * @return The first key, at index 0.
+         */
+        const Key *Keys() const { return _lines.empty() ? nullptr : _lines.front().keys; }
+
+        /**
+         * @brief Compares two keys without branches.
+         */
+        static bool Less(const uint32_t &cLeft, const uint32_t &cRight) { return cLeft < cRight; }
+        static bool Less(const Key128 &cLeft, const Key128 &cRight)
+        {
+            return (cLeft.upper < cRight.upper) | ((cLeft.upper == cRight.upper) & (cLeft.lower < cRight.lower));
+        }
+
+        /**
+         * @brief Converts between addresses and keys.
+         */
+        static uint32_t ToKey(const IPv4Address &cAddress) { return cAddress.ToUint32(); }
+        static Key128 ToKey(const IPv6Address &cAddress) { return Key128{cAddress.GetUpper64(), cAddress.GetLower64()}; }
+        static IPv4Address ToAddress(const uint32_t &cKey) { return IPv4Address::FromUint32(cKey); }
+        static IPv6Address ToAddress(const Key128 &cKey) { return IPv6Address::FromUint64(cKey.upper, cKey.lower); }
+
+        /**
+         * @brief Returns the number of trailing zero bits of a non-zero word.
+         */
+        static uint32_t TrailingZeros(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanForward64(&index, cWord);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctzll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Prefetches the cache lines of the descendants of a node four levels down.
+         * @param cNode The node.
+         */
+        void Prefetch(const size_t &cNode) const
+        {
+#if defined(__GNUC__)
+            // Computed as an integer: the lines may lie past the end of the array, where a prefetch is harmless.
+            const uintptr_t cLine = reinterpret_cast<uintptr_t>(Keys()) + cNode * PREFETCH_KEYS * sizeof(Key);
+            for (size_t i = 0; i < PREFETCH_KEYS / KEYS_PER_LINE; i++)
+            {
+                __builtin_prefetch(reinterpret_cast<const void *>(cLine + i * sizeof(CacheLine)));
+            }
+#else
+            (void)cNode;
+#endif
+        }
+
+        /**
+         * @brief Places the sorted keys by an in-order walk of the implicit tree.
+         * @param cSorted The sorted distinct keys.
+         * @param cNode The node to fill with its subtree.
+         * @param next The index of the next sorted key.
+         */
+        void Fill(const std::vector<Key> &cSorted, const size_t &cNode, size_t &next)
+        {
+            if (cNode > _size)
+            {
+                return;
+            }
+            Fill(cSorted, 2 * cNode, next);
+            _lines[cNode / KEYS_PER_LINE].keys[cNode % KEYS_PER_LINE] = cSorted[next++];
+            Fill(cSorted, 2 * cNode + 1, next);
+        }
+
+        /**
+         * @brief Returns the node of the smallest key not below a key.
+         * @param cKey The key.
+         * @return The node, or 0 if every key is smaller.
+         */
+        size_t LowerBoundNode(const Key &cKey) const
+        {
+            const Key *const cKeys = Keys();
+            size_t node = 1;
+            while (node <= _size)
+            {
+                Prefetch(node);
+                node = 2 * node + static_cast<size_t>(Less(cKeys[node], cKey));
+            }
+            // The lower bound is the last node the search went left from, i.e. drop the trailing
+            // right turns (one bits) and the left turn before them.
+            return node >> (TrailingZeros(~static_cast<uint64_t>(node)) + 1);
+        }
+    }; /* class EytzingerAddressSet */
+}
+
+#endif /* EYTZINGERADDRESSSET_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
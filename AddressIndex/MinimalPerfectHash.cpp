@@ -0,0 +1,455 @@
+/**
+ * @file MinimalPerfectHash.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MinimalPerfectHash class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "MinimalPerfectHash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief First word of the words: "EPMH" and the format version 1.
+         */
+        constexpr uint64_t MAGIC = 0x00000001484D5045ull;
+
+        /**
+         * @brief Keys per thread below which a pass runs on the calling thread only.
+         */
+        constexpr size_t MIN_KEYS_PER_THREAD = 1u << 16;
+
+        /**
+         * @brief Returns the number of set bits of a word.
+         */
+        inline uint32_t PopCount(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            return static_cast<uint32_t>(__popcnt64(cWord));
+#else
+            return static_cast<uint32_t>(__builtin_popcountll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Returns the upper 64 bits of the 128-bit product of two words.
+         */
+        inline uint64_t MultiplyHigh(const uint64_t &cLeft, const uint64_t &cRight)
+        {
+#if defined(_MSC_VER)
+            return __umulh(cLeft, cRight);
+#else
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(cLeft) * cRight) >> 64);
+#endif
+        }
+
+        /**
+         * @brief Mixes the bits of a word (the MurmurHash3 finalizer).
+         */
+        inline uint64_t Mix(uint64_t word)
+        {
+            word ^= word >> 33;
+            word *= 0xFF51AFD7ED558CCDull;
+            word ^= word >> 33;
+            word *= 0xC4CEB9FE1A85EC53ull;
+            return word ^ (word >> 33);
+        }
+
+        /**
+         * @brief Hashes a key to the word the level hashes derive from.
+         */
+        inline uint64_t KeyHash(const uint64_t &cUpper, const uint64_t &cLower)
+        {
+            return Mix(cLower ^ Mix(cUpper ^ 0x2545F4914F6CDD1Dull));
+        }
+
+        /**
+         * @brief Returns the bit of a key in a level of cBits bits.
+         */
+        inline uint64_t LevelBit(const uint64_t &cKeyHash, const uint64_t &cLevel, const uint64_t &cBits)
+        {
+            return MultiplyHigh(Mix(cKeyHash + (cLevel + 1) * 0x9E3779B97F4A7C15ull), cBits);
+        }
+
+        /**
+         * @brief Returns the number of threads to use.
+         */
+        size_t ThreadCount(const size_t &cThreads, const size_t &cCount)
+        {
+            const size_t cWanted = cThreads != 0 ? cThreads : (std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1);
+            return std::max<size_t>(1, std::min(cWanted, cCount / MIN_KEYS_PER_THREAD));
+        }
+
+        /**
+         * @brief Splits the range [0, cCount) into cThreads contiguous chunks and runs a function on each in its own thread.
+         * @param cCount The size of the range.
+         * @param cThreads The number of chunks.
+         * @param function Called as function(begin, end, chunk).
+         */
+        template <typename Function>
+        void ParallelFor(const size_t &cCount, const size_t &cThreads, Function function)
+        {
+            std::vector<std::thread> threads;
+            for (size_t chunk = 1; chunk < cThreads; chunk++)
+            {
+                threads.emplace_back(function, cCount * chunk / cThreads, cCount * (chunk + 1) / cThreads, chunk);
+            }
+            function(size_t{0}, cCount / cThreads, size_t{0});
+            for (std::thread &thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Default constructor. Creates the function of an empty set.
+     */
+    MinimalPerfectHash::MinimalPerfectHash() : MinimalPerfectHash(nullptr, nullptr, 0, 1)
+    {
+    } /* MinimalPerfectHash::MinimalPerfectHash() */
+
+    /**
+     * @brief Constructor for the MinimalPerfectHash class.
+     * @param cUpper The upper 64 bits of the keys, nullptr if they are all zero (e.g. IPv4 keys).
+     * @param cLower The lower 64 bits of the keys.
+     * @param cCount The number of keys.
+     * @param cThreads The number of build threads, 0 for the number of hardware threads.
+     * @throw std::invalid_argument If cLower is null and cCount is not zero, or a key occurs twice.
+     */
+    MinimalPerfectHash::MinimalPerfectHash(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, const size_t &cThreads)
+    {
+        if (!cLower && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        // Level 0 takes every key; the indices of the keys still to place are kept from level 1 on.
+        const size_t cThreadCount = ThreadCount(cThreads, cCount);
+        std::vector<std::vector<uint64_t>> levels;
+        std::vector<size_t> remaining;
+        size_t remainingCount = cCount;
+        while (remainingCount != 0 && levels.size() < MAX_LEVELS)
+        {
+            const uint64_t cLevel = levels.size();
+            const uint64_t cBits = std::max<uint64_t>(64, (2 * static_cast<uint64_t>(remainingCount) + 63) / 64 * 64);
+            std::vector<std::atomic<uint64_t>> seen(static_cast<size_t>(cBits / 64));
+            std::vector<std::atomic<uint64_t>> collided(static_cast<size_t>(cBits / 64));
+            const size_t cLevelThreads = ThreadCount(cThreadCount, remainingCount);
+            const auto cKeyBit = [&](const size_t &cIndex) {
+                return LevelBit(KeyHash(cUpper ? cUpper[cIndex] : 0, cLower[cIndex]), cLevel, cBits);
+            };
+
+            ParallelFor(remainingCount, cLevelThreads, [&](const size_t cBegin, const size_t cEnd, const size_t) {
+                for (size_t i = cBegin; i < cEnd; i++)
+                {
+                    const uint64_t cBit = cKeyBit(cLevel == 0 ? i : remaining[i]);
+                    const uint64_t cMask = 1ull << (cBit % 64);
+                    if (seen[cBit / 64].fetch_or(cMask, std::memory_order_relaxed) & cMask)
+                    {
+                        collided[cBit / 64].fetch_or(cMask, std::memory_order_relaxed);
+                    }
+                }
+            });
+
+            std::vector<uint64_t> level(static_cast<size_t>(cBits / 64));
+            for (size_t word = 0; word < level.size(); word++)
+            {
+                level[word] = seen[word].load(std::memory_order_relaxed) & ~collided[word].load(std::memory_order_relaxed);
+            }
+            levels.push_back(std::move(level));
+
+            // Keys of collided bits move on, in their order, whatever the number of threads.
+            std::vector<std::vector<size_t>> next(cLevelThreads);
+            ParallelFor(remainingCount, cLevelThreads, [&](const size_t cBegin, const size_t cEnd, const size_t cChunk) {
+                for (size_t i = cBegin; i < cEnd; i++)
+                {
+                    const size_t cIndex = cLevel == 0 ? i : remaining[i];
+                    const uint64_t cBit = cKeyBit(cIndex);
+                    if ((collided[cBit / 64].load(std::memory_order_relaxed) >> (cBit % 64)) & 1)
+                    {
+                        next[cChunk].push_back(cIndex);
+                    }
+                }
+            });
+            remaining.clear();
+            for (const std::vector<size_t> &cChunk : next)
+            {
+                remaining.insert(remaining.end(), cChunk.begin(), cChunk.end());
+            }
+            remainingCount = remaining.size();
+        }
+
+        // Equal keys collide on every level, so they can only end up here.
+        std::vector<std::pair<uint64_t, uint64_t>> fallback;
+        for (size_t i = 0; i < remainingCount; i++)
+        {
+            fallback.emplace_back(cUpper ? cUpper[remaining[i]] : 0, cLower[remaining[i]]);
+        }
+        std::sort(fallback.begin(), fallback.end());
+        if (std::adjacent_find(fallback.begin(), fallback.end()) != fallback.end())
+        {
+            throw std::invalid_argument(DUPLICATE_KEY);
+        }
+
+        uint64_t bitCount{};
+        for (const std::vector<uint64_t> &cLevel : levels)
+        {
+            bitCount += 64 * cLevel.size();
+        }
+        uint64_t header[HEADER_WORDS];
+        FillHeader(cCount, levels.size(), bitCount, fallback.size(), header);
+        _storage.assign(static_cast<size_t>(header[TOTAL_WORDS_WORD]), 0);
+        std::copy(header, header + HEADER_WORDS, _storage.begin());
+
+        uint64_t *const cStarts = _storage.data() + HEADER_WORDS;
+        uint64_t *const cBlocks = _storage.data() + header[BLOCKS_OFFSET_WORD];
+        uint64_t bit{};
+        uint64_t ones{};
+        for (size_t level = 0; level < levels.size(); level++)
+        {
+            cStarts[level + 1] = cStarts[level] + 64 * levels[level].size();
+            for (const uint64_t &cWord : levels[level])
+            {
+                if (bit % BLOCK_BITS == 0)
+                {
+                    cBlocks[BitWord(bit) - 1] = ones;
+                }
+                cBlocks[BitWord(bit)] = cWord;
+                ones += PopCount(cWord);
+                bit += 64;
+            }
+        }
+        uint64_t *const cFallback = _storage.data() + header[FALLBACK_OFFSET_WORD];
+        for (size_t i = 0; i < fallback.size(); i++)
+        {
+            cFallback[2 * i] = fallback[i].first;
+            cFallback[2 * i + 1] = fallback[i].second;
+        }
+    } /* MinimalPerfectHash::MinimalPerfectHash(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, const size_t &cThreads) */
+
+    /**
+     * @brief Returns the position of a key.
+     * @param cUpper The upper 64 bits of the key.
+     * @param cLower The lower 64 bits of the key.
+     * @return The position below Size() for a key of the set; for any other key an arbitrary position below Size(), or Size().
+     */
+    size_t MinimalPerfectHash::Lookup(const uint64_t &cUpper, const uint64_t &cLower) const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t *const cStarts = cWords + HEADER_WORDS;
+        const uint64_t *const cBlocks = cWords + cWords[BLOCKS_OFFSET_WORD];
+        const uint64_t cKeyHash = KeyHash(cUpper, cLower);
+        for (uint64_t level = 0; level < cWords[LEVEL_COUNT_WORD]; level++)
+        {
+            const uint64_t cBit = cStarts[level] + LevelBit(cKeyHash, level, cStarts[level + 1] - cStarts[level]);
+            if ((cBlocks[BitWord(cBit)] >> (cBit % 64)) & 1)
+            {
+                return Rank(cBit);
+            }
+        }
+
+        // The fallback keys take the last positions, in key order.
+        const uint64_t *const cFallback = cWords + cWords[FALLBACK_OFFSET_WORD];
+        size_t first{};
+        size_t last = static_cast<size_t>(cWords[FALLBACK_COUNT_WORD]);
+        while (first < last)
+        {
+            const size_t cMiddle = first + (last - first) / 2;
+            const std::pair<uint64_t, uint64_t> cKey{cFallback[2 * cMiddle], cFallback[2 * cMiddle + 1]};
+            if (cKey < std::make_pair(cUpper, cLower))
+            {
+                first = cMiddle + 1;
+            }
+            else
+            {
+                last = cMiddle;
+            }
+        }
+        if (first < cWords[FALLBACK_COUNT_WORD] && cFallback[2 * first] == cUpper && cFallback[2 * first + 1] == cLower)
+        {
+            return static_cast<size_t>(cWords[SIZE_WORD] - cWords[FALLBACK_COUNT_WORD] + first);
+        }
+        return Size();
+    } /* size_t MinimalPerfectHash::Lookup(const uint64_t &cUpper, const uint64_t &cLower) const */
+
+    /**
+     * @brief Returns the positions of several keys.
+     * @param cUpper The upper 64 bits of the keys, nullptr if they are all zero.
+     * @param cLower The lower 64 bits of the keys.
+     * @param cCount The number of keys.
+     * @param positions Receives the cCount positions, as from Lookup().
+     * @param cThreads The number of threads, 0 for the number of hardware threads.
+     * @throw std::invalid_argument If cLower or positions is null and cCount is not zero.
+     */
+    void MinimalPerfectHash::Lookup(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, size_t *positions, const size_t &cThreads) const
+    {
+        if ((!cLower || !positions) && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        ParallelFor(cCount, ThreadCount(cThreads, cCount), [&](const size_t cBegin, const size_t cEnd, const size_t) {
+            for (size_t i = cBegin; i < cEnd; i++)
+            {
+                positions[i] = Lookup(cUpper ? cUpper[i] : 0, cLower[i]);
+            }
+        });
+    } /* void MinimalPerfectHash::Lookup(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, size_t *positions, const size_t &cThreads) const */
+
+    /**
+     * @brief Serializes the function.
+     * @return The words of the function as bytes, readable by View() on a machine of the same byte order.
+     */
+    std::vector<uint8_t> MinimalPerfectHash::Serialize() const
+    {
+        const uint8_t *const cBytes = reinterpret_cast<const uint8_t *>(Words());
+        return std::vector<uint8_t>(cBytes, cBytes + SizeInBytes());
+    } /* std::vector<uint8_t> MinimalPerfectHash::Serialize() const */
+
+    /**
+     * @brief Creates a function that looks up serialized bytes in place.
+     * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the function and its copies.
+     * @param cSize The number of bytes.
+     * @return The function.
+     * @throw std::invalid_argument If the pointer is null or misaligned, or the header and the level offsets do not match the size.
+     */
+    MinimalPerfectHash MinimalPerfectHash::View(const uint8_t *cData, const size_t &cSize)
+    {
+        if (!cData)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (reinterpret_cast<uintptr_t>(cData) % alignof(uint64_t) || cSize % sizeof(uint64_t) || cSize < HEADER_WORDS * sizeof(uint64_t))
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        // The level offsets must start at zero and grow by whole words, and the header must be
+        // exactly what the constructor writes for them; the counts are bounded first.
+        const uint64_t *const cWords = reinterpret_cast<const uint64_t *>(cData);
+        const uint64_t cTotalWords = cSize / sizeof(uint64_t);
+        const uint64_t cLevelCount = cWords[LEVEL_COUNT_WORD];
+        if (cWords[MAGIC_WORD] != MAGIC || cLevelCount > MAX_LEVELS || HEADER_WORDS + cLevelCount + 1 > cTotalWords || cWords[FALLBACK_COUNT_WORD] > cTotalWords)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+        const uint64_t *const cStarts = cWords + HEADER_WORDS;
+        for (uint64_t level = 0; level < cLevelCount; level++)
+        {
+            if (cStarts[level + 1] <= cStarts[level] || (cStarts[level + 1] - cStarts[level]) % 64 || cStarts[level + 1] / 64 > cTotalWords)
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+        }
+        uint64_t expected[HEADER_WORDS];
+        FillHeader(cWords[SIZE_WORD], cLevelCount, cStarts[cLevelCount], cWords[FALLBACK_COUNT_WORD], expected);
+        if (cStarts[0] != 0 || !std::equal(expected, expected + HEADER_WORDS, cWords) || expected[TOTAL_WORDS_WORD] != cTotalWords)
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+
+        // Only the header and the at most MAX_LEVELS + 1 level offsets are read, so opening a
+        // memory-mapped image touches a single page; Validate() checks the blocks and the fallback
+        // table when the image is not trusted.
+        MinimalPerfectHash function;
+        function._storage.clear();
+        function._view = cWords;
+        return function;
+    } /* MinimalPerfectHash MinimalPerfectHash::View(const uint8_t *cData, const size_t &cSize) */
+
+    /**
+     * @brief Checks the blocks and the fallback table.
+     *
+     * Lookups trust the block counts and the fallback order, so this checks them, the padding
+     * after the last level and the key count. Reads every word of the function.
+     *
+     * @throw std::invalid_argument If the words are not a valid function.
+     */
+    void MinimalPerfectHash::Validate() const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t cLevelBits = cWords[HEADER_WORDS + cWords[LEVEL_COUNT_WORD]];
+        const uint64_t *const cBlocks = cWords + cWords[BLOCKS_OFFSET_WORD];
+        uint64_t ones{};
+        for (uint64_t word = 0; word < cWords[FALLBACK_OFFSET_WORD] - cWords[BLOCKS_OFFSET_WORD]; word++)
+        {
+            const uint64_t cBit = word / BLOCK_WORDS * BLOCK_BITS + (word % BLOCK_WORDS - 1) * 64;
+            if (word % BLOCK_WORDS == 0 ? cBlocks[word] != ones : cBit >= cLevelBits && cBlocks[word] != 0)
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+            ones += word % BLOCK_WORDS == 0 ? 0 : PopCount(cBlocks[word]);
+        }
+        const uint64_t *const cFallback = cWords + cWords[FALLBACK_OFFSET_WORD];
+        for (uint64_t i = 1; i < cWords[FALLBACK_COUNT_WORD]; i++)
+        {
+            if (std::make_pair(cFallback[2 * i - 2], cFallback[2 * i - 1]) >= std::make_pair(cFallback[2 * i], cFallback[2 * i + 1]))
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+        }
+        if (ones + cWords[FALLBACK_COUNT_WORD] != cWords[SIZE_WORD])
+        {
+            throw std::invalid_argument(INVALID_DATA);
+        }
+    } /* void MinimalPerfectHash::Validate() const */
+
+    // Private Methods.
+
+    /**
+     * @brief Fills the header from the shape of the function.
+     * @param cSize The number of keys.
+     * @param cLevelCount The number of levels.
+     * @param cBitCount The number of bits of all levels.
+     * @param cFallbackCount The number of fallback keys.
+     * @param header Receives HEADER_WORDS words.
+     */
+    void MinimalPerfectHash::FillHeader(const uint64_t &cSize, const uint64_t &cLevelCount, const uint64_t &cBitCount, const uint64_t &cFallbackCount, uint64_t *header)
+    {
+        header[MAGIC_WORD] = MAGIC;
+        header[SIZE_WORD] = cSize;
+        header[LEVEL_COUNT_WORD] = cLevelCount;
+        header[FALLBACK_COUNT_WORD] = cFallbackCount;
+        header[BLOCKS_OFFSET_WORD] = HEADER_WORDS + cLevelCount + 1;
+        header[FALLBACK_OFFSET_WORD] = header[BLOCKS_OFFSET_WORD] + (cBitCount + BLOCK_BITS - 1) / BLOCK_BITS * BLOCK_WORDS;
+        header[TOTAL_WORDS_WORD] = header[FALLBACK_OFFSET_WORD] + 2 * cFallbackCount;
+    } /* void MinimalPerfectHash::FillHeader(const uint64_t &cSize, const uint64_t &cLevelCount, const uint64_t &cBitCount, const uint64_t &cFallbackCount, uint64_t *header) */
+
+    /**
+     * @brief Counts the set level bits before a bit.
+     * @param cBit The bit position.
+     * @return The number of set bits below cBit.
+     */
+    size_t MinimalPerfectHash::Rank(const uint64_t &cBit) const
+    {
+        const uint64_t *const cWords = Words();
+        const uint64_t *const cBlock = cWords + cWords[BLOCKS_OFFSET_WORD] + cBit / BLOCK_BITS * BLOCK_WORDS;
+        const uint64_t cWord = 1 + cBit % BLOCK_BITS / 64;
+        uint64_t rank = cBlock[0];
+        for (uint64_t word = 1; word < cWord; word++)
+        {
+            rank += PopCount(cBlock[word]);
+        }
+        return static_cast<size_t>(rank + PopCount(cBlock[cWord] & ((1ull << (cBit % 64)) - 1)));
+    } /* size_t MinimalPerfectHash::Rank(const uint64_t &cBit) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,204 @@
+/**
+ * @file MinimalPerfectHash.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MinimalPerfectHash (BBHash-style minimal perfect hash function) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef MINIMALPERFECTHASH_H
+#define MINIMALPERFECTHASH_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class MinimalPerfectHash
+     * @brief Maps a static set of n 128-bit keys one to one onto the positions 0 to n - 1.
+     *
+     * The construction follows BBHash: every level is a bit vector of twice as many bits as keys
+     * still to place. Each key hashes to one bit of the level; bits hit by exactly one key are
+     * kept set, and the keys that collided move on to the next, smaller level. The position of
+     * a key is the number of set bits before its bit over all levels, so the function takes
+     * about 3.7 bits per key. The bits are stored in blocks of one cache line: a count of the set
+     * bits before the block and 448 bits, so a lookup usually touches one line before the
+     * caller's value array. The few keys left after MAX_LEVELS levels are stored verbatim in a
+     * sorted fallback table.
+     *
+     * A level is built in two passes over the keys, both split between threads: hitting the bits
+     * with atomic ORs, then collecting the keys of collided bits. The result does not depend on
+     * the number of threads.
+     *
+     * All data lives in one array of 64-bit words that Serialize() writes as is. View() runs
+     * lookups straight on such an image, e.g. a memory-mapped file, without copying it. View()
+     * only checks the header and the level offsets, in constant time; an image from an untrusted
+     * source must also pass Validate(), which reads all of it, before it is queried.
+     */
+    class MinimalPerfectHash
+    {
+    public:
+        /**
+         * @brief Maximum number of levels before the remaining keys go to the fallback table.
+         */
+        static constexpr size_t MAX_LEVELS = 24;
+
+        /**
+         * @brief Default constructor. Creates the function of an empty set.
+         */
+        MinimalPerfectHash();
+
+        /**
+         * @brief Constructor for the MinimalPerfectHash class.
+         * @param cUpper The upper 64 bits of the keys, nullptr if they are all zero (e.g. IPv4 keys).
+         * @param cLower The lower 64 bits of the keys.
+         * @param cCount The number of keys.
+         * @param cThreads The number of build threads, 0 for the number of hardware threads.
+         * @throws std::invalid_argument If cLower is null and cCount is not zero, or a key occurs twice.
+         */
+        MinimalPerfectHash(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, const size_t &cThreads = 0);
+
+        /**
+         * @brief Returns the number of keys.
+         * @return The number of keys.
+         */
+        size_t Size() const { return static_cast<size_t>(Words()[SIZE_WORD]); }
+
+        /**
+         * @brief Returns the number of bytes of the function, the same as the size of Serialize().
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return static_cast<size_t>(Words()[TOTAL_WORDS_WORD]) * sizeof(uint64_t); }
+
+        /**
+         * @brief Returns the position of a key.
+         * @param cUpper The upper 64 bits of the key.
+         * @param cLower The lower 64 bits of the key.
+         * @return The position below Size() for a key of the set; for any other key an arbitrary position below Size(), or Size().
+         */
+        size_t Lookup(const uint64_t &cUpper, const uint64_t &cLower) const;
+
+        /**
+         * @brief Returns the positions of several keys.
+         * @param cUpper The upper 64 bits of the keys, nullptr if they are all zero.
+         * @param cLower The lower 64 bits of the keys.
+         * @param cCount The number of keys.
+         * @param positions Receives the cCount positions, as from Lookup().
+         * @param cThreads The number of threads, 0 for the number of hardware threads.
+         * @throws std::invalid_argument If cLower or positions is null and cCount is not zero.
+         */
+        void Lookup(const uint64_t *cUpper, const uint64_t *cLower, const size_t &cCount, size_t *positions, const size_t &cThreads = 1) const;
+
+        /**
+         * @brief Serializes the function.
+         * @return The words of the function as bytes, readable by View() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const;
+
+        /**
+         * @brief Creates a function that looks up serialized bytes in place.
+         * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the function and its copies.
+         * @param cSize The number of bytes.
+         * @return The function.
+         * @throws std::invalid_argument If the pointer is null or misaligned, or the header and the level offsets do not match the size.
+         */
+        static MinimalPerfectHash View(const uint8_t *cData, const size_t &cSize);
+
+        /**
+         * @brief Checks the blocks and the fallback table. Linear in the size.
+         * @throws std::invalid_argument If the words are not a valid function.
+         */
+        void Validate() const;
+
+    private:
+        /**
+         * @brief Word indices of the header fields at the start of the words. The header is
+         *        followed by the LEVEL_COUNT + 1 bit offsets of the levels.
+         */
+        static constexpr size_t MAGIC_WORD = 0;
+        static constexpr size_t SIZE_WORD = 1;
+        static constexpr size_t LEVEL_COUNT_WORD = 2;
+        static constexpr size_t FALLBACK_COUNT_WORD = 3;
+        static constexpr size_t BLOCKS_OFFSET_WORD = 4;
+        static constexpr size_t FALLBACK_OFFSET_WORD = 5;
+        static constexpr size_t TOTAL_WORDS_WORD = 6;
+        static constexpr size_t HEADER_WORDS = 7;
+
+        /**
+         * @brief Number of words of a block: the count of set bits before it, then the level bits.
+         */
+        static constexpr size_t BLOCK_WORDS = 8;
+
+        /**
+         * @brief Number of level bits of a block.
+         */
+        static constexpr size_t BLOCK_BITS = 64 * (BLOCK_WORDS - 1);
+
+        /**
+         * @brief The words of an owned function.
+         */
+        std::vector<uint64_t> _storage;
+
+        /**
+         * @brief The words of a viewed function, nullptr for an owned one.
+         */
+        const uint64_t *_view{};
+
+        /**
+         * @brief Returns the words of the function.
+         * @return The header, the level offsets, the blocks of level bits and the fallback keys.
+         */
+        const uint64_t *Words() const { return _view ? _view : _storage.data(); }
+
+        /**
+         * @brief Fills the header from the shape of the function.
+         * @param cSize The number of keys.
+         * @param cLevelCount The number of levels.
+         * @param cBitCount The number of bits of all levels.
+         * @param cFallbackCount The number of fallback keys.
+         * @param header Receives HEADER_WORDS words.
+         */
+        static void FillHeader(const uint64_t &cSize, const uint64_t &cLevelCount, const uint64_t &cBitCount, const uint64_t &cFallbackCount, uint64_t *header);
+
+        /**
+         * @brief Returns the index of the word holding a level bit.
+         * @param cBit The bit position over all levels.
+         * @return The word index within the blocks.
+         */
+        static uint64_t BitWord(const uint64_t &cBit) { return cBit / BLOCK_BITS * BLOCK_WORDS + 1 + cBit % BLOCK_BITS / 64; }
+
+        /**
+         * @brief Counts the set level bits before a bit.
+         * @param cBit The bit position.
+         * @return The number of set bits below cBit.
+         */
+        size_t Rank(const uint64_t &cBit) const;
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::MinimalPerfectHash] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a repeated key.
+         */
+        static constexpr char DUPLICATE_KEY[]{"[EthernetParameter::MinimalPerfectHash] Duplicate key!"};
+
+        /**
+         * @brief Error message indicating malformed serialized data.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::MinimalPerfectHash] Invalid serialized data!"};
+    }; /* class MinimalPerfectHash */
+}
+
+#endif /* MINIMALPERFECTHASH_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
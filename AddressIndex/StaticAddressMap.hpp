@@ -0,0 +1,323 @@
+/**
+ * @file StaticAddressMap.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief StaticAddressMap (immutable address to value map over a minimal perfect hash) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef STATICADDRESSMAP_H
+#define STATICADDRESSMAP_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include "MinimalPerfectHash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class StaticAddressMap
+     * @brief An immutable map from IPv4 or IPv6 addresses to values, e.g. enrichment tables.
+     *
+     * A MinimalPerfectHash gives every key its own slot of two flat arrays, one of keys and one
+     * of values. A lookup is one hash evaluation, one key comparison (so that addresses outside
+     * the map are rejected) and one value copy, with no probing; the index costs about 3.7 bits
+     * per key on top of the arrays.
+     *
+     * Serialize() writes the function and both arrays as one image of 64-bit words; View()
+     * queries such an image in place, so a map built once can be memory-mapped by every reader.
+     * View() only checks the headers and the sizes; call Validate() before querying an image from
+     * an untrusted source.
+     *
+     * @tparam Address IPv4Address or IPv6Address.
+     * @tparam Value A trivially copyable value type, stored byte for byte.
+     */
+    template <typename Address, typename Value>
+    class StaticAddressMap
+    {
+        static_assert(std::is_same<Address, IPv4Address>::value || std::is_same<Address, IPv6Address>::value, "Keys must be IPv4Address or IPv6Address");
+        static_assert(std::is_trivially_copyable<Value>::value, "Values must be trivially copyable");
+
+    public:
+        /**
+         * @brief Default constructor. Creates an empty map.
+         */
+        StaticAddressMap() = default;
+
+        /**
+         * @brief Constructor for the StaticAddressMap class.
+         * @param cKeys The keys, in any order.
+         * @param cValues The values, cValues[i] for cKeys[i].
+         * @param cThreads The number of build threads, 0 for the number of hardware threads.
+         * @throws std::invalid_argument If the vectors differ in size or a key occurs twice.
+         */
+        StaticAddressMap(const std::vector<Address> &cKeys, const std::vector<Value> &cValues, const size_t &cThreads = 0)
+        {
+            if (cKeys.size() != cValues.size())
+            {
+                throw std::invalid_argument(SIZE_MISMATCH);
+            }
+
+            const size_t cCount = cKeys.size();
+            std::vector<uint64_t> upper(KEY_BYTES == 16 ? cCount : 0);
+            std::vector<uint64_t> lower(cCount);
+            for (size_t i = 0; i < cCount; i++)
+            {
+                uint64_t keyUpper{};
+                Split(cKeys[i], keyUpper, lower[i]);
+                if (KEY_BYTES == 16)
+                {
+                    upper[i] = keyUpper;
+                }
+            }
+            const uint64_t *const cUpper = KEY_BYTES == 16 ? upper.data() : nullptr;
+            _hash = MinimalPerfectHash(cUpper, lower.data(), cCount, cThreads);
+
+            std::vector<size_t> positions(cCount);
+            _hash.Lookup(cUpper, lower.data(), cCount, positions.data(), cThreads);
+            _storage.assign(static_cast<size_t>(KeyWords(cCount) + ValueWords(cCount)), 0);
+            uint8_t *const cKeyBytes = reinterpret_cast<uint8_t *>(_storage.data());
+            uint8_t *const cValueBytes = cKeyBytes + KeyWords(cCount) * sizeof(uint64_t);
+            for (size_t i = 0; i < cCount; i++)
+            {
+                EncodeKey(cUpper ? cUpper[i] : 0, lower[i], cKeyBytes + positions[i] * KEY_BYTES);
+                std::memcpy(cValueBytes + positions[i] * sizeof(Value), &cValues[i], sizeof(Value));
+            }
+        }
+
+        /**
+         * @brief Returns the number of keys.
+         * @return The number of keys.
+         */
+        size_t Size() const { return _hash.Size(); }
+
+        /**
+         * @brief Returns the number of bytes of the map, the same as the size of Serialize().
+         * @return The size in bytes.
+         */
+        size_t SizeInBytes() const { return static_cast<size_t>(HEADER_WORDS + KeyWords(Size()) + ValueWords(Size())) * sizeof(uint64_t) + _hash.SizeInBytes(); }
+
+        /**
+         * @brief Looks up the value of a key.
+         * @param cKey The key.
+         * @param value Receives the value, if the key is in the map.
+         * @return `true` if the key is in the map, `false` otherwise.
+         */
+        bool Find(const Address &cKey, Value &value) const
+        {
+            uint64_t upper{};
+            uint64_t lower{};
+            Split(cKey, upper, lower);
+            const size_t cPosition = _hash.Lookup(upper, lower);
+            if (cPosition >= Size())
+            {
+                return false;
+            }
+
+            // Read the value before checking the key, so that both cache misses overlap.
+            Value candidate;
+            std::memcpy(&candidate, reinterpret_cast<const uint8_t *>(Table()) + KeyWords(Size()) * sizeof(uint64_t) + cPosition * sizeof(Value), sizeof(Value));
+            if (!KeyMatches(cPosition, upper, lower))
+            {
+                return false;
+            }
+            value = candidate;
+            return true;
+        }
+
+        /**
+         * @brief Checks whether the map contains a key.
+         * @param cKey The key.
+         * @return `true` if the key is in the map, `false` otherwise.
+         */
+        bool Contains(const Address &cKey) const
+        {
+            uint64_t upper{};
+            uint64_t lower{};
+            Split(cKey, upper, lower);
+            const size_t cPosition = _hash.Lookup(upper, lower);
+            return cPosition < Size() && KeyMatches(cPosition, upper, lower);
+        }
+
+        /**
+         * @brief Serializes the map.
+         * @return The map as bytes, readable by View() on a machine of the same byte order.
+         */
+        std::vector<uint8_t> Serialize() const
+        {
+            const uint64_t cHeader[HEADER_WORDS]{MAGIC, KEY_BYTES, sizeof(Value), Size(), _hash.SizeInBytes() / sizeof(uint64_t)};
+            const std::vector<uint8_t> cHash = _hash.Serialize();
+            const uint8_t *const cTable = reinterpret_cast<const uint8_t *>(Table());
+            std::vector<uint8_t> bytes(reinterpret_cast<const uint8_t *>(cHeader), reinterpret_cast<const uint8_t *>(cHeader + HEADER_WORDS));
+            bytes.insert(bytes.end(), cHash.begin(), cHash.end());
+            bytes.insert(bytes.end(), cTable, cTable + (KeyWords(Size()) + ValueWords(Size())) * sizeof(uint64_t));
+            return bytes;
+        }
+
+        /**
+         * @brief Creates a map that queries serialized bytes in place.
+         * @param cData The bytes written by Serialize(), 8-byte aligned. Must outlive the map and its copies.
+         * @param cSize The number of bytes.
+         * @return The map.
+         * @throws std::invalid_argument If the pointer is null or misaligned, or the bytes are not a valid map of these key and value types.
+         */
+        static StaticAddressMap View(const uint8_t *cData, const size_t &cSize)
+        {
+            if (!cData)
+            {
+                throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+            }
+            if (reinterpret_cast<uintptr_t>(cData) % alignof(uint64_t) || cSize % sizeof(uint64_t) || cSize < HEADER_WORDS * sizeof(uint64_t))
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+
+            const uint64_t *const cWords = reinterpret_cast<const uint64_t *>(cData);
+            const uint64_t cTotalWords = cSize / sizeof(uint64_t);
+            if (cWords[MAGIC_WORD] != MAGIC || cWords[KEY_BYTES_WORD] != KEY_BYTES || cWords[VALUE_BYTES_WORD] != sizeof(Value) ||
+                cWords[HASH_WORDS_WORD] > cTotalWords - HEADER_WORDS)
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+            StaticAddressMap map;
+            map._hash = MinimalPerfectHash::View(cData + HEADER_WORDS * sizeof(uint64_t), static_cast<size_t>(cWords[HASH_WORDS_WORD]) * sizeof(uint64_t));
+            const uint64_t cCount = map._hash.Size();
+            if (cWords[SIZE_WORD] != cCount || cTotalWords != HEADER_WORDS + cWords[HASH_WORDS_WORD] + KeyWords(cCount) + ValueWords(cCount))
+            {
+                throw std::invalid_argument(INVALID_DATA);
+            }
+            map._view = cWords + HEADER_WORDS + cWords[HASH_WORDS_WORD];
+            return map;
+        }
+
+        /**
+         * @brief Checks the whole perfect hash function, see MinimalPerfectHash::Validate().
+         * @throws std::invalid_argument If the function is not valid.
+         */
+        void Validate() const { _hash.Validate(); }
+
+    private:
+        /**
+         * @brief Number of bytes of a stored key: the host-order IPv4 value, or the two IPv6 halves.
+         */
+        static constexpr size_t KEY_BYTES = std::is_same<Address, IPv4Address>::value ? 4 : 16;
+
+        /**
+         * @brief Word indices of the header fields; the function, the keys and the values follow.
+         */
+        static constexpr size_t MAGIC_WORD = 0;
+        static constexpr size_t KEY_BYTES_WORD = 1;
+        static constexpr size_t VALUE_BYTES_WORD = 2;
+        static constexpr size_t SIZE_WORD = 3;
+        static constexpr size_t HASH_WORDS_WORD = 4;
+        static constexpr size_t HEADER_WORDS = 5;
+
+        /**
+         * @brief First word of the image: "EPAM" and the format version 1.
+         */
+        static constexpr uint64_t MAGIC = 0x000000014D415045ull;
+
+        /**
+         * @brief The function giving the slot of every key.
+         */
+        MinimalPerfectHash _hash;
+
+        /**
+         * @brief The keys and then the values of an owned map, each array padded to whole words.
+         */
+        std::vector<uint64_t> _storage;
+
+        /**
+         * @brief The keys and values of a viewed map, nullptr for an owned one.
+         */
+        const uint64_t *_view{};
+
+        /**
+         * @brief Returns the keys, followed by the values.
+         * @return The first word of the keys.
+         */
+        const uint64_t *Table() const { return _view ? _view : _storage.data(); }
+
+        /**
+         * @brief Returns the number of words of the keys or the values of cCount entries.
+         */
+        static constexpr uint64_t KeyWords(const uint64_t &cCount) { return (cCount * KEY_BYTES + sizeof(uint64_t) - 1) / sizeof(uint64_t); }
+        static constexpr uint64_t ValueWords(const uint64_t &cCount) { return (cCount * sizeof(Value) + sizeof(uint64_t) - 1) / sizeof(uint64_t); }
+
+        /**
+         * @brief Splits a key into the two halves the function hashes.
+         */
+        static void Split(const IPv4Address &cKey, uint64_t &upper, uint64_t &lower)
+        {
+            upper = 0;
+            lower = cKey.ToUint32();
+        }
+        static void Split(const IPv6Address &cKey, uint64_t &upper, uint64_t &lower)
+        {
+            upper = cKey.GetUpper64();
+            lower = cKey.GetLower64();
+        }
+
+        /**
+         * @brief Writes the KEY_BYTES bytes of a stored key.
+         */
+        static void EncodeKey(const uint64_t &cUpper, const uint64_t &cLower, uint8_t *bytes)
+        {
+            if (KEY_BYTES == 4)
+            {
+                const uint32_t cValue = static_cast<uint32_t>(cLower);
+                std::memcpy(bytes, &cValue, sizeof(cValue));
+            }
+            else
+            {
+                std::memcpy(bytes, &cUpper, sizeof(cUpper));
+                std::memcpy(bytes + sizeof(cUpper), &cLower, sizeof(cLower));
+            }
+        }
+
+        /**
+         * @brief Checks whether a slot holds a key.
+         * @param cPosition The slot, below Size().
+         * @param cUpper The upper half of the key.
+         * @param cLower The lower half of the key.
+         * @return `true` if the stored key is the given one, `false` otherwise.
+         */
+        bool KeyMatches(const size_t &cPosition, const uint64_t &cUpper, const uint64_t &cLower) const
+        {
+            uint8_t key[KEY_BYTES];
+            EncodeKey(cUpper, cLower, key);
+            return std::memcmp(reinterpret_cast<const uint8_t *>(Table()) + cPosition * KEY_BYTES, key, KEY_BYTES) == 0;
+        }
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::StaticAddressMap] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating keys and values of different counts.
+         */
+        static constexpr char SIZE_MISMATCH[]{"[EthernetParameter::StaticAddressMap] Keys and values differ in size!"};
+
+        /**
+         * @brief Error message indicating malformed serialized data.
+         */
+        static constexpr char INVALID_DATA[]{"[EthernetParameter::StaticAddressMap] Invalid serialized data!"};
+    }; /* class StaticAddressMap */
+}
+
+#endif /* STATICADDRESSMAP_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
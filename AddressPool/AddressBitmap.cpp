@@ -0,0 +1,303 @@
+/**
+ * @file AddressBitmap.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressBitmap (hierarchical free-list bitmap) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressBitmap.hpp"
+#include <stdexcept>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the AddressBitmap class.
+     *
+     * Allocates the leaf level and as many summary levels as needed to reach a single top word.
+     * Bits past the last slot are set, so they are never reported as free.
+     *
+     * @param cSize The number of slots.
+     *
+     * @throw std::invalid_argument If the size is zero or greater than 2^32.
+     */
+    AddressBitmap::AddressBitmap(const uint64_t &cSize) : _size{cSize}
+    {
+        if (cSize == 0 || cSize > MAX_SIZE)
+        {
+            throw std::invalid_argument(INVALID_SIZE);
+        }
+
+        uint64_t bits = cSize;
+        do
+        {
+            const uint64_t cWords = (bits + WORD_BITS - 1) / WORD_BITS;
+            _levels.emplace_back(cWords, 0);
+            bits = cWords;
+        } while (bits > 1);
+
+        Rebuild();
+    } /* AddressBitmap::AddressBitmap(const uint64_t &cSize) */
+
+    /**
+     * @brief Returns the number of slots.
+     * @return The number of slots.
+     */
+    uint64_t AddressBitmap::Size() const
+    {
+        return _size;
+    } /* uint64_t AddressBitmap::Size() const */
+
+    /**
+     * @brief Returns the number of used slots.
+     * @return The number of used slots.
+     */
+    uint64_t AddressBitmap::Count() const
+    {
+        return _count;
+    } /* uint64_t AddressBitmap::Count() const */
+
+    /**
+     * @brief Checks whether the slot is used.
+     * @param cIndex The slot index.
+     * @return `true` if the slot is used, `false` otherwise.
+     */
+    bool AddressBitmap::Test(const uint64_t &cIndex) const
+    {
+        return (_levels[0][cIndex / WORD_BITS] >> (cIndex % WORD_BITS)) & 1;
+    } /* bool AddressBitmap::Test(const uint64_t &cIndex) const */
+
+    /**
+     * @brief Marks the slot as used.
+     *
+     * When the leaf word becomes full, the corresponding summary bit is set, and so on upwards.
+     *
+     * @param cIndex The slot index.
+     */
+    void AddressBitmap::Set(const uint64_t &cIndex)
+    {
+        if (Test(cIndex))
+        {
+            return;
+        }
+
+        _count++;
+        uint64_t index = cIndex;
+        for (size_t level = 0; level < _levels.size(); level++)
+        {
+            uint64_t &word = _levels[level][index / WORD_BITS];
+            word |= static_cast<uint64_t>(1) << (index % WORD_BITS);
+            if (word != UINT64_MAX)
+            {
+                break;
+            }
+            index /= WORD_BITS;
+        }
+    } /* void AddressBitmap::Set(const uint64_t &cIndex) */
+
+    /**
+     * @brief Marks the slot as free.
+     *
+     * When a full leaf word gets a free bit, the corresponding summary bit is cleared, and so on upwards.
+     *
+     * @param cIndex The slot index.
+     */
+    void AddressBitmap::Reset(const uint64_t &cIndex)
+    {
+        if (!Test(cIndex))
+        {
+            return;
+        }
+
+        _count--;
+        uint64_t index = cIndex;
+        for (size_t level = 0; level < _levels.size(); level++)
+        {
+            uint64_t &word = _levels[level][index / WORD_BITS];
+            const bool cWasFull = word == UINT64_MAX;
+            word &= ~(static_cast<uint64_t>(1) << (index % WORD_BITS));
+            if (!cWasFull)
+            {
+                break;
+            }
+            index /= WORD_BITS;
+        }
+    } /* void AddressBitmap::Reset(const uint64_t &cIndex) */
+
+    /**
+     * @brief Finds the lowest free slot by descending from the top word.
+     * @return The index of the lowest free slot, or Size() if all slots are used.
+     */
+    uint64_t AddressBitmap::FindFirstZero() const
+    {
+        uint64_t index{};
+        for (size_t level = _levels.size(); level-- > 0;)
+        {
+            const uint64_t cWord = _levels[level][index];
+            if (cWord == UINT64_MAX)
+            {
+                return _size;
+            }
+            index = index * WORD_BITS + CountTrailingZeros(~cWord);
+        }
+
+        return index;
+    } /* uint64_t AddressBitmap::FindFirstZero() const */
+
+    /**
+     * @brief Returns the leaf level words.
+     * @return The leaf words.
+     */
+    const std::vector<uint64_t> &AddressBitmap::GetWords() const
+    {
+        return _levels[0];
+    } /* const std::vector<uint64_t> &AddressBitmap::GetWords() const */
+
+    /**
+     * @brief Replaces the leaf level words and rebuilds the upper levels.
+     * @param cWords The leaf words.
+     * @throw std::invalid_argument If the number of words does not match the size.
+     */
+    void AddressBitmap::SetWords(const std::vector<uint64_t> &cWords)
+    {
+        if (cWords.size() != _levels[0].size())
+        {
+            throw std::invalid_argument(INVALID_WORD_COUNT);
+        }
+
+        _levels[0] = cWords;
+        Rebuild();
+    } /* void AddressBitmap::SetWords(const std::vector<uint64_t> &cWords) */
+
+    /**
+     * @brief Returns the size of the binary form of the leaf words.
+     * @return The number of bytes written by AppendBinary().
+     */
+    size_t AddressBitmap::BinarySize() const
+    {
+        return _levels[0].size() * sizeof(uint64_t);
+    } /* size_t AddressBitmap::BinarySize() const */
+
+    /**
+     * @brief Appends the leaf words as little-endian 64-bit values.
+     * @param destBinary The vector to append to.
+     */
+    void AddressBitmap::AppendBinary(std::vector<uint8_t> &destBinary) const
+    {
+        destBinary.reserve(destBinary.size() + BinarySize());
+        for (const uint64_t &cWord : _levels[0])
+        {
+            for (uint8_t shift = 0; shift < WORD_BITS; shift += 8)
+            {
+                destBinary.push_back(static_cast<uint8_t>(cWord >> shift));
+            }
+        }
+    } /* void AddressBitmap::AppendBinary(std::vector<uint8_t> &destBinary) const */
+
+    /**
+     * @brief Loads the leaf words from little-endian 64-bit values and rebuilds the upper levels.
+     * @param cBinaryWords Pointer to BinarySize() bytes created by AppendBinary().
+     * @throw std::invalid_argument If the provided pointer is null (nullptr).
+     */
+    void AddressBitmap::SetFromBinary(const uint8_t *cBinaryWords)
+    {
+        if (!cBinaryWords)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        for (uint64_t &word : _levels[0])
+        {
+            word = 0;
+            for (uint8_t shift = 0; shift < WORD_BITS; shift += 8)
+            {
+                word |= static_cast<uint64_t>(*cBinaryWords++) << shift;
+            }
+        }
+        Rebuild();
+    } /* void AddressBitmap::SetFromBinary(const uint8_t *cBinaryWords) */
+
+    /**
+     * @brief Returns the index of the lowest set bit.
+     * @param cWord The word to scan, must not be zero.
+     * @return The number of trailing zero bits.
+     */
+    uint8_t AddressBitmap::CountTrailingZeros(const uint64_t &cWord)
+    {
+#if defined(_MSC_VER)
+        unsigned long index{};
+        _BitScanForward64(&index, cWord);
+        return static_cast<uint8_t>(index);
+#else
+        return static_cast<uint8_t>(__builtin_ctzll(cWord));
+#endif
+    } /* uint8_t AddressBitmap::CountTrailingZeros(const uint64_t &cWord) */
+
+    /**
+     * @brief Returns the number of set bits.
+     * @param cWord The word to count.
+     * @return The number of set bits.
+     */
+    uint8_t AddressBitmap::PopCount(const uint64_t &cWord)
+    {
+#if defined(_MSC_VER)
+        return static_cast<uint8_t>(__popcnt64(cWord));
+#else
+        return static_cast<uint8_t>(__builtin_popcountll(cWord));
+#endif
+    } /* uint8_t AddressBitmap::PopCount(const uint64_t &cWord) */
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Private Methods.
+
+    /**
+     * @brief Recomputes all levels above the leaf one and the used slot counter.
+     *
+     * Bits past the last slot (and past the last word of every level) are forced to 1.
+     */
+    void AddressBitmap::Rebuild()
+    {
+        std::vector<uint64_t> &leaf = _levels[0];
+        const uint64_t cTailBits = _size % WORD_BITS;
+        if (cTailBits != 0)
+        {
+            leaf.back() |= UINT64_MAX << cTailBits;
+        }
+
+        _count = 0;
+        for (const uint64_t &cWord : leaf)
+        {
+            _count += PopCount(cWord);
+        }
+        _count -= cTailBits != 0 ? WORD_BITS - cTailBits : 0;
+
+        for (size_t level = 1; level < _levels.size(); level++)
+        {
+            const std::vector<uint64_t> &cBelow = _levels[level - 1];
+            std::vector<uint64_t> &current = _levels[level];
+            for (uint64_t &word : current)
+            {
+                word = UINT64_MAX;
+            }
+            for (size_t i = 0; i < cBelow.size(); i++)
+            {
+                if (cBelow[i] != UINT64_MAX)
+                {
+                    current[i / WORD_BITS] &= ~(static_cast<uint64_t>(1) << (i % WORD_BITS));
+                }
+            }
+        }
+    } /* void AddressBitmap::Rebuild() */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
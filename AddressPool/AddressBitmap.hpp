@@ -0,0 +1,175 @@
+/**
+ * @file AddressBitmap.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressBitmap (hierarchical free-list bitmap) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSBITMAP_H
+#define ADDRESSBITMAP_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressBitmap
+     * @brief Hierarchical bitmap used as a free-list of address slots.
+     *
+     * Level 0 holds one bit per slot (1 = used). Every upper level holds one bit per 64-bit word
+     * of the level below, set when that word is completely used. Finding the first free slot is
+     * therefore one count-trailing-zeros per level (4 levels cover 2^24 slots, 6 levels cover 2^32).
+     */
+    class AddressBitmap
+    {
+    public:
+        /**
+         * @brief Maximum number of slots (the size of the whole IPv4 address space).
+         */
+        static constexpr uint64_t MAX_SIZE{static_cast<uint64_t>(1) << 32};
+
+        /**
+         * @brief Number of bits in a single bitmap word.
+         */
+        static constexpr uint8_t WORD_BITS{64};
+
+        /**
+         * @brief Constructor for the AddressBitmap class. All slots start free.
+         * @param cSize The number of slots.
+         * @throws std::invalid_argument If the size is zero or greater than 2^32.
+         */
+        explicit AddressBitmap(const uint64_t &cSize);
+
+        /**
+         * @brief Returns the number of slots.
+         * @return The number of slots.
+         */
+        uint64_t Size() const;
+
+        /**
+         * @brief Returns the number of used slots.
+         * @return The number of used slots.
+         */
+        uint64_t Count() const;
+
+        /**
+         * @brief Checks whether the slot is used. The index is not checked.
+         * @param cIndex The slot index, must be lower than Size().
+         * @return `true` if the slot is used, `false` otherwise.
+         */
+        bool Test(const uint64_t &cIndex) const;
+
+        /**
+         * @brief Marks the slot as used. The index is not checked.
+         * @param cIndex The slot index, must be lower than Size().
+         */
+        void Set(const uint64_t &cIndex);
+
+        /**
+         * @brief Marks the slot as free. The index is not checked.
+         * @param cIndex The slot index, must be lower than Size().
+         */
+        void Reset(const uint64_t &cIndex);
+
+        /**
+         * @brief Finds the lowest free slot.
+         * @return The index of the lowest free slot, or Size() if all slots are used.
+         */
+        uint64_t FindFirstZero() const;
+
+        /**
+         * @brief Returns the leaf level words (one bit per slot, unused tail bits set).
+         * @return The leaf words.
+         */
+        const std::vector<uint64_t> &GetWords() const;
+
+        /**
+         * @brief Replaces the leaf level words and rebuilds the upper levels.
+         * @param cWords The leaf words, there must be exactly (Size() + 63) / 64 of them.
+         * @throws std::invalid_argument If the number of words does not match the size.
+         */
+        void SetWords(const std::vector<uint64_t> &cWords);
+
+        /**
+         * @brief Returns the size of the binary form of the leaf words.
+         * @return The number of bytes written by AppendBinary().
+         */
+        size_t BinarySize() const;
+
+        /**
+         * @brief Appends the leaf words as little-endian 64-bit values.
+         * @param destBinary The vector to append to.
+         */
+        void AppendBinary(std::vector<uint8_t> &destBinary) const;
+
+        /**
+         * @brief Loads the leaf words from little-endian 64-bit values and rebuilds the upper levels.
+         * @param cBinaryWords Pointer to BinarySize() bytes created by AppendBinary().
+         * @throws std::invalid_argument If the provided pointer is null (nullptr).
+         */
+        void SetFromBinary(const uint8_t *cBinaryWords);
+
+        /**
+         * @brief Returns the index of the lowest set bit.
+         * @param cWord The word to scan, must not be zero.
+         * @return The number of trailing zero bits.
+         */
+        static uint8_t CountTrailingZeros(const uint64_t &cWord);
+
+        /**
+         * @brief Returns the number of set bits.
+         * @param cWord The word to count.
+         * @return The number of set bits.
+         */
+        static uint8_t PopCount(const uint64_t &cWord);
+
+    private:
+        /**
+         * @brief Number of slots.
+         */
+        uint64_t _size{};
+
+        /**
+         * @brief Number of used slots.
+         */
+        uint64_t _count{};
+
+        /**
+         * @brief Bitmap levels, index 0 is the leaf level, the last level is a single word.
+         */
+        std::vector<std::vector<uint64_t>> _levels{};
+
+        /**
+         * @brief Recomputes all levels above the leaf one and the used slot counter.
+         */
+        void Rebuild();
+
+        /**
+         * @brief Error message indicating an invalid bitmap size.
+         */
+        static constexpr char INVALID_SIZE[]{"[EthernetParameter::AddressBitmap] Invalid bitmap size!"};
+
+        /**
+         * @brief Error message indicating a word vector that does not match the bitmap size.
+         */
+        static constexpr char INVALID_WORD_COUNT[]{"[EthernetParameter::AddressBitmap] Invalid number of bitmap words!"};
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::AddressBitmap] Null pointer encountered!"};
+    }; /* class AddressBitmap */
+}
+
+#endif /* ADDRESSBITMAP_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
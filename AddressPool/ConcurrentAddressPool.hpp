@@ -0,0 +1,464 @@
+/**
+ * @file ConcurrentAddressPool.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ConcurrentAddressPool (thread-safe IPAM allocator with per-thread caches) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef CONCURRENTADDRESSPOOL_H
+#define CONCURRENTADDRESSPOOL_H
+#include "IPv4AddressPool.hpp"
+#include "IPv6AddressPool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class ConcurrentAddressPool
+     * @brief Thread-safe wrapper around IPv4AddressPool / IPv6AddressPool.
+     *
+     * Every thread is bound to one of several caches. A cache holds a batch of addresses taken from
+     * the shared pool in one locked operation, so most Allocate()/Free() calls only touch the
+     * thread's own (uncontended) cache. Freed addresses go back to the cache and overflow to the
+     * shared pool in batches. Addresses sitting in caches count as allocated in the shared pool,
+     * call Flush() before inspecting or snapshotting it.
+     *
+     * The wrapper keeps two bits per address of the range (pooled, cached or leased) so Free() can
+     * tell in O(1) and without the shared lock whether an address was handed out by Allocate() and
+     * not returned since. Everything else (double frees, addresses outside the pool, addresses
+     * allocated directly on the shared pool) goes through PoolType::Free() under the shared lock,
+     * so a cache only ever holds addresses that are free for the clients. The states take
+     * Size() / 4 bytes on top of the pool's own bitmaps (1 GiB for a /96 IPv6 pool).
+     *
+     * @tparam PoolType IPv4AddressPool or IPv6AddressPool.
+     * @tparam AddressType The address type handed out by the pool.
+     */
+    template <typename PoolType, typename AddressType>
+    class ConcurrentAddressPool
+    {
+    public:
+        /**
+         * @brief Default number of addresses moved between a cache and the shared pool at once.
+         */
+        static constexpr size_t DEFAULT_BATCH_SIZE = 64;
+
+        /**
+         * @brief Constructor for the ConcurrentAddressPool class.
+         * @param pool The pool to share between threads.
+         * @param cCacheCount The number of caches, defaults to the number of hardware threads.
+         * @param cBatchSize The number of addresses moved between a cache and the shared pool at once.
+         * @throws std::invalid_argument If the batch size is zero.
+         */
+        explicit ConcurrentAddressPool(PoolType pool, const size_t &cCacheCount = 0, const size_t &cBatchSize = DEFAULT_BATCH_SIZE)
+            : _pool{std::move(pool)},
+              _cacheCount{cCacheCount != 0 ? cCacheCount : (std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1)},
+              _batchSize{cBatchSize},
+              _caches{new Cache[_cacheCount]},
+              _range{_pool.GetRange()},
+              _states{new std::atomic<uint64_t>[(_pool.Size() + STATES_PER_WORD - 1) / STATES_PER_WORD]()}
+        {
+            if (cBatchSize == 0)
+            {
+                throw std::invalid_argument(INVALID_BATCH_SIZE);
+            }
+        }
+
+        /**
+         * @brief Allocates an address, preferably from the calling thread's cache.
+         * @return The allocated address.
+         * @throws std::runtime_error If the pool is exhausted.
+         */
+        AddressType Allocate()
+        {
+            AddressType address{};
+            if (!TryAllocate(address))
+            {
+                throw std::runtime_error(POOL_EXHAUSTED);
+            }
+
+            return address;
+        }
+
+        /**
+         * @brief Allocates an address without throwing.
+         * @param address The allocated address, untouched if the pool is exhausted.
+         * @return `true` if an address was allocated, `false` if the pool and all caches are exhausted.
+         */
+        bool TryAllocate(AddressType &address)
+        {
+            {
+                Cache &cache = LocalCache();
+                std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                if (cache.addresses.empty())
+                {
+                    Refill(cache);
+                }
+                if (!cache.addresses.empty())
+                {
+                    address = Take(cache);
+                    return true;
+                }
+            }
+
+            return StealFromOtherCaches(address);
+        }
+
+        /**
+         * @brief Returns an allocated address, keeping it in the calling thread's cache when possible.
+         *
+         * Only an address handed out by Allocate() and not freed since goes to the cache. Any other address
+         * is passed to the shared pool, which frees it if it was allocated there directly and throws otherwise,
+         * so a double free or a foreign address is reported by the call that made it.
+         *
+         * @param cAddress The address to release. It must have been allocated from this pool.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is not allocated or is reserved.
+         */
+        void Free(const AddressType &cAddress)
+        {
+            if (_range.Contains(cAddress) && ChangeState(IndexOf(cAddress), LEASED, CACHED))
+            {
+                Cache &cache = LocalCache();
+                std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                cache.addresses.push_back(cAddress);
+                if (cache.addresses.size() >= 2 * _batchSize)
+                {
+                    std::lock_guard<std::mutex> poolLock(_poolMutex);
+                    ReturnToPool(cache, _batchSize);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> poolLock(_poolMutex);
+            if (_range.Contains(cAddress) && GetState(IndexOf(cAddress)) != POOLED)
+            {
+                throw std::invalid_argument(ADDRESS_NOT_ALLOCATED);
+            }
+            _pool.Free(cAddress);
+        }
+
+        /**
+         * @brief Returns all cached addresses to the shared pool.
+         * @throws std::out_of_range If a cached address does not belong to the pool.
+         * @throws std::invalid_argument If a cached address is not allocated or is reserved.
+         */
+        void Flush()
+        {
+            for (size_t i = 0; i < _cacheCount; i++)
+            {
+                std::lock_guard<std::mutex> cacheLock(_caches[i].mutex);
+                std::lock_guard<std::mutex> poolLock(_poolMutex);
+                ReturnToPool(_caches[i], 0);
+            }
+        }
+
+        /**
+         * @brief Returns the number of addresses that can still be allocated (shared pool and caches).
+         * @return The number of free addresses.
+         */
+        uint64_t Available()
+        {
+            uint64_t available{};
+            for (size_t i = 0; i < _cacheCount; i++)
+            {
+                std::lock_guard<std::mutex> cacheLock(_caches[i].mutex);
+                available += _caches[i].addresses.size();
+            }
+
+            std::lock_guard<std::mutex> poolLock(_poolMutex);
+            return available + _pool.Available();
+        }
+
+        /**
+         * @brief Returns a binary snapshot of the pool after flushing all caches.
+         * @return The snapshot in the format of PoolType::ToBinary().
+         */
+        std::vector<uint8_t> ToBinary()
+        {
+            Flush();
+            std::lock_guard<std::mutex> poolLock(_poolMutex);
+            return _pool.ToBinary();
+        }
+
+        /**
+         * @brief Runs a function on the shared pool under its lock (e.g. to reserve addresses).
+         *
+         * The function must not replace the range of the pool (SetFromBinary()) nor free addresses handed out
+         * by this wrapper, those go through Free().
+         *
+         * @param function Callable taking PoolType &.
+         */
+        template <typename FunctionType>
+        void WithPool(FunctionType &&function)
+        {
+            std::lock_guard<std::mutex> poolLock(_poolMutex);
+            function(_pool);
+        }
+
+    private:
+        /**
+         * @brief Per-thread address cache, aligned to avoid false sharing between caches.
+         */
+        struct alignas(64) Cache
+        {
+            std::mutex mutex{};
+            std::vector<AddressType> addresses{};
+        };
+
+        /**
+         * @brief Range type of the pool.
+         */
+        using RangeType = decltype(std::declval<const PoolType &>().GetRange());
+
+        /**
+         * @brief State of an address: free or allocated directly in the shared pool, in a cache, or handed out by Allocate().
+         */
+        static constexpr uint64_t POOLED = 0;
+        static constexpr uint64_t CACHED = 1;
+        static constexpr uint64_t LEASED = 2;
+
+        /**
+         * @brief Number of 2-bit address states per word.
+         */
+        static constexpr uint64_t STATES_PER_WORD = 32;
+
+        /**
+         * @brief Shared pool lock.
+         */
+        std::mutex _poolMutex{};
+
+        /**
+         * @brief Shared pool.
+         */
+        PoolType _pool;
+
+        /**
+         * @brief Number of caches.
+         */
+        size_t _cacheCount{};
+
+        /**
+         * @brief Number of addresses moved between a cache and the shared pool at once.
+         */
+        size_t _batchSize{};
+
+        /**
+         * @brief Caches, threads are spread over them round-robin.
+         */
+        std::unique_ptr<Cache[]> _caches{};
+
+        /**
+         * @brief Range of the shared pool.
+         */
+        RangeType _range;
+
+        /**
+         * @brief Address states, 2 bits per address of the range.
+         */
+        std::unique_ptr<std::atomic<uint64_t>[]> _states{};
+
+        /**
+         * @brief Number of times addresses were returned from caches to the shared pool.
+         */
+        std::atomic<uint64_t> _returns{};
+
+        /**
+         * @brief Returns the cache of the calling thread.
+         * @return The cache.
+         */
+        Cache &LocalCache()
+        {
+            static std::atomic<size_t> nextThreadSlot{};
+            thread_local const size_t cThreadSlot = nextThreadSlot.fetch_add(1, std::memory_order_relaxed);
+            return _caches[cThreadSlot % _cacheCount];
+        }
+
+        /**
+         * @brief Returns the index of an address of the range.
+         * @param cAddress The address, it must belong to the range.
+         * @return The index.
+         */
+        uint64_t IndexOf(const AddressType &cAddress) const { return static_cast<uint64_t>(cAddress - _range.GetFirst()); }
+
+        /**
+         * @brief Returns the state of an address.
+         * @param cIndex The index of the address.
+         * @return POOLED, CACHED or LEASED.
+         */
+        uint64_t GetState(const uint64_t &cIndex) const
+        {
+            return _states[cIndex / STATES_PER_WORD].load(std::memory_order_acquire) >> (2 * (cIndex % STATES_PER_WORD)) & 3;
+        }
+
+        /**
+         * @brief Moves an address from one state to another if it is in the first one.
+         * @param cIndex The index of the address.
+         * @param cFrom The expected state.
+         * @param cTo The new state.
+         * @return `true` if the address was in the expected state, `false` otherwise.
+         */
+        bool ChangeState(const uint64_t &cIndex, const uint64_t &cFrom, const uint64_t &cTo)
+        {
+            std::atomic<uint64_t> &word = _states[cIndex / STATES_PER_WORD];
+            const uint64_t cShift = 2 * (cIndex % STATES_PER_WORD);
+            uint64_t expected = word.load(std::memory_order_relaxed);
+            do
+            {
+                if ((expected >> cShift & 3) != cFrom)
+                {
+                    return false;
+                }
+            } while (!word.compare_exchange_weak(expected, (expected & ~(static_cast<uint64_t>(3) << cShift)) | cTo << cShift, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed));
+            return true;
+        }
+
+        /**
+         * @brief Moves an address whose state is known from one state to another.
+         * @param cIndex The index of the address.
+         * @param cFrom The current state.
+         * @param cTo The new state.
+         */
+        void SetState(const uint64_t &cIndex, const uint64_t &cFrom, const uint64_t &cTo)
+        {
+            _states[cIndex / STATES_PER_WORD].fetch_xor((cFrom ^ cTo) << (2 * (cIndex % STATES_PER_WORD)), std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief Fills an empty cache with a batch from the shared pool.
+         * @param cache The cache (already locked).
+         */
+        void Refill(Cache &cache)
+        {
+            cache.addresses.resize(_batchSize);
+            size_t refilled{};
+            {
+                std::lock_guard<std::mutex> poolLock(_poolMutex);
+                refilled = _pool.AllocateBatch(cache.addresses.data(), _batchSize);
+                for (size_t i = 0; i < refilled; i++)
+                {
+                    SetState(IndexOf(cache.addresses[i]), POOLED, CACHED);
+                }
+            }
+            cache.addresses.resize(refilled);
+        }
+
+        /**
+         * @brief Hands out the most recently cached address.
+         * @param cache A non-empty cache (already locked).
+         * @return The address.
+         */
+        AddressType Take(Cache &cache)
+        {
+            const AddressType cAddress = cache.addresses.back();
+            cache.addresses.pop_back();
+            SetState(IndexOf(cAddress), CACHED, LEASED);
+            return cAddress;
+        }
+
+        /**
+         * @brief Returns cached addresses to the shared pool until the given number is left.
+         * @param cache The cache (already locked, as is the shared pool).
+         * @param cKeep The number of addresses to keep.
+         */
+        void ReturnToPool(Cache &cache, const size_t &cKeep)
+        {
+            while (cache.addresses.size() > cKeep)
+            {
+                const AddressType cReturned = cache.addresses.back();
+                _pool.Free(cReturned);
+                cache.addresses.pop_back();
+                SetState(IndexOf(cReturned), CACHED, POOLED);
+            }
+            _returns.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief Takes an address from any cache or the shared pool once the calling thread's cache is exhausted.
+         *
+         * Called without holding any cache lock, so every cache is locked in turn (blocking) and the shared pool
+         * is checked after them. The scan repeats while addresses were returned from caches to the shared pool
+         * meanwhile, so an address free for the whole call is always found.
+         *
+         * @param address The allocated address.
+         * @return `true` if an address was found, `false` otherwise.
+         */
+        bool StealFromOtherCaches(AddressType &address)
+        {
+            uint64_t returns = _returns.load(std::memory_order_acquire);
+            while (true)
+            {
+                for (size_t i = 0; i < _cacheCount; i++)
+                {
+                    std::lock_guard<std::mutex> otherLock(_caches[i].mutex);
+                    if (!_caches[i].addresses.empty())
+                    {
+                        address = Take(_caches[i]);
+                        return true;
+                    }
+                }
+
+                {
+                    std::lock_guard<std::mutex> poolLock(_poolMutex);
+                    if (_pool.TryAllocate(address))
+                    {
+                        SetState(IndexOf(address), POOLED, LEASED);
+                        return true;
+                    }
+                }
+
+                const uint64_t cReturns = _returns.load(std::memory_order_acquire);
+                if (cReturns == returns)
+                {
+                    return false;
+                }
+                returns = cReturns;
+            }
+        }
+
+        /**
+         * @brief Error message indicating a zero batch size.
+         */
+        static constexpr char INVALID_BATCH_SIZE[]{"[EthernetParameter::ConcurrentAddressPool] Batch size must not be zero!"};
+
+        /**
+         * @brief Error message indicating an exhausted pool.
+         */
+        static constexpr char POOL_EXHAUSTED[]{"[EthernetParameter::ConcurrentAddressPool] Address pool exhausted!"};
+
+        /**
+         * @brief Error message indicating an address freed while it sits in a cache (double free).
+         */
+        static constexpr char ADDRESS_NOT_ALLOCATED[]{"[EthernetParameter::ConcurrentAddressPool] Address is not allocated!"};
+    }; /* class ConcurrentAddressPool */
+
+    /**
+     * @brief Thread-safe IPv4 address pool.
+     */
+    using ConcurrentIPv4AddressPool = ConcurrentAddressPool<IPv4AddressPool, IPv4Address>;
+
+    /**
+     * @brief Thread-safe IPv6 address pool.
+     */
+    using ConcurrentIPv6AddressPool = ConcurrentAddressPool<IPv6AddressPool, IPv6Address>;
+}
+
+#endif /* CONCURRENTADDRESSPOOL_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,246 @@
+/**
+ * @file IPv4AddressPool.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4AddressPool (IPAM allocator) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV4ADDRESSPOOL_H
+#define IPV4ADDRESSPOOL_H
+#include "AddressBitmap.hpp"
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv4Address/IPv4Prefix.hpp"
+#include "IPv4Address/IPv4Range.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv4AddressPool
+     * @brief Allocates IPv4 addresses from a prefix or range.
+     *
+     * Used addresses are tracked in a hierarchical bitmap, so allocation always returns the lowest
+     * free address and both allocation and release take a constant number of word operations.
+     * Reserved addresses (e.g. gateway, broadcast) are never handed out and cannot be freed.
+     */
+    class IPv4AddressPool
+    {
+    public:
+        /**
+         * @brief Binary snapshot format version.
+         */
+        static constexpr uint8_t BINARY_FORMAT_VERSION = 1;
+
+        /**
+         * @brief Constructor for the IPv4AddressPool class that covers a whole prefix.
+         * @param cPrefix The prefix to allocate addresses from.
+         */
+        explicit IPv4AddressPool(const IPv4Prefix &cPrefix);
+
+        /**
+         * @brief Constructor for the IPv4AddressPool class that covers a range.
+         * @param cRange The range to allocate addresses from.
+         */
+        explicit IPv4AddressPool(const IPv4Range &cRange);
+
+        /**
+         * @brief Constructor for the IPv4AddressPool class that restores a binary snapshot.
+         * @param cBinaryPool The snapshot created by ToBinary().
+         * @throws std::invalid_argument If the snapshot is malformed.
+         */
+        explicit IPv4AddressPool(const std::vector<uint8_t> &cBinaryPool);
+
+        /**
+         * @brief Returns the range covered by the pool.
+         * @return The IPv4 range.
+         */
+        IPv4Range GetRange() const;
+
+        /**
+         * @brief Returns the number of addresses in the pool.
+         * @return The number of addresses.
+         */
+        uint64_t Size() const;
+
+        /**
+         * @brief Returns the number of addresses that can still be allocated.
+         * @return The number of free addresses.
+         */
+        uint64_t Available() const;
+
+        /**
+         * @brief Allocates the lowest free address.
+         * @return The allocated IPv4 address.
+         * @throws std::runtime_error If the pool is exhausted.
+         */
+        IPv4Address Allocate();
+
+        /**
+         * @brief Allocates the lowest free address without throwing.
+         * @param address The allocated IPv4 address, untouched if the pool is exhausted.
+         * @return `true` if an address was allocated, `false` if the pool is exhausted.
+         */
+        bool TryAllocate(IPv4Address &address);
+
+        /**
+         * @brief Allocates a specific address.
+         * @param cAddress The IPv4 address to allocate.
+         * @return `true` if the address was free and is now allocated, `false` if it was already used or reserved.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         */
+        bool Allocate(const IPv4Address &cAddress);
+
+        /**
+         * @brief Allocates up to the given number of addresses.
+         * @param destAddressPtr Pointer to the destination array for the allocated addresses.
+         * @param cCount The number of addresses to allocate.
+         * @return The number of addresses actually allocated (lower than cCount if the pool got exhausted).
+         * @throws std::invalid_argument If the destination pointer is null and cCount is not zero.
+         */
+        size_t AllocateBatch(IPv4Address *destAddressPtr, const size_t &cCount);
+
+        /**
+         * @brief Returns an allocated address to the pool.
+         * @param cAddress The IPv4 address to release.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is not allocated or is reserved.
+         */
+        void Free(const IPv4Address &cAddress);
+
+        /**
+         * @brief Reserves an address so it is never allocated.
+         * @param cAddress The IPv4 address to reserve.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is already allocated.
+         */
+        void Reserve(const IPv4Address &cAddress);
+
+        /**
+         * @brief Reserves all addresses of a range that belong to the pool.
+         * @param cRange The IPv4 range to reserve.
+         * @throws std::invalid_argument If any address of the range is already allocated, nothing is reserved then.
+         */
+        void Reserve(const IPv4Range &cRange);
+
+        /**
+         * @brief Removes a reservation, making the address free again.
+         * @param cAddress The IPv4 address to unreserve.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is not reserved.
+         */
+        void Unreserve(const IPv4Address &cAddress);
+
+        /**
+         * @brief Checks whether the address is allocated (reserved addresses count as allocated).
+         * @param cAddress The IPv4 address to check.
+         * @return `true` if the address is used, `false` if it is free or outside of the pool.
+         */
+        bool IsAllocated(const IPv4Address &cAddress) const;
+
+        /**
+         * @brief Checks whether the address is reserved.
+         * @param cAddress The IPv4 address to check.
+         * @return `true` if the address is reserved, `false` otherwise.
+         */
+        bool IsReserved(const IPv4Address &cAddress) const;
+
+        /**
+         * @brief Returns a binary snapshot of the pool.
+         *
+         * Layout: version (1 byte), family (1 byte, 4), first and last address in binary form (4 + 4 bytes),
+         * followed by the allocation and reservation bitmaps as little-endian 64-bit words.
+         *
+         * @return The snapshot.
+         */
+        std::vector<uint8_t> ToBinary() const;
+
+        /**
+         * @brief Replaces the pool state with a binary snapshot.
+         * @param cBinaryPool The snapshot created by ToBinary().
+         * @throws std::invalid_argument If the snapshot is malformed.
+         */
+        void SetFromBinary(const std::vector<uint8_t> &cBinaryPool);
+
+    private:
+        /**
+         * @brief Range covered by the pool.
+         */
+        IPv4Range _range;
+
+        /**
+         * @brief Used addresses (allocated or reserved).
+         */
+        AddressBitmap _used;
+
+        /**
+         * @brief Reserved addresses.
+         */
+        AddressBitmap _reserved;
+
+        /**
+         * @brief Returns the pool index of the address.
+         * @param cAddress The IPv4 address.
+         * @return The index of the address within the pool.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         */
+        uint64_t IndexOf(const IPv4Address &cAddress) const;
+
+        /**
+         * @brief Address family tag used in binary snapshots.
+         */
+        static constexpr uint8_t BINARY_FAMILY = 4;
+
+        /**
+         * @brief Error message indicating an exhausted pool.
+         */
+        static constexpr char POOL_EXHAUSTED[]{"[EthernetParameter::IPv4AddressPool] Address pool exhausted!"};
+
+        /**
+         * @brief Error message indicating an address outside of the pool.
+         */
+        static constexpr char ADDRESS_OUT_OF_POOL[]{"[EthernetParameter::IPv4AddressPool] Address does not belong to the pool!"};
+
+        /**
+         * @brief Error message indicating release of an address that is not allocated.
+         */
+        static constexpr char ADDRESS_NOT_ALLOCATED[]{"[EthernetParameter::IPv4AddressPool] Address is not allocated!"};
+
+        /**
+         * @brief Error message indicating an operation on an already allocated address.
+         */
+        static constexpr char ADDRESS_ALREADY_ALLOCATED[]{"[EthernetParameter::IPv4AddressPool] Address is already allocated!"};
+
+        /**
+         * @brief Error message indicating an operation on a reserved address.
+         */
+        static constexpr char ADDRESS_RESERVED[]{"[EthernetParameter::IPv4AddressPool] Address is reserved!"};
+
+        /**
+         * @brief Error message indicating an address that is not reserved.
+         */
+        static constexpr char ADDRESS_NOT_RESERVED[]{"[EthernetParameter::IPv4AddressPool] Address is not reserved!"};
+
+        /**
+         * @brief Error message indicating a malformed binary snapshot.
+         */
+        static constexpr char INVALID_BINARY_POOL[]{"[EthernetParameter::IPv4AddressPool] Invalid binary pool snapshot!"};
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::IPv4AddressPool] Null pointer encountered!"};
+    }; /* class IPv4AddressPool */
+}
+
+#endif /* IPV4ADDRESSPOOL_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,396 @@
+/**
+ * @file IPv6AddressPool.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv6AddressPool (IPAM allocator) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv6AddressPool.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the IPv6AddressPool class that covers a whole prefix.
+     *
+     * @param cPrefix The prefix to allocate addresses from.
+     * @throw std::invalid_argument If the prefix holds more than 2^32 addresses.
+     */
+    IPv6AddressPool::IPv6AddressPool(const IPv6Prefix &cPrefix)
+        : IPv6AddressPool(cPrefix.ToRange())
+    {
+    } /* IPv6AddressPool::IPv6AddressPool(const IPv6Prefix &cPrefix) */
+
+    /**
+     * @brief Constructor for the IPv6AddressPool class that covers a window at the start of a prefix.
+     *
+     * The bitmaps only cover the window, so a /64 can be served without allocating 2^64 bits.
+     *
+     * @param cPrefix The prefix to allocate addresses from.
+     * @param cWindowSize The number of addresses of the window.
+     * @throw std::invalid_argument If the window size is zero or larger than 2^32.
+     */
+    IPv6AddressPool::IPv6AddressPool(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize)
+        : IPv6AddressPool(Window(cPrefix, cWindowSize))
+    {
+    } /* IPv6AddressPool::IPv6AddressPool(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize) */
+
+    /**
+     * @brief Constructor for the IPv6AddressPool class that covers a range.
+     * @param cRange The range to allocate addresses from.
+     * @throw std::invalid_argument If the range holds more than 2^32 addresses.
+     */
+    IPv6AddressPool::IPv6AddressPool(const IPv6Range &cRange)
+        : _range{cRange}, _used{CheckedSize(cRange)}, _reserved{cRange.Size()}
+    {
+    } /* IPv6AddressPool::IPv6AddressPool(const IPv6Range &cRange) */
+
+    /**
+     * @brief Constructor for the IPv6AddressPool class that restores a binary snapshot.
+     * @param cBinaryPool The snapshot created by ToBinary().
+     * @throw std::invalid_argument If the snapshot is malformed.
+     */
+    IPv6AddressPool::IPv6AddressPool(const std::vector<uint8_t> &cBinaryPool)
+        : IPv6AddressPool(IPv6Range(IPv6Address(), IPv6Address()))
+    {
+        SetFromBinary(cBinaryPool);
+    } /* IPv6AddressPool::IPv6AddressPool(const std::vector<uint8_t> &cBinaryPool) */
+
+    /**
+     * @brief Returns the range covered by the pool.
+     * @return The IPv6 range.
+     */
+    IPv6Range IPv6AddressPool::GetRange() const
+    {
+        return _range;
+    } /* IPv6Range IPv6AddressPool::GetRange() const */
+
+    /**
+     * @brief Returns the number of addresses in the pool.
+     * @return The number of addresses.
+     */
+    uint64_t IPv6AddressPool::Size() const
+    {
+        return _used.Size();
+    } /* uint64_t IPv6AddressPool::Size() const */
+
+    /**
+     * @brief Returns the number of addresses that can still be allocated.
+     * @return The number of free addresses.
+     */
+    uint64_t IPv6AddressPool::Available() const
+    {
+        return _used.Size() - _used.Count();
+    } /* uint64_t IPv6AddressPool::Available() const */
+
+    /**
+     * @brief Allocates the lowest free address.
+     * @return The allocated IPv6 address.
+     * @throw std::runtime_error If the pool is exhausted.
+     */
+    IPv6Address IPv6AddressPool::Allocate()
+    {
+        IPv6Address address{};
+        if (!TryAllocate(address))
+        {
+            throw std::runtime_error(POOL_EXHAUSTED);
+        }
+
+        return address;
+    } /* IPv6Address IPv6AddressPool::Allocate() */
+
+    /**
+     * @brief Allocates the lowest free address without throwing.
+     * @param address The allocated IPv6 address, untouched if the pool is exhausted.
+     * @return `true` if an address was allocated, `false` if the pool is exhausted.
+     */
+    bool IPv6AddressPool::TryAllocate(IPv6Address &address)
+    {
+        const uint64_t cIndex = _used.FindFirstZero();
+        if (cIndex == _used.Size())
+        {
+            return false;
+        }
+
+        _used.Set(cIndex);
+        address = _range[cIndex];
+        return true;
+    } /* bool IPv6AddressPool::TryAllocate(IPv6Address &address) */
+
+    /**
+     * @brief Allocates a specific address.
+     * @param cAddress The IPv6 address to allocate.
+     * @return `true` if the address was free and is now allocated, `false` if it was already used or reserved.
+     * @throw std::out_of_range If the address does not belong to the pool.
+     */
+    bool IPv6AddressPool::Allocate(const IPv6Address &cAddress)
+    {
+        const uint64_t cIndex = IndexOf(cAddress);
+        if (_used.Test(cIndex))
+        {
+            return false;
+        }
+
+        _used.Set(cIndex);
+        return true;
+    } /* bool IPv6AddressPool::Allocate(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Allocates up to the given number of addresses.
+     * @param destAddressPtr Pointer to the destination array for the allocated addresses.
+     * @param cCount The number of addresses to allocate.
+     * @return The number of addresses actually allocated.
+     * @throw std::invalid_argument If the destination pointer is null and cCount is not zero.
+     */
+    size_t IPv6AddressPool::AllocateBatch(IPv6Address *destAddressPtr, const size_t &cCount)
+    {
+        if (!destAddressPtr && cCount != 0)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        size_t allocated{};
+        while (allocated < cCount && TryAllocate(destAddressPtr[allocated]))
+        {
+            allocated++;
+        }
+
+        return allocated;
+    } /* size_t IPv6AddressPool::AllocateBatch(IPv6Address *destAddressPtr, const size_t &cCount) */
+
+    /**
+     * @brief Returns an allocated address to the pool.
+     * @param cAddress The IPv6 address to release.
+     * @throw std::out_of_range If the address does not belong to the pool.
+     * @throw std::invalid_argument If the address is not allocated or is reserved.
+     */
+    void IPv6AddressPool::Free(const IPv6Address &cAddress)
+    {
+        const uint64_t cIndex = IndexOf(cAddress);
+        if (_reserved.Test(cIndex))
+        {
+            throw std::invalid_argument(ADDRESS_RESERVED);
+        }
+        if (!_used.Test(cIndex))
+        {
+            throw std::invalid_argument(ADDRESS_NOT_ALLOCATED);
+        }
+
+        _used.Reset(cIndex);
+    } /* void IPv6AddressPool::Free(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Reserves an address so it is never allocated.
+     * @param cAddress The IPv6 address to reserve.
+     * @throw std::out_of_range If the address does not belong to the pool.
+     * @throw std::invalid_argument If the address is already allocated.
+     */
+    void IPv6AddressPool::Reserve(const IPv6Address &cAddress)
+    {
+        const uint64_t cIndex = IndexOf(cAddress);
+        if (_reserved.Test(cIndex))
+        {
+            return;
+        }
+        if (_used.Test(cIndex))
+        {
+            throw std::invalid_argument(ADDRESS_ALREADY_ALLOCATED);
+        }
+
+        _used.Set(cIndex);
+        _reserved.Set(cIndex);
+    } /* void IPv6AddressPool::Reserve(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Reserves all addresses of a range that belong to the pool.
+     * @param cRange The IPv6 range to reserve.
+     * @throw std::invalid_argument If any address of the range is already allocated, nothing is reserved then.
+     */
+    void IPv6AddressPool::Reserve(const IPv6Range &cRange)
+    {
+        const IPv6Address cFirst = cRange.GetFirst() < _range.GetFirst() ? _range.GetFirst() : cRange.GetFirst();
+        const IPv6Address cLast = cRange.GetLast() > _range.GetLast() ? _range.GetLast() : cRange.GetLast();
+        if (cFirst > cLast)
+        {
+            return;
+        }
+
+        // Check the whole range first so a failing call leaves the pool unchanged.
+        const uint64_t cFirstIndex = IndexOf(cFirst);
+        const uint64_t cLastIndex = IndexOf(cLast);
+        for (uint64_t index = cFirstIndex; index <= cLastIndex; index++)
+        {
+            if (_used.Test(index) && !_reserved.Test(index))
+            {
+                throw std::invalid_argument(ADDRESS_ALREADY_ALLOCATED);
+            }
+        }
+
+        for (uint64_t index = cFirstIndex; index <= cLastIndex; index++)
+        {
+            _used.Set(index);
+            _reserved.Set(index);
+        }
+    } /* void IPv6AddressPool::Reserve(const IPv6Range &cRange) */
+
+    /**
+     * @brief Removes a reservation, making the address free again.
+     * @param cAddress The IPv6 address to unreserve.
+     * @throw std::out_of_range If the address does not belong to the pool.
+     * @throw std::invalid_argument If the address is not reserved.
+     */
+    void IPv6AddressPool::Unreserve(const IPv6Address &cAddress)
+    {
+        const uint64_t cIndex = IndexOf(cAddress);
+        if (!_reserved.Test(cIndex))
+        {
+            throw std::invalid_argument(ADDRESS_NOT_RESERVED);
+        }
+
+        _reserved.Reset(cIndex);
+        _used.Reset(cIndex);
+    } /* void IPv6AddressPool::Unreserve(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Checks whether the address is allocated (reserved addresses count as allocated).
+     * @param cAddress The IPv6 address to check.
+     * @return `true` if the address is used, `false` if it is free or outside of the pool.
+     */
+    bool IPv6AddressPool::IsAllocated(const IPv6Address &cAddress) const
+    {
+        return _range.Contains(cAddress) && _used.Test(cAddress - _range.GetFirst());
+    } /* bool IPv6AddressPool::IsAllocated(const IPv6Address &cAddress) const */
+
+    /**
+     * @brief Checks whether the address is reserved.
+     * @param cAddress The IPv6 address to check.
+     * @return `true` if the address is reserved, `false` otherwise.
+     */
+    bool IPv6AddressPool::IsReserved(const IPv6Address &cAddress) const
+    {
+        return _range.Contains(cAddress) && _reserved.Test(cAddress - _range.GetFirst());
+    } /* bool IPv6AddressPool::IsReserved(const IPv6Address &cAddress) const */
+
+    /**
+     * @brief Returns a binary snapshot of the pool.
+     * @return The snapshot.
+     */
+    std::vector<uint8_t> IPv6AddressPool::ToBinary() const
+    {
+        std::vector<uint8_t> binaryPool{BINARY_FORMAT_VERSION, BINARY_FAMILY};
+        binaryPool.resize(binaryPool.size() + 2 * IPv6Address::IPV6_ADDRESS_BYTE_LENGTH);
+        _range.GetFirst().ToBinary(&binaryPool[2]);
+        _range.GetLast().ToBinary(&binaryPool[2 + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH]);
+        _used.AppendBinary(binaryPool);
+        _reserved.AppendBinary(binaryPool);
+        return binaryPool;
+    } /* std::vector<uint8_t> IPv6AddressPool::ToBinary() const */
+
+    /**
+     * @brief Replaces the pool state with a binary snapshot.
+     * @param cBinaryPool The snapshot created by ToBinary().
+     * @throw std::invalid_argument If the snapshot is malformed.
+     */
+    void IPv6AddressPool::SetFromBinary(const std::vector<uint8_t> &cBinaryPool)
+    {
+        const size_t cHeaderSize = 2 + 2 * IPv6Address::IPV6_ADDRESS_BYTE_LENGTH;
+        if (cBinaryPool.size() < cHeaderSize || cBinaryPool[0] != BINARY_FORMAT_VERSION || cBinaryPool[1] != BINARY_FAMILY)
+        {
+            throw std::invalid_argument(INVALID_BINARY_POOL);
+        }
+
+        const IPv6Address cFirst(&cBinaryPool[2]);
+        const IPv6Address cLast(&cBinaryPool[2 + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH]);
+        if (cLast < cFirst)
+        {
+            throw std::invalid_argument(INVALID_BINARY_POOL);
+        }
+
+        const IPv6Range cRange(cFirst, cLast);
+        if (cRange.Size() > AddressBitmap::MAX_SIZE)
+        {
+            throw std::invalid_argument(INVALID_BINARY_POOL);
+        }
+
+        AddressBitmap used(cRange.Size());
+        AddressBitmap reserved(cRange.Size());
+        if (cBinaryPool.size() != cHeaderSize + used.BinarySize() + reserved.BinarySize())
+        {
+            throw std::invalid_argument(INVALID_BINARY_POOL);
+        }
+
+        used.SetFromBinary(&cBinaryPool[cHeaderSize]);
+        reserved.SetFromBinary(&cBinaryPool[cHeaderSize + used.BinarySize()]);
+
+        _range = cRange;
+        _used = std::move(used);
+        _reserved = std::move(reserved);
+    } /* void IPv6AddressPool::SetFromBinary(const std::vector<uint8_t> &cBinaryPool) */
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Private Methods.
+
+    /**
+     * @brief Returns the number of addresses in the range, checking that it fits into a bitmap.
+     * @param cRange The IPv6 range.
+     * @return The number of addresses.
+     * @throw std::invalid_argument If the range holds more than 2^32 addresses.
+     */
+    uint64_t IPv6AddressPool::CheckedSize(const IPv6Range &cRange)
+    {
+        if (cRange.Size() > AddressBitmap::MAX_SIZE)
+        {
+            throw std::invalid_argument(POOL_TOO_LARGE);
+        }
+
+        return cRange.Size();
+    } /* uint64_t IPv6AddressPool::CheckedSize(const IPv6Range &cRange) */
+
+    /**
+     * @brief Returns the range of the first addresses of a prefix.
+     * @param cPrefix The IPv6 prefix.
+     * @param cWindowSize The number of addresses, capped to the size of the prefix.
+     * @return The IPv6 range.
+     * @throw std::invalid_argument If the window size is zero or larger than 2^32.
+     */
+    IPv6Range IPv6AddressPool::Window(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize)
+    {
+        if (cWindowSize == 0 || cWindowSize > AddressBitmap::MAX_SIZE)
+        {
+            throw std::invalid_argument(INVALID_WINDOW_SIZE);
+        }
+
+        const IPv6Range cPrefixRange = cPrefix.ToRange();
+        IPv6Address last = cPrefixRange.GetFirst();
+        last += static_cast<int64_t>(std::min(cWindowSize, cPrefixRange.Size()) - 1);
+        return IPv6Range(cPrefixRange.GetFirst(), last);
+    } /* IPv6Range IPv6AddressPool::Window(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize) */
+
+    /**
+     * @brief Returns the pool index of the address.
+     * @param cAddress The IPv6 address.
+     * @return The index of the address within the pool.
+     * @throw std::out_of_range If the address does not belong to the pool.
+     */
+    uint64_t IPv6AddressPool::IndexOf(const IPv6Address &cAddress) const
+    {
+        if (!_range.Contains(cAddress))
+        {
+            throw std::out_of_range(ADDRESS_OUT_OF_POOL);
+        }
+
+        return static_cast<uint64_t>(cAddress - _range.GetFirst());
+    } /* uint64_t IPv6AddressPool::IndexOf(const IPv6Address &cAddress) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,289 @@
+/**
+ * @file IPv6AddressPool.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv6AddressPool (IPAM allocator) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV6ADDRESSPOOL_H
+#define IPV6ADDRESSPOOL_H
+#include "AddressBitmap.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include "IPv6Address/IPv6Prefix.hpp"
+#include "IPv6Address/IPv6Range.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv6AddressPool
+     * @brief Allocates IPv6 addresses from a prefix or range.
+     *
+     * Used addresses are tracked in a hierarchical bitmap, so allocation always returns the lowest
+     * free address and both allocation and release take a constant number of word operations.
+     * Reserved addresses (e.g. router anycast) are never handed out and cannot be freed.
+     *
+     * The bitmaps are allocated in full when the pool is built: about 2 bits per address of the
+     * pool (one for used, one for reserved), i.e. 16 KiB for a /112, 4 MiB for a /104 and 1 GiB
+     * for a /96; ConcurrentAddressPool adds 2 more bits per address. The pool holds at most 2^32
+     * addresses. To serve a larger prefix, such as a /64 container subnet, build the pool over a
+     * window of its first addresses and size the window to the expected number of leases.
+     */
+    class IPv6AddressPool
+    {
+    public:
+        /**
+         * @brief Binary snapshot format version.
+         */
+        static constexpr uint8_t BINARY_FORMAT_VERSION = 1;
+
+        /**
+         * @brief Constructor for the IPv6AddressPool class that covers a whole prefix.
+         * @param cPrefix The prefix to allocate addresses from.
+         * @throws std::invalid_argument If the prefix holds more than 2^32 addresses.
+         */
+        explicit IPv6AddressPool(const IPv6Prefix &cPrefix);
+
+        /**
+         * @brief Constructor for the IPv6AddressPool class that covers a window at the start of a prefix.
+         * @param cPrefix The prefix to allocate addresses from, of any length.
+         * @param cWindowSize The number of addresses of the window, at most 2^32; capped to the size of the prefix.
+         * @throws std::invalid_argument If the window size is zero or larger than 2^32.
+         */
+        IPv6AddressPool(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize);
+
+        /**
+         * @brief Constructor for the IPv6AddressPool class that covers a range.
+         * @param cRange The range to allocate addresses from.
+         * @throws std::invalid_argument If the range holds more than 2^32 addresses.
+         */
+        explicit IPv6AddressPool(const IPv6Range &cRange);
+
+        /**
+         * @brief Constructor for the IPv6AddressPool class that restores a binary snapshot.
+         * @param cBinaryPool The snapshot created by ToBinary().
+         * @throws std::invalid_argument If the snapshot is malformed.
+         */
+        explicit IPv6AddressPool(const std::vector<uint8_t> &cBinaryPool);
+
+        /**
+         * @brief Returns the range covered by the pool.
+         * @return The IPv6 range.
+         */
+        IPv6Range GetRange() const;
+
+        /**
+         * @brief Returns the number of addresses in the pool.
+         * @return The number of addresses.
+         */
+        uint64_t Size() const;
+
+        /**
+         * @brief Returns the number of addresses that can still be allocated.
+         * @return The number of free addresses.
+         */
+        uint64_t Available() const;
+
+        /**
+         * @brief Allocates the lowest free address.
+         * @return The allocated IPv6 address.
+         * @throws std::runtime_error If the pool is exhausted.
+         */
+        IPv6Address Allocate();
+
+        /**
+         * @brief Allocates the lowest free address without throwing.
+         * @param address The allocated IPv6 address, untouched if the pool is exhausted.
+         * @return `true` if an address was allocated, `false` if the pool is exhausted.
+         */
+        bool TryAllocate(IPv6Address &address);
+
+        /**
+         * @brief Allocates a specific address.
+         * @param cAddress The IPv6 address to allocate.
+         * @return `true` if the address was free and is now allocated, `false` if it was already used or reserved.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         */
+        bool Allocate(const IPv6Address &cAddress);
+
+        /**
+         * @brief Allocates up to the given number of addresses.
+         * @param destAddressPtr Pointer to the destination array for the allocated addresses.
+         * @param cCount The number of addresses to allocate.
+         * @return The number of addresses actually allocated (lower than cCount if the pool got exhausted).
+         * @throws std::invalid_argument If the destination pointer is null and cCount is not zero.
+         */
+        size_t AllocateBatch(IPv6Address *destAddressPtr, const size_t &cCount);
+
+        /**
+         * @brief Returns an allocated address to the pool.
+         * @param cAddress The IPv6 address to release.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is not allocated or is reserved.
+         */
+        void Free(const IPv6Address &cAddress);
+
+        /**
+         * @brief Reserves an address so it is never allocated.
+         * @param cAddress The IPv6 address to reserve.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is already allocated.
+         */
+        void Reserve(const IPv6Address &cAddress);
+
+        /**
+         * @brief Reserves all addresses of a range that belong to the pool.
+         * @param cRange The IPv6 range to reserve.
+         * @throws std::invalid_argument If any address of the range is already allocated, nothing is reserved then.
+         */
+        void Reserve(const IPv6Range &cRange);
+
+        /**
+         * @brief Removes a reservation, making the address free again.
+         * @param cAddress The IPv6 address to unreserve.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         * @throws std::invalid_argument If the address is not reserved.
+         */
+        void Unreserve(const IPv6Address &cAddress);
+
+        /**
+         * @brief Checks whether the address is allocated (reserved addresses count as allocated).
+         * @param cAddress The IPv6 address to check.
+         * @return `true` if the address is used, `false` if it is free or outside of the pool.
+         */
+        bool IsAllocated(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Checks whether the address is reserved.
+         * @param cAddress The IPv6 address to check.
+         * @return `true` if the address is reserved, `false` otherwise.
+         */
+        bool IsReserved(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Returns a binary snapshot of the pool.
+         *
+         * Layout: version (1 byte), family (1 byte, 6), first and last address in binary form (16 + 16 bytes),
+         * followed by the allocation and reservation bitmaps as little-endian 64-bit words.
+         *
+         * @return The snapshot.
+         */
+        std::vector<uint8_t> ToBinary() const;
+
+        /**
+         * @brief Replaces the pool state with a binary snapshot.
+         * @param cBinaryPool The snapshot created by ToBinary().
+         * @throws std::invalid_argument If the snapshot is malformed.
+         */
+        void SetFromBinary(const std::vector<uint8_t> &cBinaryPool);
+
+    private:
+        /**
+         * @brief Range covered by the pool.
+         */
+        IPv6Range _range;
+
+        /**
+         * @brief Used addresses (allocated or reserved).
+         */
+        AddressBitmap _used;
+
+        /**
+         * @brief Reserved addresses.
+         */
+        AddressBitmap _reserved;
+
+        /**
+         * @brief Returns the number of addresses in the range, checking that it fits into a bitmap.
+         * @param cRange The IPv6 range.
+         * @return The number of addresses.
+         * @throws std::invalid_argument If the range holds more than 2^32 addresses.
+         */
+        static uint64_t CheckedSize(const IPv6Range &cRange);
+
+        /**
+         * @brief Returns the range of the first addresses of a prefix.
+         * @param cPrefix The IPv6 prefix.
+         * @param cWindowSize The number of addresses, capped to the size of the prefix.
+         * @return The IPv6 range.
+         * @throws std::invalid_argument If the window size is zero or larger than 2^32.
+         */
+        static IPv6Range Window(const IPv6Prefix &cPrefix, const uint64_t &cWindowSize);
+
+        /**
+         * @brief Returns the pool index of the address.
+         * @param cAddress The IPv6 address.
+         * @return The index of the address within the pool.
+         * @throws std::out_of_range If the address does not belong to the pool.
+         */
+        uint64_t IndexOf(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Address family tag used in binary snapshots.
+         */
+        static constexpr uint8_t BINARY_FAMILY = 6;
+
+        /**
+         * @brief Error message indicating a range that does not fit into a bitmap.
+         */
+        static constexpr char POOL_TOO_LARGE[]{"[EthernetParameter::IPv6AddressPool] Address pool larger than 2^32 addresses!"};
+
+        /**
+         * @brief Error message indicating a window size that is zero or does not fit into a bitmap.
+         */
+        static constexpr char INVALID_WINDOW_SIZE[]{"[EthernetParameter::IPv6AddressPool] Invalid address pool window size!"};
+
+        /**
+         * @brief Error message indicating an exhausted pool.
+         */
+        static constexpr char POOL_EXHAUSTED[]{"[EthernetParameter::IPv6AddressPool] Address pool exhausted!"};
+
+        /**
+         * @brief Error message indicating an address outside of the pool.
+         */
+        static constexpr char ADDRESS_OUT_OF_POOL[]{"[EthernetParameter::IPv6AddressPool] Address does not belong to the pool!"};
+
+        /**
+         * @brief Error message indicating release of an address that is not allocated.
+         */
+        static constexpr char ADDRESS_NOT_ALLOCATED[]{"[EthernetParameter::IPv6AddressPool] Address is not allocated!"};
+
+        /**
+         * @brief Error message indicating an operation on an already allocated address.
+         */
+        static constexpr char ADDRESS_ALREADY_ALLOCATED[]{"[EthernetParameter::IPv6AddressPool] Address is already allocated!"};
+
+        /**
+         * @brief Error message indicating an operation on a reserved address.
+         */
+        static constexpr char ADDRESS_RESERVED[]{"[EthernetParameter::IPv6AddressPool] Address is reserved!"};
+
+        /**
+         * @brief Error message indicating an address that is not reserved.
+         */
+        static constexpr char ADDRESS_NOT_RESERVED[]{"[EthernetParameter::IPv6AddressPool] Address is not reserved!"};
+
+        /**
+         * @brief Error message indicating a malformed binary snapshot.
+         */
+        static constexpr char INVALID_BINARY_POOL[]{"[EthernetParameter::IPv6AddressPool] Invalid binary pool snapshot!"};
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::IPv6AddressPool] Null pointer encountered!"};
+    }; /* class IPv6AddressPool */
+}
+
+#endif /* IPV6ADDRESSPOOL_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
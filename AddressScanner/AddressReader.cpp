@@ -0,0 +1,238 @@
+/**
+ * @file AddressReader.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressReader (buffered address list reader for streams and files) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressReader.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Longest text IPv6Address::TryParse() accepts; longer tokens are rejected unread.
+         */
+        constexpr size_t MAX_TOKEN_LENGTH = 45;
+
+        /**
+         * @brief Returns whether a character ends a token.
+         * @param cCharacter The character.
+         * @return `true` for whitespace and '#'.
+         */
+        constexpr bool IsDelimiter(const char &cCharacter)
+        {
+            return cCharacter == ' ' || cCharacter == '\n' || cCharacter == '\t' || cCharacter == '\r' || cCharacter == '\v' || cCharacter == '\f' || cCharacter == '#';
+        }
+    }
+
+    /**
+     * @brief Constructor for a reader of a stream.
+     * @param input The stream. Must outlive the reader.
+     * @param cBufferSize The size of the read buffer.
+     * @throw std::invalid_argument If the buffer size is below MIN_BUFFER_SIZE.
+     */
+    AddressReader::AddressReader(std::istream &input, const size_t &cBufferSize)
+        : _stream{&input}, _capacity{cBufferSize}
+    {
+        if (cBufferSize < MIN_BUFFER_SIZE)
+        {
+            throw std::invalid_argument(BUFFER_TOO_SMALL);
+        }
+        _buffer.reset(new char[cBufferSize]);
+    } /* AddressReader::AddressReader(std::istream &input, const size_t &cBufferSize) */
+
+    /**
+     * @brief Constructor for a reader of a C file.
+     * @param input The file, opened for reading. Must stay open while the reader is used.
+     * @param cBufferSize The size of the read buffer.
+     * @throw std::invalid_argument If the file is null or the buffer size is below MIN_BUFFER_SIZE.
+     */
+    AddressReader::AddressReader(std::FILE *input, const size_t &cBufferSize)
+        : _file{input}, _capacity{cBufferSize}
+    {
+        if (!input)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (cBufferSize < MIN_BUFFER_SIZE)
+        {
+            throw std::invalid_argument(BUFFER_TOO_SMALL);
+        }
+        _buffer.reset(new char[cBufferSize]);
+    } /* AddressReader::AddressReader(std::FILE *input, const size_t &cBufferSize) */
+
+    /**
+     * @brief Reads the next IPv4 address.
+     * @param address Receives the address.
+     * @return `true` if an address was read, `false` at the end of the input.
+     * @throw std::runtime_error If the next token is not a valid IPv4 address, or reading the input fails.
+     */
+    bool AddressReader::Next(IPv4Address &address)
+    {
+        size_t length{};
+        if (!NextToken(length))
+        {
+            return false;
+        }
+        const char *cToken = _buffer.get() + _begin;
+        _begin += length;
+        if (!IPv4Address::TryParse(cToken, length, address))
+        {
+            ThrowAtLine(INVALID_ADDRESS);
+        }
+        return true;
+    } /* bool AddressReader::Next(IPv4Address &address) */
+
+    /**
+     * @brief Reads the next IPv6 address.
+     * @param address Receives the address.
+     * @return `true` if an address was read, `false` at the end of the input.
+     * @throw std::runtime_error If the next token is not a valid IPv6 address, or reading the input fails.
+     */
+    bool AddressReader::Next(IPv6Address &address)
+    {
+        size_t length{};
+        if (!NextToken(length))
+        {
+            return false;
+        }
+        const char *cToken = _buffer.get() + _begin;
+        _begin += length;
+        if (!IPv6Address::TryParse(cToken, length, address))
+        {
+            ThrowAtLine(INVALID_ADDRESS);
+        }
+        return true;
+    } /* bool AddressReader::Next(IPv6Address &address) */
+
+    // Private Methods.
+
+    /**
+     * @brief Finds the next token, reading more input as needed.
+     * @param length Receives the length of the token at _begin.
+     * @return `true` if a token was found, `false` at the end of the input.
+     * @throw std::runtime_error If the token is longer than any address (it is skipped), or reading the input fails.
+     */
+    bool AddressReader::NextToken(size_t &length)
+    {
+        // Skip whitespace and comments.
+        for (;;)
+        {
+            if (_begin == _end && !Fill())
+            {
+                return false;
+            }
+            const char *cText = _buffer.get();
+            if (_comment)
+            {
+                const void *cNewline = std::memchr(cText + _begin, '\n', _end - _begin);
+                if (!cNewline)
+                {
+                    _begin = _end;
+                    continue;
+                }
+                _begin = static_cast<size_t>(static_cast<const char *>(cNewline) - cText);
+                _comment = false;
+            }
+
+            const char cCharacter = cText[_begin];
+            if (!IsDelimiter(cCharacter))
+            {
+                break;
+            }
+            _line += cCharacter == '\n';
+            _comment = cCharacter == '#';
+            _begin++;
+        }
+
+        // The token ends at a delimiter or at the end of the input. A token too long for any
+        // address is dropped as it is scanned, so it never has to fit the buffer.
+        _tokenLine = _line;
+        length = 0;
+        bool tooLong{};
+        for (;;)
+        {
+            while (_begin + length < _end && !IsDelimiter(_buffer[_begin + length]))
+            {
+                if (++length > MAX_TOKEN_LENGTH)
+                {
+                    tooLong = true;
+                    _begin += length;
+                    length = 0;
+                }
+            }
+            if (_begin + length < _end || !Fill())
+            {
+                break;
+            }
+        }
+        if (tooLong)
+        {
+            _begin += length;
+            ThrowAtLine(INVALID_ADDRESS);
+        }
+        return true;
+    } /* bool AddressReader::NextToken(size_t &length) */
+
+    /**
+     * @brief Moves the unread text to the front of the buffer and reads more input after it.
+     * @return The number of bytes read, 0 at the end of the input.
+     * @throw std::runtime_error If reading the input fails.
+     */
+    size_t AddressReader::Fill()
+    {
+        char *buffer = _buffer.get();
+        if (_begin)
+        {
+            std::memmove(buffer, buffer + _begin, _end - _begin);
+            _end -= _begin;
+            _begin = 0;
+        }
+
+        size_t count{};
+        if (_stream)
+        {
+            _stream->read(buffer + _end, static_cast<std::streamsize>(_capacity - _end));
+            count = static_cast<size_t>(_stream->gcount());
+            if (_stream->bad())
+            {
+                throw std::runtime_error(READ_FAILED);
+            }
+        }
+        else
+        {
+            count = std::fread(buffer + _end, 1, _capacity - _end, _file);
+            if (!count && std::ferror(_file))
+            {
+                throw std::runtime_error(READ_FAILED);
+            }
+        }
+        _end += count;
+        return count;
+    } /* size_t AddressReader::Fill() */
+
+    /**
+     * @brief Throws the error for an invalid token on the current line.
+     * @param cMessage The error message, completed with the line number.
+     * @throw std::runtime_error Always.
+     */
+    void AddressReader::ThrowAtLine(const char *cMessage) const
+    {
+        throw std::runtime_error(cMessage + std::to_string(_tokenLine) + "!");
+    } /* void AddressReader::ThrowAtLine(const char *cMessage) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
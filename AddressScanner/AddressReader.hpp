@@ -0,0 +1,185 @@
+/**
+ * @file AddressReader.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressReader (buffered address list reader for streams and files) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSREADER_H
+#define ADDRESSREADER_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <istream>
+#include <memory>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressReader
+     * @brief Reads address lists, e.g. block lists or allow lists, from a stream or a FILE*.
+     *
+     * Addresses are separated by whitespace; '#' starts a comment that runs to the end of the
+     * line. The input is read in blocks into one buffer owned by the reader, and each address is
+     * parsed in place with IPv4Address::TryParse() or IPv6Address::TryParse(), so reading makes
+     * no allocation per address. An address split across two blocks is moved to the front of the
+     * buffer before the next block is read.
+     *
+     * Lines are counted from 1. An invalid address is reported with its line number and skipped,
+     * so reading can go on after the exception.
+     */
+    class AddressReader
+    {
+    public:
+        /**
+         * @brief Default size of the read buffer.
+         */
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 16;
+
+        /**
+         * @brief Smallest read buffer, which holds the longest valid address with room to spare.
+         */
+        static constexpr size_t MIN_BUFFER_SIZE = 64;
+
+        /**
+         * @brief Constructor for a reader of a stream.
+         * @param input The stream. Must outlive the reader.
+         * @param cBufferSize The size of the read buffer.
+         * @throws std::invalid_argument If the buffer size is below MIN_BUFFER_SIZE.
+         */
+        explicit AddressReader(std::istream &input, const size_t &cBufferSize = DEFAULT_BUFFER_SIZE);
+
+        /**
+         * @brief Constructor for a reader of a C file.
+         * @param input The file, opened for reading. Must stay open while the reader is used.
+         * @param cBufferSize The size of the read buffer.
+         * @throws std::invalid_argument If the file is null or the buffer size is below MIN_BUFFER_SIZE.
+         */
+        explicit AddressReader(std::FILE *input, const size_t &cBufferSize = DEFAULT_BUFFER_SIZE);
+
+        /**
+         * @brief Reads the next IPv4 address.
+         * @param address Receives the address.
+         * @return `true` if an address was read, `false` at the end of the input.
+         * @throws std::runtime_error If the next token is not a valid IPv4 address (the message holds
+         *                            its line number), or reading the input fails.
+         */
+        bool Next(IPv4Address &address);
+
+        /**
+         * @brief Reads the next IPv6 address.
+         * @param address Receives the address.
+         * @return `true` if an address was read, `false` at the end of the input.
+         * @throws std::runtime_error If the next token is not a valid IPv6 address (the message holds
+         *                            its line number), or reading the input fails.
+         */
+        bool Next(IPv6Address &address);
+
+        /**
+         * @brief Returns the line of the last token read.
+         * @return The line number, counted from 1.
+         */
+        size_t Line() const { return _tokenLine; }
+
+    private:
+        /**
+         * @brief The stream, nullptr when reading a file.
+         */
+        std::istream *_stream{};
+
+        /**
+         * @brief The file, nullptr when reading a stream.
+         */
+        std::FILE *_file{};
+
+        /**
+         * @brief The read buffer.
+         */
+        std::unique_ptr<char[]> _buffer;
+
+        /**
+         * @brief Size of the read buffer.
+         */
+        size_t _capacity{};
+
+        /**
+         * @brief Start of the unread text in the buffer.
+         */
+        size_t _begin{};
+
+        /**
+         * @brief End of the unread text in the buffer.
+         */
+        size_t _end{};
+
+        /**
+         * @brief Line at _begin.
+         */
+        size_t _line{1};
+
+        /**
+         * @brief Line of the last token read.
+         */
+        size_t _tokenLine{1};
+
+        /**
+         * @brief `true` while _begin is inside a comment.
+         */
+        bool _comment{};
+
+        /**
+         * @brief Finds the next token, reading more input as needed.
+         * @param length Receives the length of the token at _begin.
+         * @return `true` if a token was found, `false` at the end of the input.
+         * @throws std::runtime_error If the token is longer than any address (it is skipped), or reading the input fails.
+         */
+        bool NextToken(size_t &length);
+
+        /**
+         * @brief Moves the unread text to the front of the buffer and reads more input after it.
+         * @return The number of bytes read, 0 at the end of the input.
+         * @throws std::runtime_error If reading the input fails.
+         */
+        size_t Fill();
+
+        /**
+         * @brief Throws the error for an invalid token on the current line.
+         * @param cMessage The error message, completed with the line number.
+         * @throws std::runtime_error Always.
+         */
+        [[noreturn]] void ThrowAtLine(const char *cMessage) const;
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::AddressReader] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a buffer below MIN_BUFFER_SIZE.
+         */
+        static constexpr char BUFFER_TOO_SMALL[]{"[EthernetParameter::AddressReader] Buffer size too small!"};
+
+        /**
+         * @brief Error message indicating a failed read.
+         */
+        static constexpr char READ_FAILED[]{"[EthernetParameter::AddressReader] Reading the input failed!"};
+
+        /**
+         * @brief Error message indicating a token that is not a valid address.
+         */
+        static constexpr char INVALID_ADDRESS[]{"[EthernetParameter::AddressReader] Invalid address at line "};
+    }; /* class AddressReader */
+}
+
+#endif /* ADDRESSREADER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
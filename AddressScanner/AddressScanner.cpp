@@ -0,0 +1,504 @@
+/**
+ * @file AddressScanner.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressScanner (finds IPv4/IPv6 addresses embedded in text) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressScanner.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <cstring>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ADDRESS_SCANNER_SSE2
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ADDRESS_SCANNER_AVX
+#define ADDRESS_SCANNER_AVX2_TARGET __attribute__((target("avx2")))
+#define ADDRESS_SCANNER_AVX512_TARGET __attribute__((target("avx512f,avx512bw")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#define ADDRESS_SCANNER_AVX
+#define ADDRESS_SCANNER_AVX2_TARGET
+#define ADDRESS_SCANNER_AVX512_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Returns the number of trailing zero bits.
+         * @param cWord The word to scan, must not be zero.
+         * @return The index of the lowest set bit.
+         */
+        inline uint32_t CountTrailingZeros(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            unsigned long index{};
+            _BitScanForward64(&index, cWord);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctzll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Checks whether a character is a letter, a digit or '_'.
+         * @param c The character.
+         * @return `true` for word characters, `false` otherwise.
+         */
+        inline bool IsWordCharacter(const char &c)
+        {
+            return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_';
+        }
+
+        /**
+         * @brief Checks whether a character is a decimal digit or '.'.
+         * @param c The character.
+         * @return `true` for IPv4 characters, `false` otherwise.
+         */
+        inline bool IsIPv4Character(const char &c)
+        {
+            return (c >= '0' && c <= '9') || c == '.';
+        }
+
+        /**
+         * @brief Number of bytes a classify kernel reads.
+         */
+        constexpr size_t CLASSIFY_BYTES = 64;
+
+        /**
+         * @brief Classifies CLASSIFY_BYTES bytes one at a time.
+         *
+         * This is the reference every SIMD variant must match.
+         *
+         * @param cBlock The bytes.
+         * @param candidates Bitmask of hexadecimal digits, '.' and ':'.
+         * @param separators Bitmask of '.' and ':'.
+         */
+        void ClassifyScalar(const char *cBlock, uint64_t &candidates, uint64_t &separators)
+        {
+            candidates = 0;
+            separators = 0;
+            for (size_t i = 0; i < CLASSIFY_BYTES; i++)
+            {
+                const char c = cBlock[i];
+                const bool cIsSeparator = c == '.' || c == ':';
+                const bool cIsCandidate = cIsSeparator || (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f');
+                candidates |= static_cast<uint64_t>(cIsCandidate) << i;
+                separators |= static_cast<uint64_t>(cIsSeparator) << i;
+            }
+        }
+
+#if defined(ADDRESS_SCANNER_SSE2)
+        /**
+         * @brief ClassifyScalar() for 16 bytes per step with SSE2: two range checks ('0'..':' and
+         * 'a'..'f' after folding case) and two equality checks.
+         */
+        void ClassifySse2(const char *cBlock, uint64_t &candidates, uint64_t &separators)
+        {
+            const __m128i cDigitBase = _mm_set1_epi8('0');
+            const __m128i cDigitSpan = _mm_set1_epi8(':' - '0');
+            const __m128i cCaseBit = _mm_set1_epi8(0x20);
+            const __m128i cLetterBase = _mm_set1_epi8('a');
+            const __m128i cLetterSpan = _mm_set1_epi8('f' - 'a');
+            const __m128i cDot = _mm_set1_epi8('.');
+            const __m128i cColon = _mm_set1_epi8(':');
+
+            candidates = 0;
+            separators = 0;
+            for (size_t i = 0; i < CLASSIFY_BYTES; i += 16)
+            {
+                const __m128i cBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cBlock + i));
+                const __m128i cDigits = _mm_sub_epi8(cBytes, cDigitBase);
+                const __m128i cIsDigitOrColon = _mm_cmpeq_epi8(_mm_min_epu8(cDigits, cDigitSpan), cDigits);
+                const __m128i cLetters = _mm_sub_epi8(_mm_or_si128(cBytes, cCaseBit), cLetterBase);
+                const __m128i cIsHexLetter = _mm_cmpeq_epi8(_mm_min_epu8(cLetters, cLetterSpan), cLetters);
+                const __m128i cIsDot = _mm_cmpeq_epi8(cBytes, cDot);
+                const __m128i cIsSeparator = _mm_or_si128(cIsDot, _mm_cmpeq_epi8(cBytes, cColon));
+                const __m128i cIsCandidate = _mm_or_si128(_mm_or_si128(cIsDigitOrColon, cIsHexLetter), cIsDot);
+
+                candidates |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(cIsCandidate))) << i;
+                separators |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(cIsSeparator))) << i;
+            }
+        }
+#endif
+
+#if defined(ADDRESS_SCANNER_AVX)
+        /**
+         * @brief ClassifySse2() for 32 bytes per step with AVX2.
+         */
+        ADDRESS_SCANNER_AVX2_TARGET void ClassifyAvx2(const char *cBlock, uint64_t &candidates, uint64_t &separators)
+        {
+            const __m256i cDigitBase = _mm256_set1_epi8('0');
+            const __m256i cDigitSpan = _mm256_set1_epi8(':' - '0');
+            const __m256i cCaseBit = _mm256_set1_epi8(0x20);
+            const __m256i cLetterBase = _mm256_set1_epi8('a');
+            const __m256i cLetterSpan = _mm256_set1_epi8('f' - 'a');
+            const __m256i cDot = _mm256_set1_epi8('.');
+            const __m256i cColon = _mm256_set1_epi8(':');
+
+            candidates = 0;
+            separators = 0;
+            for (size_t i = 0; i < CLASSIFY_BYTES; i += 32)
+            {
+                const __m256i cBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cBlock + i));
+                const __m256i cDigits = _mm256_sub_epi8(cBytes, cDigitBase);
+                const __m256i cIsDigitOrColon = _mm256_cmpeq_epi8(_mm256_min_epu8(cDigits, cDigitSpan), cDigits);
+                const __m256i cLetters = _mm256_sub_epi8(_mm256_or_si256(cBytes, cCaseBit), cLetterBase);
+                const __m256i cIsHexLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(cLetters, cLetterSpan), cLetters);
+                const __m256i cIsDot = _mm256_cmpeq_epi8(cBytes, cDot);
+                const __m256i cIsSeparator = _mm256_or_si256(cIsDot, _mm256_cmpeq_epi8(cBytes, cColon));
+                const __m256i cIsCandidate = _mm256_or_si256(_mm256_or_si256(cIsDigitOrColon, cIsHexLetter), cIsDot);
+
+                candidates |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(cIsCandidate))) << i;
+                separators |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(cIsSeparator))) << i;
+            }
+        }
+
+        /**
+         * @brief ClassifyScalar() for the whole block at once with AVX-512: the byte compares give
+         * the 64-bit masks directly.
+         */
+        ADDRESS_SCANNER_AVX512_TARGET void ClassifyAvx512(const char *cBlock, uint64_t &candidates, uint64_t &separators)
+        {
+            const __m512i cBytes = _mm512_loadu_si512(cBlock);
+            const __mmask64 cIsDigitOrColon = _mm512_cmple_epu8_mask(_mm512_sub_epi8(cBytes, _mm512_set1_epi8('0')), _mm512_set1_epi8(':' - '0'));
+            const __m512i cLetters = _mm512_sub_epi8(_mm512_or_si512(cBytes, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+            const __mmask64 cIsHexLetter = _mm512_cmple_epu8_mask(cLetters, _mm512_set1_epi8('f' - 'a'));
+            const __mmask64 cIsDot = _mm512_cmpeq_epi8_mask(cBytes, _mm512_set1_epi8('.'));
+
+            candidates = static_cast<uint64_t>(cIsDigitOrColon | cIsHexLetter | cIsDot);
+            separators = static_cast<uint64_t>(cIsDot | _mm512_cmpeq_epi8_mask(cBytes, _mm512_set1_epi8(':')));
+        }
+#endif
+
+        /**
+         * @brief The signature shared by the variants of ClassifyScalar().
+         */
+        using ClassifyFunction = void (*)(const char *, uint64_t &, uint64_t &);
+
+        /**
+         * @brief Returns the variant of ClassifyScalar() for a tier.
+         *
+         * Each tier without its own variant takes the one of the tier below it (SSE4.2 adds
+         * nothing this kernel uses).
+         *
+         * @param cTier The tier.
+         * @return The variant.
+         */
+        ClassifyFunction ClassifyKernel(const CpuFeatures::Tier &cTier)
+        {
+            static const ClassifyFunction cTable[CpuFeatures::TIER_COUNT]{
+                ClassifyScalar,
+#if defined(ADDRESS_SCANNER_SSE2)
+                ClassifySse2,
+                ClassifySse2,
+#else
+                ClassifyScalar,
+                ClassifyScalar,
+#endif
+#if defined(ADDRESS_SCANNER_AVX)
+                ClassifyAvx2,
+                ClassifyAvx512,
+#elif defined(ADDRESS_SCANNER_SSE2)
+                ClassifySse2,
+                ClassifySse2,
+#else
+                ClassifyScalar,
+                ClassifyScalar,
+#endif
+            };
+            return cTable[static_cast<uint8_t>(cTier)];
+        }
+    }
+
+    /**
+     * @brief Finds all addresses in a buffer.
+     * @param cData The text to scan.
+     * @param cSize The size of the text in bytes.
+     * @param matches The vector to append the matches to.
+     * @return The number of matches appended.
+     */
+    size_t AddressScanner::Scan(const char *cData, const size_t &cSize, std::vector<Match> &matches)
+    {
+        AddressScanner scanner;
+        const size_t cFound = scanner.Feed(cData, cSize, matches);
+        return cFound + scanner.Finish(matches);
+    } /* size_t AddressScanner::Scan(const char *cData, const size_t &cSize, std::vector<Match> &matches) */
+
+    /**
+     * @brief Scans the next chunk of a stream.
+     *
+     * Each 64 byte block is turned into candidate and separator bitmasks, then runs are walked
+     * with bit scans: the lowest candidate bit starts a run and the lowest non-candidate bit
+     * after it ends the run, so text without addresses costs a few instructions per block.
+     *
+     * @param cData The chunk to scan.
+     * @param cSize The size of the chunk in bytes.
+     * @param matches The vector to append the matches to.
+     * @return The number of matches appended.
+     */
+    size_t AddressScanner::Feed(const char *cData, const size_t &cSize, std::vector<Match> &matches)
+    {
+        if (!cData || cSize == 0)
+        {
+            return 0;
+        }
+
+        size_t found{};
+        bool inRun = _carryLength != 0;
+        bool runFromCarry = inRun;
+        bool runHasSeparator = _carryHasSeparator;
+        size_t runStart{};
+
+        for (size_t base = 0; base < cSize; base += BLOCK_SIZE)
+        {
+            const size_t cBlockSize = cSize - base < BLOCK_SIZE ? cSize - base : BLOCK_SIZE;
+            const uint64_t cValidMask = cBlockSize == BLOCK_SIZE ? UINT64_MAX : (uint64_t{1} << cBlockSize) - 1;
+            uint64_t candidates{};
+            uint64_t separators{};
+            Classify(cData + base, cBlockSize, candidates, separators);
+
+            size_t bit{};
+            while (bit < cBlockSize)
+            {
+                if (!inRun)
+                {
+                    const uint64_t cStarts = candidates >> bit;
+                    if (cStarts == 0)
+                    {
+                        break;
+                    }
+
+                    bit += CountTrailingZeros(cStarts);
+                    runStart = base + bit;
+                    runHasSeparator = false;
+                    inRun = true;
+                }
+
+                const uint64_t cEnds = (~candidates & cValidMask) >> bit;
+                if (cEnds == 0)
+                {
+                    runHasSeparator = runHasSeparator || (separators >> bit) != 0;
+                    break;
+                }
+
+                const size_t cEnd = bit + CountTrailingZeros(cEnds);
+                runHasSeparator = runHasSeparator || ((separators >> bit) & ((uint64_t{1} << (cEnd - bit)) - 1)) != 0;
+                inRun = false;
+
+                if (runFromCarry)
+                {
+                    runFromCarry = false;
+                    const size_t cRunLength = _carryLength + base + cEnd;
+                    if (runHasSeparator && cRunLength <= MAX_RUN_LENGTH)
+                    {
+                        memcpy(_carry + _carryLength, cData, base + cEnd);
+                        found += ProcessRun(_carry, cRunLength, _carryOffset, _beforeCarry, cData[base + cEnd], matches);
+                    }
+                    _carryLength = 0;
+                }
+                else if (runHasSeparator && base + cEnd - runStart <= MAX_RUN_LENGTH)
+                {
+                    const char cBefore = runStart > 0 ? cData[runStart - 1] : _previous;
+                    found += ProcessRun(cData + runStart, base + cEnd - runStart, _chunkOffset + runStart, cBefore, cData[base + cEnd], matches);
+                }
+
+                bit = cEnd + 1;
+            }
+        }
+
+        if (inRun)
+        {
+            // Hold back the run touching the end of the chunk.
+            if (runFromCarry)
+            {
+                if (_carryLength + cSize <= MAX_RUN_LENGTH)
+                {
+                    memcpy(_carry + _carryLength, cData, cSize);
+                }
+                _carryLength += cSize;
+            }
+            else
+            {
+                _carryOffset = _chunkOffset + runStart;
+                _beforeCarry = runStart > 0 ? cData[runStart - 1] : _previous;
+                _carryLength = cSize - runStart;
+                if (_carryLength <= MAX_RUN_LENGTH)
+                {
+                    memcpy(_carry, cData + runStart, _carryLength);
+                }
+            }
+            _carryHasSeparator = runHasSeparator;
+        }
+
+        _previous = cData[cSize - 1];
+        _chunkOffset += cSize;
+        return found;
+    } /* size_t AddressScanner::Feed(const char *cData, const size_t &cSize, std::vector<Match> &matches) */
+
+    /**
+     * @brief Ends the stream, reporting a run held back by the last Feed(), and resets the scanner.
+     * @param matches The vector to append the matches to.
+     * @return The number of matches appended.
+     */
+    size_t AddressScanner::Finish(std::vector<Match> &matches)
+    {
+        size_t found{};
+        if (_carryLength != 0 && _carryHasSeparator && _carryLength <= MAX_RUN_LENGTH)
+        {
+            found = ProcessRun(_carry, _carryLength, _carryOffset, _beforeCarry, 0, matches);
+        }
+
+        Reset();
+        return found;
+    } /* size_t AddressScanner::Finish(std::vector<Match> &matches) */
+
+    /**
+     * @brief Resets the scanner to the start of a new stream.
+     */
+    void AddressScanner::Reset()
+    {
+        _chunkOffset = 0;
+        _previous = 0;
+        _carryOffset = 0;
+        _beforeCarry = 0;
+        _carryLength = 0;
+        _carryHasSeparator = false;
+    } /* void AddressScanner::Reset() */
+
+    // Private Methods.
+
+    /**
+     * @brief Classifies a block of text.
+     *
+     * A short block is copied into a zero-padded buffer, so the kernels always read BLOCK_SIZE
+     * bytes; the kernel of the tier chosen by CpuFeatures is looked up once.
+     *
+     * @param cData The block (cSize bytes are readable).
+     * @param cSize The number of bytes to classify, at most BLOCK_SIZE.
+     * @param candidates Bitmask of hexadecimal digits, '.' and ':'.
+     * @param separators Bitmask of '.' and ':'.
+     */
+    void AddressScanner::Classify(const char *cData, const size_t &cSize, uint64_t &candidates, uint64_t &separators)
+    {
+        static_assert(BLOCK_SIZE == CLASSIFY_BYTES, "The kernels classify a whole block");
+        static const ClassifyFunction cClassify = ClassifyKernel(CpuFeatures::Selected());
+
+        alignas(64) char padded[BLOCK_SIZE];
+        const char *block = cData;
+        if (cSize < BLOCK_SIZE)
+        {
+            memset(padded, 0, BLOCK_SIZE);
+            memcpy(padded, cData, cSize);
+            block = padded;
+        }
+        cClassify(block, candidates, separators);
+    } /* void AddressScanner::Classify(const char *cData, const size_t &cSize, uint64_t &candidates, uint64_t &separators) */
+
+    /**
+     * @brief Validates a candidate run and appends the addresses it contains.
+     * @param cRun The run text.
+     * @param cLength The run length.
+     * @param cOffset The stream offset of the run.
+     * @param cBefore The character before the run (0 if none).
+     * @param cAfter The character after the run (0 if none).
+     * @param matches The vector to append the matches to.
+     * @return The number of matches appended.
+     */
+    size_t AddressScanner::ProcessRun(const char *cRun, const size_t &cLength, const uint64_t &cOffset, const char &cBefore, const char &cAfter, std::vector<Match> &matches)
+    {
+        if (cLength < 3)
+        {
+            return 0;
+        }
+
+        if (!IsWordCharacter(cAfter) && memchr(cRun, ':', cLength))
+        {
+            // A run glued to a word, as in "peer:2001:db8::1" or "id:2001:db8::1", starts with the
+            // letters of that word that are hexadecimal digits and the ':' after them; the address
+            // can only begin behind them. A digit there means the first group of the address is
+            // part of the word ("G2001:db8::1"), and the run is left to the IPv4 check.
+            size_t start{};
+            if (IsWordCharacter(cBefore))
+            {
+                while (start < cLength && cRun[start] >= 'A' && (cRun[start] | 0x20) <= 'f')
+                {
+                    start++;
+                }
+                start = start < cLength && cRun[start] == ':' ? start + 1 : cLength;
+            }
+
+            Match match{};
+            size_t length = start < cLength ? cLength - start : 0;
+            bool parsed = length > 2 && IPv6Address::TryParse(cRun + start, length, match.ipv6);
+            if (!parsed && length > 2 && (cRun[cLength - 1] == '.' || cRun[cLength - 1] == ':'))
+            {
+                parsed = IPv6Address::TryParse(cRun + start, --length, match.ipv6);
+            }
+
+            if (parsed && length > 2)
+            {
+                match.offset = cOffset + start;
+                match.length = static_cast<uint8_t>(length);
+                match.family = Family::IPv6;
+                matches.push_back(match);
+                return 1;
+            }
+        }
+
+        size_t found{};
+        size_t i{};
+        while (i < cLength)
+        {
+            const size_t cSegmentStart = i;
+            while (i < cLength && IsIPv4Character(cRun[i]))
+            {
+                i++;
+            }
+
+            // Each dotted quad is checked against its own neighbours: ':' inside the run, the
+            // characters around the run at its ends.
+            const bool cDelimited = (cSegmentStart == 0 ? !IsWordCharacter(cBefore) : cRun[cSegmentStart - 1] == ':') &&
+                                    (i == cLength ? !IsWordCharacter(cAfter) : cRun[i] == ':');
+            if (cDelimited && i - cSegmentStart >= 7)
+            {
+                size_t length = i - cSegmentStart;
+                if (i == cLength && cRun[i - 1] == '.')
+                {
+                    length--;
+                }
+
+                Match match{};
+                if (IPv4Address::TryParse(cRun + cSegmentStart, length, match.ipv4))
+                {
+                    match.offset = cOffset + cSegmentStart;
+                    match.length = static_cast<uint8_t>(length);
+                    match.family = Family::IPv4;
+                    matches.push_back(match);
+                    found++;
+                }
+            }
+
+            i++;
+        }
+
+        return found;
+    } /* size_t AddressScanner::ProcessRun(const char *cRun, const size_t &cLength, const uint64_t &cOffset, const char &cBefore, const char &cAfter, std::vector<Match> &matches) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
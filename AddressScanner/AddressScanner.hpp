@@ -0,0 +1,176 @@
+/**
+ * @file AddressScanner.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressScanner (finds IPv4/IPv6 addresses embedded in text) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSSCANNER_H
+#define ADDRESSSCANNER_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressScanner
+     * @brief Finds all IPv4 and IPv6 addresses in arbitrary text, e.g. raw log files.
+     *
+     * The text is classified 64 bytes at a time with SIMD compares (SSE2, AVX2 or AVX-512, picked
+     * at runtime by CpuFeatures) into a bitmask of candidate characters (hexadecimal digits, '.'
+     * and ':') and a bitmask of separators ('.' and ':').
+     * Runs of candidate characters are extracted with bit scans, runs without a separator are
+     * skipped, and the remaining ones are validated with IPv6Address::TryParse() and
+     * IPv4Address::TryParse().
+     *
+     * A match must not be directly preceded or followed by a letter, digit or '_' (like a regex
+     * word boundary), so "v1.2.3.4" or "std::" are not reported, while the address of "ip:1.2.3.4"
+     * or "peer:2001:db8::1" is. Within a run, an IPv6 address
+     * takes the whole run (a single trailing '.' or ':' is ignored); otherwise every dotted quad
+     * delimited by the run ends or ':' is reported, which covers "10.0.0.1:8080". Longer dotted
+     * sequences such as "1.2.3.4.5" are not reported.
+     *
+     * Text can be fed in chunks of any size; a run crossing a chunk boundary is carried over.
+     * Match offsets are counted from the start of the stream.
+     */
+    class AddressScanner
+    {
+    public:
+        /**
+         * @brief Address family of a match.
+         */
+        enum class Family : uint8_t
+        {
+            IPv4 = 4,
+            IPv6 = 6
+        };
+
+        /**
+         * @struct Match
+         * @brief A single address found in the text.
+         */
+        struct Match
+        {
+            uint64_t offset{};
+            uint8_t length{};
+            Family family{Family::IPv4};
+            IPv4Address ipv4{};
+            IPv6Address ipv6{};
+        };
+
+        /**
+         * @brief Longest candidate run that is still validated; longer runs (e.g. hex dumps) are skipped.
+         */
+        static constexpr size_t MAX_RUN_LENGTH = 64;
+
+        /**
+         * @brief Finds all addresses in a buffer.
+         * @param cData The text to scan.
+         * @param cSize The size of the text in bytes.
+         * @param matches The vector to append the matches to.
+         * @return The number of matches appended.
+         */
+        static size_t Scan(const char *cData, const size_t &cSize, std::vector<Match> &matches);
+
+        /**
+         * @brief Scans the next chunk of a stream.
+         *
+         * A run touching the end of the chunk is held back until the next Feed() or Finish().
+         *
+         * @param cData The chunk to scan.
+         * @param cSize The size of the chunk in bytes.
+         * @param matches The vector to append the matches to.
+         * @return The number of matches appended.
+         */
+        size_t Feed(const char *cData, const size_t &cSize, std::vector<Match> &matches);
+
+        /**
+         * @brief Ends the stream, reporting a run held back by the last Feed(), and resets the scanner.
+         * @param matches The vector to append the matches to.
+         * @return The number of matches appended.
+         */
+        size_t Finish(std::vector<Match> &matches);
+
+        /**
+         * @brief Resets the scanner to the start of a new stream.
+         */
+        void Reset();
+
+    private:
+        /**
+         * @brief Number of bytes classified at once.
+         */
+        static constexpr size_t BLOCK_SIZE = 64;
+
+        /**
+         * @brief Stream offset of the current chunk.
+         */
+        uint64_t _chunkOffset{};
+
+        /**
+         * @brief Character before the current chunk (0 at stream start).
+         */
+        char _previous{};
+
+        /**
+         * @brief Stream offset of the held back run.
+         */
+        uint64_t _carryOffset{};
+
+        /**
+         * @brief Character before the held back run.
+         */
+        char _beforeCarry{};
+
+        /**
+         * @brief Held back run, valid while _carryLength is not zero.
+         */
+        char _carry[MAX_RUN_LENGTH]{};
+
+        /**
+         * @brief Length of the held back run, may exceed MAX_RUN_LENGTH (then it is only tracked).
+         */
+        size_t _carryLength{};
+
+        /**
+         * @brief Whether the held back run contains a separator.
+         */
+        bool _carryHasSeparator{};
+
+        /**
+         * @brief Classifies a block of text.
+         * @param cData The block (cSize bytes are readable).
+         * @param cSize The number of bytes to classify, at most BLOCK_SIZE.
+         * @param candidates Bitmask of hexadecimal digits, '.' and ':'.
+         * @param separators Bitmask of '.' and ':'.
+         */
+        static void Classify(const char *cData, const size_t &cSize, uint64_t &candidates, uint64_t &separators);
+
+        /**
+         * @brief Validates a candidate run and appends the addresses it contains.
+         * @param cRun The run text.
+         * @param cLength The run length.
+         * @param cOffset The stream offset of the run.
+         * @param cBefore The character before the run (0 if none).
+         * @param cAfter The character after the run (0 if none).
+         * @param matches The vector to append the matches to.
+         * @return The number of matches appended.
+         */
+        static size_t ProcessRun(const char *cRun, const size_t &cLength, const uint64_t &cOffset, const char &cBefore, const char &cAfter, std::vector<Match> &matches);
+    }; /* class AddressScanner */
+}
+
+#endif /* ADDRESSSCANNER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,321 @@
+/**
+ * @file Aes128.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Aes128 (AES-128 block encryption, AES-NI or portable) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "Aes128.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <wmmintrin.h>
+#define AES128_HARDWARE
+#define AES128_TARGET __attribute__((target("aes,sse2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <wmmintrin.h>
+#define AES128_HARDWARE
+#define AES128_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Multiplies two elements of GF(2^8) modulo the AES polynomial.
+         */
+        constexpr uint8_t Multiply(uint8_t a, uint8_t b)
+        {
+            uint8_t product{};
+            while (b != 0)
+            {
+                if (b & 1)
+                {
+                    product ^= a;
+                }
+                a = static_cast<uint8_t>((a << 1) ^ ((a & 0x80) ? 0x1B : 0));
+                b >>= 1;
+            }
+            return product;
+        }
+
+        /**
+         * @brief Builds the AES S-box (multiplicative inverse followed by the affine transform).
+         */
+        constexpr std::array<uint8_t, 256> MakeSBox()
+        {
+            std::array<uint8_t, 256> sBox{};
+            for (uint16_t x = 0; x < 256; x++)
+            {
+                // x^254 is the inverse of x (and maps 0 to 0).
+                uint8_t inverse = 1;
+                for (uint8_t i = 0; i < 254; i++)
+                {
+                    inverse = Multiply(inverse, static_cast<uint8_t>(x));
+                }
+                if (x == 0)
+                {
+                    inverse = 0;
+                }
+
+                uint8_t value = inverse;
+                for (uint8_t shift = 1; shift < 5; shift++)
+                {
+                    value ^= static_cast<uint8_t>((inverse << shift) | (inverse >> (8 - shift)));
+                }
+                sBox[x] = static_cast<uint8_t>(value ^ 0x63);
+            }
+            return sBox;
+        }
+
+        /**
+         * @brief AES S-box.
+         */
+        constexpr std::array<uint8_t, 256> S_BOX = MakeSBox();
+
+        /**
+         * @brief Builds the combined SubBytes/MixColumns table for the first row.
+         */
+        constexpr std::array<uint32_t, 256> MakeTTable()
+        {
+            std::array<uint32_t, 256> table{};
+            for (uint16_t x = 0; x < 256; x++)
+            {
+                const uint8_t cS = S_BOX[x];
+                table[x] = (static_cast<uint32_t>(Multiply(cS, 2)) << 24) | (static_cast<uint32_t>(cS) << 16) |
+                           (static_cast<uint32_t>(cS) << 8) | Multiply(cS, 3);
+            }
+            return table;
+        }
+
+        /**
+         * @brief Combined SubBytes/MixColumns table, the other rows are byte rotations of it.
+         */
+        constexpr std::array<uint32_t, 256> T_TABLE = MakeTTable();
+
+        inline uint32_t RotateRight(const uint32_t &cWord, const uint8_t &cBits)
+        {
+            return (cWord >> cBits) | (cWord << (32 - cBits));
+        }
+
+        inline uint32_t LoadBigEndian(const uint8_t *cData)
+        {
+            return (static_cast<uint32_t>(cData[0]) << 24) | (static_cast<uint32_t>(cData[1]) << 16) |
+                   (static_cast<uint32_t>(cData[2]) << 8) | cData[3];
+        }
+
+        inline void StoreBigEndian(const uint32_t &cWord, uint8_t *data)
+        {
+            data[0] = static_cast<uint8_t>(cWord >> 24);
+            data[1] = static_cast<uint8_t>(cWord >> 16);
+            data[2] = static_cast<uint8_t>(cWord >> 8);
+            data[3] = static_cast<uint8_t>(cWord);
+        }
+
+        inline uint32_t SubWord(const uint32_t &cWord)
+        {
+            return (static_cast<uint32_t>(S_BOX[cWord >> 24]) << 24) | (static_cast<uint32_t>(S_BOX[(cWord >> 16) & 0xFF]) << 16) |
+                   (static_cast<uint32_t>(S_BOX[(cWord >> 8) & 0xFF]) << 8) | S_BOX[cWord & 0xFF];
+        }
+
+#if defined(AES128_HARDWARE)
+        /**
+         * @brief Encrypts consecutive blocks with AES-NI, 8 blocks in flight.
+         */
+        AES128_TARGET void EncryptBlocksHardware(const uint8_t (*cRoundKeys)[16], const uint8_t *cInput, uint8_t *output, const size_t &cBlocks)
+        {
+            __m128i keys[11];
+            for (size_t round = 0; round < 11; round++)
+            {
+                keys[round] = _mm_load_si128(reinterpret_cast<const __m128i *>(cRoundKeys[round]));
+            }
+
+            // Named states instead of an array so the compiler keeps all 8 in registers.
+            size_t block{};
+            for (; block + 8 <= cBlocks; block += 8)
+            {
+                const __m128i *cIn = reinterpret_cast<const __m128i *>(cInput + 16 * block);
+                __m128i s0 = _mm_xor_si128(_mm_loadu_si128(cIn), keys[0]);
+                __m128i s1 = _mm_xor_si128(_mm_loadu_si128(cIn + 1), keys[0]);
+                __m128i s2 = _mm_xor_si128(_mm_loadu_si128(cIn + 2), keys[0]);
+                __m128i s3 = _mm_xor_si128(_mm_loadu_si128(cIn + 3), keys[0]);
+                __m128i s4 = _mm_xor_si128(_mm_loadu_si128(cIn + 4), keys[0]);
+                __m128i s5 = _mm_xor_si128(_mm_loadu_si128(cIn + 5), keys[0]);
+                __m128i s6 = _mm_xor_si128(_mm_loadu_si128(cIn + 6), keys[0]);
+                __m128i s7 = _mm_xor_si128(_mm_loadu_si128(cIn + 7), keys[0]);
+                for (size_t round = 1; round < 10; round++)
+                {
+                    s0 = _mm_aesenc_si128(s0, keys[round]);
+                    s1 = _mm_aesenc_si128(s1, keys[round]);
+                    s2 = _mm_aesenc_si128(s2, keys[round]);
+                    s3 = _mm_aesenc_si128(s3, keys[round]);
+                    s4 = _mm_aesenc_si128(s4, keys[round]);
+                    s5 = _mm_aesenc_si128(s5, keys[round]);
+                    s6 = _mm_aesenc_si128(s6, keys[round]);
+                    s7 = _mm_aesenc_si128(s7, keys[round]);
+                }
+                __m128i *out = reinterpret_cast<__m128i *>(output + 16 * block);
+                _mm_storeu_si128(out, _mm_aesenclast_si128(s0, keys[10]));
+                _mm_storeu_si128(out + 1, _mm_aesenclast_si128(s1, keys[10]));
+                _mm_storeu_si128(out + 2, _mm_aesenclast_si128(s2, keys[10]));
+                _mm_storeu_si128(out + 3, _mm_aesenclast_si128(s3, keys[10]));
+                _mm_storeu_si128(out + 4, _mm_aesenclast_si128(s4, keys[10]));
+                _mm_storeu_si128(out + 5, _mm_aesenclast_si128(s5, keys[10]));
+                _mm_storeu_si128(out + 6, _mm_aesenclast_si128(s6, keys[10]));
+                _mm_storeu_si128(out + 7, _mm_aesenclast_si128(s7, keys[10]));
+            }
+
+            for (; block < cBlocks; block++)
+            {
+                __m128i state = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(cInput + 16 * block)), keys[0]);
+                for (size_t round = 1; round < 10; round++)
+                {
+                    state = _mm_aesenc_si128(state, keys[round]);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16 * block), _mm_aesenclast_si128(state, keys[10]));
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Constructor for the Aes128 class. Expands the key (FIPS-197 section 5.2).
+     * @param cKey The 16 byte key.
+     * @param cUseHardware `false` forces the portable implementation even if AES-NI is available.
+     * @throw std::invalid_argument If the key pointer is null.
+     */
+    Aes128::Aes128(const uint8_t *cKey, const bool &cUseHardware)
+        : _useHardware{cUseHardware && HasHardwareSupport()}
+    {
+        if (!cKey)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        uint8_t roundConstant = 1;
+        for (size_t i = 0; i < 4 * (ROUNDS + 1); i++)
+        {
+            if (i < 4)
+            {
+                _roundWords[i] = LoadBigEndian(cKey + 4 * i);
+                continue;
+            }
+
+            uint32_t word = _roundWords[i - 1];
+            if (i % 4 == 0)
+            {
+                word = SubWord((word << 8) | (word >> 24)) ^ (static_cast<uint32_t>(roundConstant) << 24);
+                roundConstant = Multiply(roundConstant, 2);
+            }
+            _roundWords[i] = _roundWords[i - 4] ^ word;
+        }
+
+        for (size_t i = 0; i < 4 * (ROUNDS + 1); i++)
+        {
+            StoreBigEndian(_roundWords[i], &_roundKeys[i / 4][4 * (i % 4)]);
+        }
+    } /* Aes128::Aes128(const uint8_t *cKey, const bool &cUseHardware) */
+
+    /**
+     * @brief Encrypts a single block.
+     * @param cInput The 16 byte plaintext.
+     * @param output The 16 byte ciphertext, may alias the input.
+     */
+    void Aes128::EncryptBlock(const uint8_t *cInput, uint8_t *output) const
+    {
+        EncryptBlocks(cInput, output, 1);
+    } /* void Aes128::EncryptBlock(const uint8_t *cInput, uint8_t *output) const */
+
+    /**
+     * @brief Encrypts consecutive blocks independently.
+     * @param cInput The plaintext blocks.
+     * @param output The ciphertext blocks, may alias the input.
+     * @param cBlocks The number of blocks.
+     */
+    void Aes128::EncryptBlocks(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const
+    {
+#if defined(AES128_HARDWARE)
+        if (_useHardware)
+        {
+            EncryptBlocksHardware(_roundKeys, cInput, output, cBlocks);
+            return;
+        }
+#endif
+        EncryptBlocksPortable(cInput, output, cBlocks);
+    } /* void Aes128::EncryptBlocks(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const */
+
+    /**
+     * @brief Checks whether AES-NI may be used, as decided by CpuFeatures::HasAes().
+     * @return `true` if AES-NI is available, `false` otherwise.
+     */
+    bool Aes128::HasHardwareSupport()
+    {
+#if defined(AES128_HARDWARE)
+        return CpuFeatures::HasAes();
+#else
+        return false;
+#endif
+    } /* bool Aes128::HasHardwareSupport() */
+
+    // Private Methods.
+
+    /**
+     * @brief Encrypts consecutive blocks with the portable T-table implementation.
+     * @param cInput The plaintext blocks.
+     * @param output The ciphertext blocks.
+     * @param cBlocks The number of blocks.
+     */
+    void Aes128::EncryptBlocksPortable(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const
+    {
+        for (size_t block = 0; block < cBlocks; block++)
+        {
+            const uint8_t *cIn = cInput + BLOCK_SIZE * block;
+            uint8_t *out = output + BLOCK_SIZE * block;
+            const uint32_t *roundWords = _roundWords;
+
+            uint32_t s0 = LoadBigEndian(cIn) ^ roundWords[0];
+            uint32_t s1 = LoadBigEndian(cIn + 4) ^ roundWords[1];
+            uint32_t s2 = LoadBigEndian(cIn + 8) ^ roundWords[2];
+            uint32_t s3 = LoadBigEndian(cIn + 12) ^ roundWords[3];
+
+            for (size_t round = 1; round < ROUNDS; round++)
+            {
+                roundWords += 4;
+                const uint32_t cT0 = T_TABLE[s0 >> 24] ^ RotateRight(T_TABLE[(s1 >> 16) & 0xFF], 8) ^ RotateRight(T_TABLE[(s2 >> 8) & 0xFF], 16) ^ RotateRight(T_TABLE[s3 & 0xFF], 24) ^ roundWords[0];
+                const uint32_t cT1 = T_TABLE[s1 >> 24] ^ RotateRight(T_TABLE[(s2 >> 16) & 0xFF], 8) ^ RotateRight(T_TABLE[(s3 >> 8) & 0xFF], 16) ^ RotateRight(T_TABLE[s0 & 0xFF], 24) ^ roundWords[1];
+                const uint32_t cT2 = T_TABLE[s2 >> 24] ^ RotateRight(T_TABLE[(s3 >> 16) & 0xFF], 8) ^ RotateRight(T_TABLE[(s0 >> 8) & 0xFF], 16) ^ RotateRight(T_TABLE[s1 & 0xFF], 24) ^ roundWords[2];
+                const uint32_t cT3 = T_TABLE[s3 >> 24] ^ RotateRight(T_TABLE[(s0 >> 16) & 0xFF], 8) ^ RotateRight(T_TABLE[(s1 >> 8) & 0xFF], 16) ^ RotateRight(T_TABLE[s2 & 0xFF], 24) ^ roundWords[3];
+                s0 = cT0;
+                s1 = cT1;
+                s2 = cT2;
+                s3 = cT3;
+            }
+
+            roundWords += 4;
+            const uint32_t cState[4]{s0, s1, s2, s3};
+            for (uint8_t column = 0; column < 4; column++)
+            {
+                const uint32_t cWord = (static_cast<uint32_t>(S_BOX[cState[column] >> 24]) << 24) |
+                                       (static_cast<uint32_t>(S_BOX[(cState[(column + 1) % 4] >> 16) & 0xFF]) << 16) |
+                                       (static_cast<uint32_t>(S_BOX[(cState[(column + 2) % 4] >> 8) & 0xFF]) << 8) |
+                                       S_BOX[cState[(column + 3) % 4] & 0xFF];
+                StoreBigEndian(cWord ^ roundWords[column], out + 4 * column);
+            }
+        }
+    } /* void Aes128::EncryptBlocksPortable(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
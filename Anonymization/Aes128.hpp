@@ -0,0 +1,117 @@
+/**
+ * @file Aes128.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Aes128 (AES-128 block encryption, AES-NI or portable) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef AES128_H
+#define AES128_H
+#include <cstddef>
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class Aes128
+     * @brief AES-128 block encryption (FIPS-197) used as the pseudo-random function of the anonymizers.
+     *
+     * Only encryption of independent blocks (ECB) is provided. On x86 CPUs with AES-NI the rounds
+     * run in hardware with 8 blocks interleaved to hide the instruction latency; elsewhere a
+     * portable T-table implementation is used. Both produce identical output.
+     */
+    class Aes128
+    {
+    public:
+        /**
+         * @brief Block size in bytes.
+         */
+        static constexpr size_t BLOCK_SIZE = 16;
+
+        /**
+         * @brief Key size in bytes.
+         */
+        static constexpr size_t KEY_SIZE = 16;
+
+        /**
+         * @brief Number of rounds.
+         */
+        static constexpr size_t ROUNDS = 10;
+
+        /**
+         * @brief Constructor for the Aes128 class.
+         * @param cKey The 16 byte key.
+         * @param cUseHardware `false` forces the portable implementation even if AES-NI is available.
+         * @throws std::invalid_argument If the key pointer is null.
+         */
+        explicit Aes128(const uint8_t *cKey, const bool &cUseHardware = true);
+
+        /**
+         * @brief Encrypts a single block.
+         * @param cInput The 16 byte plaintext.
+         * @param output The 16 byte ciphertext, may alias the input.
+         */
+        void EncryptBlock(const uint8_t *cInput, uint8_t *output) const;
+
+        /**
+         * @brief Encrypts consecutive blocks independently.
+         * @param cInput The plaintext blocks.
+         * @param output The ciphertext blocks, may alias the input.
+         * @param cBlocks The number of blocks.
+         */
+        void EncryptBlocks(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const;
+
+        /**
+         * @brief Checks whether the instance uses AES-NI.
+         * @return `true` if blocks are encrypted in hardware, `false` otherwise.
+         */
+        bool UsesHardware() const { return _useHardware; }
+
+        /**
+         * @brief Checks whether the CPU supports AES-NI and the selected CpuFeatures tier allows it.
+         * @return `true` if AES-NI is available, `false` otherwise (e.g. with ETHERNET_PARAMETER_SIMD=scalar).
+         */
+        static bool HasHardwareSupport();
+
+    private:
+        /**
+         * @brief Expanded key, round keys stored as bytes in the order AES-NI loads them.
+         */
+        alignas(16) uint8_t _roundKeys[ROUNDS + 1][BLOCK_SIZE]{};
+
+        /**
+         * @brief Expanded key as big-endian words for the portable implementation.
+         */
+        uint32_t _roundWords[4 * (ROUNDS + 1)]{};
+
+        /**
+         * @brief Whether AES-NI is used.
+         */
+        bool _useHardware{};
+
+        /**
+         * @brief Encrypts consecutive blocks with the portable implementation.
+         * @param cInput The plaintext blocks.
+         * @param output The ciphertext blocks.
+         * @param cBlocks The number of blocks.
+         */
+        void EncryptBlocksPortable(const uint8_t *cInput, uint8_t *output, const size_t &cBlocks) const;
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::Aes128] Null pointer encountered!"};
+    }; /* class Aes128 */
+}
+
+#endif /* AES128_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
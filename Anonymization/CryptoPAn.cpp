@@ -0,0 +1,325 @@
+/**
+ * @file CryptoPAn.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CryptoPAn (prefix-preserving IPv4/IPv6 address anonymization) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "CryptoPAn.hpp"
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        inline uint64_t LoadBigEndian64(const uint8_t *cData)
+        {
+            uint64_t value{};
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                value = (value << 8) | cData[i];
+            }
+            return value;
+        }
+
+        inline void StoreBigEndian64(const uint64_t &cValue, uint8_t *data)
+        {
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                data[i] = static_cast<uint8_t>(cValue >> (56 - 8 * i));
+            }
+        }
+
+        /**
+         * @brief Returns a mask of the cBits most significant bits of a 64-bit word.
+         */
+        inline uint64_t HighMask(const size_t &cBits)
+        {
+            return cBits == 0 ? 0 : (cBits >= 64 ? ~uint64_t{0} : ~uint64_t{0} << (64 - cBits));
+        }
+
+        /**
+         * @brief Number of IPv4 bit positions kept in the tail tree of a /24 cache entry.
+         */
+        constexpr size_t IPV4_TAIL_BITS = 8;
+    }
+
+    /**
+     * @brief Constructor for the CryptoPAn class.
+     * @param cKey The 32 byte key.
+     * @param cUseHardware `false` forces the portable AES implementation even if AES-NI is available.
+     * @throws std::invalid_argument If the key pointer is null.
+     */
+    CryptoPAn::CryptoPAn(const uint8_t *cKey, const bool &cUseHardware)
+        : _cipher{CheckedKey(cKey), cUseHardware}, _prefix16(size_t{1} << 16), _prefix24(PREFIX24_CACHE_SIZE), _prefix64(PREFIX64_CACHE_SIZE)
+    {
+        uint8_t pad[Aes128::BLOCK_SIZE];
+        _cipher.EncryptBlock(cKey + Aes128::KEY_SIZE, pad);
+        _padUpper = LoadBigEndian64(pad);
+        _padLower = LoadBigEndian64(pad + 8);
+        _blocks.resize(IPV4_BATCH * IPV4_TAIL_BITS * Aes128::BLOCK_SIZE);
+    } /* CryptoPAn::CryptoPAn(const uint8_t *cKey, const bool &cUseHardware) */
+
+    /**
+     * @brief Constructor for the CryptoPAn class.
+     * @param cKey The 32 byte key.
+     * @param cUseHardware `false` forces the portable AES implementation even if AES-NI is available.
+     * @throws std::invalid_argument If the key does not have KEY_SIZE bytes.
+     */
+    CryptoPAn::CryptoPAn(const std::vector<uint8_t> &cKey, const bool &cUseHardware)
+        : CryptoPAn(CheckedKey(cKey), cUseHardware)
+    {
+    } /* CryptoPAn::CryptoPAn(const std::vector<uint8_t> &cKey, const bool &cUseHardware) */
+
+    /**
+     * @brief Anonymizes an IPv4 address.
+     * @param cAddress The address.
+     * @return The anonymized address.
+     */
+    IPv4Address CryptoPAn::Anonymize(const IPv4Address &cAddress)
+    {
+        IPv4Address anonymized;
+        AnonymizeBatch(&cAddress, &anonymized, 1);
+        return anonymized;
+    } /* IPv4Address CryptoPAn::Anonymize(const IPv4Address &cAddress) */
+
+    /**
+     * @brief Anonymizes an IPv6 address.
+     * @param cAddress The address.
+     * @return The anonymized address.
+     */
+    IPv6Address CryptoPAn::Anonymize(const IPv6Address &cAddress)
+    {
+        const uint64_t cUpper = cAddress.GetUpper64();
+        const uint64_t cLower = cAddress.GetLower64();
+        return IPv6Address::FromUint64(cUpper ^ PrefixFlips64(cUpper), cLower ^ ComputeFlips(cUpper, cLower, 64, 64));
+    } /* IPv6Address CryptoPAn::Anonymize(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Anonymizes an array of IPv4 addresses.
+     *
+     * Flipping bits 0-23 and the known tail tree nodes come from the /24 cache. The missing tail
+     * nodes of up to IPV4_BATCH addresses are encrypted in a single pass and stored back.
+     *
+     * @param cInput The addresses.
+     * @param output The anonymized addresses, may alias the input.
+     * @param cCount The number of addresses.
+     */
+    void CryptoPAn::AnonymizeBatch(const IPv4Address *cInput, IPv4Address *output, const size_t &cCount)
+    {
+        uint32_t values[IPV4_BATCH];
+        uint32_t flips[IPV4_BATCH];
+        uint8_t missing[IPV4_BATCH];
+
+        for (size_t start = 0; start < cCount; start += IPV4_BATCH)
+        {
+            const size_t cChunk = (cCount - start < IPV4_BATCH) ? cCount - start : IPV4_BATCH;
+
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                values[i] = cInput[start + i].ToUint32();
+#if defined(__GNUC__)
+                __builtin_prefetch(&_prefix24[((values[i] >> 8) * 0x9E3779B97F4A7C15ull) >> 48]);
+#endif
+            }
+
+            size_t blocks{};
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                const Prefix24Entry &cEntry = Prefix24(values[i]);
+                flips[i] = cEntry.flips;
+                missing[i] = 0;
+
+                size_t node = 1;
+                for (size_t depth = 0; depth < IPV4_TAIL_BITS; depth++)
+                {
+                    if (cEntry.tailValid[node / 64] & (uint64_t{1} << (node % 64)))
+                    {
+                        flips[i] |= static_cast<uint32_t>((cEntry.tailFlips[node / 64] >> (node % 64)) & 1) << (7 - depth);
+                    }
+                    else
+                    {
+                        missing[i] |= static_cast<uint8_t>(1 << depth);
+                        MakeBlock(static_cast<uint64_t>(values[i]) << 32, 0, 32 - IPV4_TAIL_BITS + depth, _blocks.data() + blocks * Aes128::BLOCK_SIZE);
+                        blocks++;
+                    }
+                    node = 2 * node + ((values[i] >> (7 - depth)) & 1);
+                }
+            }
+
+            if (blocks != 0)
+            {
+                _cipher.EncryptBlocks(_blocks.data(), _blocks.data(), blocks);
+            }
+
+            const uint8_t *cBlock = _blocks.data();
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                // The entry may have been replaced by a later address of the chunk; then the bits are not cached.
+                Prefix24Entry &entry = _prefix24[((values[i] >> 8) * 0x9E3779B97F4A7C15ull) >> 48];
+                const bool cCached = entry.key == (values[i] >> 8) + 1;
+
+                size_t node = 1;
+                for (size_t depth = 0; depth < IPV4_TAIL_BITS && missing[i] != 0; depth++)
+                {
+                    if (missing[i] & (1 << depth))
+                    {
+                        const uint64_t cFlip = cBlock[0] >> 7;
+                        cBlock += Aes128::BLOCK_SIZE;
+                        flips[i] |= static_cast<uint32_t>(cFlip) << (7 - depth);
+                        if (cCached)
+                        {
+                            entry.tailFlips[node / 64] |= cFlip << (node % 64);
+                            entry.tailValid[node / 64] |= uint64_t{1} << (node % 64);
+                        }
+                    }
+                    node = 2 * node + ((values[i] >> (7 - depth)) & 1);
+                }
+
+                output[start + i] = IPv4Address::FromUint32(values[i] ^ flips[i]);
+            }
+        }
+    } /* void CryptoPAn::AnonymizeBatch(const IPv4Address *cInput, IPv4Address *output, const size_t &cCount) */
+
+    /**
+     * @brief Anonymizes an array of IPv6 addresses.
+     * @param cInput The addresses.
+     * @param output The anonymized addresses, may alias the input.
+     * @param cCount The number of addresses.
+     */
+    void CryptoPAn::AnonymizeBatch(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount)
+    {
+        // The 64 independent blocks of one address already fill the AES pipeline.
+        for (size_t i = 0; i < cCount; i++)
+        {
+            output[i] = Anonymize(cInput[i]);
+        }
+    } /* void CryptoPAn::AnonymizeBatch(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount) */
+
+    // Private Methods.
+
+    /**
+     * @brief Computes flipping bits of an address for a range of bit positions.
+     * @param cUpper The upper 64 bits of the (left-aligned) address.
+     * @param cLower The lower 64 bits of the (left-aligned) address.
+     * @param cFirst The first bit position (0 is the most significant bit).
+     * @param cCount The number of positions, at most 64.
+     * @return The flipping bits, position cFirst in bit cCount - 1.
+     */
+    uint64_t CryptoPAn::ComputeFlips(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cFirst, const size_t &cCount)
+    {
+        uint8_t blocks[64 * Aes128::BLOCK_SIZE];
+        for (size_t i = 0; i < cCount; i++)
+        {
+            MakeBlock(cUpper, cLower, cFirst + i, blocks + i * Aes128::BLOCK_SIZE);
+        }
+
+        _cipher.EncryptBlocks(blocks, blocks, cCount);
+
+        uint64_t flips{};
+        for (size_t i = 0; i < cCount; i++)
+        {
+            flips = (flips << 1) | (blocks[i * Aes128::BLOCK_SIZE] >> 7);
+        }
+        return flips;
+    } /* uint64_t CryptoPAn::ComputeFlips(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cFirst, const size_t &cCount) */
+
+    /**
+     * @brief Writes the PRF input block of one bit position: the first cPosition address bits followed by the pad.
+     * @param cUpper The upper 64 bits of the (left-aligned) address.
+     * @param cLower The lower 64 bits of the (left-aligned) address.
+     * @param cPosition The bit position.
+     * @param block The 16 byte block.
+     */
+    void CryptoPAn::MakeBlock(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cPosition, uint8_t *block) const
+    {
+        const uint64_t cUpperMask = HighMask(cPosition);
+        const uint64_t cLowerMask = cPosition > 64 ? HighMask(cPosition - 64) : 0;
+        StoreBigEndian64((cUpper & cUpperMask) | (_padUpper & ~cUpperMask), block);
+        StoreBigEndian64((cLower & cLowerMask) | (_padLower & ~cLowerMask), block + 8);
+    } /* void CryptoPAn::MakeBlock(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cPosition, uint8_t *block) const */
+
+    /**
+     * @brief Returns the /24 cache entry of an IPv4 address, replacing the cached network on a miss.
+     * @param cAddress The address value.
+     * @return The entry holding the flipping bits 0-23 of the address.
+     */
+    CryptoPAn::Prefix24Entry &CryptoPAn::Prefix24(const uint32_t &cAddress)
+    {
+        const uint32_t cNetwork = cAddress >> 8;
+        Prefix24Entry &entry = _prefix24[(cNetwork * 0x9E3779B97F4A7C15ull) >> 48];
+        if (entry.key == cNetwork + 1)
+        {
+            return entry;
+        }
+
+        const uint64_t cUpper = static_cast<uint64_t>(cAddress) << 32;
+        uint32_t &flips16 = _prefix16[cAddress >> 16];
+        if (!(flips16 & PREFIX16_VALID))
+        {
+            flips16 = PREFIX16_VALID | static_cast<uint32_t>(ComputeFlips(cUpper, 0, 0, 16));
+        }
+
+        entry = Prefix24Entry{};
+        entry.key = cNetwork + 1;
+        entry.flips = ((flips16 & 0xFFFF) << 16) | (static_cast<uint32_t>(ComputeFlips(cUpper, 0, 16, 8)) << 8);
+        return entry;
+    } /* CryptoPAn::Prefix24Entry &CryptoPAn::Prefix24(const uint32_t &cAddress) */
+
+    /**
+     * @brief Returns the cached flipping bits 0-63 of an IPv6 address, computing them on a miss.
+     * @param cUpper The upper 64 bits of the address.
+     * @return The flipping bits.
+     */
+    uint64_t CryptoPAn::PrefixFlips64(const uint64_t &cUpper)
+    {
+        Prefix64Entry &entry = _prefix64[(cUpper * 0x9E3779B97F4A7C15ull) >> 52];
+        if (!entry.valid || entry.prefix != cUpper)
+        {
+            entry.prefix = cUpper;
+            entry.flips = ComputeFlips(cUpper, 0, 0, 64);
+            entry.valid = true;
+        }
+        return entry.flips;
+    } /* uint64_t CryptoPAn::PrefixFlips64(const uint64_t &cUpper) */
+
+    /**
+     * @brief Validates a key pointer.
+     * @param cKey The key.
+     * @return The key.
+     * @throw std::invalid_argument If the key pointer is null.
+     */
+    const uint8_t *CryptoPAn::CheckedKey(const uint8_t *cKey)
+    {
+        if (!cKey)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        return cKey;
+    } /* const uint8_t *CryptoPAn::CheckedKey(const uint8_t *cKey) */
+
+    /**
+     * @brief Validates a key vector.
+     * @param cKey The key.
+     * @return Pointer to the key bytes.
+     * @throw std::invalid_argument If the key does not have KEY_SIZE bytes.
+     */
+    const uint8_t *CryptoPAn::CheckedKey(const std::vector<uint8_t> &cKey)
+    {
+        if (cKey.size() != KEY_SIZE)
+        {
+            throw std::invalid_argument(INVALID_KEY_SIZE);
+        }
+        return cKey.data();
+    } /* const uint8_t *CryptoPAn::CheckedKey(const std::vector<uint8_t> &cKey) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,244 @@
+/**
+ * @file CryptoPAn.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CryptoPAn (prefix-preserving IPv4/IPv6 address anonymization) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef CRYPTOPAN_H
+#define CRYPTOPAN_H
+#include "Aes128.hpp"
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class CryptoPAn
+     * @brief Prefix-preserving address anonymization (Crypto-PAn, Xu et al.).
+     *
+     * Two addresses sharing a k-bit prefix are mapped to anonymized addresses sharing exactly a
+     * k-bit prefix, so subnet structure survives while the addresses themselves are hidden. Bit i
+     * of the result is bit i of the address XOR the top bit of AES_K(first i address bits followed
+     * by a secret pad). The 32 byte key holds the AES key and the pad seed; IPv4 output matches
+     * the reference implementation, IPv6 uses the same construction over 128 bits.
+     *
+     * Since the flipping bits of a prefix only depend on the prefix, they are cached. For IPv4 the
+     * first 16 bits are kept per /16, and a direct-mapped cache of /24 networks holds the next 8
+     * bits plus the binary tree of the last 8 (255 nodes, filled as addresses are seen), so hot
+     * networks need no AES at all. For IPv6 the first 64 bits are kept in a direct-mapped cache
+     * of /64 networks. The batch functions collect the missing AES blocks of many addresses so
+     * they are encrypted in one pipelined pass.
+     *
+     * The caches make the instance stateful: use one instance per thread.
+     */
+    class CryptoPAn
+    {
+    public:
+        /**
+         * @brief Key size in bytes (AES key followed by the pad seed).
+         */
+        static constexpr size_t KEY_SIZE = 32;
+
+        /**
+         * @brief Constructor for the CryptoPAn class.
+         * @param cKey The 32 byte key.
+         * @param cUseHardware `false` forces the portable AES implementation even if AES-NI is available.
+         * @throws std::invalid_argument If the key pointer is null.
+         */
+        explicit CryptoPAn(const uint8_t *cKey, const bool &cUseHardware = true);
+
+        /**
+         * @brief Constructor for the CryptoPAn class.
+         * @param cKey The 32 byte key.
+         * @param cUseHardware `false` forces the portable AES implementation even if AES-NI is available.
+         * @throws std::invalid_argument If the key does not have KEY_SIZE bytes.
+         */
+        explicit CryptoPAn(const std::vector<uint8_t> &cKey, const bool &cUseHardware = true);
+
+        /**
+         * @brief Anonymizes an IPv4 address.
+         * @param cAddress The address.
+         * @return The anonymized address.
+         */
+        IPv4Address Anonymize(const IPv4Address &cAddress);
+
+        /**
+         * @brief Anonymizes an IPv6 address.
+         * @param cAddress The address.
+         * @return The anonymized address.
+         */
+        IPv6Address Anonymize(const IPv6Address &cAddress);
+
+        /**
+         * @brief Anonymizes an array of IPv4 addresses.
+         * @param cInput The addresses.
+         * @param output The anonymized addresses, may alias the input.
+         * @param cCount The number of addresses.
+         */
+        void AnonymizeBatch(const IPv4Address *cInput, IPv4Address *output, const size_t &cCount);
+
+        /**
+         * @brief Anonymizes an array of IPv6 addresses.
+         * @param cInput The addresses.
+         * @param output The anonymized addresses, may alias the input.
+         * @param cCount The number of addresses.
+         */
+        void AnonymizeBatch(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount);
+
+        /**
+         * @brief Checks whether the AES rounds run on AES-NI.
+         * @return `true` if AES-NI is used, `false` otherwise.
+         */
+        bool UsesHardware() const { return _cipher.UsesHardware(); }
+
+    private:
+        /**
+         * @struct Prefix24Entry
+         * @brief Cached flipping bits of one IPv4 /24.
+         */
+        struct Prefix24Entry
+        {
+            uint32_t key{};          // /24 network plus one, 0 for an empty entry
+            uint32_t flips{};        // bits 0-23 in bits 31-8
+            uint64_t tailFlips[4]{}; // bits 24-31 as a tree, node 1 is the root and node n has children 2n and 2n + 1
+            uint64_t tailValid[4]{};
+        };
+
+        /**
+         * @struct Prefix64Entry
+         * @brief Flipping bits 0-63 of one IPv6 /64.
+         */
+        struct Prefix64Entry
+        {
+            uint64_t prefix{};
+            uint64_t flips{};
+            bool valid{};
+        };
+
+        /**
+         * @brief Number of IPv4 addresses whose missing blocks are encrypted in one pass.
+         */
+        static constexpr size_t IPV4_BATCH = 32;
+
+        /**
+         * @brief Number of entries of the IPv4 /24 cache.
+         */
+        static constexpr size_t PREFIX24_CACHE_SIZE = size_t{1} << 16;
+
+        /**
+         * @brief Number of entries of the IPv6 /64 cache.
+         */
+        static constexpr size_t PREFIX64_CACHE_SIZE = 4096;
+
+        /**
+         * @brief Marks a valid entry of _prefix16.
+         */
+        static constexpr uint32_t PREFIX16_VALID = 0x10000;
+
+        /**
+         * @brief The pseudo-random function.
+         */
+        Aes128 _cipher;
+
+        /**
+         * @brief The pad (encrypted second key half), upper and lower 64 bits.
+         */
+        uint64_t _padUpper{};
+        uint64_t _padLower{};
+
+        /**
+         * @brief Flipping bits 0-15 per /16 (PREFIX16_VALID marks computed entries).
+         */
+        std::vector<uint32_t> _prefix16;
+
+        /**
+         * @brief Direct-mapped cache of IPv4 /24 networks.
+         */
+        std::vector<Prefix24Entry> _prefix24;
+
+        /**
+         * @brief Direct-mapped cache of IPv6 flipping bits 0-63 per /64.
+         */
+        std::vector<Prefix64Entry> _prefix64;
+
+        /**
+         * @brief Block buffer of the batch functions.
+         */
+        std::vector<uint8_t> _blocks;
+
+        /**
+         * @brief Computes flipping bits of an address for a range of bit positions.
+         * @param cUpper The upper 64 bits of the (left-aligned) address.
+         * @param cLower The lower 64 bits of the (left-aligned) address.
+         * @param cFirst The first bit position (0 is the most significant bit).
+         * @param cCount The number of positions, at most 64.
+         * @return The flipping bits, position cFirst in bit cCount - 1.
+         */
+        uint64_t ComputeFlips(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cFirst, const size_t &cCount);
+
+        /**
+         * @brief Writes the PRF input block of one bit position.
+         * @param cUpper The upper 64 bits of the (left-aligned) address.
+         * @param cLower The lower 64 bits of the (left-aligned) address.
+         * @param cPosition The bit position.
+         * @param block The 16 byte block.
+         */
+        void MakeBlock(const uint64_t &cUpper, const uint64_t &cLower, const size_t &cPosition, uint8_t *block) const;
+
+        /**
+         * @brief Returns the /24 cache entry of an IPv4 address, replacing the cached network on a miss.
+         * @param cAddress The address value.
+         * @return The entry holding the flipping bits 0-23 of the address.
+         */
+        Prefix24Entry &Prefix24(const uint32_t &cAddress);
+
+        /**
+         * @brief Returns the cached flipping bits 0-63 of an IPv6 address, computing them on a miss.
+         * @param cUpper The upper 64 bits of the address.
+         * @return The flipping bits.
+         */
+        uint64_t PrefixFlips64(const uint64_t &cUpper);
+
+        /**
+         * @brief Validates a key pointer.
+         * @param cKey The key.
+         * @return The key.
+         * @throws std::invalid_argument If the key pointer is null.
+         */
+        static const uint8_t *CheckedKey(const uint8_t *cKey);
+
+        /**
+         * @brief Validates a key vector.
+         * @param cKey The key.
+         * @return Pointer to the key bytes.
+         * @throws std::invalid_argument If the key does not have KEY_SIZE bytes.
+         */
+        static const uint8_t *CheckedKey(const std::vector<uint8_t> &cKey);
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::CryptoPAn] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a key of the wrong size.
+         */
+        static constexpr char INVALID_KEY_SIZE[]{"[EthernetParameter::CryptoPAn] Key must have 32 bytes!"};
+    }; /* class CryptoPAn */
+}
+
+#endif /* CRYPTOPAN_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
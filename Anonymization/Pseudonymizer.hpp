@@ -0,0 +1,375 @@
+/**
+ * @file Pseudonymizer.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Pseudonymizer (batch address truncation / keyed pseudonymization) class template definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef PSEUDONYMIZER_H
+#define PSEUDONYMIZER_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv4Address/IPv4Prefix.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include "IPv6Address/IPv6Prefix.hpp"
+#include "SipHash.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace EthernetParameter
+{
+    /**
+     * @class TruncationPolicy
+     * @brief Pseudonymizer policy clearing the host bits beyond a configurable prefix length.
+     *
+     * E.g. with the defaults 192.0.2.77 becomes 192.0.2.0 and 2001:db8:1:2::5 becomes 2001:db8:1::.
+     */
+    class TruncationPolicy
+    {
+    public:
+        /**
+         * @brief Constructor for the TruncationPolicy class.
+         * @param cIPv4Length The number of IPv4 bits kept.
+         * @param cIPv6Length The number of IPv6 bits kept.
+         * @throws std::out_of_range If a length exceeds the address size.
+         */
+        constexpr explicit TruncationPolicy(const uint8_t &cIPv4Length = 24, const uint8_t &cIPv6Length = 48)
+            : _ipv4Mask{IPv4Prefix::MaskFromLength(cIPv4Length <= IPv4Prefix::MAX_PREFIX_LENGTH ? cIPv4Length : 0)},
+              _ipv6UpperMask{IPv6Prefix::UpperMaskFromLength(cIPv6Length)},
+              _ipv6LowerMask{IPv6Prefix::LowerMaskFromLength(cIPv6Length <= IPv6Prefix::MAX_PREFIX_LENGTH ? cIPv6Length : 0)}
+        {
+            if (cIPv4Length > IPv4Prefix::MAX_PREFIX_LENGTH || cIPv6Length > IPv6Prefix::MAX_PREFIX_LENGTH)
+            {
+                throw std::out_of_range(PREFIX_LENGTH_OUT_OF_RANGE);
+            }
+        }
+
+        /**
+         * @brief Maps IPv4 address values in place.
+         * @param values The host-order address values.
+         * @param cCount The number of values.
+         */
+        void Map(uint32_t *values, const size_t &cCount) const
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                values[i] &= _ipv4Mask;
+            }
+        }
+
+        /**
+         * @brief Maps IPv6 address values in place.
+         * @param upper The upper 64 bits of the addresses.
+         * @param lower The lower 64 bits of the addresses.
+         * @param cCount The number of addresses.
+         */
+        void Map(uint64_t *upper, uint64_t *lower, const size_t &cCount) const
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                upper[i] &= _ipv6UpperMask;
+                lower[i] &= _ipv6LowerMask;
+            }
+        }
+
+        /**
+         * @brief Maps IPv6 addresses directly, without converting them to integers.
+         *
+         * Clearing bits commutes with any reordering of them, so the mask is converted to the storage
+         * layout of IPv6Address once and applied to the two 64-bit storage words of every address.
+         *
+         * @param cInput The addresses.
+         * @param output The mapped addresses, may alias the input.
+         * @param cCount The number of addresses.
+         */
+        void Map(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount) const
+        {
+            static_assert(sizeof(IPv6Address) == 2 * sizeof(uint64_t), "IPv6 addresses must be two words");
+            const IPv6Address cMaskAddress = IPv6Address::FromUint64(_ipv6UpperMask, _ipv6LowerMask);
+            uint64_t mask[2];
+            std::memcpy(mask, &cMaskAddress, sizeof(mask));
+            for (size_t i = 0; i < cCount; i++)
+            {
+                uint64_t words[2];
+                std::memcpy(words, &cInput[i], sizeof(words));
+                words[0] &= mask[0];
+                words[1] &= mask[1];
+                std::memcpy(&output[i], words, sizeof(words));
+            }
+        }
+
+    private:
+        /**
+         * @brief Masks of the kept bits.
+         */
+        uint32_t _ipv4Mask{};
+        uint64_t _ipv6UpperMask{};
+        uint64_t _ipv6LowerMask{};
+
+        /**
+         * @brief Error message indicating a prefix length greater than the address size.
+         */
+        static constexpr char PREFIX_LENGTH_OUT_OF_RANGE[]{"[EthernetParameter::TruncationPolicy] Prefix length out of range!"};
+    }; /* class TruncationPolicy */
+
+    /**
+     * @class KeyedMappingPolicy
+     * @brief Pseudonymizer policy replacing an address by a keyed SipHash of it inside a reserved range.
+     *
+     * The network bits come from the target prefix and the host bits from the hash, so the output
+     * can never be mistaken for a real address. The mapping is deterministic for a key (joins
+     * across exports keep working) but not invertible, and distinct addresses may collide when the
+     * target range is smaller than the address space (the default IPv4 range has 2^28 addresses).
+     */
+    class KeyedMappingPolicy
+    {
+    public:
+        /**
+         * @brief Key size in bytes.
+         */
+        static constexpr size_t KEY_SIZE = SipHash::KEY_SIZE;
+
+        /**
+         * @brief Default IPv4 target range (reserved, 240.0.0.0/4).
+         */
+        static constexpr IPv4Prefix DEFAULT_IPV4_TARGET{IPv4Address::FromUint32(0xF0000000), 4};
+
+        /**
+         * @brief Default IPv6 target range (documentation, 2001:db8::/32).
+         */
+        static constexpr IPv6Prefix DEFAULT_IPV6_TARGET{IPv6Address::FromUint64(0x20010DB800000000ull, 0), 32};
+
+        /**
+         * @brief Constructor for the KeyedMappingPolicy class.
+         * @param cKey The 16 byte SipHash key.
+         * @param cIPv4Target The range IPv4 addresses are mapped into.
+         * @param cIPv6Target The range IPv6 addresses are mapped into.
+         * @throws std::invalid_argument If the key pointer is null.
+         */
+        constexpr explicit KeyedMappingPolicy(const uint8_t *cKey, const IPv4Prefix &cIPv4Target = DEFAULT_IPV4_TARGET, const IPv6Prefix &cIPv6Target = DEFAULT_IPV6_TARGET)
+            : _hash{cKey},
+              _ipv4Network{cIPv4Target.GetAddress().ToUint32()},
+              _ipv4HostMask{~IPv4Prefix::MaskFromLength(cIPv4Target.GetLength())},
+              _ipv6UpperNetwork{cIPv6Target.GetAddress().GetUpper64()},
+              _ipv6LowerNetwork{cIPv6Target.GetAddress().GetLower64()},
+              _ipv6UpperHostMask{~IPv6Prefix::UpperMaskFromLength(cIPv6Target.GetLength())},
+              _ipv6LowerHostMask{~IPv6Prefix::LowerMaskFromLength(cIPv6Target.GetLength())}
+        {
+        }
+
+        /**
+         * @brief Maps IPv4 address values in place.
+         * @param values The host-order address values.
+         * @param cCount The number of values.
+         */
+        void Map(uint32_t *values, const size_t &cCount) const
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                values[i] = _ipv4Network | (static_cast<uint32_t>(_hash.Hash64(values[i])) & _ipv4HostMask);
+            }
+        }
+
+        /**
+         * @brief Maps IPv6 address values in place.
+         * @param upper The upper 64 bits of the addresses.
+         * @param lower The lower 64 bits of the addresses.
+         * @param cCount The number of addresses.
+         */
+        void Map(uint64_t *upper, uint64_t *lower, const size_t &cCount) const
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                uint64_t upperHash{};
+                uint64_t lowerHash{};
+                _hash.Hash128(upper[i], lower[i], upperHash, lowerHash);
+                upper[i] = _ipv6UpperNetwork | (upperHash & _ipv6UpperHostMask);
+                lower[i] = _ipv6LowerNetwork | (lowerHash & _ipv6LowerHostMask);
+            }
+        }
+
+    private:
+        /**
+         * @brief The keyed hash.
+         */
+        SipHash _hash;
+
+        /**
+         * @brief Target network bits and masks of the hashed host bits.
+         */
+        uint32_t _ipv4Network{};
+        uint32_t _ipv4HostMask{};
+        uint64_t _ipv6UpperNetwork{};
+        uint64_t _ipv6LowerNetwork{};
+        uint64_t _ipv6UpperHostMask{};
+        uint64_t _ipv6LowerHostMask{};
+    }; /* class KeyedMappingPolicy */
+
+    /**
+     * @class Pseudonymizer
+     * @brief Applies a pseudonymization policy to single addresses or arrays of addresses.
+     *
+     * The policy is a template parameter, so there are no virtual calls: addresses are converted
+     * in chunks to plain arrays of integers, the policy's Map() runs over the whole chunk (simple
+     * loops the compiler can vectorize), and the results are written back.
+     *
+     * A policy provides:
+     * - `void Map(uint32_t *values, const size_t &cCount) const` for host-order IPv4 values,
+     * - `void Map(uint64_t *upper, uint64_t *lower, const size_t &cCount) const` for IPv6 values,
+     * - optionally `void Map(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount) const`,
+     *   used instead of the conversion when the policy can work on the addresses as stored.
+     *
+     * @tparam Policy TruncationPolicy, KeyedMappingPolicy or a user policy.
+     */
+    template <typename Policy>
+    class Pseudonymizer
+    {
+        // Results are written back with memcpy: GCC turns assignments in the vectorized loop into byte stores.
+        static_assert(std::is_trivially_copyable<IPv4Address>::value && std::is_trivially_copyable<IPv6Address>::value,
+                      "Addresses must be trivially copyable");
+
+    public:
+        /**
+         * @brief Constructor for the Pseudonymizer class.
+         * @param cPolicy The policy.
+         */
+        constexpr explicit Pseudonymizer(const Policy &cPolicy) : _policy{cPolicy} {}
+
+        /**
+         * @brief Returns the policy.
+         * @return The policy.
+         */
+        constexpr const Policy &GetPolicy() const { return _policy; }
+
+        /**
+         * @brief Pseudonymizes an IPv4 address.
+         * @param cAddress The address.
+         * @return The pseudonymized address.
+         */
+        IPv4Address Apply(const IPv4Address &cAddress) const
+        {
+            IPv4Address result;
+            ApplyBatch(&cAddress, &result, 1);
+            return result;
+        }
+
+        /**
+         * @brief Pseudonymizes an IPv6 address.
+         * @param cAddress The address.
+         * @return The pseudonymized address.
+         */
+        IPv6Address Apply(const IPv6Address &cAddress) const
+        {
+            IPv6Address result;
+            ApplyBatch(&cAddress, &result, 1);
+            return result;
+        }
+
+        /**
+         * @brief Pseudonymizes an array of IPv4 addresses.
+         * @param cInput The addresses.
+         * @param output The pseudonymized addresses, may alias the input.
+         * @param cCount The number of addresses.
+         */
+        void ApplyBatch(const IPv4Address *cInput, IPv4Address *output, const size_t &cCount) const
+        {
+            uint32_t values[CHUNK_SIZE];
+            for (size_t start = 0; start < cCount; start += CHUNK_SIZE)
+            {
+                const size_t cChunk = (cCount - start < CHUNK_SIZE) ? cCount - start : CHUNK_SIZE;
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    values[i] = cInput[start + i].ToUint32();
+                }
+                _policy.Map(values, cChunk);
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    const IPv4Address cAddress = IPv4Address::FromUint32(values[i]);
+                    std::memcpy(&output[start + i], &cAddress, sizeof(IPv4Address));
+                }
+            }
+        }
+
+        /**
+         * @brief Pseudonymizes an array of IPv6 addresses.
+         * @param cInput The addresses.
+         * @param output The pseudonymized addresses, may alias the input.
+         * @param cCount The number of addresses.
+         */
+        void ApplyBatch(const IPv6Address *cInput, IPv6Address *output, const size_t &cCount) const
+        {
+            if constexpr (MapsIPv6Addresses<Policy>::value)
+            {
+                _policy.Map(cInput, output, cCount);
+                return;
+            }
+
+            uint64_t upper[CHUNK_SIZE];
+            uint64_t lower[CHUNK_SIZE];
+            for (size_t start = 0; start < cCount; start += CHUNK_SIZE)
+            {
+                const size_t cChunk = (cCount - start < CHUNK_SIZE) ? cCount - start : CHUNK_SIZE;
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    upper[i] = cInput[start + i].GetUpper64();
+                    lower[i] = cInput[start + i].GetLower64();
+                }
+                _policy.Map(upper, lower, cChunk);
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    const IPv6Address cAddress = IPv6Address::FromUint64(upper[i], lower[i]);
+                    std::memcpy(&output[start + i], &cAddress, sizeof(IPv6Address));
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief Detects the optional `Map(const IPv6Address *, IPv6Address *, const size_t &)` of a policy.
+         */
+        template <typename PolicyType, typename = void>
+        struct MapsIPv6Addresses : std::false_type
+        {
+        };
+        template <typename PolicyType>
+        struct MapsIPv6Addresses<PolicyType, decltype(std::declval<const PolicyType &>().Map(std::declval<const IPv6Address *>(), std::declval<IPv6Address *>(),
+                                                                                             std::declval<const size_t &>()))> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Number of addresses converted and mapped at once.
+         */
+        static constexpr size_t CHUNK_SIZE = 256;
+
+        /**
+         * @brief The policy.
+         */
+        Policy _policy;
+    }; /* class Pseudonymizer */
+
+    /**
+     * @brief Pseudonymizer clearing host bits.
+     */
+    using TruncatingPseudonymizer = Pseudonymizer<TruncationPolicy>;
+
+    /**
+     * @brief Pseudonymizer mapping addresses into a reserved range with a keyed hash.
+     */
+    using KeyedPseudonymizer = Pseudonymizer<KeyedMappingPolicy>;
+}
+
+#endif /* PSEUDONYMIZER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,268 @@
+/**
+ * @file SipHash.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief SipHash (keyed SipHash-2-4 pseudo-random function) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef SIPHASH_H
+#define SIPHASH_H
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @class SipHash
+     * @brief SipHash-2-4 (Aumasson, Bernstein) with 64-bit and 128-bit output.
+     *
+     * Besides hashing byte strings, the class has branch-free fast paths for the two messages the
+     * pseudonymizers hash: the 4 byte and the 16 byte network-order form of an address. They give
+     * the same result as Hash64() over those bytes and inline into loops the compiler can vectorize.
+     */
+    class SipHash
+    {
+    public:
+        /**
+         * @brief Key size in bytes.
+         */
+        static constexpr size_t KEY_SIZE = 16;
+
+        /**
+         * @brief Default constructor. Uses the all-zero key.
+         */
+        constexpr SipHash() = default;
+
+        /**
+         * @brief Constructor for the SipHash class.
+         * @param cKey The 16 byte key.
+         * @throws std::invalid_argument If the key pointer is null.
+         */
+        constexpr explicit SipHash(const uint8_t *cKey);
+
+        /**
+         * @brief Hashes a byte string.
+         * @param cData The message.
+         * @param cLength The message length in bytes.
+         * @return The 64-bit hash.
+         */
+        constexpr uint64_t Hash64(const uint8_t *cData, const size_t &cLength) const;
+
+        /**
+         * @brief Hashes a 4 byte message given as a big-endian integer (an IPv4 address value).
+         * @param cValue The message.
+         * @return The 64-bit hash, equal to Hash64() over the 4 network-order bytes.
+         */
+        constexpr uint64_t Hash64(const uint32_t &cValue) const;
+
+        /**
+         * @brief Hashes a 16 byte message given as two big-endian integers (an IPv6 address value).
+         * @param cUpper The first 8 bytes of the message.
+         * @param cLower The last 8 bytes of the message.
+         * @param upperHash The first 64 bits of the 128-bit hash.
+         * @param lowerHash The last 64 bits of the 128-bit hash.
+         */
+        constexpr void Hash128(const uint64_t &cUpper, const uint64_t &cLower, uint64_t &upperHash, uint64_t &lowerHash) const;
+
+    private:
+        /**
+         * @brief Key words.
+         */
+        uint64_t _k0{};
+        uint64_t _k1{};
+
+        /**
+         * @struct State
+         * @brief The four state words.
+         */
+        struct State
+        {
+            uint64_t v0;
+            uint64_t v1;
+            uint64_t v2;
+            uint64_t v3;
+        };
+
+        /**
+         * @brief Rotates a word left.
+         */
+        static constexpr uint64_t RotateLeft(const uint64_t &cValue, const uint8_t &cBits) { return (cValue << cBits) | (cValue >> (64 - cBits)); }
+
+        /**
+         * @brief Reverses the byte order of a word.
+         */
+        static constexpr uint64_t ByteSwap(const uint64_t &cValue);
+
+        /**
+         * @brief Loads up to 8 bytes as a little-endian word.
+         */
+        static constexpr uint64_t LoadLittleEndian(const uint8_t *cData, const size_t &cLength);
+
+        /**
+         * @brief One SipRound.
+         */
+        static constexpr void Round(State &state);
+
+        /**
+         * @brief Absorbs one message word (2 rounds).
+         */
+        static constexpr void Compress(State &state, const uint64_t &cWord);
+
+        /**
+         * @brief Returns the initial state (cOutputTweak is 0xEE for 128-bit output).
+         */
+        constexpr State Initialize(const uint64_t &cOutputTweak) const;
+
+        /**
+         * @brief Runs the 4 finalization rounds and returns the first output word.
+         */
+        static constexpr uint64_t Finalize(State &state, const uint8_t &cTweak);
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::SipHash] Null pointer encountered!"};
+    }; /* class SipHash */
+
+    // Constexpr definitions.
+
+    /**
+     * @brief Constructor for the SipHash class.
+     * @param cKey The 16 byte key.
+     * @throw std::invalid_argument If the key pointer is null.
+     */
+    constexpr SipHash::SipHash(const uint8_t *cKey)
+    {
+        if (!cKey)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        _k0 = LoadLittleEndian(cKey, 8);
+        _k1 = LoadLittleEndian(cKey + 8, 8);
+    } /* SipHash::SipHash(const uint8_t *cKey) */
+
+    /**
+     * @brief Hashes a byte string.
+     * @param cData The message.
+     * @param cLength The message length in bytes.
+     * @return The 64-bit hash.
+     */
+    constexpr uint64_t SipHash::Hash64(const uint8_t *cData, const size_t &cLength) const
+    {
+        State state = Initialize(0);
+
+        size_t offset{};
+        for (; offset + 8 <= cLength; offset += 8)
+        {
+            Compress(state, LoadLittleEndian(cData + offset, 8));
+        }
+        Compress(state, LoadLittleEndian(cData + offset, cLength - offset) | (static_cast<uint64_t>(cLength) << 56));
+
+        return Finalize(state, 0xFF);
+    } /* uint64_t SipHash::Hash64(const uint8_t *cData, const size_t &cLength) const */
+
+    /**
+     * @brief Hashes a 4 byte message given as a big-endian integer (an IPv4 address value).
+     * @param cValue The message.
+     * @return The 64-bit hash, equal to Hash64() over the 4 network-order bytes.
+     */
+    constexpr uint64_t SipHash::Hash64(const uint32_t &cValue) const
+    {
+        State state = Initialize(0);
+        Compress(state, (ByteSwap(cValue) >> 32) | (uint64_t{4} << 56));
+        return Finalize(state, 0xFF);
+    } /* uint64_t SipHash::Hash64(const uint32_t &cValue) const */
+
+    /**
+     * @brief Hashes a 16 byte message given as two big-endian integers (an IPv6 address value).
+     * @param cUpper The first 8 bytes of the message.
+     * @param cLower The last 8 bytes of the message.
+     * @param upperHash The first 64 bits of the 128-bit hash.
+     * @param lowerHash The last 64 bits of the 128-bit hash.
+     */
+    constexpr void SipHash::Hash128(const uint64_t &cUpper, const uint64_t &cLower, uint64_t &upperHash, uint64_t &lowerHash) const
+    {
+        State state = Initialize(0xEE);
+        Compress(state, ByteSwap(cUpper));
+        Compress(state, ByteSwap(cLower));
+        Compress(state, uint64_t{16} << 56);
+
+        upperHash = Finalize(state, 0xEE);
+        state.v1 ^= 0xDD;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            Round(state);
+        }
+        lowerHash = state.v0 ^ state.v1 ^ state.v2 ^ state.v3;
+    } /* void SipHash::Hash128(const uint64_t &cUpper, const uint64_t &cLower, uint64_t &upperHash, uint64_t &lowerHash) const */
+
+    constexpr uint64_t SipHash::ByteSwap(const uint64_t &cValue)
+    {
+        uint64_t swapped{};
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            swapped |= ((cValue >> (8 * i)) & 0xFF) << (56 - 8 * i);
+        }
+        return swapped;
+    } /* uint64_t SipHash::ByteSwap(const uint64_t &cValue) */
+
+    constexpr uint64_t SipHash::LoadLittleEndian(const uint8_t *cData, const size_t &cLength)
+    {
+        uint64_t value{};
+        for (size_t i = 0; i < cLength; i++)
+        {
+            value |= static_cast<uint64_t>(cData[i]) << (8 * i);
+        }
+        return value;
+    } /* uint64_t SipHash::LoadLittleEndian(const uint8_t *cData, const size_t &cLength) */
+
+    constexpr void SipHash::Round(State &state)
+    {
+        state.v0 += state.v1;
+        state.v1 = RotateLeft(state.v1, 13) ^ state.v0;
+        state.v0 = RotateLeft(state.v0, 32);
+        state.v2 += state.v3;
+        state.v3 = RotateLeft(state.v3, 16) ^ state.v2;
+        state.v0 += state.v3;
+        state.v3 = RotateLeft(state.v3, 21) ^ state.v0;
+        state.v2 += state.v1;
+        state.v1 = RotateLeft(state.v1, 17) ^ state.v2;
+        state.v2 = RotateLeft(state.v2, 32);
+    } /* void SipHash::Round(State &state) */
+
+    constexpr void SipHash::Compress(State &state, const uint64_t &cWord)
+    {
+        state.v3 ^= cWord;
+        Round(state);
+        Round(state);
+        state.v0 ^= cWord;
+    } /* void SipHash::Compress(State &state, const uint64_t &cWord) */
+
+    constexpr SipHash::State SipHash::Initialize(const uint64_t &cOutputTweak) const
+    {
+        return State{_k0 ^ 0x736F6D6570736575ull, _k1 ^ 0x646F72616E646F6Dull ^ cOutputTweak, _k0 ^ 0x6C7967656E657261ull, _k1 ^ 0x7465646279746573ull};
+    } /* SipHash::State SipHash::Initialize(const uint64_t &cOutputTweak) const */
+
+    constexpr uint64_t SipHash::Finalize(State &state, const uint8_t &cTweak)
+    {
+        state.v2 ^= cTweak;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            Round(state);
+        }
+        return state.v0 ^ state.v1 ^ state.v2 ^ state.v3;
+    } /* uint64_t SipHash::Finalize(State &state, const uint8_t &cTweak) */
+}
+
+#endif /* SIPHASH_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
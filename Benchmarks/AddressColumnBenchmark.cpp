@@ -0,0 +1,133 @@
+/**
+ * @file AddressColumnBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4AddressColumn and IPv6AddressColumn scan throughput against vectors of address objects.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Fills a column and a std::vector of address objects with the same random addresses, then
+ * measures the equality, prefix and range filters of the column against the loop an engine
+ * storing address objects would run (IPv4Prefix::Contains() and friends per row), and gather
+ * and dictionary encoding of the column.
+ *
+ * Usage: ADDRESS_COLUMN_BENCHMARK [number of rows in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressColumn/IPv4AddressColumn.hpp"
+#include "AddressColumn/IPv6AddressColumn.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cRows, const size_t &cMatches, const std::chrono::duration<double> &cElapsed)
+    {
+        std::cout << cName << cRows / cElapsed.count() / 1e6 << " M rows/s (" << cMatches << " matches)\n";
+    }
+
+    /**
+     * @brief Times a filter over the column and the same predicate over the address objects.
+     */
+    template <typename Address, typename Column, typename ColumnFilter, typename Predicate>
+    void Compare(const char *cName, const Column &cColumn, const std::vector<Address> &cObjects, std::vector<uint32_t> &selection,
+                 const ColumnFilter &cColumnFilter, const Predicate &cPredicate)
+    {
+        std::cout << cName << "\n";
+        auto start = std::chrono::steady_clock::now();
+        const size_t cMatches = cColumnFilter(selection.data());
+        Report("  column filter:    ", cColumn.Size(), cMatches, std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        size_t count{};
+        for (size_t row = 0; row < cObjects.size(); row++)
+        {
+            if (cPredicate(cObjects[row]))
+            {
+                selection[count++] = static_cast<uint32_t>(row);
+            }
+        }
+        Report("  object vector:    ", cObjects.size(), count, std::chrono::steady_clock::now() - start);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cRows = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 32) * 1000000;
+
+    std::mt19937_64 random(42);
+    std::vector<IPv4Address> ipv4(cRows);
+    std::vector<IPv6Address> ipv6(cRows / 2);
+    for (IPv4Address &address : ipv4)
+    {
+        // Addresses from 4096 /24 networks, like the client side of a flow log.
+        address = IPv4Address::FromUint32(0x0A000000u | static_cast<uint32_t>(random() % 4096) << 8 | static_cast<uint32_t>(random() % 256));
+    }
+    for (IPv6Address &address : ipv6)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | (random() % 4096) << 16, random() % 65536);
+    }
+
+    const IPv4AddressColumn cIpv4Column(ipv4);
+    const IPv6AddressColumn cIpv6Column(ipv6);
+    // Touch the selection buffer once so page faults are not measured.
+    std::vector<uint32_t> selection(cRows, 1);
+
+    const IPv4Address cIpv4Needle = ipv4[cRows / 2];
+    Compare("IPv4 equality", cIpv4Column, ipv4, selection,
+            [&](uint32_t *output) { return cIpv4Column.FilterEqual(cIpv4Needle, output); },
+            [&](const IPv4Address &cAddress) { return cAddress == cIpv4Needle; });
+
+    const IPv4Prefix cIpv4Prefix(IPv4Address("10.0.0.0"), 16);
+    Compare("IPv4 prefix /16 (~6% selected)", cIpv4Column, ipv4, selection,
+            [&](uint32_t *output) { return cIpv4Column.FilterPrefix(cIpv4Prefix, output); },
+            [&](const IPv4Address &cAddress) { return cIpv4Prefix.Contains(cAddress); });
+
+    const IPv4Range cIpv4Range(IPv4Address("10.0.0.0"), IPv4Address("10.7.255.255"));
+    Compare("IPv4 range (~50% selected)", cIpv4Column, ipv4, selection,
+            [&](uint32_t *output) { return cIpv4Column.FilterRange(cIpv4Range, output); },
+            [&](const IPv4Address &cAddress) { return cIpv4Range.Contains(cAddress); });
+
+    const IPv6Address cIpv6Needle = ipv6[ipv6.size() / 2];
+    Compare("IPv6 equality", cIpv6Column, ipv6, selection,
+            [&](uint32_t *output) { return cIpv6Column.FilterEqual(cIpv6Needle, output); },
+            [&](const IPv6Address &cAddress) { return cAddress == cIpv6Needle; });
+
+    const IPv6Prefix cIpv6Prefix(IPv6Address("2001:db8::"), 40);
+    Compare("IPv6 prefix /40 (~6% selected)", cIpv6Column, ipv6, selection,
+            [&](uint32_t *output) { return cIpv6Column.FilterPrefix(cIpv6Prefix, output); },
+            [&](const IPv6Address &cAddress) { return cIpv6Prefix.Contains(cAddress); });
+
+    const IPv6Range cIpv6Range(IPv6Address("2001:db8::"), IPv6Address("2001:db8:7ff:ffff:ffff:ffff:ffff:ffff"));
+    Compare("IPv6 range (~50% selected)", cIpv6Column, ipv6, selection,
+            [&](uint32_t *output) { return cIpv6Column.FilterRange(cIpv6Range, output); },
+            [&](const IPv6Address &cAddress) { return cIpv6Range.Contains(cAddress); });
+
+    std::cout << "IPv4 gather and dictionary\n";
+    const size_t cSelected = cIpv4Column.FilterRange(cIpv4Range, selection.data());
+    auto start = std::chrono::steady_clock::now();
+    const IPv4AddressColumn cGathered = cIpv4Column.Gather(selection.data(), cSelected);
+    Report("  Gather():           ", cSelected, cGathered.Size(), std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    const IPv4AddressColumn cDictionary = cIpv4Column.DictionaryEncode(selection.data());
+    Report("  DictionaryEncode(): ", cRows, cDictionary.Size(), std::chrono::steady_clock::now() - start);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
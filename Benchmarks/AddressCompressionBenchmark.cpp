@@ -0,0 +1,175 @@
+/**
+ * @file AddressCompressionBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Compressed sorted address list size, decode throughput and random access.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Compresses sorted blocklist-like address sets (random hosts of 4096 /24 or /64 networks,
+ * and sorted /64 prefixes), then measures the size per address, full decode throughput in
+ * bytes of decoded values per second, single block decode and Contains(). For IPv4 the
+ * lookups are compared with std::binary_search over the uncompressed values.
+ *
+ * Usage: ADDRESS_COMPRESSION_BENCHMARK [number of addresses in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressCompression/CompressedIPv4List.hpp"
+#include "AddressCompression/CompressedIPv6List.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Number of random lookups.
+     */
+    constexpr size_t LOOKUPS = 1000000;
+
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    void RunIPv4(const char *cName, const std::vector<uint32_t> &cValues)
+    {
+        std::cout << cName << " (" << cValues.size() << " addresses)\n";
+        auto start = std::chrono::steady_clock::now();
+        const CompressedIPv4List cList(cValues.data(), cValues.size());
+        std::cout << "  encode:            " << cValues.size() / Seconds(start) / 1e6 << " M addresses/s\n";
+        std::cout << "  size:              " << static_cast<double>(cList.CompressedSize()) / cValues.size() << " bytes/address (raw 4)\n";
+
+        std::vector<uint32_t> decoded(cValues.size());
+        start = std::chrono::steady_clock::now();
+        for (int round = 0; round < 10; round++)
+        {
+            cList.Decode(decoded.data());
+        }
+        std::cout << "  decode:            " << 10 * 4 * cValues.size() / Seconds(start) / 1e9 << " GB/s" << (decoded == cValues ? "" : " MISMATCH") << "\n";
+
+        std::mt19937 random(1);
+        uint32_t block[CompressedIPv4List::BLOCK_SIZE];
+        uint64_t checksum{};
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            cList.DecodeBlock(random() % cList.BlockCount(), block);
+            checksum += block[0];
+        }
+        std::cout << "  random block:      " << Seconds(start) / LOOKUPS * 1e9 << " ns\n";
+
+        std::vector<uint32_t> probes(LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            probes[i] = i % 2 ? cValues[random() % cValues.size()] : cValues[random() % cValues.size()] + 1;
+        }
+        size_t hits{};
+        start = std::chrono::steady_clock::now();
+        for (const uint32_t &cProbe : probes)
+        {
+            hits += cList.Contains(IPv4Address::FromUint32(cProbe));
+        }
+        std::cout << "  Contains():        " << Seconds(start) / LOOKUPS * 1e9 << " ns\n";
+        start = std::chrono::steady_clock::now();
+        for (const uint32_t &cProbe : probes)
+        {
+            hits -= std::binary_search(cValues.begin(), cValues.end(), cProbe);
+        }
+        std::cout << "  std::binary_search: " << Seconds(start) / LOOKUPS * 1e9 << " ns" << (hits ? " MISMATCH" : "") << " (" << checksum % 10 << ")\n";
+    }
+
+    void RunIPv6(const char *cName, const std::vector<uint64_t> &cUpper, const std::vector<uint64_t> &cLower)
+    {
+        std::cout << cName << " (" << cUpper.size() << " addresses)\n";
+        auto start = std::chrono::steady_clock::now();
+        const CompressedIPv6List cList(cUpper.data(), cLower.data(), cUpper.size());
+        std::cout << "  encode:            " << cUpper.size() / Seconds(start) / 1e6 << " M addresses/s\n";
+        std::cout << "  size:              " << static_cast<double>(cList.CompressedSize()) / cUpper.size() << " bytes/address (raw 16)\n";
+
+        std::vector<uint64_t> upper(cUpper.size());
+        std::vector<uint64_t> lower(cUpper.size());
+        start = std::chrono::steady_clock::now();
+        for (int round = 0; round < 10; round++)
+        {
+            cList.Decode(upper.data(), lower.data());
+        }
+        std::cout << "  decode:            " << 10 * 16 * cUpper.size() / Seconds(start) / 1e9 << " GB/s"
+                  << (upper == cUpper && lower == cLower ? "" : " MISMATCH") << "\n";
+
+        std::mt19937 random(1);
+        std::vector<IPv6Address> probes(LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            const size_t cIndex = random() % cUpper.size();
+            probes[i] = IPv6Address::FromUint64(cUpper[cIndex], cLower[cIndex] + i % 2);
+        }
+        size_t hits{};
+        start = std::chrono::steady_clock::now();
+        for (const IPv6Address &cProbe : probes)
+        {
+            hits += cList.Contains(cProbe);
+        }
+        std::cout << "  Contains():        " << Seconds(start) / LOOKUPS * 1e9 << " ns (" << hits * 100 / LOOKUPS << "% hits)\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4) * 1000000;
+    std::mt19937_64 random(42);
+
+    std::vector<uint32_t> ipv4(cCount);
+    for (uint32_t &value : ipv4)
+    {
+        value = static_cast<uint32_t>(0x0A000000u | (random() % 4096) << 8 | random() % 256);
+    }
+    std::sort(ipv4.begin(), ipv4.end());
+    ipv4.erase(std::unique(ipv4.begin(), ipv4.end()), ipv4.end());
+    RunIPv4("IPv4 hosts of 4096 /24s", ipv4);
+
+    for (uint32_t &value : ipv4)
+    {
+        value = static_cast<uint32_t>(random());
+    }
+    std::sort(ipv4.begin(), ipv4.end());
+    RunIPv4("IPv4 uniformly random", ipv4);
+
+    std::vector<uint64_t> upper(cCount);
+    std::vector<uint64_t> lower(cCount);
+    std::vector<std::pair<uint64_t, uint64_t>> ipv6(cCount);
+    for (auto &address : ipv6)
+    {
+        address = {0x20010DB800000000ull | (random() % 4096) << 16, random() % 65536};
+    }
+    std::sort(ipv6.begin(), ipv6.end());
+    for (size_t i = 0; i < cCount; i++)
+    {
+        upper[i] = ipv6[i].first;
+        lower[i] = ipv6[i].second;
+    }
+    RunIPv6("IPv6 hosts of 4096 /64s", upper, lower);
+
+    for (size_t i = 0; i < cCount; i++)
+    {
+        upper[i] = 0x2A00000000000000ull + 16 * i + random() % 16;
+        lower[i] = 0;
+    }
+    std::sort(upper.begin(), upper.end());
+    RunIPv6("IPv6 sorted /64 prefixes", upper, lower);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,120 @@
+/**
+ * @file AddressFormatBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Address formatter throughput against the operator<< path.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Formats random addresses into one reused buffer, as a logger does: through the fmt::formatter
+ * specialisations, through fmt::streamed() (operator<< and ToString()) and through an
+ * std::ostringstream. Without {fmt} only AddressFormat::Write() and the stream are compared.
+ *
+ * Usage: ADDRESS_FORMAT_BENCHMARK [number of addresses in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressFormat/AddressFormatter.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#if defined(ETHERNET_PARAMETER_WITH_FMT)
+#include <fmt/ostream.h>
+#endif
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cCount, const size_t &cBytes, const std::chrono::steady_clock::time_point &cStart)
+    {
+        const double cSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+        std::cout << cName << cCount / cSeconds / 1e6 << " M addresses/s (" << cBytes << " bytes)\n";
+    }
+
+    template <typename Address>
+    void Run(const char *cName, const std::vector<Address> &cAddresses)
+    {
+        std::cout << cName << " (" << cAddresses.size() << " addresses)\n";
+
+#if defined(ETHERNET_PARAMETER_WITH_FMT)
+        fmt::memory_buffer buffer;
+        auto start = std::chrono::steady_clock::now();
+        size_t bytes{};
+        for (const Address &cAddress : cAddresses)
+        {
+            buffer.clear();
+            fmt::format_to(std::back_inserter(buffer), "peer {}\n", cAddress);
+            bytes += buffer.size();
+        }
+        Report("  fmt::formatter:     ", cAddresses.size(), bytes, start);
+
+        start = std::chrono::steady_clock::now();
+        bytes = 0;
+        for (const Address &cAddress : cAddresses)
+        {
+            buffer.clear();
+            fmt::format_to(std::back_inserter(buffer), "peer {}\n", fmt::streamed(cAddress));
+            bytes += buffer.size();
+        }
+        Report("  fmt::streamed():    ", cAddresses.size(), bytes, start);
+#else
+        const AddressFormat::Spec cSpec{};
+        char text[AddressFormat::MAX_LENGTH];
+        auto start = std::chrono::steady_clock::now();
+        size_t bytes{};
+        for (const Address &cAddress : cAddresses)
+        {
+            bytes += AddressFormat::Write(cAddress, cSpec, text) + 6;
+        }
+        Report("  AddressFormat:      ", cAddresses.size(), bytes, start);
+#endif
+
+        std::ostringstream stream;
+        start = std::chrono::steady_clock::now();
+        bytes = 0;
+        for (const Address &cAddress : cAddresses)
+        {
+            stream.str({});
+            stream << "peer " << cAddress << '\n';
+            bytes += static_cast<size_t>(stream.tellp());
+        }
+        Report("  std::ostringstream: ", cAddresses.size(), bytes, start);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2) * 1000000;
+    std::mt19937_64 random(42);
+    {
+        std::vector<IPv4Address> addresses(cCount);
+        for (IPv4Address &address : addresses)
+        {
+            address = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        Run("IPv4", addresses);
+    }
+
+    std::vector<IPv6Address> addresses(cCount);
+    for (IPv6Address &address : addresses)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | (random() & 0xFFFF), random());
+    }
+    Run("IPv6", addresses);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,156 @@
+/**
+ * @file AddressIndexBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Minimal perfect hash build speed, size and StaticAddressMap lookup latency.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Builds a MinimalPerfectHash over random IPv4 and IPv6 keys with 1 and with all hardware
+ * threads, then a StaticAddressMap of tenant IDs, and measures Find() on random members and
+ * non-members against std::unordered_map.
+ *
+ * Usage: ADDRESS_INDEX_BENCHMARK [number of keys in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressIndex/StaticAddressMap.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Number of random lookups.
+     */
+    constexpr size_t LOOKUPS = 1000000;
+
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    /**
+     * @brief Hash of the reference std::unordered_map.
+     */
+    struct AddressHash
+    {
+        size_t operator()(const IPv4Address &cAddress) const { return std::hash<uint32_t>()(cAddress.ToUint32()); }
+        size_t operator()(const IPv6Address &cAddress) const { return std::hash<uint64_t>()(cAddress.GetUpper64() * 0x9E3779B97F4A7C15ull ^ cAddress.GetLower64()); }
+    };
+
+    void RunHash(const char *cName, const std::vector<uint64_t> &cUpper, const std::vector<uint64_t> &cLower)
+    {
+        const size_t cCount = cLower.size();
+        std::cout << cName << " (" << cCount << " keys)\n";
+        for (const size_t &cThreads : std::vector<size_t>{1, 0})
+        {
+            const auto cStart = std::chrono::steady_clock::now();
+            const MinimalPerfectHash cHash(cUpper.empty() ? nullptr : cUpper.data(), cLower.data(), cCount, cThreads);
+            const double cBuild = Seconds(cStart);
+            std::cout << "  build (" << (cThreads ? cThreads : std::max(1u, std::thread::hardware_concurrency())) << " threads): " << cBuild << " s, "
+                      << cCount / cBuild / 1e6 << " M keys/s, " << 8.0 * cHash.SizeInBytes() / cCount << " bits/key\n";
+        }
+    }
+
+    template <typename Address>
+    void RunMap(const char *cName, const std::vector<Address> &cKeys, const std::vector<Address> &cOthers)
+    {
+        std::vector<uint32_t> tenants(cKeys.size());
+        for (size_t i = 0; i < tenants.size(); i++)
+        {
+            tenants[i] = static_cast<uint32_t>(i % 100000);
+        }
+        auto start = std::chrono::steady_clock::now();
+        const StaticAddressMap<Address, uint32_t> cMap(cKeys, tenants);
+        std::cout << cName << " map of tenant IDs\n";
+        std::cout << "  build:              " << Seconds(start) << " s, " << static_cast<double>(cMap.SizeInBytes()) / cKeys.size() << " bytes/key\n";
+
+        std::mt19937_64 random(1);
+        std::vector<Address> probes(LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            probes[i] = i % 2 ? cKeys[random() % cKeys.size()] : cOthers[random() % cOthers.size()];
+        }
+        uint64_t checksum{};
+        uint32_t tenant{};
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : probes)
+        {
+            checksum += cMap.Find(cProbe, tenant) ? tenant + 1 : 0;
+        }
+        std::cout << "  Find():             " << Seconds(start) / LOOKUPS * 1e9 << " ns\n";
+
+        std::unordered_map<Address, uint32_t, AddressHash> reference;
+        reference.reserve(cKeys.size());
+        for (size_t i = 0; i < cKeys.size(); i++)
+        {
+            reference.emplace(cKeys[i], tenants[i]);
+        }
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : probes)
+        {
+            const auto cFound = reference.find(cProbe);
+            checksum -= cFound != reference.end() ? cFound->second + 1 : 0;
+        }
+        std::cout << "  std::unordered_map: " << Seconds(start) / LOOKUPS * 1e9 << " ns" << (checksum ? " MISMATCH" : "") << " ("
+                  << static_cast<double>(reference.bucket_count() * sizeof(void *) + reference.size() * 32) / cKeys.size() << " bytes/key)\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10) * 1000000;
+    std::mt19937_64 random(42);
+
+    // Distinct IPv4 keys: a random permutation prefix of a multiplicative sequence.
+    std::vector<IPv4Address> ipv4(cCount + LOOKUPS);
+    std::vector<uint64_t> ipv4Lower(cCount);
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        ipv4[i] = IPv4Address::FromUint32(static_cast<uint32_t>(i * 2654435761u));
+    }
+    std::shuffle(ipv4.begin(), ipv4.end(), random);
+    const std::vector<IPv4Address> cOtherIPv4(ipv4.begin() + cCount, ipv4.end());
+    ipv4.resize(cCount);
+    for (size_t i = 0; i < cCount; i++)
+    {
+        ipv4Lower[i] = ipv4[i].ToUint32();
+    }
+    RunHash("IPv4 keys", {}, ipv4Lower);
+    RunMap("IPv4", ipv4, cOtherIPv4);
+
+    std::vector<IPv6Address> ipv6(cCount + LOOKUPS);
+    std::vector<uint64_t> ipv6Upper(cCount);
+    std::vector<uint64_t> ipv6Lower(cCount);
+    for (IPv6Address &address : ipv6)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | random() >> 32, random());
+    }
+    const std::vector<IPv6Address> cOtherIPv6(ipv6.begin() + cCount, ipv6.end());
+    ipv6.resize(cCount);
+    for (size_t i = 0; i < cCount; i++)
+    {
+        ipv6Upper[i] = ipv6[i].GetUpper64();
+        ipv6Lower[i] = ipv6[i].GetLower64();
+    }
+    RunHash("IPv6 keys", ipv6Upper, ipv6Lower);
+    RunMap("IPv6", ipv6, cOtherIPv6);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,185 @@
+/**
+ * @file AddressScannerBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressScanner throughput benchmark against std::regex and a naive byte loop.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Generates a synthetic log (timestamps, words, ports, MAC addresses, IPv4 and IPv6 addresses)
+ * or reads a real one, then measures the scanner, a naive byte-at-a-time loop using the same
+ * parsers, and std::regex. std::regex only scans a prefix of the log because it is orders of
+ * magnitude slower; its throughput is reported for that prefix.
+ *
+ * Usage: ADDRESS_SCANNER_BENCHMARK [log size in MiB | log file path] [regex prefix in MiB]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressScanner/AddressScanner.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Builds a synthetic log of the given size.
+     */
+    std::string GenerateLog(const size_t &cSize)
+    {
+        static const char *const cWords[]{"GET", "POST", "user", "session", "timeout", "connection", "accepted", "denied", "deadbeef", "cafe"};
+        std::mt19937_64 random(42);
+        std::string log;
+        log.reserve(cSize + 256);
+
+        while (log.size() < cSize)
+        {
+            log += "2026-10-17T12:";
+            log += std::to_string(random() % 60);
+            log += ":00Z host-";
+            log += std::to_string(random() % 100);
+            log += " ";
+            for (int i = 0; i < 6; i++)
+            {
+                log += cWords[random() % 10];
+                log += ' ';
+            }
+
+            switch (random() % 4)
+            {
+            case 0:
+                log += "from " + IPv4Address::FromUint32(static_cast<uint32_t>(random())).ToString() + " port " + std::to_string(random() % 65536);
+                break;
+            case 1:
+                log += "client=" + IPv4Address::FromUint32(static_cast<uint32_t>(random())).ToString() + ":" + std::to_string(random() % 65536);
+                break;
+            case 2:
+            {
+                char text[48];
+                std::snprintf(text, sizeof(text), "[2001:db8::%x:%x]:443", static_cast<unsigned>(random() % 65536), static_cast<unsigned>(random() % 65536));
+                log += text;
+                break;
+            }
+            default:
+                log += "mac 00:1a:2b:3c:4d:5e version 1.2.3 took 12.5ms";
+                break;
+            }
+            log += '\n';
+        }
+
+        return log;
+    }
+
+    /**
+     * @brief Naive scanner: byte-at-a-time run detection, then the library parsers on every run.
+     */
+    size_t NaiveScan(const std::string &cLog)
+    {
+        auto isCandidate = [](const char &c)
+        { return (c >= '0' && c <= ':') || c == '.' || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f'); };
+
+        size_t found{};
+        size_t i{};
+        while (i < cLog.size())
+        {
+            if (!isCandidate(cLog[i]))
+            {
+                i++;
+                continue;
+            }
+
+            const size_t cStart = i;
+            while (i < cLog.size() && isCandidate(cLog[i]))
+            {
+                i++;
+            }
+
+            IPv4Address ipv4;
+            IPv6Address ipv6;
+            size_t length = i - cStart;
+            if (cLog[i - 1] == '.')
+            {
+                length--;
+            }
+            if (IPv6Address::TryParse(cLog.data() + cStart, length, ipv6) || IPv4Address::TryParse(cLog.data() + cStart, length, ipv4))
+            {
+                found++;
+            }
+            else
+            {
+                const size_t cColon = cLog.find(':', cStart);
+                if (cColon < i && IPv4Address::TryParse(cLog.data() + cStart, cColon - cStart, ipv4))
+                {
+                    found++;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cBytes, const size_t &cFound, const std::chrono::duration<double> &cElapsed)
+    {
+        std::cout << cName << cFound << " addresses, " << cBytes / cElapsed.count() / (1 << 20) << " MiB/s\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::string log;
+    const char *cSource = argc > 1 ? argv[1] : "256";
+    char *end{};
+    const unsigned long long cMegabytes = std::strtoull(cSource, &end, 10);
+    if (*end == '\0')
+    {
+        log = GenerateLog(static_cast<size_t>(cMegabytes) << 20);
+    }
+    else
+    {
+        std::ifstream file(cSource, std::ios::binary);
+        log.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const size_t cRegexBytes = std::min(log.size(), static_cast<size_t>(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8) << 20);
+
+    std::vector<AddressScanner::Match> matches;
+    matches.reserve(1 << 20);
+    size_t found{};
+    auto start = std::chrono::steady_clock::now();
+    AddressScanner scanner;
+    for (size_t offset = 0; offset < log.size(); offset += 1 << 20)
+    {
+        found += scanner.Feed(log.data() + offset, std::min<size_t>(1 << 20, log.size() - offset), matches);
+        matches.clear();
+    }
+    found += scanner.Finish(matches);
+    Report("AddressScanner: ", log.size(), found, std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    found = NaiveScan(log);
+    Report("Naive loop:     ", log.size(), found, std::chrono::steady_clock::now() - start);
+
+    const std::regex cPattern(R"(\b(?:\d{1,3}\.){3}\d{1,3}\b|(?:[0-9a-fA-F]{0,4}:){2,7}[0-9a-fA-F]{1,4})", std::regex::optimize);
+    start = std::chrono::steady_clock::now();
+    found = std::distance(std::cregex_iterator(log.data(), log.data() + cRegexBytes, cPattern), std::cregex_iterator());
+    Report("std::regex:     ", cRegexBytes, found, std::chrono::steady_clock::now() - start);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,144 @@
+/**
+ * @file ColumnExportBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Arrow export and Parquet writer throughput and size against CSV text.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Exports random client addresses (4096 /24 networks) through the Arrow C data interface,
+ * writes them to an in-memory Parquet file with every encoding, and compares both against
+ * the CSV text produced with IPv4Address::ToString() and IPv6Address::ToString() and with
+ * AddressTextWriter. Set ETHERNET_PARAMETER_SIMD to compare the AddressTextWriter kernels.
+ *
+ * Usage: COLUMN_EXPORT_BENCHMARK [number of rows in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ColumnExport/AddressTextWriter.hpp"
+#include "ColumnExport/ArrowExporter.hpp"
+#include "ColumnExport/ParquetWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput and output size of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cRows, const size_t &cBytes, const std::chrono::duration<double> &cElapsed)
+    {
+        std::cout << cName << cRows / cElapsed.count() / 1e6 << " M rows/s, " << static_cast<double>(cBytes) / cRows << " bytes/row\n";
+    }
+
+    /**
+     * @brief Writes one column to an in-memory Parquet file and reports it.
+     */
+    template <typename Column>
+    void RunParquet(const char *cName, const Column &cColumn, const ParquetWriter::Encoding &cEncoding)
+    {
+        const auto cStart = std::chrono::steady_clock::now();
+        std::ostringstream stream;
+        ParquetWriter writer(stream);
+        writer.WriteColumn("address", cColumn, nullptr, cEncoding);
+        writer.Close();
+        Report(cName, cColumn.Size(), stream.str().size(), std::chrono::steady_clock::now() - cStart);
+    }
+
+    /**
+     * @brief Formats addresses as one CSV line each and reports it.
+     */
+    template <typename Address>
+    void RunCsv(const char *cName, const std::vector<Address> &cAddresses)
+    {
+        const auto cStart = std::chrono::steady_clock::now();
+        std::string csv;
+        for (const Address &cAddress : cAddresses)
+        {
+            csv += cAddress.ToString();
+            csv += '\n';
+        }
+        Report(cName, cAddresses.size(), csv.size(), std::chrono::steady_clock::now() - cStart);
+    }
+
+    /**
+     * @brief Formats addresses as one line each with AddressTextWriter and reports it.
+     */
+    template <typename Address>
+    void RunTextWriter(const char *cName, const std::vector<Address> &cAddresses)
+    {
+        const auto cStart = std::chrono::steady_clock::now();
+        AddressTextWriter writer;
+        writer.Write(cAddresses.data(), cAddresses.size());
+        Report(cName, cAddresses.size(), writer.Size(), std::chrono::steady_clock::now() - cStart);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cRows = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4) * 1000000;
+
+    std::mt19937_64 random(42);
+    std::vector<IPv4Address> ipv4(cRows);
+    std::vector<IPv6Address> ipv6(cRows);
+    for (size_t i = 0; i < cRows; i++)
+    {
+        const uint64_t cNetwork = random() % 4096;
+        ipv4[i] = IPv4Address::FromUint32(static_cast<uint32_t>(0x0A000000u | cNetwork << 8 | random() % 256));
+        ipv6[i] = IPv6Address::FromUint64(0x20010DB800000000ull | cNetwork << 16, random() % 256);
+    }
+    const IPv4AddressColumn cIpv4Column(ipv4);
+    const IPv6AddressColumn cIpv6Column(ipv6);
+
+    std::cout << "Arrow C data interface\n";
+    ArrowArray array{};
+    ArrowSchema schema{};
+    auto start = std::chrono::steady_clock::now();
+    ArrowExporter::Export(ipv4.data(), ipv4.size(), nullptr, "address", &array, &schema);
+    Report("  IPv4 addresses (zero-copy): ", cRows, 4 * cRows, std::chrono::steady_clock::now() - start);
+    array.release(&array);
+    schema.release(&schema);
+
+    start = std::chrono::steady_clock::now();
+    ArrowExporter::Export(ipv6.data(), ipv6.size(), nullptr, "address", &array, &schema);
+    Report("  IPv6 addresses:             ", cRows, 16 * cRows, std::chrono::steady_clock::now() - start);
+    array.release(&array);
+    schema.release(&schema);
+
+    std::cout << "Parquet, random order\n";
+    RunParquet("  IPv4 plain:      ", cIpv4Column, ParquetWriter::Encoding::Plain);
+    RunParquet("  IPv4 dictionary: ", cIpv4Column, ParquetWriter::Encoding::Dictionary);
+    RunParquet("  IPv4 delta:      ", cIpv4Column, ParquetWriter::Encoding::Delta);
+    RunParquet("  IPv6 plain:      ", cIpv6Column, ParquetWriter::Encoding::Plain);
+    RunParquet("  IPv6 dictionary: ", cIpv6Column, ParquetWriter::Encoding::Dictionary);
+    RunParquet("  IPv6 delta:      ", cIpv6Column, ParquetWriter::Encoding::Delta);
+
+    std::cout << "Parquet, sorted\n";
+    std::sort(ipv4.begin(), ipv4.end());
+    std::sort(ipv6.begin(), ipv6.end());
+    RunParquet("  IPv4 delta:      ", IPv4AddressColumn(ipv4), ParquetWriter::Encoding::Delta);
+    RunParquet("  IPv6 delta:      ", IPv6AddressColumn(ipv6), ParquetWriter::Encoding::Delta);
+
+    std::cout << "CSV text\n";
+    RunCsv("  IPv4 ToString(): ", ipv4);
+    RunCsv("  IPv6 ToString(): ", ipv6);
+    RunTextWriter("  IPv4 AddressTextWriter: ", ipv4);
+    RunTextWriter("  IPv6 AddressTextWriter: ", ipv6);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,185 @@
+/**
+ * @file ConnTrackBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ConnTrackTable fill rate and steady-state packet rate with millions of concurrent flows.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Fills a table with random IPv4 and then IPv6 flows, then replays packets of random flows in
+ * random directions. Each packet extends the timeout of its flow, packets of flows that have
+ * aged out re-create them, and the table is aged every 64 batches, so the flow count settles
+ * where creation and expiry balance. One tick of the clock is one batch of 256 packets; the
+ * timeout is four times the mean number of ticks between two packets of a flow.
+ *
+ * Usage: CONN_TRACK_BENCHMARK [flows in millions] [packets per thread in millions] [threads]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ConnTrack/ConnTrackTable.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Packets processed per batch call.
+     */
+    constexpr size_t PACKETS_PER_BATCH = 256;
+
+    /**
+     * @brief Returns the seconds since a start time.
+     */
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    /**
+     * @brief Returns a random address.
+     */
+    IPv4Address RandomAddress(std::mt19937_64 &random, const IPv4Address &) { return IPv4Address::FromUint32(static_cast<uint32_t>(random())); }
+    IPv6Address RandomAddress(std::mt19937_64 &random, const IPv6Address &) { return IPv6Address::FromUint64(0x20010DB800000000ull | (random() & 0xFFFF), random()); }
+
+    /**
+     * @brief Replays packets on a number of threads and prints the packet rate and the table state.
+     */
+    template <typename Address>
+    void Replay(ConnTrackTable<Address, uint32_t> &table, const std::vector<FlowKey<Address>> &cFlows, const size_t &cPackets, const unsigned &cThreads,
+                const bool &cBatched, std::atomic<uint64_t> &clock)
+    {
+        using Table = ConnTrackTable<Address, uint32_t>;
+        const uint64_t cTimeout = 4 * cFlows.size() / (PACKETS_PER_BATCH * cThreads) + 1;
+        std::atomic<size_t> created{};
+        std::atomic<size_t> expired{};
+        std::vector<std::thread> threads;
+        const auto cStart = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < cThreads; t++)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                                     std::mt19937_64 random(t + 1);
+                                     std::vector<FlowKey<Address>> packets(PACKETS_PER_BATCH);
+                                     std::vector<FlowKey<Address>> misses;
+                                     misses.reserve(PACKETS_PER_BATCH);
+                                     std::vector<uint32_t> values(PACKETS_PER_BATCH);
+                                     std::unique_ptr<bool[]> inserted(new bool[PACKETS_PER_BATCH]);
+                                     std::unique_ptr<typename Table::Match[]> matches(new typename Table::Match[PACKETS_PER_BATCH]);
+                                     std::vector<typename Table::Flow> aged;
+                                     size_t localCreated{};
+                                     size_t localExpired{};
+                                     for (size_t batch = 0; batch * PACKETS_PER_BATCH < cPackets; batch++)
+                                     {
+                                         for (FlowKey<Address> &packet : packets)
+                                         {
+                                             const uint64_t cRandom = random();
+                                             const FlowKey<Address> &cFlow = cFlows[(cRandom >> 1) % cFlows.size()];
+                                             packet = (cRandom & 1) ? cFlow.Reversed() : cFlow;
+                                         }
+                                         const uint64_t cNow = clock.fetch_add(1) + 1;
+                                         const uint64_t cExpiry = cNow + cTimeout;
+                                         if (cBatched)
+                                         {
+                                             table.LookupBatch(packets.data(), packets.size(), cExpiry, values.data(), matches.get());
+                                         }
+                                         else
+                                         {
+                                             for (size_t i = 0; i < packets.size(); i++)
+                                             {
+                                                 matches[i] = table.Lookup(packets[i], values[i], cExpiry);
+                                             }
+                                         }
+
+                                         misses.clear();
+                                         for (size_t i = 0; i < packets.size(); i++)
+                                         {
+                                             if (matches[i] == Table::Match::NONE)
+                                             {
+                                                 misses.push_back(packets[i]);
+                                             }
+                                         }
+                                         localCreated += table.InsertBatch(misses.data(), values.data(), misses.size(), cExpiry, inserted.get());
+
+                                         if (!(batch & 63))
+                                         {
+                                             aged.clear();
+                                             localExpired += table.Expire(cNow, aged);
+                                         }
+                                     }
+                                     created += localCreated;
+                                     expired += localExpired; });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        const double cSeconds = Seconds(cStart);
+        const size_t cTotal = (cPackets + PACKETS_PER_BATCH - 1) / PACKETS_PER_BATCH * PACKETS_PER_BATCH * cThreads;
+        std::cout << "  " << (cBatched ? "LookupBatch()" : "Lookup()     ") << ", " << cThreads << " threads: " << cTotal / cSeconds / 1e6
+                  << " M packets/s, " << 100.0 * created.load() / cTotal << "% created, " << expired.load() << " expired, "
+                  << table.Size() << " flows\n";
+    }
+
+    /**
+     * @brief Fills a table with random flows and replays packets against it.
+     */
+    template <typename Address>
+    void Run(const char *cName, const size_t &cFlowCount, const size_t &cPackets, const unsigned &cThreads)
+    {
+        using Table = ConnTrackTable<Address, uint32_t>;
+        std::mt19937_64 random(42);
+        std::vector<FlowKey<Address>> flows(cFlowCount);
+        for (FlowKey<Address> &flow : flows)
+        {
+            const uint64_t cPorts = random();
+            flow = FlowKey<Address>(RandomAddress(random, Address()), RandomAddress(random, Address()), static_cast<uint16_t>(cPorts),
+                                    static_cast<uint16_t>(cPorts >> 16), (cPorts >> 32) & 1 ? 6 : 17);
+        }
+
+        // Room for a quarter more flows than are live, as a table sized for the peak would have.
+        Table table(cFlowCount + cFlowCount / 4);
+        std::vector<uint32_t> values(cFlowCount);
+        std::unique_ptr<bool[]> inserted(new bool[cFlowCount]);
+        const auto cStart = std::chrono::steady_clock::now();
+        const size_t cInserted = table.InsertBatch(flows.data(), values.data(), flows.size(), 4 * cFlowCount / PACKETS_PER_BATCH + 1, inserted.get());
+        const double cSeconds = Seconds(cStart);
+        std::cout << cName << ": " << cInserted << " flows in " << table.ShardCount() << " shards, " << table.MemoryBytes() / (1 << 20)
+                  << " MiB (" << table.MemoryBytes() / cInserted << " bytes/flow), filled at " << cInserted / cSeconds / 1e6 << " M flows/s\n";
+
+        std::atomic<uint64_t> clock{};
+        Replay(table, flows, cPackets, 1, false, clock);
+        Replay(table, flows, cPackets, 1, true, clock);
+        if (cThreads > 1)
+        {
+            Replay(table, flows, cPackets, cThreads, true, clock);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cFlows = std::max<size_t>(1, static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2) * 1000000);
+    const size_t cPackets = static_cast<size_t>(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10) * 1000000;
+    const unsigned cThreads = argc > 3 ? static_cast<unsigned>(std::strtoul(argv[3], nullptr, 10)) : std::max(1u, std::thread::hardware_concurrency());
+
+    Run<IPv4Address>("IPv4", cFlows, cPackets, cThreads);
+    Run<IPv6Address>("IPv6", cFlows, cPackets, cThreads);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,114 @@
+/**
+ * @file CryptoPAnBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CryptoPAn anonymization throughput benchmark.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Anonymizes a trace-like address stream (most addresses from a few thousand /24 networks,
+ * the rest uniformly random) with the single-address and batch functions, on AES-NI and on the
+ * portable AES implementation, and a set of random IPv6 addresses inside a few /64 networks.
+ *
+ * Usage: CRYPTOPAN_BENCHMARK [number of addresses in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "Anonymization/CryptoPAn.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cCount, const uint32_t &cChecksum, const std::chrono::duration<double> &cElapsed)
+    {
+        std::cout << cName << cCount / cElapsed.count() / 1e6 << " M addresses/s (checksum " << cChecksum << ")\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16) * 1000000;
+
+    std::vector<uint8_t> key(CryptoPAn::KEY_SIZE);
+    std::mt19937_64 random(42);
+    for (uint8_t &byte : key)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+
+    std::vector<uint32_t> networks(4096);
+    for (uint32_t &network : networks)
+    {
+        network = static_cast<uint32_t>(random()) & 0xFFFFFF00u;
+    }
+
+    std::vector<IPv4Address> addresses(cCount);
+    for (IPv4Address &address : addresses)
+    {
+        const uint64_t cValue = random();
+        address = (cValue % 10 == 0) ? IPv4Address::FromUint32(static_cast<uint32_t>(cValue >> 32))
+                                     : IPv4Address::FromUint32(networks[(cValue >> 8) % networks.size()] | static_cast<uint8_t>(cValue >> 40));
+    }
+    std::vector<IPv4Address> anonymized(cCount);
+
+    for (const bool cUseHardware : {true, false})
+    {
+        const size_t cRunCount = cUseHardware ? cCount : cCount / 16;
+        std::cout << (cUseHardware ? "AES-NI" : "Portable AES") << ", " << cRunCount << " IPv4 addresses\n";
+
+        CryptoPAn single(key, cUseHardware);
+        uint32_t checksum{};
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < cRunCount; i++)
+        {
+            checksum += single.Anonymize(addresses[i]).ToUint32();
+        }
+        Report("  Anonymize():      ", cRunCount, checksum, std::chrono::steady_clock::now() - start);
+
+        CryptoPAn batch(key, cUseHardware);
+        start = std::chrono::steady_clock::now();
+        batch.AnonymizeBatch(addresses.data(), anonymized.data(), cRunCount);
+        checksum = 0;
+        for (size_t i = 0; i < cRunCount; i++)
+        {
+            checksum += anonymized[i].ToUint32();
+        }
+        Report("  AnonymizeBatch(): ", cRunCount, checksum, std::chrono::steady_clock::now() - start);
+
+        // Second pass with warm caches.
+        start = std::chrono::steady_clock::now();
+        batch.AnonymizeBatch(addresses.data(), anonymized.data(), cRunCount);
+        Report("  ...warm caches:   ", cRunCount, checksum, std::chrono::steady_clock::now() - start);
+    }
+
+    const size_t cIpv6Count = cCount / 16;
+    std::vector<IPv6Address> ipv6Addresses(cIpv6Count);
+    for (IPv6Address &address : ipv6Addresses)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | (random() % 64), random());
+    }
+    std::vector<IPv6Address> ipv6Anonymized(cIpv6Count);
+
+    CryptoPAn ipv6(key);
+    const auto cStart = std::chrono::steady_clock::now();
+    ipv6.AnonymizeBatch(ipv6Addresses.data(), ipv6Anonymized.data(), cIpv6Count);
+    Report("IPv6 AnonymizeBatch(): ", cIpv6Count, static_cast<uint32_t>(ipv6Anonymized[0].GetLower64()), std::chrono::steady_clock::now() - cStart);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,144 @@
+/**
+ * @file EliasFanoBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Elias-Fano address set size and query latency.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Builds an EliasFanoIPv4Set over random IPv4 addresses and an EliasFanoIPv6Set over random
+ * /64 networks of a /32, then measures bits per key, Contains(), Predecessor() and Select()
+ * on random probes (half members, half other addresses of the same distribution) against std::binary_search and std::upper_bound over the
+ * uncompressed sorted keys.
+ *
+ * Usage: ELIAS_FANO_BENCHMARK [number of keys in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressCompression/EliasFanoIPv4Set.hpp"
+#include "AddressCompression/EliasFanoIPv6Set.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Number of random lookups.
+     */
+    constexpr size_t LOOKUPS = 1000000;
+
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    template <typename Set, typename Address, typename Key>
+    void Run(const char *cName, const std::vector<Address> &cAddresses, const std::vector<Address> &cOthers, Key (*keyOf)(const Address &))
+    {
+        auto start = std::chrono::steady_clock::now();
+        const Set cSet(cAddresses);
+        const double cBuild = Seconds(start);
+        std::vector<Key> keys(cAddresses.size());
+        std::transform(cAddresses.begin(), cAddresses.end(), keys.begin(), keyOf);
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        std::cout << cName << " (" << cSet.Size() << " keys)\n";
+        std::cout << "  build:              " << cAddresses.size() / cBuild / 1e6 << " M addresses/s\n";
+        std::cout << "  size:               " << 8.0 * cSet.SizeInBytes() / cSet.Size() << " bits/key (raw " << 8 * sizeof(Key) << ")\n";
+
+        std::mt19937_64 random(1);
+        std::vector<Address> probes(LOOKUPS);
+        std::vector<Key> probeKeys(LOOKUPS);
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            probes[i] = i % 2 ? cAddresses[random() % cAddresses.size()] : cOthers[random() % cOthers.size()];
+            probeKeys[i] = keyOf(probes[i]);
+        }
+
+        size_t hits{};
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : probes)
+        {
+            hits += cSet.Contains(cProbe);
+        }
+        std::cout << "  Contains():         " << Seconds(start) / LOOKUPS * 1e9 << " ns\n";
+        start = std::chrono::steady_clock::now();
+        for (const Key &cProbe : probeKeys)
+        {
+            hits -= std::binary_search(keys.begin(), keys.end(), cProbe);
+        }
+        std::cout << "  std::binary_search: " << Seconds(start) / LOOKUPS * 1e9 << " ns" << (hits ? " MISMATCH" : "") << "\n";
+
+        Address predecessor{};
+        uint64_t checksum{};
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : probes)
+        {
+            checksum += cSet.Predecessor(cProbe, predecessor) ? keyOf(predecessor) : 0;
+        }
+        std::cout << "  Predecessor():      " << Seconds(start) / LOOKUPS * 1e9 << " ns\n";
+        start = std::chrono::steady_clock::now();
+        for (const Key &cProbe : probeKeys)
+        {
+            const auto cUpper = std::upper_bound(keys.begin(), keys.end(), cProbe);
+            checksum -= cUpper != keys.begin() ? *(cUpper - 1) : 0;
+        }
+        std::cout << "  std::upper_bound:   " << Seconds(start) / LOOKUPS * 1e9 << " ns" << (checksum ? " MISMATCH" : "") << "\n";
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < LOOKUPS; i++)
+        {
+            checksum += keyOf(cSet.Select(static_cast<size_t>(probeKeys[i] % cSet.Size())));
+        }
+        std::cout << "  Select():           " << Seconds(start) / LOOKUPS * 1e9 << " ns (" << checksum % 10 << ")\n";
+    }
+
+    uint32_t IPv4Key(const IPv4Address &cAddress)
+    {
+        return cAddress.ToUint32();
+    }
+
+    uint64_t IPv6Key(const IPv6Address &cAddress)
+    {
+        return cAddress.GetUpper64();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16) * 1000000;
+    std::mt19937_64 random(42);
+
+    std::vector<IPv4Address> ipv4(cCount + LOOKUPS);
+    for (IPv4Address &address : ipv4)
+    {
+        address = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+    }
+    const std::vector<IPv4Address> cOtherIPv4(ipv4.begin() + cCount, ipv4.end());
+    ipv4.resize(cCount);
+    Run<EliasFanoIPv4Set>("IPv4 uniformly random", ipv4, cOtherIPv4, IPv4Key);
+
+    std::vector<IPv6Address> ipv6(cCount + LOOKUPS);
+    for (IPv6Address &address : ipv6)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | random() >> 32, random());
+    }
+    const std::vector<IPv6Address> cOtherIPv6(ipv6.begin() + cCount, ipv6.end());
+    ipv6.resize(cCount);
+    Run<EliasFanoIPv6Set>("IPv6 /64s of a /32", ipv6, cOtherIPv6, IPv6Key);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
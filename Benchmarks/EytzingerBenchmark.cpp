@@ -0,0 +1,129 @@
+/**
+ * @file EytzingerBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief EytzingerAddressSet search latency against std::lower_bound on a sorted vector.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * For each set size, builds an EytzingerAddressSet and a sorted std::vector of random IPv4 and
+ * IPv6 addresses and measures random lower bound and predecessor queries on both.
+ *
+ * Usage: EYTZINGER_BENCHMARK [largest number of keys in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressIndex/EytzingerAddressSet.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Number of random queries per measurement.
+     */
+    constexpr size_t QUERIES = 2000000;
+
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    /**
+     * @brief Folds a found address into the checksum that keeps the searches from being optimized out.
+     */
+    uint64_t Checksum(const IPv4Address &cAddress) { return cAddress.ToUint32() + 1ull; }
+    uint64_t Checksum(const IPv6Address &cAddress) { return cAddress.GetLower64() | 1; }
+
+    template <typename Address>
+    void Run(const char *cName, const std::vector<Address> &cAddresses, const std::vector<Address> &cProbes)
+    {
+        const EytzingerAddressSet<Address> cSet(cAddresses);
+        std::vector<Address> sorted(cAddresses);
+        std::sort(sorted.begin(), sorted.end());
+
+        uint64_t checksum{};
+        Address found;
+        auto start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : cProbes)
+        {
+            checksum += cSet.LowerBound(cProbe, found) ? Checksum(found) : 0;
+        }
+        const double cLowerBound = Seconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : cProbes)
+        {
+            checksum += cSet.Predecessor(cProbe, found) ? Checksum(found) : 0;
+        }
+        const double cPredecessor = Seconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : cProbes)
+        {
+            const auto cLower = std::lower_bound(sorted.begin(), sorted.end(), cProbe);
+            checksum -= cLower != sorted.end() ? Checksum(*cLower) : 0;
+        }
+        const double cReference = Seconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (const Address &cProbe : cProbes)
+        {
+            const auto cUpper = std::upper_bound(sorted.begin(), sorted.end(), cProbe);
+            checksum -= cUpper != sorted.begin() ? Checksum(*(cUpper - 1)) : 0;
+        }
+        const double cReferencePredecessor = Seconds(start);
+
+        std::cout << "  " << cName << ": LowerBound() " << cLowerBound / cProbes.size() * 1e9 << " ns, Predecessor() " << cPredecessor / cProbes.size() * 1e9
+                  << " ns; std::lower_bound " << cReference / cProbes.size() * 1e9 << " ns, std::upper_bound " << cReferencePredecessor / cProbes.size() * 1e9
+                  << " ns" << (checksum ? " MISMATCH" : "") << "\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cLargest = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64) * 1000000;
+    std::mt19937_64 random(42);
+
+    std::vector<IPv4Address> ipv4Probes(QUERIES);
+    std::vector<IPv6Address> ipv6Probes(QUERIES);
+    for (size_t i = 0; i < QUERIES; i++)
+    {
+        ipv4Probes[i] = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        ipv6Probes[i] = IPv6Address::FromUint64(0x20010DB800000000ull | random() >> 32, random());
+    }
+
+    for (size_t count = 1000000; count <= cLargest; count *= 4)
+    {
+        std::cout << count << " keys\n";
+        std::vector<IPv4Address> ipv4(count);
+        for (IPv4Address &address : ipv4)
+        {
+            address = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        Run("IPv4", ipv4, ipv4Probes);
+        ipv4 = std::vector<IPv4Address>();
+
+        std::vector<IPv6Address> ipv6(count);
+        for (IPv6Address &address : ipv6)
+        {
+            address = IPv6Address::FromUint64(0x20010DB800000000ull | random() >> 32, random());
+        }
+        Run("IPv6", ipv6, ipv6Probes);
+    }
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,94 @@
+/**
+ * @file LeaseTableBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief LeaseTable churn benchmark.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Simulates a DHCP server handing out 100k leases per simulated second: every second new clients
+ * bind, a part of the existing clients renew or release, and expired leases are collected. The
+ * table is pre-filled to its steady state size before measuring.
+ *
+ * Usage: LEASE_TABLE_BENCHMARK [seconds] [leases per second] [lease time]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "LeaseTable/LeaseTable.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+int main(int argc, char *argv[])
+{
+    const uint64_t cSeconds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 30;
+    const uint64_t cLeasesPerSecond = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100000;
+    const uint64_t cLeaseTime = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10;
+    const uint64_t cClients = cLeasesPerSecond * cLeaseTime * 2;
+
+    LeaseTable table(0, cLeasesPerSecond * cLeaseTime);
+    std::mt19937_64 random(1);
+    std::vector<LeaseTable::Lease> expired;
+    uint64_t nextClient{};
+
+    auto bind = [&](const uint64_t &cNow)
+    {
+        const uint64_t cClient = nextClient++ % cClients;
+        table.Bind(MacAddress::FromUint64(0x020000000000ull + cClient), IPv4Address::FromUint32(0x0A000000 + static_cast<uint32_t>(cClient)), cNow + cLeaseTime / 2 + random() % cLeaseTime);
+    };
+
+    for (uint64_t second = 1; second <= cLeaseTime; second++)
+    {
+        for (uint64_t i = 0; i < cLeasesPerSecond; i++)
+        {
+            bind(second);
+        }
+        expired.clear();
+        table.Expire(second, expired);
+    }
+
+    uint64_t operations{};
+    uint64_t expiredTotal{};
+    const auto cStart = std::chrono::steady_clock::now();
+    for (uint64_t second = cLeaseTime + 1; second <= cLeaseTime + cSeconds; second++)
+    {
+        for (uint64_t i = 0; i < cLeasesPerSecond; i++)
+        {
+            bind(second);
+            const MacAddress cMac = MacAddress::FromUint64(0x020000000000ull + random() % cClients);
+            if (i % 4 == 0)
+            {
+                table.Release(cMac);
+            }
+            else
+            {
+                table.Renew(cMac, second + cLeaseTime);
+            }
+        }
+        expired.clear();
+        expiredTotal += table.Expire(second, expired);
+        operations += 2 * cLeasesPerSecond;
+    }
+    const std::chrono::duration<double> cElapsed = std::chrono::steady_clock::now() - cStart;
+
+    std::cout << "Simulated seconds:   " << cSeconds << "\n"
+              << "Leases per second:   " << cLeasesPerSecond << "\n"
+              << "Active leases:       " << table.Size() << "\n"
+              << "Expired leases:      " << expiredTotal << "\n"
+              << "Wall time [s]:       " << cElapsed.count() << "\n"
+              << "Operations per sec:  " << operations / cElapsed.count() << "\n"
+              << "Real-time factor:    " << cSeconds / cElapsed.count() << "x\n";
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
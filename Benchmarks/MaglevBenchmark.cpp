@@ -0,0 +1,130 @@
+/**
+ * @file MaglevBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Maglev table build, rebuild and lookup cost, against jump consistent hashing.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Builds a Maglev table for a pool of backends, removes and re-adds one backend and prints the
+ * rebuild time with the share of slots that moved, then looks up random IPv4 and IPv6 clients
+ * one by one, in batches and with JumpHash.
+ *
+ * Usage: MAGLEV_BENCHMARK [number of backends] [table size, a prime] [number of clients in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "FlowHash/JumpHash.hpp"
+#include "FlowHash/MaglevTable.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Returns the seconds since a start time.
+     */
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    /**
+     * @brief Prints the throughput of one lookup phase.
+     */
+    void Report(const char *cName, const size_t &cCount, const uint64_t &cChecksum, const std::chrono::steady_clock::time_point &cStart)
+    {
+        std::cout << cName << cCount / Seconds(cStart) / 1e6 << " M lookups/s (checksum " << cChecksum << ")\n";
+    }
+
+    template <typename Address>
+    void Run(const char *cName, const MaglevTable &cTable, const uint32_t &cBackends, const std::vector<Address> &cClients)
+    {
+        std::cout << cName << " clients (" << cClients.size() << ")\n";
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t checksum{};
+        for (const Address &cClient : cClients)
+        {
+            checksum += cTable.Lookup(cClient);
+        }
+        Report("  Maglev Lookup():      ", cClients.size(), checksum, start);
+
+        std::vector<uint32_t> backends(cClients.size());
+        start = std::chrono::steady_clock::now();
+        cTable.LookupBatch(cClients.data(), cClients.size(), backends.data());
+        checksum = 0;
+        for (const uint32_t &cBackend : backends)
+        {
+            checksum += cBackend;
+        }
+        Report("  Maglev LookupBatch(): ", cClients.size(), checksum, start);
+
+        start = std::chrono::steady_clock::now();
+        JumpHash::BucketBatch(cClients.data(), cClients.size(), cBackends, backends.data());
+        checksum = 0;
+        for (const uint32_t &cBackend : backends)
+        {
+            checksum += cBackend;
+        }
+        Report("  JumpHash:             ", cClients.size(), checksum, start);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const uint32_t cBackends = static_cast<uint32_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500);
+    const size_t cTableSize = static_cast<size_t>(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000003);
+    const size_t cClients = static_cast<size_t>(argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 4) * 1000000;
+
+    MaglevTable table(cTableSize);
+    for (uint32_t id = 0; id < cBackends; id++)
+    {
+        table.AddBackend(id);
+    }
+    auto start = std::chrono::steady_clock::now();
+    table.Build();
+    std::cout << "Build, " << cBackends << " backends, " << cTableSize << " slots: " << Seconds(start) * 1e3 << " ms\n";
+
+    table.RemoveBackend(cBackends / 2);
+    start = std::chrono::steady_clock::now();
+    size_t moved = table.Build();
+    std::cout << "Rebuild without one backend: " << Seconds(start) * 1e3 << " ms, " << 100.0 * moved / cTableSize
+              << "% of slots moved (ideal " << 100.0 / cBackends << "%)\n";
+
+    table.AddBackend(cBackends / 2);
+    start = std::chrono::steady_clock::now();
+    moved = table.Build();
+    std::cout << "Rebuild with it again:       " << Seconds(start) * 1e3 << " ms, " << 100.0 * moved / cTableSize << "% of slots moved\n";
+
+    std::mt19937_64 random(42);
+    {
+        std::vector<IPv4Address> clients(cClients);
+        for (IPv4Address &client : clients)
+        {
+            client = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        Run("IPv4", table, cBackends, clients);
+    }
+
+    std::vector<IPv6Address> clients(cClients);
+    for (IPv6Address &client : clients)
+    {
+        client = IPv6Address::FromUint64(random(), random());
+    }
+    Run("IPv6", table, cBackends, clients);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,99 @@
+/**
+ * @file PrefixMatchBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief PrefixMatch throughput against a Contains() loop building the same bitmask.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Tests a burst of random addresses against a few hot prefixes, once with PrefixMatch and once
+ * with IPv4Prefix::Contains() / IPv6Prefix::Contains() per address. Set ETHERNET_PARAMETER_SIMD
+ * to compare the kernel tiers.
+ *
+ * Usage: PREFIX_MATCH_BENCHMARK [number of addresses in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressColumn/PrefixMatch.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    template <typename Address, typename Prefix>
+    void Run(const char *cName, const std::vector<Address> &cAddresses, const std::vector<Prefix> &cPrefixes)
+    {
+        const double cTests = static_cast<double>(cAddresses.size() * cPrefixes.size());
+        std::vector<uint64_t> matches(PrefixMatch::WordCount(cAddresses.size()));
+        std::cout << cName << " (" << cAddresses.size() << " addresses, " << cPrefixes.size() << " prefixes)\n";
+
+        size_t count{};
+        auto start = std::chrono::steady_clock::now();
+        for (const Prefix &cPrefix : cPrefixes)
+        {
+            count += PrefixMatch::Match(cAddresses.data(), cAddresses.size(), cPrefix, matches.data());
+        }
+        std::cout << "  PrefixMatch: " << cTests / Seconds(start) / 1e6 << " M tests/s (" << count << " matches)\n";
+
+        size_t reference{};
+        start = std::chrono::steady_clock::now();
+        for (const Prefix &cPrefix : cPrefixes)
+        {
+            for (size_t i = 0; i < cAddresses.size(); i++)
+            {
+                matches[i / 64] = (matches[i / 64] & ~(1ull << (i % 64))) | static_cast<uint64_t>(cPrefix.Contains(cAddresses[i])) << (i % 64);
+            }
+            for (const uint64_t &cWord : matches)
+            {
+                reference += static_cast<size_t>(__builtin_popcountll(cWord));
+            }
+        }
+        std::cout << "  Contains():  " << cTests / Seconds(start) / 1e6 << " M tests/s (" << reference << " matches)\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16) * 1000000;
+    std::cout << "SIMD tier: " << CpuFeatures::Name(CpuFeatures::Selected()) << "\n";
+    std::mt19937_64 random(42);
+    {
+        std::vector<IPv4Address> addresses(cCount);
+        for (IPv4Address &address : addresses)
+        {
+            address = IPv4Address::FromUint32(0x0A000000u | static_cast<uint32_t>(random() & 0xFFFFFF));
+        }
+        const std::vector<IPv4Prefix> cPrefixes{IPv4Prefix(IPv4Address("10.0.0.0"), 12), IPv4Prefix(IPv4Address("10.20.0.0"), 16),
+                                                IPv4Prefix(IPv4Address("10.30.40.0"), 24), IPv4Prefix(IPv4Address("192.168.0.0"), 16)};
+        Run("IPv4", addresses, cPrefixes);
+    }
+
+    std::vector<IPv6Address> addresses(cCount);
+    for (IPv6Address &address : addresses)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | (random() & 0xFFFF), random());
+    }
+    const std::vector<IPv6Prefix> cPrefixes{IPv6Prefix(IPv6Address("2001:db8::"), 48), IPv6Prefix(IPv6Address("2001:db8:0:1::"), 64),
+                                            IPv6Prefix(IPv6Address("2001:db8:0:2::"), 56), IPv6Prefix(IPv6Address("2001:db9::"), 32)};
+    Run("IPv6", addresses, cPrefixes);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
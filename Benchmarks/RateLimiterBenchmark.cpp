@@ -0,0 +1,139 @@
+/**
+ * @file RateLimiterBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief RateLimiter checks per second across threads.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Every thread checks batches of 1024 random clients drawn from a population larger than the
+ * table, reading the clock once per batch as a server with a coarse clock does: one at a time
+ * and with AllowBatch on one thread, then with AllowBatch on all hardware threads. A share of the requests comes from a few abusive clients.
+ *
+ * Usage: RATE_LIMITER_BENCHMARK [checks per thread in millions] [clients in millions] [threads]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "RateLimiter/RateLimiter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Returns the seconds since a start time.
+     */
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    /**
+     * @brief Runs the checks on a number of threads and prints the throughput.
+     */
+    template <typename Address>
+    void Run(const char *cName, RateLimiter &limiter, const std::vector<Address> &cClients, const size_t &cChecks, const unsigned &cThreads,
+             const bool &cBatched)
+    {
+        std::atomic<size_t> allowed{};
+        std::vector<std::thread> threads;
+        const auto cStart = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < cThreads; t++)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                                     std::mt19937_64 random(t + 1);
+                                     std::vector<Address> batch(1024);
+                                     std::unique_ptr<bool[]> results(new bool[batch.size()]);
+                                     size_t local{};
+                                     for (size_t done = 0; done < cChecks; done += batch.size())
+                                     {
+                                         for (Address &client : batch)
+                                         {
+                                             // One request in eight comes from one of 16 abusive clients.
+                                             const uint64_t cRandom = random();
+                                             client = cClients[(cRandom & 7) ? cRandom % cClients.size() : (cRandom >> 3) % 16];
+                                         }
+                                         const uint64_t cNow = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+                                         if (cBatched)
+                                         {
+                                             local += limiter.AllowBatch(batch.data(), batch.size(), cNow, results.get());
+                                         }
+                                         else
+                                         {
+                                             for (const Address &cClient : batch)
+                                             {
+                                                 local += limiter.Allow(cClient, cNow);
+                                             }
+                                         }
+                                     }
+                                     allowed += local; });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        const double cSeconds = Seconds(cStart);
+        // Clients are drawn in batches of 1024, so round the count the same way.
+        const size_t cDone = (cChecks + 1023) / 1024 * 1024;
+        std::cout << "  " << cName << (cBatched ? " batch" : "") << ", " << cThreads << " threads: " << cDone * cThreads / cSeconds / 1e6 << " M checks/s, "
+                  << 100.0 * allowed.load() / (cDone * cThreads) << "% allowed\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cChecks = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10) * 1000000;
+    const size_t cClients = static_cast<size_t>(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4) * 1000000;
+    const unsigned cThreads = argc > 3 ? static_cast<unsigned>(std::strtoul(argv[3], nullptr, 10)) : std::max(1u, std::thread::hardware_concurrency());
+
+    // 100 requests per second with bursts of 20; the table tracks half of the clients.
+    RateLimiter limiter(10000000, 20, cClients / 2);
+    std::cout << "Table: " << limiter.Capacity() << " entries, " << limiter.MemoryBytes() / (1 << 20) << " MiB\n";
+
+    std::mt19937_64 random(42);
+    {
+        std::vector<IPv4Address> clients(cClients);
+        for (IPv4Address &client : clients)
+        {
+            client = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        Run("IPv4", limiter, clients, cChecks, 1, false);
+        Run("IPv4", limiter, clients, cChecks, 1, true);
+        if (cThreads > 1)
+        {
+            Run("IPv4", limiter, clients, cChecks, cThreads, true);
+        }
+    }
+
+    limiter.Clear();
+    std::vector<IPv6Address> clients(cClients);
+    for (IPv6Address &client : clients)
+    {
+        client = IPv6Address::FromUint64(0x20010DB800000000ull | (random() & 0xFFFFFFFF), random());
+    }
+    Run("IPv6 /64", limiter, clients, cChecks, 1, false);
+    Run("IPv6 /64", limiter, clients, cChecks, 1, true);
+    if (cThreads > 1)
+    {
+        Run("IPv6 /64", limiter, clients, cChecks, cThreads, true);
+    }
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
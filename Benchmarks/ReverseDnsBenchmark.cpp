@@ -0,0 +1,186 @@
+/**
+ * @file ReverseDnsBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Reverse DNS zone-file emitter benchmark.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Emits PTR records ("<reverse name>. IN PTR host-<n>.example.com.") for consecutive IPv4 and
+ * IPv6 addresses into a fixed chunk buffer, then parses all names back. When an output path is
+ * given the zone file is written there, otherwise chunks are discarded.
+ *
+ * Usage: REVERSE_DNS_BENCHMARK [addresses] [output path]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Size of the zone file chunk buffer.
+     */
+    constexpr size_t CHUNK_SIZE = 1 << 20;
+
+    /**
+     * @brief Record text written after the reverse name.
+     */
+    constexpr char RECORD_MIDDLE[]{". IN PTR host-"};
+
+    /**
+     * @brief Record text written after the host number.
+     */
+    constexpr char RECORD_END[]{".example.com.\n"};
+
+    /**
+     * @brief Collects zone file lines in a chunk buffer and flushes full chunks to the sink.
+     */
+    struct ZoneWriter
+    {
+        std::vector<char> chunk = std::vector<char>(CHUNK_SIZE);
+        size_t used{};
+        uint64_t bytes{};
+        FILE *sink{};
+
+        char *Reserve(const size_t &cSize)
+        {
+            if (used + cSize > chunk.size())
+            {
+                Flush();
+            }
+            return chunk.data() + used;
+        }
+
+        void Flush()
+        {
+            if (sink)
+            {
+                fwrite(chunk.data(), 1, used, sink);
+            }
+            bytes += used;
+            used = 0;
+        }
+    };
+
+    /**
+     * @brief Writes the decimal text of a number.
+     * @return The number of characters written.
+     */
+    size_t WriteDecimal(char *destBuffer, uint64_t value)
+    {
+        char digits[20];
+        size_t count{};
+        do
+        {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            destBuffer[i] = digits[count - 1 - i];
+        }
+        return count;
+    }
+
+    /**
+     * @brief Appends one PTR record to the writer.
+     */
+    template <typename AddressType, size_t MaxNameLength>
+    void EmitRecord(ZoneWriter &writer, const AddressType &cAddress, const uint64_t &cHost)
+    {
+        char *line = writer.Reserve(MaxNameLength + sizeof(RECORD_MIDDLE) + 20 + sizeof(RECORD_END));
+        size_t length = cAddress.ToReverseName(line, MaxNameLength + 1);
+        memcpy(line + length, RECORD_MIDDLE, sizeof(RECORD_MIDDLE) - 1);
+        length += sizeof(RECORD_MIDDLE) - 1;
+        length += WriteDecimal(line + length, cHost);
+        memcpy(line + length, RECORD_END, sizeof(RECORD_END) - 1);
+        writer.used += length + sizeof(RECORD_END) - 1;
+    }
+
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const uint64_t &cCount, const uint64_t &cBytes, const std::chrono::duration<double> &cElapsed)
+    {
+        std::cout << cName << ": " << cCount / cElapsed.count() / 1e6 << " M names/s";
+        if (cBytes != 0)
+        {
+            std::cout << ", " << cBytes / cElapsed.count() / (1 << 20) << " MiB/s";
+        }
+        std::cout << "\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const uint64_t cAddresses = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    FILE *sink = argc > 2 ? std::fopen(argv[2], "wb") : nullptr;
+
+    ZoneWriter writer;
+    writer.sink = sink;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < cAddresses; i++)
+    {
+        EmitRecord<IPv4Address, IPv4Address::REVERSE_NAME_MAX_LENGTH>(writer, IPv4Address::FromUint32(0x0A000000 + static_cast<uint32_t>(i)), i);
+    }
+    writer.Flush();
+    Report("IPv4 emit ", cAddresses, writer.bytes, std::chrono::steady_clock::now() - start);
+
+    const uint64_t cIPv4Bytes = writer.bytes;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < cAddresses; i++)
+    {
+        EmitRecord<IPv6Address, IPv6Address::REVERSE_NAME_LENGTH>(writer, IPv6Address::FromUint64(0x20010db800000000ull, i * 0x9E3779B97F4A7C15ull), i);
+    }
+    writer.Flush();
+    Report("IPv6 emit ", cAddresses, writer.bytes - cIPv4Bytes, std::chrono::steady_clock::now() - start);
+
+    char name[IPv6Address::REVERSE_NAME_LENGTH + 1];
+    uint64_t checksum{};
+    start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < cAddresses; i++)
+    {
+        IPv4Address address;
+        const size_t cLength = IPv4Address::FromUint32(0x0A000000 + static_cast<uint32_t>(i)).ToReverseName(name, sizeof(name));
+        IPv4Address::FromReverseName(name, cLength, address);
+        checksum += address.ToUint32();
+    }
+    Report("IPv4 round", cAddresses, 0, std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < cAddresses; i++)
+    {
+        IPv6Address address;
+        IPv6Address::FromUint64(0x20010db800000000ull, i * 0x9E3779B97F4A7C15ull).ToReverseName(name, sizeof(name));
+        IPv6Address::FromReverseName(name, IPv6Address::REVERSE_NAME_LENGTH, address);
+        checksum += address.GetLower64();
+    }
+    Report("IPv6 round", cAddresses, 0, std::chrono::steady_clock::now() - start);
+
+    if (sink)
+    {
+        std::fclose(sink);
+    }
+    std::cout << "Checksum: " << checksum << "\n";
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,133 @@
+/**
+ * @file SetOperationsBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressSetOperations throughput against the std::set_* algorithms.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Builds two sorted snapshots of random addresses that share about 90% of their entries, then
+ * times intersection, difference and union with 1 and with all hardware threads against
+ * std::set_intersection, std::set_difference and std::set_union.
+ *
+ * Usage: SET_OPERATIONS_BENCHMARK [number of addresses per snapshot in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressIndex/AddressSetOperations.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    double Seconds(const std::chrono::steady_clock::time_point &cStart)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+    }
+
+    template <typename Address, typename Operation, typename Reference>
+    void Run(const char *cName, const std::vector<Address> &cLeft, const std::vector<Address> &cRight, Operation operation, Reference reference)
+    {
+        std::vector<Address> output(cLeft.size() + cRight.size());
+        const double cInput = static_cast<double>(cLeft.size() + cRight.size());
+        std::cout << "  " << cName << ":";
+        size_t count{};
+        for (const size_t &cThreads : std::vector<size_t>{1, 0})
+        {
+            const auto cStart = std::chrono::steady_clock::now();
+            count = operation(cLeft.data(), cLeft.size(), cRight.data(), cRight.size(), output.data(), cThreads);
+            std::cout << " " << (cThreads ? cThreads : std::max(1u, std::thread::hardware_concurrency())) << " threads " << cInput / Seconds(cStart) / 1e6 << " M/s,";
+        }
+
+        const auto cStart = std::chrono::steady_clock::now();
+        const auto cEnd = reference(cLeft.begin(), cLeft.end(), cRight.begin(), cRight.end(), output.begin());
+        std::cout << " std " << cInput / Seconds(cStart) / 1e6 << " M/s" << (static_cast<size_t>(cEnd - output.begin()) != count ? " MISMATCH" : "") << "\n";
+    }
+
+    template <typename Address>
+    void RunAll(const char *cName, const std::vector<Address> &cLeft, const std::vector<Address> &cRight)
+    {
+        using Iterator = typename std::vector<Address>::const_iterator;
+        using Output = typename std::vector<Address>::iterator;
+        std::cout << cName << " (" << cLeft.size() << " and " << cRight.size() << " addresses)\n";
+        Run("intersection", cLeft, cRight, [](const Address *cA, size_t cACount, const Address *cB, size_t cBCount, Address *output, size_t cThreads) {
+                return AddressSetOperations::Intersection(cA, cACount, cB, cBCount, output, cThreads);
+            }, std::set_intersection<Iterator, Iterator, Output>);
+        Run("difference  ", cLeft, cRight, [](const Address *cA, size_t cACount, const Address *cB, size_t cBCount, Address *output, size_t cThreads) {
+                return AddressSetOperations::Difference(cA, cACount, cB, cBCount, output, cThreads);
+            }, std::set_difference<Iterator, Iterator, Output>);
+        Run("union       ", cLeft, cRight, [](const Address *cA, size_t cACount, const Address *cB, size_t cBCount, Address *output, size_t cThreads) {
+                return AddressSetOperations::Union(cA, cACount, cB, cBCount, output, cThreads);
+            }, std::set_union<Iterator, Iterator, Output>);
+    }
+
+    /**
+     * @brief Splits sorted distinct addresses into two snapshots: 90% shared, 5% only in each.
+     */
+    template <typename Address>
+    void Snapshots(const std::vector<Address> &cAll, std::vector<Address> &left, std::vector<Address> &right)
+    {
+        std::mt19937 random(7);
+        for (const Address &cAddress : cAll)
+        {
+            const uint32_t cDraw = random() % 20;
+            if (cDraw != 0)
+            {
+                left.push_back(cAddress);
+            }
+            if (cDraw != 1)
+            {
+                right.push_back(cAddress);
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50) * 1000000;
+    std::mt19937_64 random(42);
+    {
+        std::vector<IPv4Address> all(cCount);
+        for (IPv4Address &address : all)
+        {
+            address = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        std::sort(all.begin(), all.end());
+        all.erase(std::unique(all.begin(), all.end()), all.end());
+        std::vector<IPv4Address> left;
+        std::vector<IPv4Address> right;
+        Snapshots(all, left, right);
+        all = std::vector<IPv4Address>();
+        RunAll("IPv4", left, right);
+    }
+
+    std::vector<IPv6Address> all(cCount / 2);
+    for (IPv6Address &address : all)
+    {
+        address = IPv6Address::FromUint64(0x20010DB800000000ull | random() >> 32, random());
+    }
+    std::sort(all.begin(), all.end());
+    all.erase(std::unique(all.begin(), all.end()), all.end());
+    std::vector<IPv6Address> left;
+    std::vector<IPv6Address> right;
+    Snapshots(all, left, right);
+    all = std::vector<IPv6Address>();
+    RunAll("IPv6", left, right);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,133 @@
+/**
+ * @file SocketAddressBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief sockaddr conversion throughput against the text round trip.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Converts random socket addresses to the library types and back: directly through
+ * SocketAddress, and through text the way callers without it do (inet_ntop() and the string
+ * constructor, then ToString() and inet_pton()).
+ *
+ * Usage: SOCKET_ADDRESS_BENCHMARK [number of addresses in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "SocketAddress/SocketAddress.hpp"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cCount, const uint64_t &cChecksum, const std::chrono::steady_clock::time_point &cStart)
+    {
+        const double cSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+        std::cout << cName << cCount / cSeconds / 1e6 << " M addresses/s (checksum " << cChecksum << ")\n";
+    }
+
+    void RunIPv4(const std::vector<sockaddr_in> &cAddresses)
+    {
+        std::cout << "IPv4 (" << cAddresses.size() << " addresses)\n";
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t checksum{};
+        for (const sockaddr_in &cAddress : cAddresses)
+        {
+            const sockaddr_in cResult = SocketAddress(cAddress).ToSockaddrIn();
+            checksum += cResult.sin_addr.s_addr + cResult.sin_port;
+        }
+        Report("  SocketAddress:       ", cAddresses.size(), checksum, start);
+
+        start = std::chrono::steady_clock::now();
+        checksum = 0;
+        char text[INET_ADDRSTRLEN];
+        for (const sockaddr_in &cAddress : cAddresses)
+        {
+            inet_ntop(AF_INET, &cAddress.sin_addr, text, sizeof(text));
+            const IPv4Address cParsed{std::string(text)};
+            sockaddr_in result{};
+            result.sin_family = AF_INET;
+            result.sin_port = cAddress.sin_port;
+            inet_pton(AF_INET, cParsed.ToString().c_str(), &result.sin_addr);
+            checksum += result.sin_addr.s_addr + result.sin_port;
+        }
+        Report("  inet_ntop/inet_pton: ", cAddresses.size(), checksum, start);
+    }
+
+    void RunIPv6(const std::vector<sockaddr_in6> &cAddresses)
+    {
+        std::cout << "IPv6 (" << cAddresses.size() << " addresses)\n";
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t checksum{};
+        for (const sockaddr_in6 &cAddress : cAddresses)
+        {
+            const sockaddr_in6 cResult = SocketAddress(cAddress).ToSockaddrIn6();
+            checksum += cResult.sin6_addr.s6_addr[15] + cResult.sin6_port + cResult.sin6_scope_id;
+        }
+        Report("  SocketAddress:       ", cAddresses.size(), checksum, start);
+
+        start = std::chrono::steady_clock::now();
+        checksum = 0;
+        char text[INET6_ADDRSTRLEN];
+        for (const sockaddr_in6 &cAddress : cAddresses)
+        {
+            inet_ntop(AF_INET6, &cAddress.sin6_addr, text, sizeof(text));
+            const IPv6Address cParsed{std::string(text)};
+            sockaddr_in6 result{};
+            result.sin6_family = AF_INET6;
+            result.sin6_port = cAddress.sin6_port;
+            result.sin6_scope_id = cAddress.sin6_scope_id;
+            inet_pton(AF_INET6, cParsed.ToString().c_str(), &result.sin6_addr);
+            checksum += result.sin6_addr.s6_addr[15] + result.sin6_port + result.sin6_scope_id;
+        }
+        Report("  inet_ntop/inet_pton: ", cAddresses.size(), checksum, start);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1) * 1000000;
+    std::mt19937_64 random(42);
+    {
+        std::vector<sockaddr_in> addresses(cCount);
+        for (sockaddr_in &address : addresses)
+        {
+            address.sin_family = AF_INET;
+            address.sin_port = static_cast<uint16_t>(random());
+            address.sin_addr.s_addr = static_cast<uint32_t>(random());
+        }
+        RunIPv4(addresses);
+    }
+
+    std::vector<sockaddr_in6> addresses(cCount);
+    for (sockaddr_in6 &address : addresses)
+    {
+        const uint64_t cHalves[2]{random(), random()};
+        address.sin6_family = AF_INET6;
+        address.sin6_port = static_cast<uint16_t>(random());
+        std::memcpy(&address.sin6_addr, cHalves, sizeof(cHalves));
+    }
+    RunIPv6(addresses);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
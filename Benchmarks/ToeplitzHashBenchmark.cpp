@@ -0,0 +1,157 @@
+/**
+ * @file ToeplitzHashBenchmark.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Toeplitz hash throughput of the table lookup against the bit-by-bit definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Hashes random IPv4 and IPv6 4-tuples one by one, in batches, and with the bit-by-bit loop of
+ * the RSS specification, and prints hashes per second.
+ *
+ * Usage: TOEPLITZ_HASH_BENCHMARK [number of tuples in millions]
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "FlowHash/ToeplitzHash.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Prints the throughput of one benchmark phase.
+     */
+    void Report(const char *cName, const size_t &cCount, const uint64_t &cChecksum, const std::chrono::steady_clock::time_point &cStart)
+    {
+        const double cSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+        std::cout << cName << cCount / cSeconds / 1e6 << " M hashes/s (checksum " << cChecksum << ")\n";
+    }
+
+    /**
+     * @brief Bit-by-bit Toeplitz hash as written in the RSS specification.
+     */
+    uint32_t ReferenceHash(const ToeplitzHash::Key &cKey, const uint8_t *cData, const size_t &cLength)
+    {
+        uint32_t hash{};
+        uint32_t window = static_cast<uint32_t>(cKey[0]) << 24 | cKey[1] << 16 | cKey[2] << 8 | cKey[3];
+        for (size_t i = 0; i < cLength; i++)
+        {
+            for (int bit = 7; bit >= 0; bit--)
+            {
+                if (cData[i] >> bit & 1)
+                {
+                    hash ^= window;
+                }
+                window = window << 1 | (cKey[i + 4] >> bit & 1);
+            }
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Writes a word to the input, most significant byte first.
+     */
+    uint8_t *Put(const uint64_t &cValue, const size_t &cBytes, uint8_t *data)
+    {
+        for (size_t i = 0; i < cBytes; i++)
+        {
+            data[i] = static_cast<uint8_t>(cValue >> (8 * (cBytes - 1 - i)));
+        }
+        return data + cBytes;
+    }
+
+    template <typename Address>
+    void Run(const char *cName, const std::vector<Address> &cSources, const std::vector<Address> &cDestinations, const std::vector<uint16_t> &cSourcePorts, const std::vector<uint16_t> &cDestinationPorts)
+    {
+        const size_t cCount = cSources.size();
+        std::cout << cName << " 4-tuples (" << cCount << ")\n";
+        const ToeplitzHash cHash;
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t checksum{};
+        for (size_t i = 0; i < cCount; i++)
+        {
+            checksum += cHash.Hash(cSources[i], cDestinations[i], cSourcePorts[i], cDestinationPorts[i]);
+        }
+        Report("  Hash():          ", cCount, checksum, start);
+
+        std::vector<uint32_t> hashes(cCount);
+        start = std::chrono::steady_clock::now();
+        cHash.HashBatch(cSources.data(), cDestinations.data(), cSourcePorts.data(), cDestinationPorts.data(), cCount, hashes.data());
+        checksum = 0;
+        for (const uint32_t &cValue : hashes)
+        {
+            checksum += cValue;
+        }
+        Report("  HashBatch():     ", cCount, checksum, start);
+
+        start = std::chrono::steady_clock::now();
+        checksum = 0;
+        uint8_t data[ToeplitzHash::MAX_INPUT_LENGTH];
+        for (size_t i = 0; i < cCount; i++)
+        {
+            uint8_t *end = data;
+            if constexpr (std::is_same<Address, IPv4Address>::value)
+            {
+                end = Put(cSources[i].ToUint32(), 4, end);
+                end = Put(cDestinations[i].ToUint32(), 4, end);
+            }
+            else
+            {
+                end = Put(cSources[i].GetUpper64(), 8, end);
+                end = Put(cSources[i].GetLower64(), 8, end);
+                end = Put(cDestinations[i].GetUpper64(), 8, end);
+                end = Put(cDestinations[i].GetLower64(), 8, end);
+            }
+            end = Put(cSourcePorts[i], 2, end);
+            end = Put(cDestinationPorts[i], 2, end);
+            checksum += ReferenceHash(ToeplitzHash::DEFAULT_KEY, data, static_cast<size_t>(end - data));
+        }
+        Report("  bit-by-bit:      ", cCount, checksum, start);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t cCount = static_cast<size_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4) * 1000000;
+    std::mt19937_64 random(42);
+    std::vector<uint16_t> sourcePorts(cCount), destinationPorts(cCount);
+    for (size_t i = 0; i < cCount; i++)
+    {
+        sourcePorts[i] = static_cast<uint16_t>(random());
+        destinationPorts[i] = static_cast<uint16_t>(random());
+    }
+    {
+        std::vector<IPv4Address> sources(cCount), destinations(cCount);
+        for (size_t i = 0; i < cCount; i++)
+        {
+            sources[i] = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+            destinations[i] = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        }
+        Run("IPv4", sources, destinations, sourcePorts, destinationPorts);
+    }
+
+    std::vector<IPv6Address> sources(cCount), destinations(cCount);
+    for (size_t i = 0; i < cCount; i++)
+    {
+        sources[i] = IPv6Address::FromUint64(random(), random());
+        destinations[i] = IPv6Address::FromUint64(random(), random());
+    }
+    Run("IPv6", sources, destinations, sourcePorts, destinationPorts);
+    return 0;
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,639 @@
+/**
+ * @file AddressTextWriter.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressTextWriter class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressTextWriter.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define ADDRESS_TEXT_WRITER_SSSE3
+#define ADDRESS_TEXT_WRITER_TARGET __attribute__((target("ssse3")))
+// Flattening inlines the default-target WriteRecords() and, inside it, the SSSE3 text writer.
+#define ADDRESS_TEXT_WRITER_BATCH_TARGET __attribute__((target("ssse3"), flatten))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <tmmintrin.h>
+#define ADDRESS_TEXT_WRITER_SSSE3
+#define ADDRESS_TEXT_WRITER_TARGET
+#define ADDRESS_TEXT_WRITER_BATCH_TARGET
+#endif
+
+namespace EthernetParameter
+{
+    // The kernels read the address arrays as raw memory.
+    static_assert(sizeof(IPv4Address) == 4, "IPv4Address arrays must be packed");
+    static_assert(sizeof(IPv6Address) == 16, "IPv6Address arrays must be packed");
+
+    namespace
+    {
+        using Format = AddressTextWriter::Format;
+
+        /**
+         * @brief Maximum text length of an IPv4 address ("255.255.255.255").
+         */
+        constexpr size_t IPV4_MAX_LENGTH = 15;
+
+        /**
+         * @brief Text length of an IPv6 address (eight groups of four digits).
+         */
+        constexpr size_t IPV6_LENGTH = 39;
+
+        /**
+         * @brief Room the kernels may write past the text of the last address (one 16-byte store).
+         */
+        constexpr size_t STORE_SLACK = 16;
+
+        /**
+         * @brief Decimal text of an octet followed by a dot, padded to four bytes so it is one store.
+         */
+        struct DecimalOctet
+        {
+            char text[4];
+            uint8_t length;
+        };
+
+        /**
+         * @brief Builds the lookup table of decimal octet texts.
+         * @return The table indexed by octet value.
+         */
+        constexpr std::array<DecimalOctet, 256> MakeDecimalOctets()
+        {
+            std::array<DecimalOctet, 256> table{};
+            for (uint16_t value = 0; value < 256; value++)
+            {
+                DecimalOctet &entry = table[value];
+                if (value >= 100)
+                {
+                    entry = DecimalOctet{{static_cast<char>('0' + value / 100), static_cast<char>('0' + value / 10 % 10), static_cast<char>('0' + value % 10), '.'}, 4};
+                }
+                else if (value >= 10)
+                {
+                    entry = DecimalOctet{{static_cast<char>('0' + value / 10), static_cast<char>('0' + value % 10), '.', 0}, 3};
+                }
+                else
+                {
+                    entry = DecimalOctet{{static_cast<char>('0' + value), '.', 0, 0}, 2};
+                }
+            }
+            return table;
+        }
+
+        /**
+         * @brief Decimal texts of all octet values.
+         */
+        constexpr std::array<DecimalOctet, 256> DECIMAL_OCTETS = MakeDecimalOctets();
+
+        /**
+         * @brief Lowercase hex digits.
+         */
+        constexpr char HEX_DIGITS[]{"0123456789abcdef"};
+
+        /**
+         * @brief IPv4 text through the lookup table, one address per block.
+         *
+         * Every text type reads BLOCK addresses in its constructor and writes the text of one of
+         * them with Write(), which returns the end of the text and may store up to STORE_SLACK
+         * bytes past it.
+         */
+        struct IPv4Portable
+        {
+            static constexpr size_t BLOCK = 1;
+
+            explicit IPv4Portable(const IPv4Address *cAddresses) { std::memcpy(_octets, cAddresses, sizeof(_octets)); }
+
+            char *Write(const size_t &, char *output) const
+            {
+                for (uint8_t i = 0; i < 4; i++)
+                {
+                    const DecimalOctet &cOctet = DECIMAL_OCTETS[_octets[i]];
+                    std::memcpy(output, cOctet.text, sizeof(cOctet.text));
+                    output += cOctet.length;
+                }
+                // Drop the dot after the last octet.
+                return output - 1;
+            }
+
+            uint8_t _octets[4];
+        };
+
+        /**
+         * @brief IPv6 text one hex digit at a time, one address per block.
+         */
+        struct IPv6Portable
+        {
+            static constexpr size_t BLOCK = 1;
+
+            explicit IPv6Portable(const IPv6Address *cAddresses) { std::memcpy(_groups, cAddresses, sizeof(_groups)); }
+
+            char *Write(const size_t &, char *output) const
+            {
+                for (uint8_t i = 0; i < 8; i++)
+                {
+                    output[0] = HEX_DIGITS[_groups[i] >> 12];
+                    output[1] = HEX_DIGITS[_groups[i] >> 8 & 0xF];
+                    output[2] = HEX_DIGITS[_groups[i] >> 4 & 0xF];
+                    output[3] = HEX_DIGITS[_groups[i] & 0xF];
+                    output[4] = ':';
+                    output += 5;
+                }
+                return output - 1;
+            }
+
+            uint16_t _groups[8];
+        };
+
+        /**
+         * @brief Layout of one address in the text.
+         *
+         * Every character is stored unconditionally and kept or not, so no format branch is left in the loop.
+         */
+        struct Layout
+        {
+            explicit Layout(const Format &cFormat, const bool &cStarted)
+                : separated{cFormat != Format::Lines}, quoted{cFormat == Format::Json}, started{cStarted},
+                  suffix{quoted ? '"' : '\n'}, suffixed{quoted || !separated} {}
+
+            bool separated;
+            bool quoted;
+            bool started;
+            char suffix;
+            bool suffixed;
+        };
+
+        /**
+         * @brief Writes one address of a block with its separator, quotes and line break.
+         * @tparam Text The address text type, IPv4Portable or the like.
+         * @param cText The block.
+         * @param cIndex The index of the address in the block.
+         * @param cRow The index of the address in the batch.
+         * @param cLayout The layout.
+         * @param output The end of the text.
+         * @return The new end of the text.
+         */
+        template <typename Text>
+        inline char *WriteRecord(const Text &cText, const size_t &cIndex, const size_t &cRow, const Layout &cLayout, char *output)
+        {
+            *output = ',';
+            output += cLayout.separated && (cLayout.started || cRow);
+            *output = '"';
+            output += cLayout.quoted;
+            output = cText.Write(cIndex, output);
+            *output = cLayout.suffix;
+            return output + cLayout.suffixed;
+        }
+
+        /**
+         * @brief Writes addresses in a layout, continuing a text that may already hold addresses.
+         * @tparam Text The address text type, IPv4Portable or the like.
+         * @tparam Address IPv4Address or IPv6Address.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @param cFormat The layout.
+         * @param cStarted `true` if an address precedes them, so the first one needs a separator.
+         * @param output The end of the text, with room for every address plus STORE_SLACK.
+         * @return The new end of the text.
+         */
+        template <typename Text, typename Address>
+        inline char *WriteRecords(const Address *cAddresses, const size_t &cCount, const Format &cFormat, const bool &cStarted, char *output)
+        {
+            const Layout cLayout(cFormat, cStarted);
+            size_t row{};
+            for (; row + Text::BLOCK <= cCount; row += Text::BLOCK)
+            {
+                const Text cText(cAddresses + row);
+                for (size_t i = 0; i < Text::BLOCK; i++)
+                {
+                    output = WriteRecord(cText, i, row + i, cLayout, output);
+                }
+            }
+            if (row < cCount)
+            {
+                // The last, short block is read from a padded copy.
+                Address padded[Text::BLOCK]{};
+                std::copy(cAddresses + row, cAddresses + cCount, padded);
+                const Text cText(padded);
+                for (size_t i = 0; row + i < cCount; i++)
+                {
+                    output = WriteRecord(cText, i, row + i, cLayout, output);
+                }
+            }
+            return output;
+        }
+
+#if defined(ADDRESS_TEXT_WRITER_SSSE3)
+        /**
+         * @brief Shuffle that packs the digits of four octets with their dots, for one combination of octet lengths.
+         */
+        struct OctetShuffle
+        {
+            alignas(16) uint8_t indices[16];
+            uint8_t length;
+        };
+
+        /**
+         * @brief Builds the shuffles for all 81 combinations of octet lengths.
+         *
+         * Entry l0 - 1 + 3 (l1 - 1) + 9 (l2 - 1) + 27 (l3 - 1) serves octets of lengths l0 to l3.
+         * The source vector holds the hundreds of the four octets in bytes 0-3, the tens in 4-7,
+         * the ones in 8-11 and a dot in byte 12.
+         *
+         * @return The table.
+         */
+        constexpr std::array<OctetShuffle, 81> MakeOctetShuffles()
+        {
+            std::array<OctetShuffle, 81> table{};
+            for (uint8_t entry = 0; entry < 81; entry++)
+            {
+                OctetShuffle &shuffle = table[entry];
+                uint8_t position{};
+                uint8_t combination = entry;
+                for (uint8_t octet = 0; octet < 4; octet++, combination /= 3)
+                {
+                    const uint8_t cLength = static_cast<uint8_t>(combination % 3 + 1);
+                    for (uint8_t digit = static_cast<uint8_t>(3 - cLength); digit < 3; digit++)
+                    {
+                        shuffle.indices[position++] = static_cast<uint8_t>(4 * digit + octet);
+                    }
+                    if (octet < 3)
+                    {
+                        shuffle.indices[position++] = 12;
+                    }
+                }
+                shuffle.length = position;
+                for (; position < 16; position++)
+                {
+                    shuffle.indices[position] = 0x80;
+                }
+            }
+            return table;
+        }
+
+        /**
+         * @brief The octet shuffles.
+         */
+        alignas(64) constexpr std::array<OctetShuffle, 81> OCTET_SHUFFLES = MakeOctetShuffles();
+
+        /**
+         * @brief Splits 16-bit lanes below 256 into decimal digits.
+         *
+         * Division by multiplication: x * 41 >> 12 == x / 100 for x < 256 and x * 103 >> 10 == x / 10
+         * for x < 100, all within 16 bits.
+         */
+        ADDRESS_TEXT_WRITER_TARGET inline void DecimalDigits(const __m128i &cValues, __m128i &hundreds, __m128i &tens, __m128i &ones)
+        {
+            hundreds = _mm_srli_epi16(_mm_mullo_epi16(cValues, _mm_set1_epi16(41)), 12);
+            const __m128i cRest = _mm_sub_epi16(cValues, _mm_mullo_epi16(hundreds, _mm_set1_epi16(100)));
+            tens = _mm_srli_epi16(_mm_mullo_epi16(cRest, _mm_set1_epi16(103)), 10);
+            ones = _mm_sub_epi16(cRest, _mm_mullo_epi16(tens, _mm_set1_epi16(10)));
+        }
+
+        /**
+         * @brief IPv4 text with SSSE3, four addresses per block.
+         *
+         * The digits of all 16 octets are computed at once and regrouped into one vector per
+         * address; each address then takes one shuffle and one store.
+         */
+        struct IPv4Ssse3
+        {
+            static constexpr size_t BLOCK = 4;
+
+            ADDRESS_TEXT_WRITER_TARGET explicit IPv4Ssse3(const IPv4Address *cAddresses)
+            {
+                const __m128i cZero = _mm_setzero_si128();
+                const __m128i cOctets = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cAddresses));
+                __m128i hundreds[2];
+                __m128i tens[2];
+                __m128i ones[2];
+                DecimalDigits(_mm_unpacklo_epi8(cOctets, cZero), hundreds[0], tens[0], ones[0]);
+                DecimalDigits(_mm_unpackhi_epi8(cOctets, cZero), hundreds[1], tens[1], ones[1]);
+                const __m128i cCharacterZero = _mm_set1_epi8('0');
+                const __m128i cHundreds = _mm_add_epi8(_mm_packus_epi16(hundreds[0], hundreds[1]), cCharacterZero);
+                const __m128i cTens = _mm_add_epi8(_mm_packus_epi16(tens[0], tens[1]), cCharacterZero);
+                const __m128i cOnes = _mm_add_epi8(_mm_packus_epi16(ones[0], ones[1]), cCharacterZero);
+
+                // Address i needs its hundreds, tens and ones in bytes 0-3, 4-7 and 8-11, then a dot.
+                const __m128i cDots = _mm_set1_epi8('.');
+                const __m128i cHundredsTensLow = _mm_unpacklo_epi32(cHundreds, cTens);
+                const __m128i cHundredsTensHigh = _mm_unpackhi_epi32(cHundreds, cTens);
+                const __m128i cOnesDotsLow = _mm_unpacklo_epi32(cOnes, cDots);
+                const __m128i cOnesDotsHigh = _mm_unpackhi_epi32(cOnes, cDots);
+                _digits[0] = _mm_unpacklo_epi64(cHundredsTensLow, cOnesDotsLow);
+                _digits[1] = _mm_unpackhi_epi64(cHundredsTensLow, cOnesDotsLow);
+                _digits[2] = _mm_unpacklo_epi64(cHundredsTensHigh, cOnesDotsHigh);
+                _digits[3] = _mm_unpackhi_epi64(cHundredsTensHigh, cOnesDotsHigh);
+
+                // Extra digits per octet: 2 minus one for x <= 9 and one for x <= 99. Weighted by 1, 3, 9
+                // and 27 they give the shuffle entry of each address.
+                const __m128i cUpTo9 = _mm_cmpeq_epi8(_mm_subs_epu8(cOctets, _mm_set1_epi8(9)), cZero);
+                const __m128i cUpTo99 = _mm_cmpeq_epi8(_mm_subs_epu8(cOctets, _mm_set1_epi8(99)), cZero);
+                const __m128i cExtra = _mm_add_epi8(_mm_set1_epi8(2), _mm_add_epi8(cUpTo9, cUpTo99));
+                const __m128i cWeighted = _mm_maddubs_epi16(cExtra, _mm_setr_epi8(1, 3, 9, 27, 1, 3, 9, 27, 1, 3, 9, 27, 1, 3, 9, 27));
+                _mm_store_si128(reinterpret_cast<__m128i *>(_entries), _mm_madd_epi16(cWeighted, _mm_set1_epi16(1)));
+            }
+
+            ADDRESS_TEXT_WRITER_TARGET char *Write(const size_t &cIndex, char *output) const
+            {
+                const OctetShuffle &cShuffle = OCTET_SHUFFLES[static_cast<size_t>(_entries[cIndex])];
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                                 _mm_shuffle_epi8(_digits[cIndex], _mm_load_si128(reinterpret_cast<const __m128i *>(cShuffle.indices))));
+                return output + cShuffle.length;
+            }
+
+            __m128i _digits[4];
+            alignas(16) int32_t _entries[4];
+        };
+
+        /**
+         * @brief IPv6 text with SSSE3, one address per block.
+         */
+        struct IPv6Ssse3
+        {
+            static constexpr size_t BLOCK = 1;
+
+            explicit IPv6Ssse3(const IPv6Address *cAddresses) : _address{cAddresses} {}
+
+            ADDRESS_TEXT_WRITER_TARGET char *Write(const size_t &, char *output) const
+            {
+                // The groups are host-order (little-endian here) 16-bit words: swap them into text order.
+                const __m128i cBytes = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_address)),
+                                                        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+                const __m128i cNibble = _mm_set1_epi8(0x0F);
+                const __m128i cHex = _mm_loadu_si128(reinterpret_cast<const __m128i *>(HEX_DIGITS));
+                const __m128i cHigh = _mm_shuffle_epi8(cHex, _mm_and_si128(_mm_srli_epi16(cBytes, 4), cNibble));
+                const __m128i cLow = _mm_shuffle_epi8(cHex, _mm_and_si128(cBytes, cNibble));
+                const __m128i cFirst = _mm_unpacklo_epi8(cHigh, cLow);
+                const __m128i cSecond = _mm_unpackhi_epi8(cHigh, cLow);
+
+                // Spread the 32 digits over the 39 characters and fill the gaps with colons.
+                const int8_t cGap = static_cast<int8_t>(0x80);
+                const __m128i cPart0 = _mm_shuffle_epi8(cFirst, _mm_setr_epi8(0, 1, 2, 3, cGap, 4, 5, 6, 7, cGap, 8, 9, 10, 11, cGap, 12));
+                const __m128i cPart1 = _mm_shuffle_epi8(_mm_alignr_epi8(cSecond, cFirst, 13),
+                                                        _mm_setr_epi8(0, 1, 2, cGap, 3, 4, 5, 6, cGap, 7, 8, 9, 10, cGap, 11, 12));
+                const __m128i cPart2 = _mm_shuffle_epi8(cSecond, _mm_setr_epi8(10, 11, cGap, 12, 13, 14, 15, cGap, cGap, cGap, cGap, cGap, cGap, cGap, cGap, cGap));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_or_si128(cPart0, _mm_setr_epi8(0, 0, 0, 0, ':', 0, 0, 0, 0, ':', 0, 0, 0, 0, ':', 0)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16), _mm_or_si128(cPart1, _mm_setr_epi8(0, 0, 0, ':', 0, 0, 0, 0, ':', 0, 0, 0, 0, ':', 0, 0)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 32), _mm_or_si128(cPart2, _mm_setr_epi8(0, 0, ':', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)));
+                return output + IPV6_LENGTH;
+            }
+
+            const IPv6Address *_address;
+        };
+
+        /**
+         * @brief WriteRecords() with the SSSE3 IPv4 text, all compiled for SSSE3.
+         */
+        ADDRESS_TEXT_WRITER_BATCH_TARGET char *WriteIPv4Ssse3(const IPv4Address *cAddresses, const size_t &cCount, const Format &cFormat, const bool &cStarted, char *output)
+        {
+            return WriteRecords<IPv4Ssse3>(cAddresses, cCount, cFormat, cStarted, output);
+        }
+
+        /**
+         * @brief WriteRecords() with the SSSE3 IPv6 text, all compiled for SSSE3.
+         */
+        ADDRESS_TEXT_WRITER_BATCH_TARGET char *WriteIPv6Ssse3(const IPv6Address *cAddresses, const size_t &cCount, const Format &cFormat, const bool &cStarted, char *output)
+        {
+            return WriteRecords<IPv6Ssse3>(cAddresses, cCount, cFormat, cStarted, output);
+        }
+#endif
+
+        /**
+         * @brief WriteRecords() with the lookup-table IPv4 text.
+         */
+        char *WriteIPv4Portable(const IPv4Address *cAddresses, const size_t &cCount, const Format &cFormat, const bool &cStarted, char *output)
+        {
+            return WriteRecords<IPv4Portable>(cAddresses, cCount, cFormat, cStarted, output);
+        }
+
+        /**
+         * @brief WriteRecords() with the portable IPv6 text.
+         */
+        char *WriteIPv6Portable(const IPv6Address *cAddresses, const size_t &cCount, const Format &cFormat, const bool &cStarted, char *output)
+        {
+            return WriteRecords<IPv6Portable>(cAddresses, cCount, cFormat, cStarted, output);
+        }
+
+        /**
+         * @brief The signature shared by the batch kernels.
+         */
+        template <typename Address>
+        using RecordsFunction = char *(*)(const Address *, const size_t &, const Format &, const bool &, char *);
+
+        /**
+         * @brief Returns the batch kernel for the tier chosen by CpuFeatures.
+         *
+         * The SSSE3 kernels serve SSE4.2 and above; the SSE2 tier has no byte shuffle.
+         */
+        template <typename Address>
+        RecordsFunction<Address> RecordsKernel(const CpuFeatures::Tier &cTier, const RecordsFunction<Address> &cPortable, const RecordsFunction<Address> &cSsse3)
+        {
+            return cTier >= CpuFeatures::Tier::SSE4_2 ? cSsse3 : cPortable;
+        }
+    }
+
+    /**
+     * @brief Constructor for a writer that keeps the whole text in its buffer.
+     * @param cFormat The layout of the text.
+     */
+    AddressTextWriter::AddressTextWriter(const Format &cFormat) : _format{cFormat}
+    {
+    } /* AddressTextWriter::AddressTextWriter(const Format &cFormat) */
+
+    /**
+     * @brief Constructor for a writer that writes the text to a stream in chunks.
+     * @param output The stream to write to. Must outlive the writer.
+     * @param cFormat The layout of the text.
+     * @param cChunkSize The buffer size at which the text is written to the stream.
+     * @throw std::invalid_argument If the chunk size is zero.
+     */
+    AddressTextWriter::AddressTextWriter(std::ostream &output, const Format &cFormat, const size_t &cChunkSize)
+        : _output{&output}, _format{cFormat}, _chunkSize{cChunkSize}
+    {
+        if (!cChunkSize)
+        {
+            throw std::invalid_argument(INVALID_CHUNK_SIZE);
+        }
+    } /* AddressTextWriter::AddressTextWriter(std::ostream &output, const Format &cFormat, const size_t &cChunkSize) */
+
+    /**
+     * @brief Appends the text of IPv4 addresses.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @throw std::invalid_argument If the writer is closed, or the pointer is null while cCount is not zero.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void AddressTextWriter::Write(const IPv4Address *cAddresses, const size_t &cCount)
+    {
+#if defined(ADDRESS_TEXT_WRITER_SSSE3)
+        static const RecordsFunction<IPv4Address> cKernel = RecordsKernel<IPv4Address>(CpuFeatures::Selected(), WriteIPv4Portable, WriteIPv4Ssse3);
+#else
+        static const RecordsFunction<IPv4Address> cKernel = WriteIPv4Portable;
+#endif
+        Append(cAddresses, cCount, IPV4_MAX_LENGTH, cKernel);
+    } /* void AddressTextWriter::Write(const IPv4Address *cAddresses, const size_t &cCount) */
+
+    /**
+     * @brief Appends the text of IPv6 addresses.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @throw std::invalid_argument If the writer is closed, or the pointer is null while cCount is not zero.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void AddressTextWriter::Write(const IPv6Address *cAddresses, const size_t &cCount)
+    {
+#if defined(ADDRESS_TEXT_WRITER_SSSE3)
+        static const RecordsFunction<IPv6Address> cKernel = RecordsKernel<IPv6Address>(CpuFeatures::Selected(), WriteIPv6Portable, WriteIPv6Ssse3);
+#else
+        static const RecordsFunction<IPv6Address> cKernel = WriteIPv6Portable;
+#endif
+        Append(cAddresses, cCount, IPV6_LENGTH, cKernel);
+    } /* void AddressTextWriter::Write(const IPv6Address *cAddresses, const size_t &cCount) */
+
+    /**
+     * @brief Completes the text (the closing bracket of a JSON array) and writes the buffer to the stream, if any.
+     *
+     * Further calls do nothing.
+     *
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void AddressTextWriter::Close()
+    {
+        if (_closed)
+        {
+            return;
+        }
+        if (_format == Format::Json)
+        {
+            if (!_started)
+            {
+                Put('[');
+            }
+            Put(']');
+        }
+        _closed = true;
+        if (_output)
+        {
+            Flush();
+        }
+    } /* void AddressTextWriter::Close() */
+
+    /**
+     * @brief Empties the buffer and starts a new text.
+     */
+    void AddressTextWriter::Clear()
+    {
+        _size = 0;
+        _started = false;
+        _closed = false;
+    } /* void AddressTextWriter::Clear() */
+
+    // Private Methods.
+
+    /**
+     * @brief Appends addresses through a batch kernel, one chunk at a time.
+     * @tparam Address IPv4Address or IPv6Address.
+     * @tparam Kernel The batch kernel type.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @param cMaxLength The maximum text length of one address.
+     * @param cKernel The kernel.
+     * @throw std::invalid_argument If the writer is closed, or the pointer is null while cCount is not zero.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    template <typename Address, typename Kernel>
+    void AddressTextWriter::Append(const Address *cAddresses, const size_t &cCount, const size_t &cMaxLength, const Kernel &cKernel)
+    {
+        if (_closed)
+        {
+            throw std::invalid_argument(WRITER_CLOSED);
+        }
+        if (!cAddresses && cCount)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (!cCount)
+        {
+            return;
+        }
+        if (_format == Format::Json && !_started)
+        {
+            Put('[');
+        }
+
+        // Separator, two quotes and the address; a stream gets chunks of about _chunkSize bytes.
+        const size_t cRecordLength = cMaxLength + 3;
+        const size_t cBatch = _output ? std::max<size_t>(1, _chunkSize / cRecordLength) : cCount;
+        for (size_t done = 0; done < cCount;)
+        {
+            const size_t cPart = std::min(cBatch, cCount - done);
+            char *begin = Reserve(cPart * cRecordLength + STORE_SLACK);
+            _size += static_cast<size_t>(cKernel(cAddresses + done, cPart, _format, _started, begin) - begin);
+            _started = true;
+            done += cPart;
+            if (_output && _size >= _chunkSize)
+            {
+                Flush();
+            }
+        }
+    } /* void AddressTextWriter::Append(const Address *cAddresses, const size_t &cCount, const size_t &cMaxLength, const Kernel &cKernel) */
+
+    /**
+     * @brief Makes room for more text.
+     * @param cBytes The number of bytes to append.
+     * @return The end of the buffered text.
+     */
+    char *AddressTextWriter::Reserve(const size_t &cBytes)
+    {
+        if (_capacity - _size < cBytes)
+        {
+            const size_t cCapacity = std::max(_size + cBytes, 2 * _capacity);
+            std::unique_ptr<char[]> buffer(new char[cCapacity]);
+            if (_size)
+            {
+                std::memcpy(buffer.get(), _buffer.get(), _size);
+            }
+            _buffer = std::move(buffer);
+            _capacity = cCapacity;
+        }
+        return _buffer.get() + _size;
+    } /* char *AddressTextWriter::Reserve(const size_t &cBytes) */
+
+    /**
+     * @brief Appends one character.
+     * @param cCharacter The character.
+     */
+    void AddressTextWriter::Put(const char &cCharacter)
+    {
+        *Reserve(1) = cCharacter;
+        _size++;
+    } /* void AddressTextWriter::Put(const char &cCharacter) */
+
+    /**
+     * @brief Writes the buffer to the stream and empties it.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void AddressTextWriter::Flush()
+    {
+        _output->write(_buffer.get(), static_cast<std::streamsize>(_size));
+        if (!*_output)
+        {
+            throw std::runtime_error(WRITE_FAILED);
+        }
+        _size = 0;
+    } /* void AddressTextWriter::Flush() */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,213 @@
+/**
+ * @file AddressTextWriter.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief AddressTextWriter (bulk formatting of address arrays into delimited text) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ADDRESSTEXTWRITER_H
+#define ADDRESSTEXTWRITER_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+namespace EthernetParameter
+{
+    /**
+     * @class AddressTextWriter
+     * @brief Formats address arrays into one growable text buffer, without a string per address.
+     *
+     * Addresses are written as ToString() writes them (IPv6 as eight groups of four lowercase hex
+     * digits). Without a stream the buffer holds the whole text until Clear(); with a stream the
+     * buffer is written out whenever it reaches the chunk size, so memory stays bounded however
+     * many addresses pass through, and Close() writes the rest.
+     *
+     * IPv4 digits are converted with SSSE3 when CpuFeatures selects SSE4.2 or better: the digits
+     * of four addresses are computed in one vector, and per address a shuffle picked by the octet
+     * lengths packs them with the dots. IPv6 groups are converted to hex by shuffles as well.
+     * Otherwise lookup tables are used.
+     */
+    class AddressTextWriter
+    {
+    public:
+        /**
+         * @brief Layout of the text.
+         */
+        enum class Format : uint8_t
+        {
+            Lines, /**< One address per line, each followed by '\n'. */
+            Comma, /**< Addresses separated by ','. */
+            Json   /**< A JSON array of strings, closed by Close(). */
+        };
+
+        /**
+         * @brief Default buffer size at which the text is written to the stream.
+         */
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 1 << 16;
+
+        /**
+         * @brief Constructor for a writer that keeps the whole text in its buffer.
+         * @param cFormat The layout of the text.
+         */
+        explicit AddressTextWriter(const Format &cFormat = Format::Lines);
+
+        /**
+         * @brief Constructor for a writer that writes the text to a stream in chunks.
+         * @param output The stream to write to. Must outlive the writer.
+         * @param cFormat The layout of the text.
+         * @param cChunkSize The buffer size at which the text is written to the stream.
+         * @throws std::invalid_argument If the chunk size is zero.
+         */
+        AddressTextWriter(std::ostream &output, const Format &cFormat = Format::Lines, const size_t &cChunkSize = DEFAULT_CHUNK_SIZE);
+
+        /**
+         * @brief Appends the text of IPv4 addresses.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @throws std::invalid_argument If the writer is closed, or the pointer is null while cCount is not zero.
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void Write(const IPv4Address *cAddresses, const size_t &cCount);
+
+        /**
+         * @brief Appends the text of IPv6 addresses.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @throws std::invalid_argument If the writer is closed, or the pointer is null while cCount is not zero.
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void Write(const IPv6Address *cAddresses, const size_t &cCount);
+
+        /**
+         * @brief Completes the text (the closing bracket of a JSON array) and writes the buffer to the stream, if any.
+         *
+         * Further calls do nothing.
+         *
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void Close();
+
+        /**
+         * @brief Returns the buffered text, not yet written to the stream.
+         * @return The text, not null-terminated; nullptr before anything was written.
+         */
+        const char *Data() const { return _buffer.get(); }
+
+        /**
+         * @brief Returns the length of the buffered text.
+         * @return The length in bytes.
+         */
+        size_t Size() const { return _size; }
+
+        /**
+         * @brief Empties the buffer and starts a new text.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief The stream, nullptr to keep the text in the buffer.
+         */
+        std::ostream *_output{};
+
+        /**
+         * @brief The layout of the text.
+         */
+        Format _format{};
+
+        /**
+         * @brief The buffer size at which the text is written to the stream.
+         */
+        size_t _chunkSize{};
+
+        /**
+         * @brief The text buffer. Grown without zero-filling, unlike std::string::resize().
+         */
+        std::unique_ptr<char[]> _buffer;
+
+        /**
+         * @brief Length of the buffered text.
+         */
+        size_t _size{};
+
+        /**
+         * @brief Size of the text buffer.
+         */
+        size_t _capacity{};
+
+        /**
+         * @brief `true` once an address was written, so the next one needs a separator.
+         */
+        bool _started{};
+
+        /**
+         * @brief `true` after Close().
+         */
+        bool _closed{};
+
+        /**
+         * @brief Appends addresses through a batch kernel, one chunk at a time.
+         * @tparam Address IPv4Address or IPv6Address.
+         * @tparam Kernel The batch kernel type.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @param cMaxLength The maximum text length of one address.
+         * @param cKernel The kernel.
+         */
+        template <typename Address, typename Kernel>
+        void Append(const Address *cAddresses, const size_t &cCount, const size_t &cMaxLength, const Kernel &cKernel);
+
+        /**
+         * @brief Makes room for more text.
+         * @param cBytes The number of bytes to append.
+         * @return The end of the buffered text.
+         */
+        char *Reserve(const size_t &cBytes);
+
+        /**
+         * @brief Appends one character.
+         * @param cCharacter The character.
+         */
+        void Put(const char &cCharacter);
+
+        /**
+         * @brief Writes the buffer to the stream and empties it.
+         */
+        void Flush();
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::AddressTextWriter] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a write after Close().
+         */
+        static constexpr char WRITER_CLOSED[]{"[EthernetParameter::AddressTextWriter] Writer is closed!"};
+
+        /**
+         * @brief Error message indicating a zero chunk size.
+         */
+        static constexpr char INVALID_CHUNK_SIZE[]{"[EthernetParameter::AddressTextWriter] Chunk size must not be zero!"};
+
+        /**
+         * @brief Error message indicating a failed stream write.
+         */
+        static constexpr char WRITE_FAILED[]{"[EthernetParameter::AddressTextWriter] Writing to the stream failed!"};
+    }; /* class AddressTextWriter */
+}
+
+#endif /* ADDRESSTEXTWRITER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
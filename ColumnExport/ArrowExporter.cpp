@@ -0,0 +1,291 @@
+/**
+ * @file ArrowExporter.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ArrowExporter class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ArrowExporter.hpp"
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    // The zero-copy export relies on an IPv4Address array being a plain array of network-order octets.
+    static_assert(sizeof(IPv4Address) == IPv4Address::IP_ADDRESS_OCTETS && std::is_trivially_copyable<IPv4Address>::value,
+                  "IPv4Address must be four octets to be exported without copying");
+
+    namespace
+    {
+        /**
+         * @struct ExportedArray
+         * @brief Private data of an exported array: the owned buffers and the buffer pointer table.
+         */
+        struct ExportedArray
+        {
+            std::vector<uint8_t> values;
+            std::vector<uint8_t> validity;
+            const void *buffers[2]{};
+        };
+
+        /**
+         * @struct ExportedSchema
+         * @brief Private data of an exported schema: the owned strings.
+         */
+        struct ExportedSchema
+        {
+            std::string format;
+            std::string name;
+        };
+
+        /**
+         * @brief Returns the number of set bits of a word.
+         */
+        inline uint32_t PopCount(const uint64_t &cWord)
+        {
+#if defined(_MSC_VER)
+            return static_cast<uint32_t>(__popcnt64(cWord));
+#else
+            return static_cast<uint32_t>(__builtin_popcountll(cWord));
+#endif
+        }
+
+        /**
+         * @brief Stores a value as 8 big-endian bytes.
+         */
+        inline void StoreBigEndian(const uint64_t &cValue, uint8_t *destination)
+        {
+            for (size_t i = 0; i < 8; i++)
+            {
+                destination[i] = static_cast<uint8_t>(cValue >> (56 - 8 * i));
+            }
+        }
+
+        void ReleaseArray(ArrowArray *array)
+        {
+            delete static_cast<ExportedArray *>(array->private_data);
+            array->private_data = nullptr;
+            array->release = nullptr;
+        }
+
+        void ReleaseSchema(ArrowSchema *schema)
+        {
+            delete static_cast<ExportedSchema *>(schema->private_data);
+            schema->private_data = nullptr;
+            schema->release = nullptr;
+        }
+
+        /**
+         * @brief Fills a fixed_size_binary schema.
+         * @param cWidth The value width in bytes.
+         * @param cNullable `true` if the field is nullable.
+         * @param cName The field name.
+         * @param schema The schema to fill.
+         */
+        void FillSchema(const size_t &cWidth, const bool &cNullable, const char *cName, ArrowSchema *schema)
+        {
+            ExportedSchema *const cPrivate = new ExportedSchema{"w:" + std::to_string(cWidth), cName};
+            schema->format = cPrivate->format.c_str();
+            schema->name = cPrivate->name.c_str();
+            schema->metadata = nullptr;
+            schema->flags = cNullable ? ARROW_FLAG_NULLABLE : 0;
+            schema->n_children = 0;
+            schema->children = nullptr;
+            schema->dictionary = nullptr;
+            schema->release = ReleaseSchema;
+            schema->private_data = cPrivate;
+        }
+
+        /**
+         * @brief Fills an array from its private data.
+         * @param cValues The value buffer.
+         * @param cValidity The validity buffer, or nullptr.
+         * @param cCount The number of rows.
+         * @param cNullCount The number of null rows.
+         * @param cPrivate The private data, owned by the array from now on.
+         * @param array The array to fill.
+         */
+        void FillArray(const void *cValues, const void *cValidity, const size_t &cCount, const size_t &cNullCount, ExportedArray *cPrivate, ArrowArray *array)
+        {
+            cPrivate->buffers[0] = cValidity;
+            cPrivate->buffers[1] = cValues;
+            array->length = static_cast<int64_t>(cCount);
+            array->null_count = static_cast<int64_t>(cNullCount);
+            array->offset = 0;
+            array->n_buffers = 2;
+            array->n_children = 0;
+            array->buffers = cPrivate->buffers;
+            array->children = nullptr;
+            array->dictionary = nullptr;
+            array->release = ReleaseArray;
+            array->private_data = cPrivate;
+        }
+
+        /**
+         * @brief Exports values already converted into the private data.
+         */
+        void ExportOwned(std::unique_ptr<ExportedArray> owned, const size_t &cWidth, const size_t &cCount, const uint8_t *cValidity, const char *cName,
+                         ArrowArray *array, ArrowSchema *schema)
+        {
+            if (cValidity)
+            {
+                owned->validity.assign(cValidity, cValidity + (cCount + 7) / 8);
+            }
+            FillSchema(cWidth, cValidity != nullptr, cName, schema);
+            ExportedArray *const cPrivate = owned.release();
+            FillArray(cPrivate->values.data(), cValidity ? cPrivate->validity.data() : nullptr, cCount,
+                      ArrowExporter::CountNulls(cValidity, cCount), cPrivate, array);
+        }
+    }
+
+    /**
+     * @brief Exports IPv4 addresses without copying them.
+     * @param cAddresses The addresses. Must outlive the exported array.
+     * @param cCount The number of addresses.
+     * @param cValidity The validity bitmap, or nullptr if no address is null. Must outlive the exported array.
+     * @param cName The field name.
+     * @param array Receives the array.
+     * @param schema Receives the schema.
+     * @throw std::invalid_argument If a required pointer is null.
+     */
+    void ArrowExporter::Export(const IPv4Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema)
+    {
+        if ((!cAddresses && cCount) || !cName || !array || !schema)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        std::unique_ptr<ExportedArray> owned(new ExportedArray);
+        FillSchema(IPv4Address::IP_ADDRESS_OCTETS, cValidity != nullptr, cName, schema);
+        FillArray(cAddresses, cValidity, cCount, CountNulls(cValidity, cCount), owned.release(), array);
+    } /* void ArrowExporter::Export(const IPv4Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema) */
+
+    /**
+     * @brief Exports IPv6 addresses. The values are converted into a buffer owned by the array.
+     * @param cAddresses The addresses.
+     * @param cCount The number of addresses.
+     * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+     * @param cName The field name.
+     * @param array Receives the array.
+     * @param schema Receives the schema.
+     * @throw std::invalid_argument If a required pointer is null.
+     */
+    void ArrowExporter::Export(const IPv6Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema)
+    {
+        if ((!cAddresses && cCount) || !cName || !array || !schema)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        std::unique_ptr<ExportedArray> owned(new ExportedArray);
+        owned->values.resize(cCount * IPv6Address::IPV6_ADDRESS_BYTE_LENGTH);
+        for (size_t i = 0; i < cCount; i++)
+        {
+            StoreBigEndian(cAddresses[i].GetUpper64(), owned->values.data() + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH * i);
+            StoreBigEndian(cAddresses[i].GetLower64(), owned->values.data() + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH * i + 8);
+        }
+        ExportOwned(std::move(owned), IPv6Address::IPV6_ADDRESS_BYTE_LENGTH, cCount, cValidity, cName, array, schema);
+    } /* void ArrowExporter::Export(const IPv6Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema) */
+
+    /**
+     * @brief Exports an IPv4 address column. The values are converted into a buffer owned by the array.
+     * @param cColumn The column.
+     * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+     * @param cName The field name.
+     * @param array Receives the array.
+     * @param schema Receives the schema.
+     * @throw std::invalid_argument If a required pointer is null.
+     */
+    void ArrowExporter::Export(const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema)
+    {
+        if (!cName || !array || !schema)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        std::unique_ptr<ExportedArray> owned(new ExportedArray);
+        owned->values.resize(cColumn.Size() * IPv4Address::IP_ADDRESS_OCTETS);
+        const uint32_t *const cValues = cColumn.Data();
+        uint8_t *const cOutput = owned->values.data();
+        for (size_t i = 0; i < cColumn.Size(); i++)
+        {
+            cOutput[4 * i] = static_cast<uint8_t>(cValues[i] >> 24);
+            cOutput[4 * i + 1] = static_cast<uint8_t>(cValues[i] >> 16);
+            cOutput[4 * i + 2] = static_cast<uint8_t>(cValues[i] >> 8);
+            cOutput[4 * i + 3] = static_cast<uint8_t>(cValues[i]);
+        }
+        ExportOwned(std::move(owned), IPv4Address::IP_ADDRESS_OCTETS, cColumn.Size(), cValidity, cName, array, schema);
+    } /* void ArrowExporter::Export(const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema) */
+
+    /**
+     * @brief Exports an IPv6 address column. The values are converted into a buffer owned by the array.
+     * @param cColumn The column.
+     * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+     * @param cName The field name.
+     * @param array Receives the array.
+     * @param schema Receives the schema.
+     * @throw std::invalid_argument If a required pointer is null.
+     */
+    void ArrowExporter::Export(const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema)
+    {
+        if (!cName || !array || !schema)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+
+        std::unique_ptr<ExportedArray> owned(new ExportedArray);
+        owned->values.resize(cColumn.Size() * IPv6Address::IPV6_ADDRESS_BYTE_LENGTH);
+        for (size_t i = 0; i < cColumn.Size(); i++)
+        {
+            StoreBigEndian(cColumn.UpperData()[i], owned->values.data() + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH * i);
+            StoreBigEndian(cColumn.LowerData()[i], owned->values.data() + IPv6Address::IPV6_ADDRESS_BYTE_LENGTH * i + 8);
+        }
+        ExportOwned(std::move(owned), IPv6Address::IPV6_ADDRESS_BYTE_LENGTH, cColumn.Size(), cValidity, cName, array, schema);
+    } /* void ArrowExporter::Export(const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema) */
+
+    /**
+     * @brief Counts the null rows of a validity bitmap.
+     * @param cValidity The validity bitmap, or nullptr if no row is null.
+     * @param cCount The number of rows.
+     * @return The number of cleared bits among the first cCount.
+     */
+    size_t ArrowExporter::CountNulls(const uint8_t *cValidity, const size_t &cCount)
+    {
+        if (!cValidity)
+        {
+            return 0;
+        }
+
+        size_t valid{};
+        size_t i{};
+        for (; i + 64 <= cCount; i += 64)
+        {
+            uint64_t word{};
+            std::memcpy(&word, cValidity + i / 8, sizeof(word));
+            valid += PopCount(word);
+        }
+        for (; i < cCount; i++)
+        {
+            valid += (cValidity[i / 8] >> (i % 8)) & 1;
+        }
+        return cCount - valid;
+    } /* size_t ArrowExporter::CountNulls(const uint8_t *cValidity, const size_t &cCount) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,156 @@
+/**
+ * @file ArrowExporter.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ArrowExporter (Arrow C data interface export of address arrays) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef ARROWEXPORTER_H
+#define ARROWEXPORTER_H
+#include "AddressColumn/IPv4AddressColumn.hpp"
+#include "AddressColumn/IPv6AddressColumn.hpp"
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// The Arrow C data interface structures, copied verbatim as the specification asks, so no Arrow
+// headers or libraries are needed. The guard lets them coexist with Arrow's own copy.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray
+{
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
+namespace EthernetParameter
+{
+    /**
+     * @class ArrowExporter
+     * @brief Exports address arrays through the Arrow C data interface.
+     *
+     * Addresses are exported as fixed_size_binary(4) (format "w:4") and fixed_size_binary(16)
+     * ("w:16") arrays holding the network-order bytes, the layout Arrow-based tools expect for
+     * binary addresses. Nulls are described by an optional validity bitmap in Arrow's layout
+     * (bit i of byte i / 8, least significant bit first, set for valid rows).
+     *
+     * IPv4Address stores its octets in network order, so an array of IPv4Address is exported
+     * without copying: the Arrow array points into the caller's memory, which must stay valid
+     * until the consumer calls the release callback. All other exports convert the values into
+     * a buffer owned by the exported array.
+     *
+     * The consumer takes ownership of the filled structures and must call their release callbacks.
+     */
+    class ArrowExporter
+    {
+    public:
+        /**
+         * @brief Exports IPv4 addresses without copying them.
+         * @param cAddresses The addresses. Must outlive the exported array.
+         * @param cCount The number of addresses.
+         * @param cValidity The validity bitmap, or nullptr if no address is null. Must outlive the exported array.
+         * @param cName The field name.
+         * @param array Receives the array.
+         * @param schema Receives the schema.
+         * @throws std::invalid_argument If a required pointer is null.
+         */
+        static void Export(const IPv4Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema);
+
+        /**
+         * @brief Exports IPv6 addresses. The values are converted into a buffer owned by the array.
+         * @param cAddresses The addresses.
+         * @param cCount The number of addresses.
+         * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+         * @param cName The field name.
+         * @param array Receives the array.
+         * @param schema Receives the schema.
+         * @throws std::invalid_argument If a required pointer is null.
+         */
+        static void Export(const IPv6Address *cAddresses, const size_t &cCount, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema);
+
+        /**
+         * @brief Exports an IPv4 address column. The values are converted into a buffer owned by the array.
+         * @param cColumn The column.
+         * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+         * @param cName The field name.
+         * @param array Receives the array.
+         * @param schema Receives the schema.
+         * @throws std::invalid_argument If a required pointer is null.
+         */
+        static void Export(const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema);
+
+        /**
+         * @brief Exports an IPv6 address column. The values are converted into a buffer owned by the array.
+         * @param cColumn The column.
+         * @param cValidity The validity bitmap, or nullptr if no address is null. It is copied.
+         * @param cName The field name.
+         * @param array Receives the array.
+         * @param schema Receives the schema.
+         * @throws std::invalid_argument If a required pointer is null.
+         */
+        static void Export(const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const char *cName, ArrowArray *array, ArrowSchema *schema);
+
+        /**
+         * @brief Counts the null rows of a validity bitmap.
+         * @param cValidity The validity bitmap, or nullptr if no row is null.
+         * @param cCount The number of rows.
+         * @return The number of cleared bits among the first cCount.
+         */
+        static size_t CountNulls(const uint8_t *cValidity, const size_t &cCount);
+
+    private:
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::ArrowExporter] Null pointer encountered!"};
+    }; /* class ArrowExporter */
+}
+
+#endif /* ARROWEXPORTER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,706 @@
+/**
+ * @file ParquetWriter.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ParquetWriter class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Only the parts of the Parquet format needed for flat FIXED_LEN_BYTE_ARRAY columns are
+ * implemented: the Thrift compact protocol for page headers and the footer, the RLE/bit-packing
+ * hybrid for definition levels and dictionary codes, and DELTA_BINARY_PACKED for the lengths of
+ * DELTA_BYTE_ARRAY.
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ParquetWriter.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Parquet file magic, at the start and the end of the file.
+         */
+        constexpr char MAGIC[]{'P', 'A', 'R', '1'};
+
+        // Parquet enumeration values (parquet.thrift).
+        constexpr int32_t TYPE_FIXED_LEN_BYTE_ARRAY = 7;
+        constexpr int32_t REPETITION_REQUIRED = 0;
+        constexpr int32_t REPETITION_OPTIONAL = 1;
+        constexpr int32_t ENCODING_PLAIN = 0;
+        constexpr int32_t ENCODING_RLE = 3;
+        constexpr int32_t ENCODING_DELTA_BYTE_ARRAY = 7;
+        constexpr int32_t ENCODING_RLE_DICTIONARY = 8;
+        constexpr int32_t PAGE_DATA = 0;
+        constexpr int32_t PAGE_DICTIONARY = 2;
+        constexpr int32_t CODEC_UNCOMPRESSED = 0;
+
+        /**
+         * @brief Appends an unsigned LEB128 varint.
+         */
+        void AppendVarint(uint64_t value, std::vector<uint8_t> &output)
+        {
+            while (value >= 0x80)
+            {
+                output.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            output.push_back(static_cast<uint8_t>(value));
+        }
+
+        /**
+         * @brief Appends a zigzag-encoded signed varint.
+         */
+        void AppendZigZag(const int64_t &cValue, std::vector<uint8_t> &output)
+        {
+            AppendVarint((static_cast<uint64_t>(cValue) << 1) ^ static_cast<uint64_t>(cValue >> 63), output);
+        }
+
+        /**
+         * @brief Returns the number of bits needed to store a value.
+         */
+        uint8_t BitWidth(uint64_t value)
+        {
+            uint8_t width{};
+            while (value)
+            {
+                width++;
+                value >>= 1;
+            }
+            return width;
+        }
+
+        /**
+         * @brief Appends values bit-packed least significant bit first, as Parquet packs them.
+         * @param cValues The values, each fitting in cWidth bits.
+         * @param cCount The number of values.
+         * @param cWidth The bit width.
+         * @param output The buffer to append to; cCount * cWidth bits rounded up to whole bytes are appended.
+         */
+        template <typename Value>
+        void AppendBitPacked(const Value *cValues, const size_t &cCount, const uint8_t &cWidth, std::vector<uint8_t> &output)
+        {
+            uint8_t current{};
+            uint8_t bits{};
+            for (size_t i = 0; i < cCount; i++)
+            {
+                uint64_t value = static_cast<uint64_t>(cValues[i]);
+                uint8_t remaining = cWidth;
+                while (remaining)
+                {
+                    const uint8_t cTaken = std::min<uint8_t>(remaining, 8 - bits);
+                    current |= static_cast<uint8_t>((value & ((1u << cTaken) - 1)) << bits);
+                    bits += cTaken;
+                    value >>= cTaken;
+                    remaining -= cTaken;
+                    if (bits == 8)
+                    {
+                        output.push_back(current);
+                        current = 0;
+                        bits = 0;
+                    }
+                }
+            }
+            if (bits)
+            {
+                output.push_back(current);
+            }
+        }
+
+        /**
+         * @brief Appends values in the RLE/bit-packing hybrid encoding (without length prefix).
+         *
+         * Runs of at least 8 equal values become RLE runs, everything else is bit-packed in groups
+         * of 8. Only the last bit-packed group may be padded.
+         *
+         * @param cValues The values.
+         * @param cCount The number of values.
+         * @param cWidth The bit width of the values.
+         * @param output The buffer to append to.
+         */
+        void AppendHybrid(const uint32_t *cValues, const size_t &cCount, const uint8_t &cWidth, std::vector<uint8_t> &output)
+        {
+            const auto cRunLength = [&](const size_t &cStart, const size_t &cLimit) {
+                size_t length = 1;
+                while (cStart + length < cCount && length < cLimit && cValues[cStart + length] == cValues[cStart])
+                {
+                    length++;
+                }
+                return length;
+            };
+
+            size_t i{};
+            while (i < cCount)
+            {
+                const size_t cRun = cRunLength(i, SIZE_MAX);
+                if (cRun >= 8)
+                {
+                    AppendVarint(cRun << 1, output);
+                    for (uint8_t byte = 0; byte < (cWidth + 7) / 8; byte++)
+                    {
+                        output.push_back(static_cast<uint8_t>(cValues[i] >> (8 * byte)));
+                    }
+                    i += cRun;
+                    continue;
+                }
+
+                const size_t cStart = i;
+                do
+                {
+                    i += 8;
+                } while (i < cCount && cRunLength(i, 8) < 8);
+
+                const size_t cGroups = (i - cStart) / 8;
+                AppendVarint((cGroups << 1) | 1, output);
+                uint32_t group[8]{};
+                for (size_t offset = cStart; offset < i; offset += 8)
+                {
+                    for (size_t j = 0; j < 8; j++)
+                    {
+                        group[j] = offset + j < cCount ? cValues[offset + j] : 0;
+                    }
+                    AppendBitPacked(group, 8, cWidth, output);
+                }
+            }
+        }
+
+        /**
+         * @brief Appends values in the DELTA_BINARY_PACKED encoding.
+         *
+         * Blocks hold 128 deltas in 4 miniblocks of 32. Each block stores its minimum delta and
+         * every miniblock the deltas minus that minimum with its own bit width.
+         *
+         * @param cValues The values.
+         * @param output The buffer to append to.
+         */
+        void AppendDeltaBinaryPacked(const std::vector<int64_t> &cValues, std::vector<uint8_t> &output)
+        {
+            constexpr size_t cBlockSize = 128;
+            constexpr size_t cMiniblocks = 4;
+            constexpr size_t cMiniblockSize = cBlockSize / cMiniblocks;
+
+            AppendVarint(cBlockSize, output);
+            AppendVarint(cMiniblocks, output);
+            AppendVarint(cValues.size(), output);
+            AppendZigZag(cValues.empty() ? 0 : cValues[0], output);
+
+            uint64_t deltas[cBlockSize]{};
+            for (size_t start = 1; start < cValues.size(); start += cBlockSize)
+            {
+                const size_t cCount = std::min(cBlockSize, cValues.size() - start);
+                int64_t minimum = INT64_MAX;
+                for (size_t i = 0; i < cCount; i++)
+                {
+                    const int64_t cDelta = static_cast<int64_t>(static_cast<uint64_t>(cValues[start + i]) - static_cast<uint64_t>(cValues[start + i - 1]));
+                    deltas[i] = static_cast<uint64_t>(cDelta);
+                    minimum = std::min(minimum, cDelta);
+                }
+                AppendZigZag(minimum, output);
+
+                uint8_t widths[cMiniblocks]{};
+                for (size_t i = 0; i < cCount; i++)
+                {
+                    deltas[i] -= static_cast<uint64_t>(minimum);
+                    widths[i / cMiniblockSize] = std::max(widths[i / cMiniblockSize], BitWidth(deltas[i]));
+                }
+                std::fill(deltas + cCount, deltas + cBlockSize, 0);
+                output.insert(output.end(), widths, widths + cMiniblocks);
+
+                // Miniblocks without values are left out; their width bytes above are zero.
+                for (size_t miniblock = 0; miniblock * cMiniblockSize < cCount; miniblock++)
+                {
+                    AppendBitPacked(deltas + miniblock * cMiniblockSize, cMiniblockSize, widths[miniblock], output);
+                }
+            }
+        }
+
+        /**
+         * @brief Appends fixed-width values in the DELTA_BYTE_ARRAY encoding.
+         * @param cValues The values, cWidth bytes each.
+         * @param cCount The number of values.
+         * @param cWidth The value width in bytes.
+         * @param output The buffer to append to.
+         */
+        void AppendDeltaByteArray(const uint8_t *cValues, const size_t &cCount, const uint8_t &cWidth, std::vector<uint8_t> &output)
+        {
+            std::vector<int64_t> prefixes(cCount);
+            std::vector<int64_t> suffixes(cCount);
+            std::vector<uint8_t> suffixBytes;
+            for (size_t i = 0; i < cCount; i++)
+            {
+                const uint8_t *const cValue = cValues + i * cWidth;
+                uint8_t prefix{};
+                if (i)
+                {
+                    while (prefix < cWidth && cValue[prefix] == cValue[prefix - cWidth])
+                    {
+                        prefix++;
+                    }
+                }
+                prefixes[i] = prefix;
+                suffixes[i] = cWidth - prefix;
+                suffixBytes.insert(suffixBytes.end(), cValue + prefix, cValue + cWidth);
+            }
+
+            AppendDeltaBinaryPacked(prefixes, output);
+            AppendDeltaBinaryPacked(suffixes, output);
+            output.insert(output.end(), suffixBytes.begin(), suffixBytes.end());
+        }
+
+        /**
+         * @class ThriftWriter
+         * @brief Writes structures in the Thrift compact protocol.
+         */
+        class ThriftWriter
+        {
+        public:
+            explicit ThriftWriter(std::vector<uint8_t> &output) : _output{output} {}
+
+            void I32(const int16_t &cField, const int32_t &cValue)
+            {
+                FieldHeader(cField, TYPE_I32);
+                AppendZigZag(cValue, _output);
+            }
+
+            void I64(const int16_t &cField, const int64_t &cValue)
+            {
+                FieldHeader(cField, TYPE_I64);
+                AppendZigZag(cValue, _output);
+            }
+
+            void Binary(const int16_t &cField, const std::string &cValue)
+            {
+                FieldHeader(cField, TYPE_BINARY);
+                BinaryElement(cValue);
+            }
+
+            void BeginStruct(const int16_t &cField)
+            {
+                FieldHeader(cField, TYPE_STRUCT);
+                _lastFields.push_back(0);
+            }
+
+            /**
+             * @brief Writes a list header; the elements follow with the *Element() functions.
+             */
+            void BeginList(const int16_t &cField, const uint8_t &cElementType, const size_t &cSize)
+            {
+                FieldHeader(cField, TYPE_LIST);
+                if (cSize < 15)
+                {
+                    _output.push_back(static_cast<uint8_t>(cSize << 4 | cElementType));
+                }
+                else
+                {
+                    _output.push_back(static_cast<uint8_t>(0xF0 | cElementType));
+                    AppendVarint(cSize, _output);
+                }
+            }
+
+            void I32Element(const int32_t &cValue) { AppendZigZag(cValue, _output); }
+
+            void BinaryElement(const std::string &cValue)
+            {
+                AppendVarint(cValue.size(), _output);
+                _output.insert(_output.end(), cValue.begin(), cValue.end());
+            }
+
+            void BeginStructElement() { _lastFields.push_back(0); }
+
+            /**
+             * @brief Ends the innermost structure (or the top-level one).
+             */
+            void EndStruct()
+            {
+                _output.push_back(0);
+                _lastFields.pop_back();
+            }
+
+            static constexpr uint8_t TYPE_I32 = 5;
+            static constexpr uint8_t TYPE_I64 = 6;
+            static constexpr uint8_t TYPE_BINARY = 8;
+            static constexpr uint8_t TYPE_LIST = 9;
+            static constexpr uint8_t TYPE_STRUCT = 12;
+
+        private:
+            std::vector<uint8_t> &_output;
+            std::vector<int16_t> _lastFields{0};
+
+            void FieldHeader(const int16_t &cField, const uint8_t &cType)
+            {
+                const int16_t cDelta = static_cast<int16_t>(cField - _lastFields.back());
+                if (cDelta > 0 && cDelta <= 15)
+                {
+                    _output.push_back(static_cast<uint8_t>(cDelta << 4 | cType));
+                }
+                else
+                {
+                    _output.push_back(cType);
+                    AppendZigZag(cField, _output);
+                }
+                _lastFields.back() = cField;
+            }
+        };
+
+        /**
+         * @brief Builds a page header.
+         * @param cType The page type.
+         * @param cSize The page body size.
+         * @param cValues The number of values (rows for data pages, entries for dictionary pages).
+         * @param cEncoding The value encoding.
+         * @return The serialized header.
+         */
+        std::vector<uint8_t> PageHeader(const int32_t &cType, const size_t &cSize, const size_t &cValues, const int32_t &cEncoding)
+        {
+            std::vector<uint8_t> header;
+            ThriftWriter writer(header);
+            writer.I32(1, cType);
+            writer.I32(2, static_cast<int32_t>(cSize));
+            writer.I32(3, static_cast<int32_t>(cSize));
+            if (cType == PAGE_DICTIONARY)
+            {
+                writer.BeginStruct(7);
+                writer.I32(1, static_cast<int32_t>(cValues));
+                writer.I32(2, cEncoding);
+                writer.EndStruct();
+            }
+            else
+            {
+                writer.BeginStruct(5);
+                writer.I32(1, static_cast<int32_t>(cValues));
+                writer.I32(2, cEncoding);
+                writer.I32(3, ENCODING_RLE);
+                writer.I32(4, ENCODING_RLE);
+                writer.EndStruct();
+            }
+            writer.EndStruct();
+            return header;
+        }
+
+        /**
+         * @brief Appends the network-order bytes of every row of a column.
+         */
+        void AppendBytes(const IPv4AddressColumn &cColumn, std::vector<uint8_t> &output)
+        {
+            const size_t cOffset = output.size();
+            output.resize(cOffset + 4 * cColumn.Size());
+            for (size_t i = 0; i < cColumn.Size(); i++)
+            {
+                const uint32_t cValue = cColumn.Data()[i];
+                for (size_t byte = 0; byte < 4; byte++)
+                {
+                    output[cOffset + 4 * i + byte] = static_cast<uint8_t>(cValue >> (24 - 8 * byte));
+                }
+            }
+        }
+
+        /**
+         * @brief Appends the network-order bytes of every row of a column.
+         */
+        void AppendBytes(const IPv6AddressColumn &cColumn, std::vector<uint8_t> &output)
+        {
+            const size_t cOffset = output.size();
+            output.resize(cOffset + 16 * cColumn.Size());
+            for (size_t i = 0; i < cColumn.Size(); i++)
+            {
+                for (size_t byte = 0; byte < 8; byte++)
+                {
+                    output[cOffset + 16 * i + byte] = static_cast<uint8_t>(cColumn.UpperData()[i] >> (56 - 8 * byte));
+                    output[cOffset + 16 * i + 8 + byte] = static_cast<uint8_t>(cColumn.LowerData()[i] >> (56 - 8 * byte));
+                }
+            }
+        }
+
+        /**
+         * @brief Returns the rows whose validity bit is set.
+         */
+        std::vector<uint32_t> ValidRows(const uint8_t *cValidity, const size_t &cRows)
+        {
+            std::vector<uint32_t> rows;
+            for (size_t row = 0; row < cRows; row++)
+            {
+                if ((cValidity[row / 8] >> (row % 8)) & 1)
+                {
+                    rows.push_back(static_cast<uint32_t>(row));
+                }
+            }
+            return rows;
+        }
+
+        /**
+         * @brief Converts the non-null values of a column for ParquetWriter::WriteChunk().
+         * @param cColumn The column.
+         * @param cValidity The validity bitmap, or nullptr.
+         * @param cDictionaryEncoding `true` to fill the dictionary and the codes instead of the values.
+         * @param values Receives the network-order bytes of the non-null values.
+         * @param dictionary Receives the network-order bytes of the dictionary.
+         * @param codes Receives the dictionary codes of the non-null values.
+         */
+        template <typename Column>
+        void Prepare(const Column &cColumn, const uint8_t *cValidity, const bool &cDictionaryEncoding,
+                     std::vector<uint8_t> &values, std::vector<uint8_t> &dictionary, std::vector<uint32_t> &codes)
+        {
+            Column compacted;
+            if (cValidity)
+            {
+                const std::vector<uint32_t> cRows = ValidRows(cValidity, cColumn.Size());
+                compacted = cColumn.Gather(cRows.data(), cRows.size());
+            }
+            const Column &cValues = cValidity ? compacted : cColumn;
+
+            if (cDictionaryEncoding)
+            {
+                codes.resize(cValues.Size());
+                AppendBytes(cValues.DictionaryEncode(codes.data()), dictionary);
+            }
+            else
+            {
+                AppendBytes(cValues, values);
+            }
+        }
+    }
+
+    /**
+     * @brief Constructor for the ParquetWriter class. Writes the file header.
+     * @param output The stream to write to, opened in binary mode. Must outlive the writer.
+     */
+    ParquetWriter::ParquetWriter(std::ostream &output) : _output{output}
+    {
+        Write(std::vector<uint8_t>(MAGIC, MAGIC + sizeof(MAGIC)));
+    } /* ParquetWriter::ParquetWriter(std::ostream &output) */
+
+    /**
+     * @brief Writes an IPv4 address column.
+     * @param cName The column name.
+     * @param cColumn The addresses.
+     * @param cValidity The validity bitmap, or nullptr if no address is null.
+     * @param cEncoding The value encoding.
+     * @throw std::invalid_argument If the writer is closed, the name is empty or the row count differs from the previous columns.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void ParquetWriter::WriteColumn(const std::string &cName, const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding)
+    {
+        CheckColumn(cName, cColumn.Size());
+        std::vector<uint8_t> values;
+        std::vector<uint8_t> dictionary;
+        std::vector<uint32_t> codes;
+        Prepare(cColumn, cValidity, cEncoding == Encoding::Dictionary, values, dictionary, codes);
+        WriteChunk(cName, IPv4Address::IP_ADDRESS_OCTETS, values, cValidity, cColumn.Size(), cEncoding, dictionary, codes);
+    } /* void ParquetWriter::WriteColumn(const std::string &cName, const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding) */
+
+    /**
+     * @brief Writes an IPv6 address column.
+     * @param cName The column name.
+     * @param cColumn The addresses.
+     * @param cValidity The validity bitmap, or nullptr if no address is null.
+     * @param cEncoding The value encoding.
+     * @throw std::invalid_argument If the writer is closed, the name is empty or the row count differs from the previous columns.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void ParquetWriter::WriteColumn(const std::string &cName, const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding)
+    {
+        CheckColumn(cName, cColumn.Size());
+        std::vector<uint8_t> values;
+        std::vector<uint8_t> dictionary;
+        std::vector<uint32_t> codes;
+        Prepare(cColumn, cValidity, cEncoding == Encoding::Dictionary, values, dictionary, codes);
+        WriteChunk(cName, IPv6Address::IPV6_ADDRESS_BYTE_LENGTH, values, cValidity, cColumn.Size(), cEncoding, dictionary, codes);
+    } /* void ParquetWriter::WriteColumn(const std::string &cName, const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding) */
+
+    /**
+     * @brief Writes the file footer. Further calls do nothing.
+     * @throw std::runtime_error If writing to the stream fails.
+     */
+    void ParquetWriter::Close()
+    {
+        if (_closed)
+        {
+            return;
+        }
+        _closed = true;
+
+        std::vector<uint8_t> footer;
+        ThriftWriter writer(footer);
+        writer.I32(1, 1);
+
+        writer.BeginList(2, ThriftWriter::TYPE_STRUCT, _chunks.size() + 1);
+        writer.BeginStructElement();
+        writer.Binary(4, "schema");
+        writer.I32(5, static_cast<int32_t>(_chunks.size()));
+        writer.EndStruct();
+        for (const Chunk &cChunk : _chunks)
+        {
+            writer.BeginStructElement();
+            writer.I32(1, TYPE_FIXED_LEN_BYTE_ARRAY);
+            writer.I32(2, cChunk.width);
+            writer.I32(3, cChunk.nullable ? REPETITION_OPTIONAL : REPETITION_REQUIRED);
+            writer.Binary(4, cChunk.name);
+            writer.EndStruct();
+        }
+
+        writer.I64(3, static_cast<int64_t>(_rows));
+
+        uint64_t totalSize{};
+        writer.BeginList(4, ThriftWriter::TYPE_STRUCT, 1);
+        writer.BeginStructElement();
+        writer.BeginList(1, ThriftWriter::TYPE_STRUCT, _chunks.size());
+        for (const Chunk &cChunk : _chunks)
+        {
+            writer.BeginStructElement();
+            writer.I64(2, static_cast<int64_t>(cChunk.firstPageOffset));
+            writer.BeginStruct(3);
+            writer.I32(1, TYPE_FIXED_LEN_BYTE_ARRAY);
+            if (cChunk.encoding == Encoding::Dictionary)
+            {
+                writer.BeginList(2, ThriftWriter::TYPE_I32, 3);
+                writer.I32Element(ENCODING_PLAIN);
+                writer.I32Element(ENCODING_RLE);
+                writer.I32Element(ENCODING_RLE_DICTIONARY);
+            }
+            else
+            {
+                writer.BeginList(2, ThriftWriter::TYPE_I32, 2);
+                writer.I32Element(cChunk.encoding == Encoding::Plain ? ENCODING_PLAIN : ENCODING_DELTA_BYTE_ARRAY);
+                writer.I32Element(ENCODING_RLE);
+            }
+            writer.BeginList(3, ThriftWriter::TYPE_BINARY, 1);
+            writer.BinaryElement(cChunk.name);
+            writer.I32(4, CODEC_UNCOMPRESSED);
+            writer.I64(5, static_cast<int64_t>(_rows));
+            writer.I64(6, static_cast<int64_t>(cChunk.size));
+            writer.I64(7, static_cast<int64_t>(cChunk.size));
+            writer.I64(9, static_cast<int64_t>(cChunk.dataPageOffset));
+            if (cChunk.encoding == Encoding::Dictionary)
+            {
+                writer.I64(11, static_cast<int64_t>(cChunk.firstPageOffset));
+            }
+            writer.EndStruct();
+            writer.EndStruct();
+            totalSize += cChunk.size;
+        }
+        writer.I64(2, static_cast<int64_t>(totalSize));
+        writer.I64(3, static_cast<int64_t>(_rows));
+        writer.EndStruct();
+
+        writer.Binary(6, "EthernetParameter ParquetWriter version 0.1");
+        writer.EndStruct();
+
+        const uint32_t cFooterSize = static_cast<uint32_t>(footer.size());
+        for (size_t byte = 0; byte < 4; byte++)
+        {
+            footer.push_back(static_cast<uint8_t>(cFooterSize >> (8 * byte)));
+        }
+        footer.insert(footer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+        Write(footer);
+        _output.flush();
+    } /* void ParquetWriter::Close() */
+
+    // Private Methods.
+
+    void ParquetWriter::CheckColumn(const std::string &cName, const size_t &cRows) const
+    {
+        if (_closed)
+        {
+            throw std::invalid_argument(WRITER_CLOSED);
+        }
+        if (cName.empty())
+        {
+            throw std::invalid_argument(EMPTY_NAME);
+        }
+        if (!_chunks.empty() && cRows != _rows)
+        {
+            throw std::invalid_argument(ROW_COUNT_MISMATCH);
+        }
+    } /* void ParquetWriter::CheckColumn(const std::string &cName, const size_t &cRows) const */
+
+    void ParquetWriter::WriteChunk(const std::string &cName, const uint8_t &cWidth, const std::vector<uint8_t> &cValues, const uint8_t *cValidity, const size_t &cRows,
+                                   const Encoding &cEncoding, const std::vector<uint8_t> &cDictionary, const std::vector<uint32_t> &cCodes)
+    {
+        Chunk chunk{cName, cWidth, cValidity != nullptr, cEncoding, _position, _position, 0};
+
+        uint8_t codeWidth{};
+        if (cEncoding == Encoding::Dictionary)
+        {
+            const size_t cEntries = cDictionary.size() / cWidth;
+            Write(PageHeader(PAGE_DICTIONARY, cDictionary.size(), cEntries, ENCODING_PLAIN));
+            Write(cDictionary);
+            chunk.dataPageOffset = _position;
+            codeWidth = std::max<uint8_t>(1, BitWidth(cEntries ? cEntries - 1 : 0));
+        }
+        const int32_t cPageEncoding = cEncoding == Encoding::Plain ? ENCODING_PLAIN : cEncoding == Encoding::Dictionary ? ENCODING_RLE_DICTIONARY : ENCODING_DELTA_BYTE_ARRAY;
+
+        size_t value{};
+        size_t pageStart{};
+        std::vector<uint8_t> page;
+        std::vector<uint32_t> levels;
+        // An empty column still gets one (empty) data page.
+        do
+        {
+            const size_t cPageRows = std::min(PAGE_ROWS, cRows - pageStart);
+            page.clear();
+
+            size_t valid = cPageRows;
+            if (cValidity)
+            {
+                levels.resize(cPageRows);
+                valid = 0;
+                for (size_t i = 0; i < cPageRows; i++)
+                {
+                    const size_t cRow = pageStart + i;
+                    levels[i] = (cValidity[cRow / 8] >> (cRow % 8)) & 1;
+                    valid += levels[i];
+                }
+                page.resize(4);
+                AppendHybrid(levels.data(), levels.size(), 1, page);
+                const uint32_t cLevelsSize = static_cast<uint32_t>(page.size() - 4);
+                for (size_t byte = 0; byte < 4; byte++)
+                {
+                    page[byte] = static_cast<uint8_t>(cLevelsSize >> (8 * byte));
+                }
+            }
+
+            switch (cEncoding)
+            {
+            case Encoding::Plain:
+                page.insert(page.end(), cValues.begin() + value * cWidth, cValues.begin() + (value + valid) * cWidth);
+                break;
+            case Encoding::Dictionary:
+                page.push_back(codeWidth);
+                AppendHybrid(cCodes.data() + value, valid, codeWidth, page);
+                break;
+            case Encoding::Delta:
+                AppendDeltaByteArray(cValues.data() + value * cWidth, valid, cWidth, page);
+                break;
+            }
+
+            Write(PageHeader(PAGE_DATA, page.size(), cPageRows, cPageEncoding));
+            Write(page);
+            value += valid;
+            pageStart += cPageRows;
+        } while (pageStart < cRows);
+
+        chunk.size = _position - chunk.firstPageOffset;
+        _chunks.push_back(chunk);
+        _rows = cRows;
+    } /* void ParquetWriter::WriteChunk(...) */
+
+    void ParquetWriter::Write(const std::vector<uint8_t> &cData)
+    {
+        _output.write(reinterpret_cast<const char *>(cData.data()), static_cast<std::streamsize>(cData.size()));
+        if (!_output)
+        {
+            throw std::runtime_error(WRITE_FAILED);
+        }
+        _position += cData.size();
+    } /* void ParquetWriter::Write(const std::vector<uint8_t> &cData) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
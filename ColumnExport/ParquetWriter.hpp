@@ -0,0 +1,193 @@
+/**
+ * @file ParquetWriter.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ParquetWriter (minimal Parquet file writer for address columns) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef PARQUETWRITER_H
+#define PARQUETWRITER_H
+#include "AddressColumn/IPv4AddressColumn.hpp"
+#include "AddressColumn/IPv6AddressColumn.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class ParquetWriter
+     * @brief Writes address columns to a Parquet file without any Parquet library.
+     *
+     * Every column is written as FIXED_LEN_BYTE_ARRAY of width 4 or 16 holding the network-order
+     * bytes, the same values ArrowExporter exports. All columns of a file belong to one row group
+     * and must have the same number of rows. A column with a validity bitmap (Arrow layout) is
+     * OPTIONAL and its null rows are skipped, otherwise it is REQUIRED. Pages are uncompressed
+     * version 1 data pages of at most PAGE_ROWS rows.
+     *
+     * Value encodings:
+     * - Plain: PLAIN.
+     * - Dictionary: a PLAIN dictionary page followed by RLE_DICTIONARY data pages, best for
+     *   columns with few distinct addresses (clients of one service, a handful of gateways).
+     * - Delta: DELTA_BYTE_ARRAY, which stores the length of the prefix shared with the previous
+     *   value and the remaining bytes, best for sorted columns.
+     *
+     * The file is complete after Close(); the destructor does not write anything.
+     */
+    class ParquetWriter
+    {
+    public:
+        /**
+         * @brief Value encoding of a column.
+         */
+        enum class Encoding : uint8_t
+        {
+            Plain,
+            Dictionary,
+            Delta
+        };
+
+        /**
+         * @brief Maximum number of rows of one data page.
+         */
+        static constexpr size_t PAGE_ROWS = 65536;
+
+        /**
+         * @brief Constructor for the ParquetWriter class. Writes the file header.
+         * @param output The stream to write to, opened in binary mode. Must outlive the writer.
+         */
+        explicit ParquetWriter(std::ostream &output);
+
+        /**
+         * @brief Writes an IPv4 address column.
+         * @param cName The column name.
+         * @param cColumn The addresses.
+         * @param cValidity The validity bitmap, or nullptr if no address is null.
+         * @param cEncoding The value encoding.
+         * @throws std::invalid_argument If the writer is closed, the name is empty or the row count differs from the previous columns.
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void WriteColumn(const std::string &cName, const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding = Encoding::Dictionary);
+
+        /**
+         * @brief Writes an IPv6 address column.
+         * @param cName The column name.
+         * @param cColumn The addresses.
+         * @param cValidity The validity bitmap, or nullptr if no address is null.
+         * @param cEncoding The value encoding.
+         * @throws std::invalid_argument If the writer is closed, the name is empty or the row count differs from the previous columns.
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void WriteColumn(const std::string &cName, const IPv6AddressColumn &cColumn, const uint8_t *cValidity, const Encoding &cEncoding = Encoding::Dictionary);
+
+        /**
+         * @brief Writes the file footer. Further calls do nothing.
+         * @throws std::runtime_error If writing to the stream fails.
+         */
+        void Close();
+
+    private:
+        /**
+         * @struct Chunk
+         * @brief Metadata of a written column chunk.
+         */
+        struct Chunk
+        {
+            std::string name;
+            uint8_t width{};
+            bool nullable{};
+            Encoding encoding{};
+            uint64_t firstPageOffset{};
+            uint64_t dataPageOffset{};
+            uint64_t size{};
+        };
+
+        /**
+         * @brief The output stream.
+         */
+        std::ostream &_output;
+
+        /**
+         * @brief Number of bytes written so far.
+         */
+        uint64_t _position{};
+
+        /**
+         * @brief Number of rows of every column, valid once a column was written.
+         */
+        uint64_t _rows{};
+
+        /**
+         * @brief The written column chunks.
+         */
+        std::vector<Chunk> _chunks;
+
+        /**
+         * @brief `true` after Close().
+         */
+        bool _closed{};
+
+        /**
+         * @brief Checks the arguments of WriteColumn().
+         * @param cName The column name.
+         * @param cRows The number of rows of the column.
+         * @throws std::invalid_argument If the writer is closed, the name is empty or the row count differs from the previous columns.
+         */
+        void CheckColumn(const std::string &cName, const size_t &cRows) const;
+
+        /**
+         * @brief Writes a column chunk.
+         * @param cName The column name.
+         * @param cWidth The value width in bytes.
+         * @param cValues The network-order bytes of the non-null values.
+         * @param cValidity The validity bitmap, or nullptr.
+         * @param cRows The number of rows, including null rows.
+         * @param cEncoding The value encoding.
+         * @param cDictionary The network-order dictionary values (Dictionary encoding only).
+         * @param cCodes The dictionary code of every non-null value (Dictionary encoding only).
+         */
+        void WriteChunk(const std::string &cName, const uint8_t &cWidth, const std::vector<uint8_t> &cValues, const uint8_t *cValidity, const size_t &cRows,
+                        const Encoding &cEncoding, const std::vector<uint8_t> &cDictionary, const std::vector<uint32_t> &cCodes);
+
+        /**
+         * @brief Writes bytes to the stream.
+         * @param cData The bytes.
+         * @throws std::runtime_error If writing fails.
+         */
+        void Write(const std::vector<uint8_t> &cData);
+
+        /**
+         * @brief Error message indicating a write after Close().
+         */
+        static constexpr char WRITER_CLOSED[]{"[EthernetParameter::ParquetWriter] Writer already closed!"};
+
+        /**
+         * @brief Error message indicating an empty column name.
+         */
+        static constexpr char EMPTY_NAME[]{"[EthernetParameter::ParquetWriter] Empty column name!"};
+
+        /**
+         * @brief Error message indicating columns of different lengths.
+         */
+        static constexpr char ROW_COUNT_MISMATCH[]{"[EthernetParameter::ParquetWriter] Column row count differs from previous columns!"};
+
+        /**
+         * @brief Error message indicating a failed stream write.
+         */
+        static constexpr char WRITE_FAILED[]{"[EthernetParameter::ParquetWriter] Writing to the stream failed!"};
+    }; /* class ParquetWriter */
+}
+
+#endif /* PARQUETWRITER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,686 @@
+/**
+ * @file ConnTrackTable.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ConnTrackTable (sharded connection-tracking table with timer-wheel aging) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef CONNTRACKTABLE_H
+#define CONNTRACKTABLE_H
+#include "FlowKey.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class ConnTrackTable
+     * @brief A bounded table of connections keyed by 5-tuple, each with a value and an expiry time.
+     *
+     * Flows are stored under their normalised FlowKey together with the direction of the packet
+     * that created them, so packets of both directions find the flow and learn whether they travel
+     * in the original or the reply direction.
+     *
+     * The table is split into shards, by default one per hardware thread, each with its own lock,
+     * flat array of entries, open addressing index and timer wheel. An index entry is a 32-bit hash
+     * tag and a 32-bit entry number; the top bits of the tag are the home position (linear probing,
+     * backward shift deletion, load factor at most 1/2) and the rest filter out most foreign keys
+     * before their entry is read. All arrays are sized for the capacity at construction and never
+     * move, so the batch operations prefetch the index lines of a whole batch before taking any
+     * lock, and a lock is kept while consecutive keys fall into the same shard.
+     *
+     * Aging is lazy. The wheel has WHEEL_SLOTS slots, each an array of the entry numbers due at
+     * one tick; expiries further away are queued at the last tick the wheel can hold and queued
+     * again when they come due. Refreshing a flow on a packet only raises the expiry stored in its
+     * entry, and when the wheel reaches a flow that has been refreshed meanwhile the flow is queued
+     * again instead of removed. Removing a flow leaves its queued copy behind; an entry records
+     * the tick it is queued for, so copies that no longer match are skipped. Unlike the linked
+     * lists of a TimingWheel, a slot is walked as an array, so the entries of the flows coming due
+     * are prefetched ahead instead of being reached one dependent cache miss at a time. Time is an
+     * abstract tick count (e.g. seconds) chosen by the caller.
+     *
+     * @tparam Address IPv4Address or IPv6Address.
+     * @tparam Value A trivially copyable per-flow value, e.g. a connection state or a NAT binding.
+     */
+    template <typename Address, typename Value>
+    class ConnTrackTable
+    {
+        static_assert(std::is_trivially_copyable<Value>::value, "Values must be trivially copyable");
+
+    public:
+        /**
+         * @brief The key type of the table.
+         */
+        using Key = FlowKey<Address>;
+
+        /**
+         * @brief Result of a lookup: whether the flow exists and which direction the key travels in.
+         */
+        enum class Match : uint8_t
+        {
+            NONE,
+            ORIGINAL,
+            REPLY
+        };
+
+        /**
+         * @struct Flow
+         * @brief An expired flow, keyed in the direction of the packet that created it.
+         */
+        struct Flow
+        {
+            Key key{};
+            Value value{};
+            uint64_t expiry{};
+        };
+
+        /**
+         * @brief Number of keys a batch operation hashes and prefetches before it takes any lock.
+         */
+        static constexpr size_t BATCH = 16;
+
+        /**
+         * @brief Constructor for the ConnTrackTable class.
+         * @param cCapacity The maximum number of flows, split evenly between the shards.
+         * @param cStartTime The current time in ticks.
+         * @param cShardCount The number of shards, rounded up to a power of two; defaults to one per hardware thread.
+         * @throws std::invalid_argument If the capacity is zero or a shard would exceed 2^31 flows.
+         */
+        explicit ConnTrackTable(const size_t &cCapacity, const uint64_t &cStartTime = 0, const size_t &cShardCount = 0)
+        {
+            if (!cCapacity)
+            {
+                throw std::invalid_argument(INVALID_CAPACITY);
+            }
+
+            const size_t cThreads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+            _shardCount = RoundUpToPowerOfTwo(cShardCount ? cShardCount : cThreads);
+            _shardCapacity = (cCapacity + _shardCount - 1) / _shardCount;
+            if (_shardCapacity > (size_t{1} << 31))
+            {
+                throw std::invalid_argument(INVALID_CAPACITY);
+            }
+            const size_t cIndexSize = RoundUpToPowerOfTwo(2 * _shardCapacity < MIN_INDEX_SIZE ? MIN_INDEX_SIZE : 2 * _shardCapacity);
+            while ((size_t{1} << _indexBits) < cIndexSize)
+            {
+                _indexBits++;
+            }
+
+            _shards.reset(new Shard[_shardCount]);
+            for (size_t i = 0; i < _shardCount; i++)
+            {
+                _shards[i].index.assign(cIndexSize, EMPTY);
+                _shards[i].entries.reserve(_shardCapacity);
+                _shards[i].wheel.resize(WHEEL_SLOTS);
+                _shards[i].wheelTime = cStartTime + 1;
+            }
+        }
+
+        /**
+         * @brief Adds a flow, or replaces the value and expiry of an existing one.
+         * @param cKey The key of the packet; a new flow takes its direction as the original one.
+         * @param cValue The value.
+         * @param cExpiry The absolute expiry time in ticks.
+         * @return `true` if the flow is in the table, `false` if the shard of the key is full.
+         */
+        bool Insert(const Key &cKey, const Value &cValue, const uint64_t &cExpiry)
+        {
+            const Key cNormalized = cKey.Normalized();
+            const uint64_t cHash = cNormalized.Hash();
+            Shard &shard = _shards[cHash & (_shardCount - 1)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return InsertLocked(shard, cNormalized, cHash, cNormalized != cKey, cValue, cExpiry);
+        }
+
+        /**
+         * @brief Adds or replaces a batch of flows with the same expiry.
+         * @param cKeys The keys.
+         * @param cValues The values, cValues[i] for cKeys[i].
+         * @param cCount The number of flows.
+         * @param cExpiry The absolute expiry time in ticks.
+         * @param inserted Receives `true` for every flow that is in the table, `false` for every one dropped.
+         * @return The number of flows in the table.
+         * @throws std::invalid_argument If an array is null.
+         */
+        size_t InsertBatch(const Key *cKeys, const Value *cValues, const size_t &cCount, const uint64_t &cExpiry, bool *inserted)
+        {
+            if (!cValues || !inserted)
+            {
+                throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+            }
+            return ForEach(cKeys, cCount, [&](Shard &shard, const Key &cNormalized, const uint64_t &cHash, const bool &cReversed, const size_t &cI)
+                           { return inserted[cI] = InsertLocked(shard, cNormalized, cHash, cReversed, cValues[cI], cExpiry); });
+        }
+
+        /**
+         * @brief Looks up the flow of a key.
+         * @param cKey The key of the packet.
+         * @param value Receives the value, if the flow exists.
+         * @return The direction of the key relative to the flow, Match::NONE if there is no flow.
+         */
+        Match Lookup(const Key &cKey, Value &value) const
+        {
+            const Key cNormalized = cKey.Normalized();
+            const uint64_t cHash = cNormalized.Hash();
+            Shard &shard = _shards[cHash & (_shardCount - 1)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return LookupLocked(shard, cNormalized, cHash, cNormalized != cKey, value, 0);
+        }
+
+        /**
+         * @brief Looks up the flow of a key and extends its expiry, as on every packet of a live connection.
+         * @param cKey The key of the packet.
+         * @param value Receives the value, if the flow exists.
+         * @param cExpiry The new absolute expiry time in ticks; an expiry already later is kept.
+         * @return The direction of the key relative to the flow, Match::NONE if there is no flow.
+         */
+        Match Lookup(const Key &cKey, Value &value, const uint64_t &cExpiry)
+        {
+            const Key cNormalized = cKey.Normalized();
+            const uint64_t cHash = cNormalized.Hash();
+            Shard &shard = _shards[cHash & (_shardCount - 1)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return LookupLocked(shard, cNormalized, cHash, cNormalized != cKey, value, cExpiry);
+        }
+
+        /**
+         * @brief Looks up the flows of a batch of keys.
+         * @param cKeys The keys.
+         * @param cCount The number of keys.
+         * @param values Receives the value of every key with a flow.
+         * @param matches Receives the direction of every key, Match::NONE for keys without a flow.
+         * @return The number of keys with a flow.
+         * @throws std::invalid_argument If an array is null.
+         */
+        size_t LookupBatch(const Key *cKeys, const size_t &cCount, Value *values, Match *matches) const
+        {
+            return FindBatch(cKeys, cCount, values, matches, 0);
+        }
+
+        /**
+         * @brief Looks up the flows of a batch of keys and extends their expiry.
+         * @param cKeys The keys.
+         * @param cCount The number of keys.
+         * @param cExpiry The new absolute expiry time in ticks; an expiry already later is kept.
+         * @param values Receives the value of every key with a flow.
+         * @param matches Receives the direction of every key, Match::NONE for keys without a flow.
+         * @return The number of keys with a flow.
+         * @throws std::invalid_argument If an array is null.
+         */
+        size_t LookupBatch(const Key *cKeys, const size_t &cCount, const uint64_t &cExpiry, Value *values, Match *matches)
+        {
+            return FindBatch(cKeys, cCount, values, matches, cExpiry);
+        }
+
+        /**
+         * @brief Removes the flow of a key.
+         * @param cKey The key of a packet of either direction.
+         * @return `true` if a flow was removed, `false` if there was none.
+         */
+        bool Remove(const Key &cKey)
+        {
+            const Key cNormalized = cKey.Normalized();
+            const uint64_t cHash = cNormalized.Hash();
+            Shard &shard = _shards[cHash & (_shardCount - 1)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            const size_t cPosition = Probe(shard, cNormalized, cHash);
+            if (shard.index[cPosition] == EMPTY)
+            {
+                return false;
+            }
+            RemoveAt(shard, cPosition);
+            return true;
+        }
+
+        /**
+         * @brief Advances the time and removes all flows whose expiry is at or before it.
+         * @param cNow The new current time in ticks.
+         * @param expired The vector to append the removed flows to.
+         * @return The number of flows removed.
+         */
+        size_t Expire(const uint64_t &cNow, std::vector<Flow> &expired)
+        {
+            size_t expiredCount{};
+            for (size_t i = 0; i < _shardCount; i++)
+            {
+                Shard &shard = _shards[i];
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                if (cNow < shard.wheelTime)
+                {
+                    continue;
+                }
+                // Every queued tick lies within WHEEL_SLOTS ticks of the wheel time, so one turn covers any jump.
+                if (cNow - shard.wheelTime >= WHEEL_SLOTS)
+                {
+                    shard.wheelTime = cNow - WHEEL_SLOTS + 1;
+                }
+                while (shard.wheelTime <= cNow)
+                {
+                    const uint64_t cTick = shard.wheelTime++;
+                    shard.firing.clear();
+                    shard.firing.swap(shard.wheel[cTick & (WHEEL_SLOTS - 1)]);
+                    expiredCount += Fire(shard, cTick, cNow, expired);
+                }
+            }
+            return expiredCount;
+        }
+
+        /**
+         * @brief Returns the shard of a key, e.g. to hand the key to the thread serving that shard.
+         * @param cKey The key of a packet of either direction.
+         * @return The shard number, below the number of shards.
+         */
+        size_t ShardOf(const Key &cKey) const { return cKey.Normalized().Hash() & (_shardCount - 1); }
+
+        /**
+         * @brief Returns the number of shards.
+         * @return The number of shards, a power of two.
+         */
+        size_t ShardCount() const { return _shardCount; }
+
+        /**
+         * @brief Returns the number of flows.
+         * @return The number of flows.
+         */
+        size_t Size() const
+        {
+            size_t size{};
+            for (size_t i = 0; i < _shardCount; i++)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i].mutex);
+                size += _shards[i].entries.size() - _shards[i].freeSlots.size();
+            }
+            return size;
+        }
+
+        /**
+         * @brief Returns the maximum number of flows.
+         * @return The capacity of all shards.
+         */
+        size_t Capacity() const { return _shardCount * _shardCapacity; }
+
+        /**
+         * @brief Returns the memory taken by the table: entries, indexes, free lists and wheel slots.
+         * @return The size in bytes.
+         */
+        size_t MemoryBytes() const
+        {
+            size_t bytes{sizeof(*this)};
+            for (size_t i = 0; i < _shardCount; i++)
+            {
+                const Shard &cShard = _shards[i];
+                std::lock_guard<std::mutex> lock(cShard.mutex);
+                bytes += sizeof(Shard) + cShard.index.capacity() * sizeof(uint64_t) + cShard.entries.capacity() * sizeof(Entry) +
+                         (cShard.freeSlots.capacity() + cShard.firing.capacity()) * sizeof(uint32_t) + cShard.wheel.capacity() * sizeof(std::vector<uint32_t>);
+                for (const std::vector<uint32_t> &cSlot : cShard.wheel)
+                {
+                    bytes += cSlot.capacity() * sizeof(uint32_t);
+                }
+            }
+            return bytes;
+        }
+
+    private:
+        /**
+         * @brief Marker of an empty index entry.
+         */
+        static constexpr uint64_t EMPTY = UINT64_MAX;
+
+        /**
+         * @brief Smallest index size per shard (power of two).
+         */
+        static constexpr size_t MIN_INDEX_SIZE = 16;
+
+        /**
+         * @brief Number of wheel slots per shard (power of two): the ticks one turn of the wheel covers.
+         */
+        static constexpr uint64_t WHEEL_SLOTS = 4096;
+
+        /**
+         * @brief How many queued flows ahead Expire() prefetches the entry of.
+         */
+        static constexpr size_t EXPIRE_PREFETCH_DISTANCE = 8;
+
+        /**
+         * @struct Entry
+         * @brief A flow: its normalised key, value, latest expiry, queued tick (0 if free) and original direction.
+         */
+        struct Entry
+        {
+            Key key{};
+            Value value{};
+            uint64_t expiry{};
+            uint64_t due{};
+            bool reversed{};
+        };
+
+        /**
+         * @brief A lock and the flows it guards, aligned to avoid false sharing between shards.
+         */
+        struct alignas(64) Shard
+        {
+            mutable std::mutex mutex{};
+            std::vector<uint64_t> index{};
+            std::vector<Entry> entries{};
+            std::vector<uint32_t> freeSlots{};
+            std::vector<std::vector<uint32_t>> wheel{};
+            uint64_t wheelTime{};
+            std::vector<uint32_t> firing{};
+        };
+
+        /**
+         * @brief Number of shards, a power of two.
+         */
+        size_t _shardCount{};
+
+        /**
+         * @brief Maximum number of flows per shard.
+         */
+        size_t _shardCapacity{};
+
+        /**
+         * @brief log2 of the index size of a shard.
+         */
+        uint8_t _indexBits{};
+
+        /**
+         * @brief The shards.
+         */
+        std::unique_ptr<Shard[]> _shards{};
+
+        /**
+         * @brief Rounds up to a power of two.
+         */
+        static size_t RoundUpToPowerOfTwo(const size_t &cValue)
+        {
+            size_t power{1};
+            while (power < cValue)
+            {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        /**
+         * @brief Returns the tag of a hash; the shard is taken from the low bits.
+         */
+        static uint32_t TagOf(const uint64_t &cHash) { return static_cast<uint32_t>(cHash >> 32); }
+
+        /**
+         * @brief Returns the home position of a tag in a shard index.
+         */
+        size_t HomeOf(const uint32_t &cTag) const { return cTag >> (32 - _indexBits); }
+
+        /**
+         * @brief Finds the index position holding a normalised key, or the empty position where it would be inserted.
+         * @param cShard The locked shard.
+         * @param cKey The normalised key.
+         * @param cHash The hash of the key.
+         * @return The position in the shard index.
+         */
+        size_t Probe(const Shard &cShard, const Key &cKey, const uint64_t &cHash) const
+        {
+            const uint32_t cTag = TagOf(cHash);
+            const size_t cMask = cShard.index.size() - 1;
+            size_t position = HomeOf(cTag);
+            while (true)
+            {
+                const uint64_t cEntry = cShard.index[position];
+                if (cEntry == EMPTY || (static_cast<uint32_t>(cEntry >> 32) == cTag && cShard.entries[static_cast<uint32_t>(cEntry)].key == cKey))
+                {
+                    return position;
+                }
+                position = (position + 1) & cMask;
+            }
+        }
+
+        /**
+         * @brief Adds or replaces a flow in a locked shard.
+         * @return `true` if the flow is in the table, `false` if the shard is full.
+         */
+        bool InsertLocked(Shard &shard, const Key &cNormalized, const uint64_t &cHash, const bool &cReversed, const Value &cValue, const uint64_t &cExpiry)
+        {
+            const size_t cPosition = Probe(shard, cNormalized, cHash);
+            if (shard.index[cPosition] != EMPTY)
+            {
+                const uint32_t cSlot = static_cast<uint32_t>(shard.index[cPosition]);
+                Entry &entry = shard.entries[cSlot];
+                entry.value = cValue;
+                entry.expiry = cExpiry;
+                // A later expiry is picked up when the queued tick comes; an earlier one needs an earlier tick.
+                if (DueOf(shard, cExpiry) < entry.due)
+                {
+                    Queue(shard, cSlot);
+                }
+                return true;
+            }
+
+            uint32_t slot{};
+            if (!shard.freeSlots.empty())
+            {
+                slot = shard.freeSlots.back();
+                shard.freeSlots.pop_back();
+                shard.entries[slot] = Entry{cNormalized, cValue, cExpiry, 0, cReversed};
+            }
+            else if (shard.entries.size() < _shardCapacity)
+            {
+                slot = static_cast<uint32_t>(shard.entries.size());
+                shard.entries.push_back(Entry{cNormalized, cValue, cExpiry, 0, cReversed});
+            }
+            else
+            {
+                return false;
+            }
+            shard.index[cPosition] = static_cast<uint64_t>(TagOf(cHash)) << 32 | slot;
+            Queue(shard, slot);
+            return true;
+        }
+
+        /**
+         * @brief Looks up a flow in a locked shard and raises its expiry to at least cExpiry.
+         * @return The direction of the key relative to the flow, Match::NONE if there is no flow.
+         */
+        Match LookupLocked(Shard &shard, const Key &cNormalized, const uint64_t &cHash, const bool &cReversed, Value &value, const uint64_t &cExpiry) const
+        {
+            const uint64_t cEntry = shard.index[Probe(shard, cNormalized, cHash)];
+            if (cEntry == EMPTY)
+            {
+                return Match::NONE;
+            }
+            Entry &entry = shard.entries[static_cast<uint32_t>(cEntry)];
+            value = entry.value;
+            if (entry.expiry < cExpiry)
+            {
+                entry.expiry = cExpiry;
+            }
+            return entry.reversed == cReversed ? Match::ORIGINAL : Match::REPLY;
+        }
+
+        /**
+         * @brief Looks up a batch of keys, raising the expiry of found flows to at least cExpiry (0 keeps it).
+         */
+        size_t FindBatch(const Key *cKeys, const size_t &cCount, Value *values, Match *matches, const uint64_t &cExpiry) const
+        {
+            if (!values || !matches)
+            {
+                throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+            }
+            return ForEach(cKeys, cCount, [&](Shard &shard, const Key &cNormalized, const uint64_t &cHash, const bool &cReversed, const size_t &cI)
+                           { return (matches[cI] = LookupLocked(shard, cNormalized, cHash, cReversed, values[cI], cExpiry)) != Match::NONE; });
+        }
+
+        /**
+         * @brief Runs an operation on every key of a batch with the key's shard locked.
+         *
+         * Each group of BATCH keys is normalised and hashed and the index line of every key is
+         * prefetched before the first of them is processed. The lock of a shard is kept while
+         * consecutive keys belong to it.
+         *
+         * @param cKeys The keys.
+         * @param cCount The number of keys.
+         * @param operation Called as operation(shard, normalised key, hash, reversed, i); returns whether to count key i.
+         * @return The number of keys counted.
+         * @throws std::invalid_argument If the keys are null.
+         */
+        template <typename Operation>
+        size_t ForEach(const Key *cKeys, const size_t &cCount, Operation operation) const
+        {
+            if (!cKeys)
+            {
+                throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+            }
+
+            Key normalized[BATCH];
+            uint64_t hashes[BATCH];
+            std::unique_lock<std::mutex> lock;
+            const Shard *locked{};
+            size_t count{};
+            for (size_t start = 0; start < cCount; start += BATCH)
+            {
+                const size_t cChunk = (cCount - start < BATCH) ? cCount - start : BATCH;
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    normalized[i] = cKeys[start + i].Normalized();
+                    hashes[i] = normalized[i].Hash();
+#if defined(__GNUC__)
+                    // The index never moves, so its address can be read without the lock.
+                    __builtin_prefetch(&_shards[hashes[i] & (_shardCount - 1)].index[HomeOf(TagOf(hashes[i]))]);
+#endif
+                }
+                for (size_t i = 0; i < cChunk; i++)
+                {
+                    Shard &shard = _shards[hashes[i] & (_shardCount - 1)];
+                    if (&shard != locked)
+                    {
+                        lock = std::unique_lock<std::mutex>(shard.mutex);
+                        locked = &shard;
+                    }
+                    count += operation(shard, normalized[i], hashes[i], normalized[i] != cKeys[start + i], start + i);
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns the tick a flow expiring at cExpiry is queued for: not before the next tick
+         *        to process and not beyond the last one the wheel holds.
+         */
+        static uint64_t DueOf(const Shard &cShard, const uint64_t &cExpiry)
+        {
+            if (cExpiry < cShard.wheelTime)
+            {
+                return cShard.wheelTime;
+            }
+            return cExpiry - cShard.wheelTime < WHEEL_SLOTS ? cExpiry : cShard.wheelTime + WHEEL_SLOTS - 1;
+        }
+
+        /**
+         * @brief Queues the flow of an entry for the tick of its expiry.
+         * @param shard The locked shard.
+         * @param cSlot The entry.
+         */
+        static void Queue(Shard &shard, const uint32_t &cSlot)
+        {
+            Entry &entry = shard.entries[cSlot];
+            entry.due = DueOf(shard, entry.expiry);
+            shard.wheel[entry.due & (WHEEL_SLOTS - 1)].push_back(cSlot);
+        }
+
+        /**
+         * @brief Processes the flows queued for a tick, held in shard.firing.
+         * @param shard The locked shard, its wheel time already past the tick.
+         * @param cTick The tick.
+         * @param cNow The current time in ticks.
+         * @param expired The vector to append the removed flows to.
+         * @return The number of flows removed.
+         */
+        size_t Fire(Shard &shard, const uint64_t &cTick, const uint64_t &cNow, std::vector<Flow> &expired)
+        {
+            size_t expiredCount{};
+            const size_t cQueued = shard.firing.size();
+            for (size_t i = 0; i < cQueued; i++)
+            {
+#if defined(__GNUC__)
+                if (i + EXPIRE_PREFETCH_DISTANCE < cQueued)
+                {
+                    __builtin_prefetch(&shard.entries[shard.firing[i + EXPIRE_PREFETCH_DISTANCE]]);
+                }
+#endif
+                const uint32_t cSlot = shard.firing[i];
+                const Entry &cEntry = shard.entries[cSlot];
+                // Skip copies left behind by removed flows and by flows queued again for another tick;
+                // after a jump of a whole turn the tick may be a later one in the same slot.
+                if (!cEntry.due || cEntry.due > cTick || ((cEntry.due ^ cTick) & (WHEEL_SLOTS - 1)))
+                {
+                    continue;
+                }
+                if (cEntry.expiry > cNow)
+                {
+                    // Refreshed since it was queued.
+                    Queue(shard, cSlot);
+                    continue;
+                }
+                expired.push_back(Flow{cEntry.reversed ? cEntry.key.Reversed() : cEntry.key, cEntry.value, cEntry.expiry});
+                RemoveAt(shard, Probe(shard, cEntry.key, cEntry.key.Hash()));
+                expiredCount++;
+            }
+            return expiredCount;
+        }
+
+        /**
+         * @brief Removes the flow at an index position of a locked shard, shifting the following entries back.
+         * @param shard The locked shard.
+         * @param cPosition The position of the flow.
+         */
+        void RemoveAt(Shard &shard, const size_t &cPosition)
+        {
+            const uint32_t cSlot = static_cast<uint32_t>(shard.index[cPosition]);
+            shard.entries[cSlot].due = 0;
+            shard.freeSlots.push_back(cSlot);
+
+            const size_t cMask = shard.index.size() - 1;
+            size_t hole = cPosition;
+            size_t next = (cPosition + 1) & cMask;
+            while (shard.index[next] != EMPTY)
+            {
+                const size_t cHome = HomeOf(static_cast<uint32_t>(shard.index[next] >> 32));
+                // Move the entry back unless its home lies cyclically in (hole, next].
+                if (((next - cHome) & cMask) >= ((next - hole) & cMask))
+                {
+                    shard.index[hole] = shard.index[next];
+                    hole = next;
+                }
+                next = (next + 1) & cMask;
+            }
+            shard.index[hole] = EMPTY;
+        }
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::ConnTrackTable] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a capacity of zero or too large for a shard.
+         */
+        static constexpr char INVALID_CAPACITY[]{"[EthernetParameter::ConnTrackTable] Capacity must be non-zero and below 2^31 flows per shard!"};
+    }; /* class ConnTrackTable */
+}
+
+#endif /* CONNTRACKTABLE_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,232 @@
+/**
+ * @file FlowKey.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief FlowKey (packed IPv4/IPv6 5-tuple with direction normalisation) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef FLOWKEY_H
+#define FLOWKEY_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace EthernetParameter
+{
+    /**
+     * @class FlowKey
+     * @brief A 5-tuple (addresses, ports and protocol) packed into 64-bit words without padding.
+     *
+     * An IPv4 key is two words (16 bytes) and an IPv6 key five (40 bytes): the addresses come
+     * first and the last word holds the source port, destination port and protocol. Every byte is
+     * defined, so comparing and hashing keys works on whole words, and the words are in the order
+     * a key is compared in.
+     *
+     * Both directions of a connection have the same normalised key, the one whose source endpoint
+     * (address, then port) is not greater than its destination endpoint, so a table keyed by
+     * normalised keys finds a flow from packets of either direction.
+     *
+     * @tparam Address IPv4Address or IPv6Address.
+     */
+    template <typename Address>
+    class FlowKey
+    {
+        static_assert(std::is_same<Address, IPv4Address>::value || std::is_same<Address, IPv6Address>::value, "Addresses must be IPv4Address or IPv6Address");
+
+    public:
+        /**
+         * @brief Number of 64-bit words of a key.
+         */
+        static constexpr size_t WORDS = std::is_same<Address, IPv4Address>::value ? 2 : 5;
+
+        /**
+         * @brief Default constructor. Creates the all-zero key.
+         */
+        constexpr FlowKey() = default;
+
+        /**
+         * @brief Constructor for the FlowKey class.
+         * @param cSource The source address.
+         * @param cDestination The destination address.
+         * @param cSourcePort The source port, 0 for protocols without ports.
+         * @param cDestinationPort The destination port, 0 for protocols without ports.
+         * @param cProtocol The IP protocol number (e.g. 6 for TCP, 17 for UDP).
+         */
+        FlowKey(const Address &cSource, const Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort, const uint8_t &cProtocol)
+        {
+            Store(cSource, cDestination);
+            _words[WORDS - 1] = static_cast<uint64_t>(cSourcePort) << 48 | static_cast<uint64_t>(cDestinationPort) << 32 | cProtocol;
+        }
+
+        /**
+         * @brief Returns the source address.
+         * @return The source address.
+         */
+        Address GetSource() const { return Load(0); }
+
+        /**
+         * @brief Returns the destination address.
+         * @return The destination address.
+         */
+        Address GetDestination() const { return Load(1); }
+
+        /**
+         * @brief Returns the source port.
+         * @return The source port.
+         */
+        uint16_t GetSourcePort() const { return static_cast<uint16_t>(_words[WORDS - 1] >> 48); }
+
+        /**
+         * @brief Returns the destination port.
+         * @return The destination port.
+         */
+        uint16_t GetDestinationPort() const { return static_cast<uint16_t>(_words[WORDS - 1] >> 32); }
+
+        /**
+         * @brief Returns the IP protocol number.
+         * @return The protocol.
+         */
+        uint8_t GetProtocol() const { return static_cast<uint8_t>(_words[WORDS - 1]); }
+
+        /**
+         * @brief Returns the key of the opposite direction: the endpoints swapped.
+         * @return The reversed key.
+         */
+        FlowKey Reversed() const { return FlowKey(GetDestination(), GetSource(), GetDestinationPort(), GetSourcePort(), GetProtocol()); }
+
+        /**
+         * @brief Checks whether the source endpoint is not greater than the destination endpoint.
+         * @return `true` if the key is its own normalised key, `false` otherwise.
+         */
+        bool IsNormalized() const
+        {
+            const uint64_t cPorts = _words[WORDS - 1] >> 32;
+            if constexpr (WORDS == 2)
+            {
+                const uint32_t cSource = static_cast<uint32_t>(_words[0] >> 32);
+                const uint32_t cDestination = static_cast<uint32_t>(_words[0]);
+                return cSource != cDestination ? cSource < cDestination : (cPorts >> 16) <= (cPorts & 0xFFFF);
+            }
+            else
+            {
+                if (_words[0] != _words[2])
+                {
+                    return _words[0] < _words[2];
+                }
+                if (_words[1] != _words[3])
+                {
+                    return _words[1] < _words[3];
+                }
+                return (cPorts >> 16) <= (cPorts & 0xFFFF);
+            }
+        }
+
+        /**
+         * @brief Returns the normalised key, the same for both directions of a connection.
+         * @return The key itself or its reverse.
+         */
+        FlowKey Normalized() const { return IsNormalized() ? *this : Reversed(); }
+
+        /**
+         * @brief Returns a 64-bit hash of the key, mixing every word so all bits affect the result.
+         * @return The hash.
+         */
+        uint64_t Hash() const
+        {
+            uint64_t hash{0x9E3779B97F4A7C15ull};
+            for (size_t i = 0; i < WORDS; i++)
+            {
+                hash = (hash ^ _words[i]) * 0xFF51AFD7ED558CCDull;
+                hash ^= hash >> 32;
+            }
+            // Finalizer of MurmurHash3.
+            hash = (hash ^ hash >> 33) * 0xC4CEB9FE1A85EC53ull;
+            return hash ^ hash >> 33;
+        }
+
+        /**
+         * @brief Equality operator.
+         * @param cKey The key to compare with.
+         * @return `true` if all fields are equal, `false` otherwise.
+         */
+        bool operator==(const FlowKey &cKey) const
+        {
+            uint64_t difference{};
+            for (size_t i = 0; i < WORDS; i++)
+            {
+                difference |= _words[i] ^ cKey._words[i];
+            }
+            return difference == 0;
+        }
+
+        /**
+         * @brief Inequality operator.
+         * @param cKey The key to compare with.
+         * @return `true` if any field differs, `false` otherwise.
+         */
+        bool operator!=(const FlowKey &cKey) const { return !(*this == cKey); }
+
+    private:
+        /**
+         * @brief The addresses, then the ports and protocol.
+         */
+        uint64_t _words[WORDS]{};
+
+        /**
+         * @brief Packs the addresses into the leading words.
+         */
+        void Store(const IPv4Address &cSource, const IPv4Address &cDestination)
+        {
+            _words[0] = static_cast<uint64_t>(cSource.ToUint32()) << 32 | cDestination.ToUint32();
+        }
+        void Store(const IPv6Address &cSource, const IPv6Address &cDestination)
+        {
+            _words[0] = cSource.GetUpper64();
+            _words[1] = cSource.GetLower64();
+            _words[2] = cDestination.GetUpper64();
+            _words[3] = cDestination.GetLower64();
+        }
+
+        /**
+         * @brief Unpacks the source (0) or destination (1) address.
+         */
+        Address Load(const size_t &cIndex) const
+        {
+            if constexpr (WORDS == 2)
+            {
+                return IPv4Address::FromUint32(static_cast<uint32_t>(_words[0] >> (cIndex ? 0 : 32)));
+            }
+            else
+            {
+                return IPv6Address::FromUint64(_words[2 * cIndex], _words[2 * cIndex + 1]);
+            }
+        }
+    }; /* class FlowKey */
+
+    /**
+     * @brief An IPv4 5-tuple, 16 bytes.
+     */
+    using IPv4FlowKey = FlowKey<IPv4Address>;
+
+    /**
+     * @brief An IPv6 5-tuple, 40 bytes.
+     */
+    using IPv6FlowKey = FlowKey<IPv6Address>;
+
+    static_assert(sizeof(IPv4FlowKey) == 16, "IPv4 flow keys must be packed");
+    static_assert(sizeof(IPv6FlowKey) == 40, "IPv6 flow keys must be packed");
+}
+
+#endif /* FLOWKEY_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
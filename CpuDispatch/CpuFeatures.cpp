@@ -0,0 +1,213 @@
+/**
+ * @file CpuFeatures.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CpuFeatures class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "CpuFeatures.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief The names of the tiers, indexed by tier.
+         */
+        constexpr const char *TIER_NAMES[CpuFeatures::TIER_COUNT]{"scalar", "sse2", "sse4.2", "avx2", "avx512"};
+
+        /**
+         * @brief Detects the best tier with the CPUID instruction.
+         * @return The tier; SCALAR on other architectures.
+         */
+        CpuFeatures::Tier Detect()
+        {
+            using Tier = CpuFeatures::Tier;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            // The builtins also check that the operating system saves the AVX and AVX-512 registers.
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl"))
+            {
+                return Tier::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return Tier::AVX2;
+            }
+            if (__builtin_cpu_supports("sse4.2"))
+            {
+                return Tier::SSE4_2;
+            }
+            return __builtin_cpu_supports("sse2") ? Tier::SSE2 : Tier::SCALAR;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4]{};
+            __cpuid(info, 0);
+            const int cMaxLeaf = info[0];
+            __cpuid(info, 1);
+            const bool cSse2 = (info[3] & (1 << 26)) != 0;
+            const bool cSse42 = (info[2] & (1 << 20)) != 0;
+            const bool cOsSaves = (info[2] & (1 << 27)) != 0;
+            const uint64_t cSaved = cOsSaves ? _xgetbv(0) : 0;
+            int extended[4]{};
+            if (cMaxLeaf >= 7)
+            {
+                __cpuidex(extended, 7, 0);
+            }
+            // XMM and YMM state (bits 1, 2), plus opmask and ZMM state (bits 5 to 7) for AVX-512.
+            const bool cAvx2 = (info[2] & (1 << 28)) != 0 && (extended[1] & (1 << 5)) != 0 && (cSaved & 0x6) == 0x6;
+            const bool cAvx512 = cAvx2 && (extended[1] & (1 << 16)) != 0 && (extended[1] & (1 << 30)) != 0 && (extended[1] & (1 << 31)) != 0 && (cSaved & 0xE6) == 0xE6;
+            if (cAvx512)
+            {
+                return Tier::AVX512;
+            }
+            if (cAvx2)
+            {
+                return Tier::AVX2;
+            }
+            if (cSse42)
+            {
+                return Tier::SSE4_2;
+            }
+            return cSse2 ? Tier::SSE2 : Tier::SCALAR;
+#else
+            return Tier::SCALAR;
+#endif
+        }
+
+        /**
+         * @brief Detects AES-NI with the CPUID instruction.
+         * @return `true` if the CPU has AES-NI; `false` on other architectures.
+         */
+        bool DetectAes()
+        {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("aes");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4]{};
+            __cpuid(info, 1);
+            return (info[2] & (1 << 25)) != 0;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Compares two strings ignoring ASCII letter case.
+         */
+        bool EqualIgnoringCase(const char *cLeft, const char *cRight)
+        {
+            for (; *cLeft && *cRight; cLeft++, cRight++)
+            {
+                if (std::tolower(static_cast<unsigned char>(*cLeft)) != std::tolower(static_cast<unsigned char>(*cRight)))
+                {
+                    return false;
+                }
+            }
+            return *cLeft == *cRight;
+        }
+    }
+
+    /**
+     * @brief Returns the best tier the CPU and the operating system support.
+     * @return The detected tier, computed on the first call.
+     */
+    CpuFeatures::Tier CpuFeatures::Detected()
+    {
+        static const Tier cDetected = Detect();
+        return cDetected;
+    } /* CpuFeatures::Tier CpuFeatures::Detected() */
+
+    /**
+     * @brief Returns the tier the kernels use.
+     * @return The detected tier, capped by the environment variable; computed on the first call.
+     */
+    CpuFeatures::Tier CpuFeatures::Selected()
+    {
+        static const Tier cSelected = Select(Detected(), std::getenv(ENVIRONMENT_VARIABLE));
+        return cSelected;
+    } /* CpuFeatures::Tier CpuFeatures::Selected() */
+
+    /**
+     * @brief Returns the name of a tier, as accepted in the environment variable.
+     * @param cTier The tier.
+     * @return "scalar", "sse2", "sse4.2", "avx2" or "avx512".
+     */
+    const char *CpuFeatures::Name(const Tier &cTier)
+    {
+        return static_cast<uint8_t>(cTier) < TIER_COUNT ? TIER_NAMES[static_cast<uint8_t>(cTier)] : "unknown";
+    } /* const char *CpuFeatures::Name(const Tier &cTier) */
+
+    /**
+     * @brief Parses the name of a tier, ignoring letter case.
+     * @param cName The name, as returned by Name().
+     * @return The tier.
+     * @throw std::invalid_argument If the pointer is null or the name is unknown.
+     */
+    CpuFeatures::Tier CpuFeatures::Parse(const char *cName)
+    {
+        if (!cName)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        for (uint8_t tier = 0; tier < TIER_COUNT; tier++)
+        {
+            if (EqualIgnoringCase(cName, TIER_NAMES[tier]))
+            {
+                return static_cast<Tier>(tier);
+            }
+        }
+        throw std::invalid_argument(UNKNOWN_TIER);
+    } /* CpuFeatures::Tier CpuFeatures::Parse(const char *cName) */
+
+    /**
+     * @brief Returns the tier the kernels use for a detected tier and an override.
+     * @param cDetected The detected tier.
+     * @param cOverride The value of the environment variable, nullptr if it is not set.
+     * @return The lower of the detected and the requested tier; the detected tier if the override is unknown.
+     */
+    CpuFeatures::Tier CpuFeatures::Select(const Tier &cDetected, const char *cOverride)
+    {
+        if (!cOverride || !*cOverride)
+        {
+            return cDetected;
+        }
+        try
+        {
+            const Tier cRequested = Parse(cOverride);
+            return cRequested < cDetected ? cRequested : cDetected;
+        }
+        catch (const std::invalid_argument &)
+        {
+            // Selected() runs on the first kernel call, where a typo must not become an exception.
+            return cDetected;
+        }
+    } /* CpuFeatures::Tier CpuFeatures::Select(const Tier &cDetected, const char *cOverride) */
+
+    /**
+     * @brief Returns whether the AES-NI kernels may run.
+     * @return `true` if the CPU has AES-NI and the selected tier is SSE4_2 or higher, `false` otherwise.
+     */
+    bool CpuFeatures::HasAes()
+    {
+        static const bool cAes = DetectAes() && Selected() >= Tier::SSE4_2;
+        return cAes;
+    } /* bool CpuFeatures::HasAes() */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
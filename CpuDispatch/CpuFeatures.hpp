@@ -0,0 +1,119 @@
+/**
+ * @file CpuFeatures.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief CpuFeatures (runtime selection of the SIMD tier of the kernels) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class CpuFeatures
+     * @brief Detects the instruction sets of the CPU once and picks the SIMD tier of the kernels.
+     *
+     * Kernels with several implementations compile each one for its own instruction set and keep
+     * them in a table of function pointers indexed by Tier. The first call of a kernel takes the
+     * entry of Selected(), which is the best tier the CPU and the operating system support,
+     * lowered by the ETHERNET_PARAMETER_SIMD environment variable if it is set (e.g. to "sse2"
+     * or "scalar"), so every tier can be tested on one machine. A tier is never raised above
+     * what the CPU supports.
+     */
+    class CpuFeatures
+    {
+    public:
+        /**
+         * @brief The SIMD tiers, each including the ones before it.
+         */
+        enum class Tier : uint8_t
+        {
+            SCALAR,
+            SSE2,
+            SSE4_2,
+            AVX2,
+            AVX512
+        };
+
+        /**
+         * @brief Number of tiers, the size of a kernel table.
+         */
+        static constexpr uint8_t TIER_COUNT = 5;
+
+        /**
+         * @brief Name of the environment variable that caps the selected tier.
+         */
+        static constexpr char ENVIRONMENT_VARIABLE[]{"ETHERNET_PARAMETER_SIMD"};
+
+        /**
+         * @brief Returns the best tier the CPU and the operating system support.
+         * @return The detected tier, computed on the first call.
+         */
+        static Tier Detected();
+
+        /**
+         * @brief Returns the tier the kernels use.
+         * @return The detected tier, capped by the environment variable; computed on the first call.
+         */
+        static Tier Selected();
+
+        /**
+         * @brief Returns the name of a tier, as accepted in the environment variable.
+         * @param cTier The tier.
+         * @return "scalar", "sse2", "sse4.2", "avx2" or "avx512".
+         */
+        static const char *Name(const Tier &cTier);
+
+        /**
+         * @brief Parses the name of a tier, ignoring letter case.
+         * @param cName The name, as returned by Name().
+         * @return The tier.
+         * @throws std::invalid_argument If the pointer is null or the name is unknown.
+         */
+        static Tier Parse(const char *cName);
+
+        /**
+         * @brief Returns the tier the kernels use for a detected tier and an override.
+         * @param cDetected The detected tier.
+         * @param cOverride The value of the environment variable, nullptr if it is not set.
+         * @return The lower of the detected and the requested tier; the detected tier if the override is unknown.
+         */
+        static Tier Select(const Tier &cDetected, const char *cOverride);
+
+        /**
+         * @brief Returns whether the AES-NI kernels may run.
+         *
+         * AES-NI is not a tier of its own. It arrived with the SSE4.2 generation, so it is used when
+         * the CPU has it and Selected() is SSE4_2 or higher; ETHERNET_PARAMETER_SIMD set to "sse2"
+         * or "scalar" turns it off.
+         *
+         * @return `true` if AES-NI may be used, `false` otherwise; computed on the first call.
+         */
+        static bool HasAes();
+
+    private:
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::CpuFeatures] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating an unknown tier name.
+         */
+        static constexpr char UNKNOWN_TIER[]{"[EthernetParameter::CpuFeatures] Unknown SIMD tier!"};
+    }; /* class CpuFeatures */
+}
+
+#endif /* CPUFEATURES_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,148 @@
+/**
+ * @file JumpHash.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief JumpHash (jump consistent hash of client addresses) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "JumpHash.hpp"
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Finalizer of MurmurHash3: every input bit affects every output bit.
+         * @param value The value.
+         * @return The mixed value.
+         */
+        constexpr uint64_t Mix(uint64_t value)
+        {
+            value = (value ^ value >> 33) * 0xFF51AFD7ED558CCDull;
+            value = (value ^ value >> 33) * 0xC4CEB9FE1A85EC53ull;
+            return value ^ value >> 33;
+        }
+
+        /**
+         * @brief The jump loop, without the argument checks.
+         * @param key The key.
+         * @param cBuckets The number of buckets, not zero.
+         * @return The bucket.
+         */
+        uint32_t Jump(uint64_t key, const uint32_t &cBuckets)
+        {
+            int64_t bucket{-1};
+            int64_t next{};
+            while (next < cBuckets)
+            {
+                bucket = next;
+                key = key * 2862933555777941757ull + 1;
+                next = static_cast<int64_t>((bucket + 1) * (static_cast<double>(1ll << 31) / static_cast<double>((key >> 33) + 1)));
+            }
+            return static_cast<uint32_t>(bucket);
+        }
+    }
+
+    /**
+     * @brief Returns the bucket of a key.
+     * @param cKey The key, ideally already well mixed.
+     * @param cBuckets The number of buckets.
+     * @return The bucket, below cBuckets.
+     * @throw std::invalid_argument If there are no buckets.
+     */
+    uint32_t JumpHash::Bucket(const uint64_t &cKey, const uint32_t &cBuckets)
+    {
+        if (!cBuckets)
+        {
+            throw std::invalid_argument(NO_BUCKETS);
+        }
+        return Jump(cKey, cBuckets);
+    } /* uint32_t JumpHash::Bucket(const uint64_t &cKey, const uint32_t &cBuckets) */
+
+    /**
+     * @brief Returns the bucket of an IPv4 client.
+     * @param cAddress The client address.
+     * @param cBuckets The number of buckets.
+     * @param cSeed The seed of the address hash.
+     * @return The bucket, below cBuckets.
+     * @throw std::invalid_argument If there are no buckets.
+     */
+    uint32_t JumpHash::Bucket(const IPv4Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed)
+    {
+        return Bucket(Mix(cAddress.ToUint32() ^ cSeed), cBuckets);
+    } /* uint32_t JumpHash::Bucket(const IPv4Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed) */
+
+    /**
+     * @brief Returns the bucket of an IPv6 client.
+     * @param cAddress The client address.
+     * @param cBuckets The number of buckets.
+     * @param cSeed The seed of the address hash.
+     * @return The bucket, below cBuckets.
+     * @throw std::invalid_argument If there are no buckets.
+     */
+    uint32_t JumpHash::Bucket(const IPv6Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed)
+    {
+        return Bucket(Mix(Mix(cAddress.GetUpper64() ^ cSeed) ^ cAddress.GetLower64()), cBuckets);
+    } /* uint32_t JumpHash::Bucket(const IPv6Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed) */
+
+    /**
+     * @brief Returns the buckets of a batch of IPv4 clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param cBuckets The number of buckets.
+     * @param buckets Receives one bucket per address.
+     * @param cSeed The seed of the address hash.
+     * @throw std::invalid_argument If an array is null or there are no buckets.
+     */
+    void JumpHash::BucketBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed)
+    {
+        if (!cAddresses || !buckets)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (!cBuckets)
+        {
+            throw std::invalid_argument(NO_BUCKETS);
+        }
+        for (size_t i = 0; i < cCount; i++)
+        {
+            buckets[i] = Jump(Mix(cAddresses[i].ToUint32() ^ cSeed), cBuckets);
+        }
+    } /* void JumpHash::BucketBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed) */
+
+    /**
+     * @brief Returns the buckets of a batch of IPv6 clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param cBuckets The number of buckets.
+     * @param buckets Receives one bucket per address.
+     * @param cSeed The seed of the address hash.
+     * @throw std::invalid_argument If an array is null or there are no buckets.
+     */
+    void JumpHash::BucketBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed)
+    {
+        if (!cAddresses || !buckets)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (!cBuckets)
+        {
+            throw std::invalid_argument(NO_BUCKETS);
+        }
+        for (size_t i = 0; i < cCount; i++)
+        {
+            buckets[i] = Jump(Mix(Mix(cAddresses[i].GetUpper64() ^ cSeed) ^ cAddresses[i].GetLower64()), cBuckets);
+        }
+    } /* void JumpHash::BucketBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
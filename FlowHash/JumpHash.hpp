@@ -0,0 +1,103 @@
+/**
+ * @file JumpHash.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief JumpHash (jump consistent hash of client addresses) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef JUMPHASH_H
+#define JUMPHASH_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace EthernetParameter
+{
+    /**
+     * @class JumpHash
+     * @brief Jump consistent hash (Lamping and Veach): maps a key to one of n buckets with no table.
+     *
+     * Growing from n to n + 1 buckets moves only the keys that land in the new bucket, about
+     * 1 / (n + 1) of them. Unlike MaglevTable the buckets are numbered 0 to n - 1 and only the
+     * last one can be removed, so it suits backend pools that grow and shrink at the end, e.g.
+     * shards. A lookup takes about ln(n) steps and no memory access.
+     */
+    class JumpHash
+    {
+    public:
+        /**
+         * @brief Returns the bucket of a key.
+         * @param cKey The key, ideally already well mixed.
+         * @param cBuckets The number of buckets.
+         * @return The bucket, below cBuckets.
+         * @throws std::invalid_argument If there are no buckets.
+         */
+        static uint32_t Bucket(const uint64_t &cKey, const uint32_t &cBuckets);
+
+        /**
+         * @brief Returns the bucket of an IPv4 client.
+         * @param cAddress The client address.
+         * @param cBuckets The number of buckets.
+         * @param cSeed The seed of the address hash.
+         * @return The bucket, below cBuckets.
+         * @throws std::invalid_argument If there are no buckets.
+         */
+        static uint32_t Bucket(const IPv4Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed = 0);
+
+        /**
+         * @brief Returns the bucket of an IPv6 client.
+         * @param cAddress The client address.
+         * @param cBuckets The number of buckets.
+         * @param cSeed The seed of the address hash.
+         * @return The bucket, below cBuckets.
+         * @throws std::invalid_argument If there are no buckets.
+         */
+        static uint32_t Bucket(const IPv6Address &cAddress, const uint32_t &cBuckets, const uint64_t &cSeed = 0);
+
+        /**
+         * @brief Returns the buckets of a batch of IPv4 clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param cBuckets The number of buckets.
+         * @param buckets Receives one bucket per address.
+         * @param cSeed The seed of the address hash.
+         * @throws std::invalid_argument If an array is null or there are no buckets.
+         */
+        static void BucketBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed = 0);
+
+        /**
+         * @brief Returns the buckets of a batch of IPv6 clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param cBuckets The number of buckets.
+         * @param buckets Receives one bucket per address.
+         * @param cSeed The seed of the address hash.
+         * @throws std::invalid_argument If an array is null or there are no buckets.
+         */
+        static void BucketBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint32_t &cBuckets, uint32_t *buckets, const uint64_t &cSeed = 0);
+
+    private:
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::JumpHash] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating zero buckets.
+         */
+        static constexpr char NO_BUCKETS[]{"[EthernetParameter::JumpHash] Number of buckets must not be zero!"};
+    }; /* class JumpHash */
+}
+
+#endif /* JUMPHASH_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
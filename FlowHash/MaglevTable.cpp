@@ -0,0 +1,221 @@
+/**
+ * @file MaglevTable.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MaglevTable (consistent-hash load-balancer table keyed by client address) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "MaglevTable.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Returns whether a number is a prime.
+         * @param cValue The number.
+         * @return `true` for a prime.
+         */
+        bool IsPrime(const size_t &cValue)
+        {
+            if (cValue < 2)
+            {
+                return false;
+            }
+            for (size_t divisor = 2; divisor * divisor <= cValue; divisor++)
+            {
+                if (cValue % divisor == 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Orders backends by ID.
+         */
+        template <typename Backend>
+        bool ById(const Backend &cBackend, const uint32_t &cId)
+        {
+            return cBackend.id < cId;
+        }
+    }
+
+    /**
+     * @brief Constructor.
+     * @param cTableSize The number of slots, a prime larger than the number of backends and below 2^32.
+     * @param cSeed The seed of the address and backend hashes.
+     * @throw std::invalid_argument If the table size is not a prime below 2^32.
+     */
+    MaglevTable::MaglevTable(const size_t &cTableSize, const uint64_t &cSeed)
+        : _seed{cSeed}
+    {
+        if (cTableSize > UINT32_MAX || !IsPrime(cTableSize))
+        {
+            throw std::invalid_argument(SIZE_NOT_PRIME);
+        }
+        _entries.assign(cTableSize, NO_BACKEND);
+    } /* MaglevTable::MaglevTable(const size_t &cTableSize, const uint64_t &cSeed) */
+
+    /**
+     * @brief Adds a backend; it gets slots at the next Build().
+     * @param cId The backend ID, not NO_BACKEND.
+     * @return `false` if the backend was already added.
+     * @throw std::invalid_argument If the ID is NO_BACKEND.
+     */
+    bool MaglevTable::AddBackend(const uint32_t &cId)
+    {
+        if (cId == NO_BACKEND)
+        {
+            throw std::invalid_argument(INVALID_BACKEND);
+        }
+        const auto cPosition = std::lower_bound(_backends.begin(), _backends.end(), cId, ById<Backend>);
+        if (cPosition != _backends.end() && cPosition->id == cId)
+        {
+            return false;
+        }
+        // Two independent hashes of the ID: where the permutation starts and its stride.
+        const uint64_t cSize = _entries.size();
+        const uint64_t cOffset = Mix(cId ^ _seed ^ 0x5851F42D4C957F2Dull) % cSize;
+        const uint64_t cSkip = Mix(cId ^ _seed ^ 0x14057B7EF767814Full) % (cSize - 1) + 1;
+        _backends.insert(cPosition, Backend{cId, static_cast<uint32_t>(cOffset), static_cast<uint32_t>(cSkip)});
+        return true;
+    } /* bool MaglevTable::AddBackend(const uint32_t &cId) */
+
+    /**
+     * @brief Removes a backend; its slots move at the next Build().
+     * @param cId The backend ID.
+     * @return `false` if the backend was not added.
+     */
+    bool MaglevTable::RemoveBackend(const uint32_t &cId)
+    {
+        const auto cPosition = std::lower_bound(_backends.begin(), _backends.end(), cId, ById<Backend>);
+        if (cPosition == _backends.end() || cPosition->id != cId)
+        {
+            return false;
+        }
+        _backends.erase(cPosition);
+        return true;
+    } /* bool MaglevTable::RemoveBackend(const uint32_t &cId) */
+
+    /**
+     * @brief Fills the table from the current backends.
+     * @return The number of slots whose backend changed.
+     */
+    size_t MaglevTable::Build()
+    {
+        const size_t cSize = _entries.size();
+        std::vector<uint32_t> entries(cSize, NO_BACKEND);
+        if (!_backends.empty())
+        {
+            // Position of every backend in its permutation; the stride is added without a division.
+            std::vector<uint32_t> next(_backends.size());
+            for (size_t i = 0; i < _backends.size(); i++)
+            {
+                next[i] = _backends[i].offset;
+            }
+
+            size_t filled{};
+            while (filled < cSize)
+            {
+                for (size_t i = 0; i < _backends.size() && filled < cSize; i++)
+                {
+                    const size_t cSkip = _backends[i].skip;
+                    size_t slot = next[i];
+                    while (entries[slot] != NO_BACKEND)
+                    {
+                        slot += cSkip;
+                        slot -= slot >= cSize ? cSize : 0;
+                    }
+                    entries[slot] = _backends[i].id;
+                    slot += cSkip;
+                    next[i] = static_cast<uint32_t>(slot - (slot >= cSize ? cSize : 0));
+                    filled++;
+                }
+            }
+        }
+
+        size_t moved{};
+        for (size_t i = 0; i < cSize; i++)
+        {
+            moved += entries[i] != _entries[i];
+        }
+        _entries.swap(entries);
+        return moved;
+    } /* size_t MaglevTable::Build() */
+
+    /**
+     * @brief Returns the backends of a batch of IPv4 clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param backends Receives one backend ID per address.
+     * @throw std::invalid_argument If an array is null.
+     */
+    void MaglevTable::LookupBatch(const IPv4Address *cAddresses, const size_t &cCount, uint32_t *backends) const
+    {
+        if (!cAddresses || !backends)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        size_t slots[BATCH];
+        for (size_t start = 0; start < cCount; start += BATCH)
+        {
+            const size_t cChunk = (cCount - start < BATCH) ? cCount - start : BATCH;
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                slots[i] = Slot(Hash(cAddresses[start + i]));
+#if defined(__GNUC__)
+                __builtin_prefetch(&_entries[slots[i]]);
+#endif
+            }
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                backends[start + i] = _entries[slots[i]];
+            }
+        }
+    } /* void MaglevTable::LookupBatch(const IPv4Address *cAddresses, const size_t &cCount, uint32_t *backends) const */
+
+    /**
+     * @brief Returns the backends of a batch of IPv6 clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param backends Receives one backend ID per address.
+     * @throw std::invalid_argument If an array is null.
+     */
+    void MaglevTable::LookupBatch(const IPv6Address *cAddresses, const size_t &cCount, uint32_t *backends) const
+    {
+        if (!cAddresses || !backends)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        size_t slots[BATCH];
+        for (size_t start = 0; start < cCount; start += BATCH)
+        {
+            const size_t cChunk = (cCount - start < BATCH) ? cCount - start : BATCH;
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                slots[i] = Slot(Hash(cAddresses[start + i]));
+#if defined(__GNUC__)
+                __builtin_prefetch(&_entries[slots[i]]);
+#endif
+            }
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                backends[start + i] = _entries[slots[i]];
+            }
+        }
+    } /* void MaglevTable::LookupBatch(const IPv6Address *cAddresses, const size_t &cCount, uint32_t *backends) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,216 @@
+/**
+ * @file MaglevTable.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MaglevTable (consistent-hash load-balancer table keyed by client address) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef MAGLEVTABLE_H
+#define MAGLEVTABLE_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class MaglevTable
+     * @brief Maps client addresses to backends with Maglev consistent hashing.
+     *
+     * Each backend has a permutation of the table slots given by an offset and a skip derived
+     * from its ID. Build() lets the backends take turns claiming their next free slot until the
+     * table is full, so every backend owns nearly the same number of slots and a change of the
+     * backend set moves few of them. The offset and skip of a backend are computed once when it
+     * is added, and Build() reports how many slots changed owner, so the disruption of each
+     * rebuild can be measured.
+     *
+     * A lookup is one hash of the address and one read of the table. Backends are identified by
+     * caller-chosen 32-bit IDs; the table does not depend on the order they were added in.
+     */
+    class MaglevTable
+    {
+    public:
+        /**
+         * @brief Backend of every slot while no backend has been built into the table.
+         */
+        static constexpr uint32_t NO_BACKEND = UINT32_MAX;
+
+        /**
+         * @brief Default number of slots, a prime about 100 times a few hundred backends.
+         */
+        static constexpr size_t DEFAULT_TABLE_SIZE = 65537;
+
+        /**
+         * @brief Number of addresses a batch lookup hashes before it reads their slots.
+         */
+        static constexpr size_t BATCH = 32;
+
+        /**
+         * @brief Constructor.
+         * @param cTableSize The number of slots, a prime larger than the number of backends and below 2^32.
+         * @param cSeed The seed of the address and backend hashes.
+         * @throws std::invalid_argument If the table size is not a prime below 2^32.
+         */
+        explicit MaglevTable(const size_t &cTableSize = DEFAULT_TABLE_SIZE, const uint64_t &cSeed = 0);
+
+        /**
+         * @brief Adds a backend; it gets slots at the next Build().
+         * @param cId The backend ID, not NO_BACKEND.
+         * @return `false` if the backend was already added.
+         * @throws std::invalid_argument If the ID is NO_BACKEND.
+         */
+        bool AddBackend(const uint32_t &cId);
+
+        /**
+         * @brief Removes a backend; its slots move at the next Build().
+         * @param cId The backend ID.
+         * @return `false` if the backend was not added.
+         */
+        bool RemoveBackend(const uint32_t &cId);
+
+        /**
+         * @brief Returns the number of backends added.
+         * @return The number of backends.
+         */
+        size_t BackendCount() const { return _backends.size(); }
+
+        /**
+         * @brief Returns the number of slots.
+         * @return The table size.
+         */
+        size_t TableSize() const { return _entries.size(); }
+
+        /**
+         * @brief Fills the table from the current backends.
+         * @return The number of slots whose backend changed.
+         */
+        size_t Build();
+
+        /**
+         * @brief Returns the backend of an IPv4 client.
+         * @param cAddress The client address.
+         * @return The backend ID, or NO_BACKEND before the first Build() with backends.
+         */
+        uint32_t Lookup(const IPv4Address &cAddress) const { return _entries[Slot(Hash(cAddress))]; }
+
+        /**
+         * @brief Returns the backend of an IPv6 client.
+         * @param cAddress The client address.
+         * @return The backend ID, or NO_BACKEND before the first Build() with backends.
+         */
+        uint32_t Lookup(const IPv6Address &cAddress) const { return _entries[Slot(Hash(cAddress))]; }
+
+        /**
+         * @brief Returns the backends of a batch of IPv4 clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param backends Receives one backend ID per address.
+         * @throws std::invalid_argument If an array is null.
+         */
+        void LookupBatch(const IPv4Address *cAddresses, const size_t &cCount, uint32_t *backends) const;
+
+        /**
+         * @brief Returns the backends of a batch of IPv6 clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param backends Receives one backend ID per address.
+         * @throws std::invalid_argument If an array is null.
+         */
+        void LookupBatch(const IPv6Address *cAddresses, const size_t &cCount, uint32_t *backends) const;
+
+        /**
+         * @brief Returns the backend of a slot, e.g. to count the slots of each backend.
+         * @param cSlot The slot.
+         * @return The backend ID.
+         */
+        uint32_t Entry(const size_t &cSlot) const { return _entries[cSlot]; }
+
+    private:
+        /**
+         * @brief A backend and its permutation of the slots.
+         */
+        struct Backend
+        {
+            uint32_t id;
+            uint32_t offset;
+            uint32_t skip;
+        };
+
+        /**
+         * @brief The seed of the address and backend hashes.
+         */
+        uint64_t _seed;
+
+        /**
+         * @brief The backends, sorted by ID.
+         */
+        std::vector<Backend> _backends;
+
+        /**
+         * @brief The backend of every slot.
+         */
+        std::vector<uint32_t> _entries;
+
+        /**
+         * @brief Finalizer of MurmurHash3: every input bit affects every output bit.
+         * @param value The value.
+         * @return The mixed value.
+         */
+        static constexpr uint64_t Mix(uint64_t value)
+        {
+            value = (value ^ value >> 33) * 0xFF51AFD7ED558CCDull;
+            value = (value ^ value >> 33) * 0xC4CEB9FE1A85EC53ull;
+            return value ^ value >> 33;
+        }
+
+        /**
+         * @brief Hashes an IPv4 address.
+         * @param cAddress The address.
+         * @return The hash.
+         */
+        uint64_t Hash(const IPv4Address &cAddress) const { return Mix(cAddress.ToUint32() ^ _seed); }
+
+        /**
+         * @brief Hashes an IPv6 address.
+         * @param cAddress The address.
+         * @return The hash.
+         */
+        uint64_t Hash(const IPv6Address &cAddress) const { return Mix(Mix(cAddress.GetUpper64() ^ _seed) ^ cAddress.GetLower64()); }
+
+        /**
+         * @brief Maps a hash to a slot by multiplying its high bits with the table size.
+         * @param cHash The hash.
+         * @return The slot.
+         */
+        size_t Slot(const uint64_t &cHash) const { return static_cast<size_t>((cHash >> 32) * _entries.size() >> 32); }
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::MaglevTable] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a table size that is not a prime.
+         */
+        static constexpr char SIZE_NOT_PRIME[]{"[EthernetParameter::MaglevTable] Table size must be a prime below 2^32!"};
+
+        /**
+         * @brief Error message indicating the reserved backend ID.
+         */
+        static constexpr char INVALID_BACKEND[]{"[EthernetParameter::MaglevTable] Backend ID is reserved!"};
+    }; /* class MaglevTable */
+}
+
+#endif /* MAGLEVTABLE_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,247 @@
+/**
+ * @file ToeplitzHash.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ToeplitzHash (RSS Toeplitz hash over address tuples) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ToeplitzHash.hpp"
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Joins the ports in input order.
+         * @param cSourcePort The source port.
+         * @param cDestinationPort The destination port.
+         * @return The ports as one word.
+         */
+        constexpr uint32_t JoinPorts(const uint16_t &cSourcePort, const uint16_t &cDestinationPort)
+        {
+            return static_cast<uint32_t>(cSourcePort) << 16 | cDestinationPort;
+        }
+    }
+
+    /**
+     * @brief Constructor.
+     * @param cKey The key, e.g. the one programmed into the NIC.
+     */
+    ToeplitzHash::ToeplitzHash(const Key &cKey)
+        : _key{cKey}, _table(MAX_INPUT_LENGTH * 256)
+    {
+        for (size_t position = 0; position < MAX_INPUT_LENGTH; position++)
+        {
+            // The 40 key bits from this byte on hold the windows of its 8 bits.
+            uint64_t bits{};
+            for (size_t i = 0; i < 5; i++)
+            {
+                bits = bits << 8 | cKey[position + i];
+            }
+            uint32_t windows[8];
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                windows[bit] = static_cast<uint32_t>(bits >> (8 - bit));
+            }
+
+            uint32_t *entries = _table.data() + position * 256;
+            for (size_t value = 1; value < 256; value++)
+            {
+                // The entry of a value is the one without its lowest set bit plus that bit's window.
+                uint8_t lowest{};
+                while (!(value >> lowest & 1))
+                {
+                    lowest++;
+                }
+                entries[value] = entries[value & (value - 1)] ^ windows[7 - lowest];
+            }
+        }
+    } /* ToeplitzHash::ToeplitzHash(const Key &cKey) */
+
+    /**
+     * @brief Hashes raw input.
+     * @param cData The input.
+     * @param cLength The length of the input in bytes.
+     * @return The hash.
+     * @throw std::invalid_argument If the data is null or longer than MAX_INPUT_LENGTH.
+     */
+    uint32_t ToeplitzHash::Hash(const uint8_t *cData, const size_t &cLength) const
+    {
+        if (!cData)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (cLength > MAX_INPUT_LENGTH)
+        {
+            throw std::invalid_argument(INPUT_TOO_LONG);
+        }
+        uint32_t hash{};
+        for (size_t i = 0; i < cLength; i++)
+        {
+            hash ^= _table[i * 256 + cData[i]];
+        }
+        return hash;
+    } /* uint32_t ToeplitzHash::Hash(const uint8_t *cData, const size_t &cLength) const */
+
+    /**
+     * @brief Hashes an IPv4 address pair (the NIC's IPv4 hash type).
+     * @param cSource The source address.
+     * @param cDestination The destination address.
+     * @return The hash.
+     */
+    uint32_t ToeplitzHash::Hash(const IPv4Address &cSource, const IPv4Address &cDestination) const
+    {
+        return HashWord(cSource.ToUint32(), 0) ^ HashWord(cDestination.ToUint32(), 4);
+    } /* uint32_t ToeplitzHash::Hash(const IPv4Address &cSource, const IPv4Address &cDestination) const */
+
+    /**
+     * @brief Hashes an IPv4 4-tuple (the NIC's TCP/UDP over IPv4 hash type).
+     * @param cSource The source address.
+     * @param cDestination The destination address.
+     * @param cSourcePort The source port.
+     * @param cDestinationPort The destination port.
+     * @return The hash.
+     */
+    uint32_t ToeplitzHash::Hash(const IPv4Address &cSource, const IPv4Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const
+    {
+        return Hash(cSource, cDestination) ^ HashWord(JoinPorts(cSourcePort, cDestinationPort), 8);
+    } /* uint32_t ToeplitzHash::Hash(const IPv4Address &cSource, const IPv4Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const */
+
+    /**
+     * @brief Hashes an IPv6 address pair (the NIC's IPv6 hash type).
+     * @param cSource The source address.
+     * @param cDestination The destination address.
+     * @return The hash.
+     */
+    uint32_t ToeplitzHash::Hash(const IPv6Address &cSource, const IPv6Address &cDestination) const
+    {
+        return HashWord(cSource.GetUpper64(), 0) ^ HashWord(cSource.GetLower64(), 8) ^
+               HashWord(cDestination.GetUpper64(), 16) ^ HashWord(cDestination.GetLower64(), 24);
+    } /* uint32_t ToeplitzHash::Hash(const IPv6Address &cSource, const IPv6Address &cDestination) const */
+
+    /**
+     * @brief Hashes an IPv6 4-tuple (the NIC's TCP/UDP over IPv6 hash type).
+     * @param cSource The source address.
+     * @param cDestination The destination address.
+     * @param cSourcePort The source port.
+     * @param cDestinationPort The destination port.
+     * @return The hash.
+     */
+    uint32_t ToeplitzHash::Hash(const IPv6Address &cSource, const IPv6Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const
+    {
+        return Hash(cSource, cDestination) ^ HashWord(JoinPorts(cSourcePort, cDestinationPort), 32);
+    } /* uint32_t ToeplitzHash::Hash(const IPv6Address &cSource, const IPv6Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const */
+
+    /**
+     * @brief Hashes a batch of IPv4 tuples.
+     * @param cSources The source addresses.
+     * @param cDestinations The destination addresses.
+     * @param cSourcePorts The source ports, or nullptr to hash address pairs only.
+     * @param cDestinationPorts The destination ports, or nullptr to hash address pairs only.
+     * @param cCount The number of tuples.
+     * @param hashes Receives one hash per tuple.
+     * @throw std::invalid_argument If an address or output array is null, or only one port array is.
+     */
+    void ToeplitzHash::HashBatch(const IPv4Address *cSources, const IPv4Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const
+    {
+        CheckBatch(cSources, cDestinations, cSourcePorts, cDestinationPorts, hashes);
+        // The tuples are independent, so the lookups of neighbouring ones overlap.
+        if (!cSourcePorts)
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                hashes[i] = Hash(cSources[i], cDestinations[i]);
+            }
+            return;
+        }
+        for (size_t i = 0; i < cCount; i++)
+        {
+            hashes[i] = Hash(cSources[i], cDestinations[i]) ^ HashWord(JoinPorts(cSourcePorts[i], cDestinationPorts[i]), 8);
+        }
+    } /* void ToeplitzHash::HashBatch(const IPv4Address *cSources, const IPv4Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const */
+
+    /**
+     * @brief Hashes a batch of IPv6 tuples.
+     * @param cSources The source addresses.
+     * @param cDestinations The destination addresses.
+     * @param cSourcePorts The source ports, or nullptr to hash address pairs only.
+     * @param cDestinationPorts The destination ports, or nullptr to hash address pairs only.
+     * @param cCount The number of tuples.
+     * @param hashes Receives one hash per tuple.
+     * @throw std::invalid_argument If an address or output array is null, or only one port array is.
+     */
+    void ToeplitzHash::HashBatch(const IPv6Address *cSources, const IPv6Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const
+    {
+        CheckBatch(cSources, cDestinations, cSourcePorts, cDestinationPorts, hashes);
+        if (!cSourcePorts)
+        {
+            for (size_t i = 0; i < cCount; i++)
+            {
+                hashes[i] = Hash(cSources[i], cDestinations[i]);
+            }
+            return;
+        }
+        for (size_t i = 0; i < cCount; i++)
+        {
+            hashes[i] = Hash(cSources[i], cDestinations[i]) ^ HashWord(JoinPorts(cSourcePorts[i], cDestinationPorts[i]), 32);
+        }
+    } /* void ToeplitzHash::HashBatch(const IPv6Address *cSources, const IPv6Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const */
+
+    // Private Methods.
+
+    /**
+     * @brief Hashes the four bytes of a word at an input position.
+     * @param cValue The word, most significant byte first in the input.
+     * @param cPosition The input position of its first byte.
+     * @return The hash contribution.
+     */
+    uint32_t ToeplitzHash::HashWord(const uint32_t &cValue, const size_t &cPosition) const
+    {
+        const uint32_t *cEntries = _table.data() + cPosition * 256;
+        return cEntries[cValue >> 24] ^ cEntries[256 + (cValue >> 16 & 0xFF)] ^
+               cEntries[512 + (cValue >> 8 & 0xFF)] ^ cEntries[768 + (cValue & 0xFF)];
+    } /* uint32_t ToeplitzHash::HashWord(const uint32_t &cValue, const size_t &cPosition) const */
+
+    /**
+     * @brief Hashes the eight bytes of a word at an input position.
+     * @param cValue The word, most significant byte first in the input.
+     * @param cPosition The input position of its first byte.
+     * @return The hash contribution.
+     */
+    uint32_t ToeplitzHash::HashWord(const uint64_t &cValue, const size_t &cPosition) const
+    {
+        return HashWord(static_cast<uint32_t>(cValue >> 32), cPosition) ^ HashWord(static_cast<uint32_t>(cValue), cPosition + 4);
+    } /* uint32_t ToeplitzHash::HashWord(const uint64_t &cValue, const size_t &cPosition) const */
+
+    /**
+     * @brief Checks the arrays of a batch.
+     * @param cSources The source addresses.
+     * @param cDestinations The destination addresses.
+     * @param cSourcePorts The source ports.
+     * @param cDestinationPorts The destination ports.
+     * @param cHashes The output.
+     * @throw std::invalid_argument If an address or output array is null, or only one port array is.
+     */
+    void ToeplitzHash::CheckBatch(const void *cSources, const void *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const uint32_t *cHashes)
+    {
+        if (!cSources || !cDestinations || !cHashes)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (!cSourcePorts != !cDestinationPorts)
+        {
+            throw std::invalid_argument(PORTS_MISMATCH);
+        }
+    } /* void ToeplitzHash::CheckBatch(const void *cSources, const void *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const uint32_t *cHashes) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,223 @@
+/**
+ * @file ToeplitzHash.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief ToeplitzHash (RSS Toeplitz hash over address tuples) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef TOEPLITZHASH_H
+#define TOEPLITZHASH_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class ToeplitzHash
+     * @brief The Toeplitz hash of Receive Side Scaling, so flows can be sharded across cores
+     *        exactly as the NIC spreads them across queues.
+     *
+     * The input is laid out as the NIC does: source address, destination address, then source
+     * and destination port, all in network byte order. Each input bit that is set XORs in the
+     * 32-bit window of the key starting at that bit. The windows of all 256 values of a byte are
+     * precomputed per input byte at construction, so hashing takes one table lookup per byte.
+     *
+     * With SYMMETRIC_KEY (0x6D5A repeated) both directions of a flow hash to the same value,
+     * because the key repeats every 16 bits and the swapped fields sit a multiple of 16 bits
+     * apart.
+     */
+    class ToeplitzHash
+    {
+    public:
+        /**
+         * @brief Size of the key in bytes, as used by most NICs.
+         */
+        static constexpr size_t KEY_SIZE = 40;
+
+        /**
+         * @brief Longest input: two IPv6 addresses and two ports.
+         */
+        static constexpr size_t MAX_INPUT_LENGTH = KEY_SIZE - 4;
+
+        /**
+         * @brief A hash key.
+         */
+        using Key = std::array<uint8_t, KEY_SIZE>;
+
+        /**
+         * @brief The default key of the Microsoft RSS specification, used by many NIC drivers.
+         */
+        static constexpr Key DEFAULT_KEY{
+            0x6D, 0x5A, 0x56, 0xDA, 0x25, 0x5B, 0x0E, 0xC2, 0x41, 0x67,
+            0x25, 0x3D, 0x43, 0xA3, 0x8F, 0xB0, 0xD0, 0xCA, 0x2B, 0xCB,
+            0xAE, 0x7B, 0x30, 0xB4, 0x77, 0xCB, 0x2D, 0xA3, 0x80, 0x30,
+            0xF2, 0x0C, 0x6A, 0x42, 0xB7, 0x3B, 0xBE, 0xAC, 0x01, 0xFA};
+
+        /**
+         * @brief A key that hashes both directions of a flow to the same value.
+         */
+        static constexpr Key SYMMETRIC_KEY{
+            0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A,
+            0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A,
+            0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A,
+            0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A, 0x6D, 0x5A};
+
+        /**
+         * @brief Constructor.
+         * @param cKey The key, e.g. the one programmed into the NIC.
+         */
+        explicit ToeplitzHash(const Key &cKey = DEFAULT_KEY);
+
+        /**
+         * @brief Returns the key.
+         * @return The key.
+         */
+        const Key &GetKey() const { return _key; }
+
+        /**
+         * @brief Hashes raw input.
+         * @param cData The input.
+         * @param cLength The length of the input in bytes.
+         * @return The hash.
+         * @throws std::invalid_argument If the data is null or longer than MAX_INPUT_LENGTH.
+         */
+        uint32_t Hash(const uint8_t *cData, const size_t &cLength) const;
+
+        /**
+         * @brief Hashes an IPv4 address pair (the NIC's IPv4 hash type).
+         * @param cSource The source address.
+         * @param cDestination The destination address.
+         * @return The hash.
+         */
+        uint32_t Hash(const IPv4Address &cSource, const IPv4Address &cDestination) const;
+
+        /**
+         * @brief Hashes an IPv4 4-tuple (the NIC's TCP/UDP over IPv4 hash type).
+         * @param cSource The source address.
+         * @param cDestination The destination address.
+         * @param cSourcePort The source port.
+         * @param cDestinationPort The destination port.
+         * @return The hash.
+         */
+        uint32_t Hash(const IPv4Address &cSource, const IPv4Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const;
+
+        /**
+         * @brief Hashes an IPv6 address pair (the NIC's IPv6 hash type).
+         * @param cSource The source address.
+         * @param cDestination The destination address.
+         * @return The hash.
+         */
+        uint32_t Hash(const IPv6Address &cSource, const IPv6Address &cDestination) const;
+
+        /**
+         * @brief Hashes an IPv6 4-tuple (the NIC's TCP/UDP over IPv6 hash type).
+         * @param cSource The source address.
+         * @param cDestination The destination address.
+         * @param cSourcePort The source port.
+         * @param cDestinationPort The destination port.
+         * @return The hash.
+         */
+        uint32_t Hash(const IPv6Address &cSource, const IPv6Address &cDestination, const uint16_t &cSourcePort, const uint16_t &cDestinationPort) const;
+
+        /**
+         * @brief Hashes a batch of IPv4 tuples.
+         * @param cSources The source addresses.
+         * @param cDestinations The destination addresses.
+         * @param cSourcePorts The source ports, or nullptr to hash address pairs only.
+         * @param cDestinationPorts The destination ports, or nullptr to hash address pairs only.
+         * @param cCount The number of tuples.
+         * @param hashes Receives one hash per tuple.
+         * @throws std::invalid_argument If an address or output array is null, or only one port array is.
+         */
+        void HashBatch(const IPv4Address *cSources, const IPv4Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const;
+
+        /**
+         * @brief Hashes a batch of IPv6 tuples.
+         * @param cSources The source addresses.
+         * @param cDestinations The destination addresses.
+         * @param cSourcePorts The source ports, or nullptr to hash address pairs only.
+         * @param cDestinationPorts The destination ports, or nullptr to hash address pairs only.
+         * @param cCount The number of tuples.
+         * @param hashes Receives one hash per tuple.
+         * @throws std::invalid_argument If an address or output array is null, or only one port array is.
+         */
+        void HashBatch(const IPv6Address *cSources, const IPv6Address *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const size_t &cCount, uint32_t *hashes) const;
+
+        /**
+         * @brief Maps a hash to a queue through an indirection table, as the NIC does.
+         * @param cHash The hash.
+         * @param cTableSize The number of entries of the indirection table, a power of two.
+         * @return The index in the indirection table: the low bits of the hash.
+         */
+        static constexpr uint32_t TableIndex(const uint32_t &cHash, const uint32_t &cTableSize) { return cHash & (cTableSize - 1); }
+
+    private:
+        /**
+         * @brief The key.
+         */
+        Key _key;
+
+        /**
+         * @brief The XOR of the key windows of every byte value at every input position, 256 per position.
+         */
+        std::vector<uint32_t> _table;
+
+        /**
+         * @brief Hashes the four bytes of a word at an input position.
+         * @param cValue The word, most significant byte first in the input.
+         * @param cPosition The input position of its first byte.
+         * @return The hash contribution.
+         */
+        uint32_t HashWord(const uint32_t &cValue, const size_t &cPosition) const;
+
+        /**
+         * @brief Hashes the eight bytes of a word at an input position.
+         * @param cValue The word, most significant byte first in the input.
+         * @param cPosition The input position of its first byte.
+         * @return The hash contribution.
+         */
+        uint32_t HashWord(const uint64_t &cValue, const size_t &cPosition) const;
+
+        /**
+         * @brief Checks the arrays of a batch.
+         * @param cSources The source addresses.
+         * @param cDestinations The destination addresses.
+         * @param cSourcePorts The source ports.
+         * @param cDestinationPorts The destination ports.
+         * @param cHashes The output.
+         * @throws std::invalid_argument If an address or output array is null, or only one port array is.
+         */
+        static void CheckBatch(const void *cSources, const void *cDestinations, const uint16_t *cSourcePorts, const uint16_t *cDestinationPorts, const uint32_t *cHashes);
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::ToeplitzHash] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating input longer than MAX_INPUT_LENGTH.
+         */
+        static constexpr char INPUT_TOO_LONG[]{"[EthernetParameter::ToeplitzHash] Input longer than the key allows!"};
+
+        /**
+         * @brief Error message indicating a batch with only one of the port arrays.
+         */
+        static constexpr char PORTS_MISMATCH[]{"[EthernetParameter::ToeplitzHash] Both port arrays or neither must be given!"};
+    }; /* class ToeplitzHash */
+}
+
+#endif /* TOEPLITZHASH_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -12,24 +12,114 @@
  *            All rights reserved.
  */
 #include "IPv4Address.hpp"
+#include <array>
 #include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
 #include <string>
-#include <sstream>
+#include <string_view>
 
 namespace EthernetParameter
 {
-	/**
-	 * @brief Default constructor for the IPv4Address class.
-	 */
-	IPv4Address::IPv4Address()
+	namespace
 	{
-	}
+		/**
+		 * @brief Decimal text of an octet used when formatting addresses and reverse names.
+		 */
+		struct DecimalOctet
+		{
+			char digits[3];
+			uint8_t length;
+		};
 
-	/**
-	 * @brief Destructor for the IPv4Address class.
-	 */
-	IPv4Address::~IPv4Address()
-	{
+		/**
+		 * @brief Builds the lookup table of decimal octet texts.
+		 * @return The table indexed by octet value.
+		 */
+		constexpr std::array<DecimalOctet, 256> MakeDecimalOctets()
+		{
+			std::array<DecimalOctet, 256> table{};
+			for (uint16_t value = 0; value < 256; value++)
+			{
+				DecimalOctet &entry = table[value];
+				if (value >= 100)
+				{
+					entry = DecimalOctet{{static_cast<char>('0' + value / 100), static_cast<char>('0' + value / 10 % 10), static_cast<char>('0' + value % 10)}, 3};
+				}
+				else if (value >= 10)
+				{
+					entry = DecimalOctet{{static_cast<char>('0' + value / 10), static_cast<char>('0' + value % 10), 0}, 2};
+				}
+				else
+				{
+					entry = DecimalOctet{{static_cast<char>('0' + value), 0, 0}, 1};
+				}
+			}
+			return table;
+		}
+
+		/**
+		 * @brief Decimal texts of all octet values.
+		 */
+		constexpr std::array<DecimalOctet, 256> DECIMAL_OCTETS = MakeDecimalOctets();
+
+		/**
+		 * @brief Reverse DNS zone suffix for IPv4.
+		 */
+		constexpr char IN_ADDR_ARPA[]{"in-addr.arpa"};
+
+		/**
+		 * @brief Writes the dotted-decimal text of an address.
+		 * @param cOctets The four octets.
+		 * @param output Receives the text; at least IP_ADDRESS_MAX_LENGTH + 1 bytes, for the dot stored after the last octet.
+		 * @return The length of the text.
+		 */
+		size_t WriteDotted(const uint8_t *cOctets, char *output)
+		{
+			char *end = output;
+			for (uint8_t i = 0; i < IPv4Address::IP_ADDRESS_OCTETS; i++)
+			{
+				const DecimalOctet &cText = DECIMAL_OCTETS[cOctets[i]];
+				memcpy(end, cText.digits, sizeof(cText.digits));
+				end += cText.length;
+				*end++ = '.';
+			}
+			return static_cast<size_t>(end - output) - 1;
+		}
+
+		/**
+		 * @brief Reads the characters an IPv4 address can hold from a stream, after leading whitespace.
+		 * @param is The input stream; eofbit is set if the text runs to the end of the stream.
+		 * @param text Receives the characters.
+		 * @param cCapacity The size of the text buffer.
+		 * @return The number of characters read, or cCapacity + 1 if the text does not fit.
+		 */
+		size_t ExtractToken(std::istream &is, char *text, const size_t &cCapacity)
+		{
+			using Traits = std::istream::traits_type;
+			std::streambuf *buffer = is.rdbuf();
+			size_t length{};
+			for (Traits::int_type character = buffer->sgetc();; character = buffer->snextc())
+			{
+				if (Traits::eq_int_type(character, Traits::eof()))
+				{
+					is.setstate(std::ios_base::eofbit);
+					break;
+				}
+				const char cCharacter = Traits::to_char_type(character);
+				if ((cCharacter < '0' || cCharacter > '9') && cCharacter != '.')
+				{
+					break;
+				}
+				if (length == cCapacity)
+				{
+					return cCapacity + 1;
+				}
+				text[length++] = cCharacter;
+			}
+			return length;
+		}
 	}
 
 	/**
@@ -54,21 +144,6 @@ namespace EthernetParameter
 		}
 	} /* IPv4Address::IPv4Address(const uint8_t *cData) */
 
-	/**
-	 * @brief Constructor for the IPv4Address class that accepts four octets as separate parameters.
-	 * @param octet1 The first octet of the IPv4 address.
-	 * @param octet2 The second octet of the IPv4 address.
-	 * @param octet3 The third octet of the IPv4 address.
-	 * @param octet4 The fourth octet of the IPv4 address.
-	 */
-	IPv4Address::IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4)
-	{
-		_octets[0] = cOctet1;
-		_octets[1] = cOctet2;
-		_octets[2] = cOctet3;
-		_octets[3] = cOctet4;
-	} /* IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4) */
-
 	/**
 	 * @brief Constructor for the IPv4Address class that accepts a string representation of an IPv4 address.
 	 *
@@ -137,6 +212,65 @@ namespace EthernetParameter
 		}
 	} /* IPv4Address::IPv4Address(const std::vector<uint8_t> &cBinaryAddress) */
 
+	/**
+	 * @brief Parses a dotted-decimal IPv4 address without throwing or allocating.
+	 *
+	 * Exactly four decimal octets in the range [0, 255] separated by dots are required and the
+	 * whole text must be consumed. Leading zeros ("01") are rejected because some tools read
+	 * them as octal.
+	 *
+	 * @param cText The text to parse (not necessarily null-terminated).
+	 * @param cLength The number of characters to parse.
+	 * @param address The parsed address, untouched if the text is invalid.
+	 * @return `true` if the text is a valid IPv4 address, `false` otherwise.
+	 */
+	bool IPv4Address::TryParse(const char *cText, const size_t &cLength, IPv4Address &address)
+	{
+		if (!cText || cLength < 7 || cLength > 15)
+		{
+			return false;
+		}
+
+		const char *position = cText;
+		const char *cEnd = cText + cLength;
+		uint8_t octets[IP_ADDRESS_OCTETS]{};
+
+		for (uint8_t i = 0; i < IP_ADDRESS_OCTETS; i++)
+		{
+			const char *cOctetStart = position;
+			uint16_t value{};
+			while (position < cEnd && *position >= '0' && *position <= '9' && position - cOctetStart < 3)
+			{
+				value = static_cast<uint16_t>(value * 10 + (*position - '0'));
+				position++;
+			}
+
+			const ptrdiff_t cDigits = position - cOctetStart;
+			if (cDigits == 0 || value > UINT8_MAX || (cDigits > 1 && *cOctetStart == '0'))
+			{
+				return false;
+			}
+			octets[i] = static_cast<uint8_t>(value);
+
+			if (i + 1 < IP_ADDRESS_OCTETS)
+			{
+				if (position == cEnd || *position != DOT)
+				{
+					return false;
+				}
+				position++;
+			}
+		}
+
+		if (position != cEnd)
+		{
+			return false;
+		}
+
+		address.SetFromBinary(octets);
+		return true;
+	} /* IPv4Address::TryParse(const char *cText, const size_t &cLength, IPv4Address &address) */
+
 	/**
 	 * @brief Sets the value of the octet at the specified index.
 	 *
@@ -189,19 +323,8 @@ namespace EthernetParameter
 	 */
 	std::string IPv4Address::ToString() const
 	{
-		std::string ipV4StrRetVal{};
-
-		for (uint8_t i = 0; i < IP_ADDRESS_OCTETS; i++)
-		{
-			ipV4StrRetVal += std::to_string(_octets[i]);
-
-			if (i != 3)
-			{
-				ipV4StrRetVal += DOT;
-			}
-		}
-
-		return ipV4StrRetVal;
+		char text[IP_ADDRESS_MAX_LENGTH + 1];
+		return std::string(text, WriteDotted(_octets, text));
 	} /* IPv4Address::ToString() */
 
 	/**
@@ -276,6 +399,113 @@ namespace EthernetParameter
 		memset(_octets, 0, IP_ADDRESS_OCTETS);
 	} /* IPv4Address::Clear() */
 
+	/**
+	 * @brief Writes the reverse DNS (PTR) name of the address, e.g. "1.0.168.192.in-addr.arpa".
+	 *
+	 * Octets are written in reverse order using a lookup table of their decimal texts,
+	 * so no memory is allocated.
+	 *
+	 * @param destBuffer The buffer to write the null-terminated name to.
+	 * @param cBufferSize The size of the buffer, REVERSE_NAME_MAX_LENGTH + 1 bytes are always enough.
+	 * @return The length of the name without the terminating null.
+	 * @throw std::invalid_argument If the buffer is null or too small for the name.
+	 */
+	size_t IPv4Address::ToReverseName(char *destBuffer, const size_t &cBufferSize) const
+	{
+		if (!destBuffer)
+		{
+			throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+		}
+
+		size_t length = sizeof(IN_ADDR_ARPA) - 1 + IP_ADDRESS_OCTETS;
+		for (uint8_t i = 0; i < IP_ADDRESS_OCTETS; i++)
+		{
+			length += DECIMAL_OCTETS[_octets[i]].length;
+		}
+
+		if (cBufferSize <= length)
+		{
+			throw std::invalid_argument(BUFFER_TOO_SMALL);
+		}
+
+		char *position = destBuffer;
+		for (uint8_t i = IP_ADDRESS_OCTETS; i > 0; i--)
+		{
+			const DecimalOctet &cOctet = DECIMAL_OCTETS[_octets[i - 1]];
+			memcpy(position, cOctet.digits, 3);
+			position += cOctet.length;
+			*position++ = DOT;
+		}
+		memcpy(position, IN_ADDR_ARPA, sizeof(IN_ADDR_ARPA));
+
+		return length;
+	} /* IPv4Address::ToReverseName(char *destBuffer, const size_t &cBufferSize) const */
+
+	/**
+	 * @brief Parses a reverse DNS name, e.g. "1.0.168.192.in-addr.arpa", into an address.
+	 *
+	 * Labels must be decimal numbers in the range [0, 255] without leading zeros.
+	 *
+	 * @param cName The name, four decimal labels followed by "in-addr.arpa" (any case, optional trailing dot).
+	 * @param cLength The length of the name.
+	 * @param address The parsed address, untouched if the name is invalid.
+	 * @return `true` if the name was parsed, `false` if it is not a valid reverse name.
+	 */
+	bool IPv4Address::FromReverseName(const char *cName, const size_t &cLength, IPv4Address &address)
+	{
+		if (!cName)
+		{
+			return false;
+		}
+
+		const char *position = cName;
+		const char *cEnd = cName + cLength;
+		uint8_t octets[IP_ADDRESS_OCTETS]{};
+
+		for (uint8_t i = IP_ADDRESS_OCTETS; i > 0; i--)
+		{
+			const char *cLabelStart = position;
+			uint16_t value{};
+			while (position < cEnd && *position >= '0' && *position <= '9' && position - cLabelStart < 3)
+			{
+				value = static_cast<uint16_t>(value * 10 + (*position - '0'));
+				position++;
+			}
+
+			const ptrdiff_t cDigits = position - cLabelStart;
+			if (cDigits == 0 || value > UINT8_MAX || (cDigits > 1 && *cLabelStart == '0') || position == cEnd || *position != DOT)
+			{
+				return false;
+			}
+
+			octets[i - 1] = static_cast<uint8_t>(value);
+			position++;
+		}
+
+		size_t suffixLength = static_cast<size_t>(cEnd - position);
+		if (suffixLength == sizeof(IN_ADDR_ARPA) && position[suffixLength - 1] == DOT)
+		{
+			suffixLength--;
+		}
+
+		if (suffixLength != sizeof(IN_ADDR_ARPA) - 1)
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < suffixLength; i++)
+		{
+			const char cLower = (position[i] >= 'A' && position[i] <= 'Z') ? static_cast<char>(position[i] | 0x20) : position[i];
+			if (cLower != IN_ADDR_ARPA[i])
+			{
+				return false;
+			}
+		}
+
+		address.SetFromBinary(octets);
+		return true;
+	} /* IPv4Address::FromReverseName(const char *cName, const size_t &cLength, IPv4Address &address) */
+
 	/**
 	 * @brief Overloads the << operator to enable output of the IPv4 address to an output stream.
 	 * @param os The output stream to write to.
@@ -284,10 +514,41 @@ namespace EthernetParameter
 	 */
 	std::ostream &operator<<(std::ostream &os, const IPv4Address &cAddress)
 	{
-		os << cAddress.ToString();
-		return os;
+		char text[IPv4Address::IP_ADDRESS_MAX_LENGTH + 1];
+		const size_t cLength = WriteDotted(cAddress._octets, text);
+		if (os.width())
+		{
+			// Padding needs formatted output; a string_view still avoids the temporary string.
+			return os << std::string_view(text, cLength);
+		}
+		return os.write(text, static_cast<std::streamsize>(cLength));
 	} /* operator<<(std::ostream &os, const IPv4Address &cAddress) */
 
+	/**
+	 * @brief Overloads the >> operator to read an IPv4 address from an input stream.
+	 *
+	 * Skips leading whitespace, then reads digits and dots into a stack buffer and parses them
+	 * with TryParse(). Reading stops at the first other character, which is left in the stream.
+	 *
+	 * @param is The input stream to read from.
+	 * @param address The IPv4 address read, untouched if the text is invalid.
+	 * @return The input stream, with failbit set if the text is not a valid IPv4 address.
+	 */
+	std::istream &operator>>(std::istream &is, IPv4Address &address)
+	{
+		const std::istream::sentry cSentry(is);
+		if (cSentry)
+		{
+			char text[IPv4Address::IP_ADDRESS_MAX_LENGTH];
+			const size_t cLength = ExtractToken(is, text, sizeof(text));
+			if (cLength > sizeof(text) || !IPv4Address::TryParse(text, cLength, address))
+			{
+				is.setstate(std::ios_base::failbit);
+			}
+		}
+		return is;
+	} /* operator>>(std::istream &is, IPv4Address &address) */
+
 	/**
 	 * @brief Overloads the != operator to compare two IPv4 addresses for inequality.
 	 * @param ip The IPv4 address to compare against.
@@ -311,22 +572,6 @@ namespace EthernetParameter
 		return memcmp(_octets, cIp._octets, IP_ADDRESS_OCTETS) == 0;
 	} /* bool IPv4Address::operator==(const IPv4Address &cIp) const */
 
-	/**
-	 * @brief Assignment operator for IPv4Address class.
-	 * This operator assigns the value of another IPv4Address object to the current object.
-	 * @param cIp The IPv4Address object to be assigned.
-	 * @return A reference to the modified IPv4Address object.
-	 */
-	IPv4Address &IPv4Address::operator=(const IPv4Address &cIp)
-	{
-		if (this != &cIp) // If they aren't the same object
-		{
-			memcpy(this->_octets, cIp._octets, IP_ADDRESS_MAX_LENGTH);
-		}
-
-		return *this;
-	} /* IPv4Address &IPv4Address::operator=(const IPv4Address &cIp) */
-
 }
 
 /******************************************************************************
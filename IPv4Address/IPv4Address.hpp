@@ -13,7 +13,9 @@
  */
 #ifndef IPV4ADDRESS_H
 #define IPV4ADDRESS_H
+#include <cstddef>
 #include <cstdint>
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -45,12 +47,14 @@ namespace EthernetParameter
          *
          * This constructor creates an empty IPv4 address.
          */
-        IPv4Address();
+        constexpr IPv4Address() = default;
 
         /**
          * @brief Destructor for the IPv4Address class.
+         *
+         * Kept trivial so the class stays a literal type usable in constant expressions.
          */
-        ~IPv4Address();
+        ~IPv4Address() = default;
 
         /**
          * @brief Constructor for the IPv4Address class that creates an IPv4 address from binary data.
@@ -66,7 +70,7 @@ namespace EthernetParameter
          * @param cOctet3 The value of the third octet.
          * @param cOctet4 The value of the fourth octet.
          */
-        IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4);
+        constexpr IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4);
 
         /**
          * @brief Constructor for the IPv4Address class that accepts a string representation of an IPv4 address.
@@ -82,6 +86,18 @@ namespace EthernetParameter
          */
         IPv4Address(const std::vector<uint8_t> &cBinaryAddress);
 
+        /**
+         * @brief Parses a dotted-decimal IPv4 address (e.g. "192.168.0.1") without throwing or allocating.
+         *
+         * Exactly four decimal octets in the range [0, 255] are required, leading zeros are rejected.
+         *
+         * @param cText The text to parse (not necessarily null-terminated).
+         * @param cLength The number of characters to parse, all of them must belong to the address.
+         * @param address The parsed address, untouched if the text is invalid.
+         * @return `true` if the text is a valid IPv4 address, `false` otherwise.
+         */
+        static bool TryParse(const char *cText, const size_t &cLength, IPv4Address &address);
+
         /**
          * @brief Setter for a specific octet.
          * @param cIndex The index of the octet to set.
@@ -98,6 +114,19 @@ namespace EthernetParameter
          */
         uint8_t GetOctet(const uint8_t &cIndex) const;
 
+        /**
+         * @brief Creates an IPv4 address from its 32-bit numeric value.
+         * @param cValue The address as a host-order integer (e.g., 0xC0A80001 for 192.168.0.1).
+         * @return The IPv4 address.
+         */
+        static constexpr IPv4Address FromUint32(const uint32_t &cValue);
+
+        /**
+         * @brief Returns the 32-bit numeric value of the IPv4 address.
+         * @return The address as a host-order integer (e.g., 0xC0A80001 for 192.168.0.1).
+         */
+        constexpr uint32_t ToUint32() const;
+
         /**
          * @brief Returns the current IP address as a string representation.
          * @return The IP address as a string.
@@ -136,6 +165,29 @@ namespace EthernetParameter
          */
         void Clear();
 
+        /**
+         * @brief Maximum length of a reverse DNS name ("255.255.255.255.in-addr.arpa") without the terminating null.
+         */
+        static constexpr size_t REVERSE_NAME_MAX_LENGTH = 28;
+
+        /**
+         * @brief Writes the reverse DNS (PTR) name of the address, e.g. "1.0.168.192.in-addr.arpa".
+         * @param destBuffer The buffer to write the null-terminated name to.
+         * @param cBufferSize The size of the buffer, REVERSE_NAME_MAX_LENGTH + 1 bytes are always enough.
+         * @return The length of the name without the terminating null.
+         * @throws std::invalid_argument If the buffer is null or too small for the name.
+         */
+        size_t ToReverseName(char *destBuffer, const size_t &cBufferSize) const;
+
+        /**
+         * @brief Parses a reverse DNS name, e.g. "1.0.168.192.in-addr.arpa", into an address.
+         * @param cName The name, four decimal labels followed by "in-addr.arpa" (any case, optional trailing dot).
+         * @param cLength The length of the name.
+         * @param address The parsed address, untouched if the name is invalid.
+         * @return `true` if the name was parsed, `false` if it is not a valid reverse name.
+         */
+        static bool FromReverseName(const char *cName, const size_t &cLength, IPv4Address &address);
+
         /**
          * @brief Overloads the insertion operator for output.
          * @param os The output stream.
@@ -144,6 +196,14 @@ namespace EthernetParameter
          */
         friend std::ostream &operator<<(std::ostream &os, const IPv4Address &cAddress);
 
+        /**
+         * @brief Overloads the extraction operator for input, without a temporary string.
+         * @param is The input stream.
+         * @param address The IPv4 address read, untouched on failure.
+         * @return The input stream, with failbit set if the text is not a valid IPv4 address.
+         */
+        friend std::istream &operator>>(std::istream &is, IPv4Address &address);
+
         /**
          * @brief Not equal comparison operator.
          * @param cIp The IPv4 address to compare.
@@ -160,10 +220,100 @@ namespace EthernetParameter
 
         /**
          * @brief Assignment operator for the IPv4Address class.
+         *
+         * Defaulted so the class stays trivially copyable and copies in batch loops are inlined.
+         *
          * @param cIp The IPv4 address to assign.
          * @return A reference to the assigned IPv4 address.
          */
-        IPv4Address &operator=(const IPv4Address &cIp);
+        IPv4Address &operator=(const IPv4Address &cIp) = default;
+
+        /**
+         * @brief Less than comparison operator (numeric order).
+         * @param cIp The IPv4 address to compare.
+         * @return `true` if this address is numerically lower, `false` otherwise.
+         */
+        constexpr bool operator<(const IPv4Address &cIp) const;
+
+        /**
+         * @brief Greater than comparison operator (numeric order).
+         * @param cIp The IPv4 address to compare.
+         * @return `true` if this address is numerically greater, `false` otherwise.
+         */
+        constexpr bool operator>(const IPv4Address &cIp) const;
+
+        /**
+         * @brief Less than or equal comparison operator (numeric order).
+         * @param cIp The IPv4 address to compare.
+         * @return `true` if this address is numerically lower or equal, `false` otherwise.
+         */
+        constexpr bool operator<=(const IPv4Address &cIp) const;
+
+        /**
+         * @brief Greater than or equal comparison operator (numeric order).
+         * @param cIp The IPv4 address to compare.
+         * @return `true` if this address is numerically greater or equal, `false` otherwise.
+         */
+        constexpr bool operator>=(const IPv4Address &cIp) const;
+
+        /**
+         * @brief Pre-increment operator. Moves to the next address, wrapping 255.255.255.255 to 0.0.0.0.
+         * @return A reference to the incremented IPv4 address.
+         */
+        constexpr IPv4Address &operator++();
+
+        /**
+         * @brief Post-increment operator. Moves to the next address, wrapping 255.255.255.255 to 0.0.0.0.
+         * @return The IPv4 address before incrementing.
+         */
+        constexpr IPv4Address operator++(int);
+
+        /**
+         * @brief Pre-decrement operator. Moves to the previous address, wrapping 0.0.0.0 to 255.255.255.255.
+         * @return A reference to the decremented IPv4 address.
+         */
+        constexpr IPv4Address &operator--();
+
+        /**
+         * @brief Post-decrement operator. Moves to the previous address, wrapping 0.0.0.0 to 255.255.255.255.
+         * @return The IPv4 address before decrementing.
+         */
+        constexpr IPv4Address operator--(int);
+
+        /**
+         * @brief Moves the address by the given offset (modulo 2^32).
+         * @param cOffset The number of addresses to move by, may be negative.
+         * @return A reference to the moved IPv4 address.
+         */
+        constexpr IPv4Address &operator+=(const int64_t &cOffset);
+
+        /**
+         * @brief Moves the address back by the given offset (modulo 2^32).
+         * @param cOffset The number of addresses to move back by, may be negative.
+         * @return A reference to the moved IPv4 address.
+         */
+        constexpr IPv4Address &operator-=(const int64_t &cOffset);
+
+        /**
+         * @brief Returns the address moved by the given offset (modulo 2^32).
+         * @param cOffset The number of addresses to move by, may be negative.
+         * @return The moved IPv4 address.
+         */
+        constexpr IPv4Address operator+(const int64_t &cOffset) const;
+
+        /**
+         * @brief Returns the address moved back by the given offset (modulo 2^32).
+         * @param cOffset The number of addresses to move back by, may be negative.
+         * @return The moved IPv4 address.
+         */
+        constexpr IPv4Address operator-(const int64_t &cOffset) const;
+
+        /**
+         * @brief Returns the signed distance between two addresses.
+         * @param cIp The IPv4 address to subtract.
+         * @return The number of addresses from `cIp` to this address (negative if `cIp` is greater).
+         */
+        constexpr int64_t operator-(const IPv4Address &cIp) const;
 
     private:
         /**
@@ -171,6 +321,12 @@ namespace EthernetParameter
          */
         uint8_t _octets[IP_ADDRESS_OCTETS]{};
 
+        /**
+         * @brief Overwrites all octets with the given 32-bit numeric value.
+         * @param cValue The address as a host-order integer.
+         */
+        constexpr void StoreUint32(const uint32_t &cValue);
+
         /**
          * @brief Separator between octets.
          */
@@ -200,7 +356,112 @@ namespace EthernetParameter
          * @brief Error message indicating an empty string encountered.
          */
         static constexpr char EMPTY_STRING[]{"[EthernetParameter::IPv4Address] Empty string encountered!"};
+
+        /**
+         * @brief Error message indicating a destination buffer that is too small.
+         */
+        static constexpr char BUFFER_TOO_SMALL[]{"[EthernetParameter::IPv4Address] Destination buffer too small!"};
     }; /* class IPv4Address */
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Constexpr definitions.
+
+    constexpr IPv4Address::IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4)
+        : _octets{cOctet1, cOctet2, cOctet3, cOctet4}
+    {
+    } /* IPv4Address(const uint8_t &cOctet1, const uint8_t &cOctet2, const uint8_t &cOctet3, const uint8_t &cOctet4) */
+
+    constexpr IPv4Address IPv4Address::FromUint32(const uint32_t &cValue)
+    {
+        return IPv4Address(static_cast<uint8_t>(cValue >> 24), static_cast<uint8_t>(cValue >> 16),
+                           static_cast<uint8_t>(cValue >> 8), static_cast<uint8_t>(cValue));
+    } /* IPv4Address IPv4Address::FromUint32(const uint32_t &cValue) */
+
+    constexpr uint32_t IPv4Address::ToUint32() const
+    {
+        return (static_cast<uint32_t>(_octets[0]) << 24) | (static_cast<uint32_t>(_octets[1]) << 16) |
+               (static_cast<uint32_t>(_octets[2]) << 8) | static_cast<uint32_t>(_octets[3]);
+    } /* uint32_t IPv4Address::ToUint32() const */
+
+    constexpr void IPv4Address::StoreUint32(const uint32_t &cValue)
+    {
+        _octets[0] = static_cast<uint8_t>(cValue >> 24);
+        _octets[1] = static_cast<uint8_t>(cValue >> 16);
+        _octets[2] = static_cast<uint8_t>(cValue >> 8);
+        _octets[3] = static_cast<uint8_t>(cValue);
+    } /* void IPv4Address::StoreUint32(const uint32_t &cValue) */
+
+    constexpr bool IPv4Address::operator<(const IPv4Address &cIp) const
+    {
+        return ToUint32() < cIp.ToUint32();
+    } /* bool IPv4Address::operator<(const IPv4Address &cIp) const */
+
+    constexpr bool IPv4Address::operator>(const IPv4Address &cIp) const
+    {
+        return ToUint32() > cIp.ToUint32();
+    } /* bool IPv4Address::operator>(const IPv4Address &cIp) const */
+
+    constexpr bool IPv4Address::operator<=(const IPv4Address &cIp) const
+    {
+        return ToUint32() <= cIp.ToUint32();
+    } /* bool IPv4Address::operator<=(const IPv4Address &cIp) const */
+
+    constexpr bool IPv4Address::operator>=(const IPv4Address &cIp) const
+    {
+        return ToUint32() >= cIp.ToUint32();
+    } /* bool IPv4Address::operator>=(const IPv4Address &cIp) const */
+
+    constexpr IPv4Address &IPv4Address::operator++()
+    {
+        return *this += 1;
+    } /* IPv4Address &IPv4Address::operator++() */
+
+    constexpr IPv4Address IPv4Address::operator++(int)
+    {
+        IPv4Address previous{*this};
+        *this += 1;
+        return previous;
+    } /* IPv4Address IPv4Address::operator++(int) */
+
+    constexpr IPv4Address &IPv4Address::operator--()
+    {
+        return *this -= 1;
+    } /* IPv4Address &IPv4Address::operator--() */
+
+    constexpr IPv4Address IPv4Address::operator--(int)
+    {
+        IPv4Address previous{*this};
+        *this -= 1;
+        return previous;
+    } /* IPv4Address IPv4Address::operator--(int) */
+
+    constexpr IPv4Address &IPv4Address::operator+=(const int64_t &cOffset)
+    {
+        // Unsigned arithmetic wraps modulo 2^32, which is exactly the address space.
+        StoreUint32(ToUint32() + static_cast<uint32_t>(cOffset));
+        return *this;
+    } /* IPv4Address &IPv4Address::operator+=(const int64_t &cOffset) */
+
+    constexpr IPv4Address &IPv4Address::operator-=(const int64_t &cOffset)
+    {
+        StoreUint32(ToUint32() - static_cast<uint32_t>(cOffset));
+        return *this;
+    } /* IPv4Address &IPv4Address::operator-=(const int64_t &cOffset) */
+
+    constexpr IPv4Address IPv4Address::operator+(const int64_t &cOffset) const
+    {
+        return FromUint32(ToUint32() + static_cast<uint32_t>(cOffset));
+    } /* IPv4Address IPv4Address::operator+(const int64_t &cOffset) const */
+
+    constexpr IPv4Address IPv4Address::operator-(const int64_t &cOffset) const
+    {
+        return FromUint32(ToUint32() - static_cast<uint32_t>(cOffset));
+    } /* IPv4Address IPv4Address::operator-(const int64_t &cOffset) const */
+
+    constexpr int64_t IPv4Address::operator-(const IPv4Address &cIp) const
+    {
+        return static_cast<int64_t>(ToUint32()) - static_cast<int64_t>(cIp.ToUint32());
+    } /* int64_t IPv4Address::operator-(const IPv4Address &cIp) const */
 }
 
 #endif /* IPV4ADDRESS_H */
@@ -0,0 +1,64 @@
+/**
+ * @file IPv4Prefix.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4Prefix (CIDR subnet) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv4Prefix.hpp"
+#include <string>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the IPv4Prefix class that accepts CIDR notation.
+     *
+     * The string should follow the standard CIDR format, such as "192.168.0.0/24".
+     * Host bits of the address part are cleared.
+     *
+     * @param cPrefixStr A string representation of an IPv4 prefix.
+     *
+     * @throw std::invalid_argument If the string is empty or has no prefix length.
+     * @throw std::out_of_range If the prefix length is greater than 32.
+     */
+    IPv4Prefix::IPv4Prefix(const std::string &cPrefixStr)
+    {
+        if (cPrefixStr.empty())
+        {
+            throw std::invalid_argument(EMPTY_STRING);
+        }
+
+        const size_t cSlashPos = cPrefixStr.find(SLASH);
+        if (cSlashPos == std::string::npos || cSlashPos + 1 == cPrefixStr.size())
+        {
+            throw std::invalid_argument(MISSING_PREFIX_LENGTH);
+        }
+
+        const int cLength = std::stoi(cPrefixStr.substr(cSlashPos + 1));
+        if (cLength < 0 || cLength > MAX_PREFIX_LENGTH)
+        {
+            throw std::out_of_range(PREFIX_LENGTH_OUT_OF_RANGE);
+        }
+
+        *this = IPv4Prefix(IPv4Address(cPrefixStr.substr(0, cSlashPos)), static_cast<uint8_t>(cLength));
+    } /* IPv4Prefix::IPv4Prefix(const std::string &cPrefixStr) */
+
+    /**
+     * @brief Returns the prefix in CIDR notation.
+     * @return The prefix as a string (e.g., "192.168.0.0/24").
+     */
+    std::string IPv4Prefix::ToString() const
+    {
+        return _address.ToString() + SLASH + std::to_string(_length);
+    } /* std::string IPv4Prefix::ToString() const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,190 @@
+/**
+ * @file IPv4Prefix.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4Prefix (CIDR subnet) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV4PREFIX_H
+#define IPV4PREFIX_H
+#include "IPv4Address.hpp"
+#include "IPv4Range.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv4Prefix
+     * @brief Represents an IPv4 prefix (subnet) in CIDR notation, e.g. 192.168.0.0/24.
+     *
+     * Host bits of the address are always cleared, so the stored address is the network address.
+     * The prefix can be iterated like a range of all addresses it contains.
+     */
+    class IPv4Prefix
+    {
+    public:
+        /**
+         * @brief Maximum IPv4 prefix length.
+         */
+        static constexpr uint8_t MAX_PREFIX_LENGTH = 32;
+
+        /**
+         * @brief Default constructor. Creates the 0.0.0.0/0 prefix.
+         */
+        constexpr IPv4Prefix() = default;
+
+        /**
+         * @brief Constructor for the IPv4Prefix class.
+         * @param cAddress Any address within the prefix. Host bits are cleared.
+         * @param cLength The prefix length in bits.
+         * @throws std::out_of_range If the prefix length is greater than 32.
+         */
+        constexpr IPv4Prefix(const IPv4Address &cAddress, const uint8_t &cLength);
+
+        /**
+         * @brief Constructor for the IPv4Prefix class that accepts CIDR notation.
+         * @param cPrefixStr A string representation of an IPv4 prefix (e.g., "192.168.0.0/24").
+         * @throws std::invalid_argument If the string is empty or has no prefix length.
+         * @throws std::out_of_range If the prefix length is greater than 32.
+         */
+        IPv4Prefix(const std::string &cPrefixStr);
+
+        /**
+         * @brief Returns the network mask for the given prefix length.
+         * @param cLength The prefix length in bits, must not exceed 32.
+         * @return The mask as a host-order integer (e.g., 0xFFFFFF00 for /24).
+         */
+        static constexpr uint32_t MaskFromLength(const uint8_t &cLength) { return cLength == 0 ? 0 : UINT32_MAX << (MAX_PREFIX_LENGTH - cLength); }
+
+        /**
+         * @brief Returns the network address of the prefix.
+         * @return The network IPv4 address.
+         */
+        constexpr IPv4Address GetAddress() const { return _address; }
+
+        /**
+         * @brief Returns the prefix length.
+         * @return The prefix length in bits.
+         */
+        constexpr uint8_t GetLength() const { return _length; }
+
+        /**
+         * @brief Returns the network mask of the prefix.
+         * @return The network mask as an IPv4 address (e.g., 255.255.255.0 for /24).
+         */
+        constexpr IPv4Address GetMask() const { return IPv4Address::FromUint32(MaskFromLength(_length)); }
+
+        /**
+         * @brief Returns the first address of the prefix (network address).
+         * @return The first IPv4 address.
+         */
+        constexpr IPv4Address First() const { return _address; }
+
+        /**
+         * @brief Returns the last address of the prefix (broadcast address).
+         * @return The last IPv4 address.
+         */
+        constexpr IPv4Address Last() const { return IPv4Address::FromUint32(_address.ToUint32() | ~MaskFromLength(_length)); }
+
+        /**
+         * @brief Returns the number of addresses in the prefix.
+         * @return The number of addresses, up to 2^32.
+         */
+        constexpr uint64_t Size() const { return static_cast<uint64_t>(1) << (MAX_PREFIX_LENGTH - _length); }
+
+        /**
+         * @brief Checks whether the address belongs to the prefix.
+         * @param cAddress The IPv4 address to check.
+         * @return `true` if the address is within the prefix, `false` otherwise.
+         */
+        constexpr bool Contains(const IPv4Address &cAddress) const { return (cAddress.ToUint32() & MaskFromLength(_length)) == _address.ToUint32(); }
+
+        /**
+         * @brief Checks whether another prefix is fully covered by this one.
+         * @param cPrefix The IPv4 prefix to check.
+         * @return `true` if the prefix is equal to or more specific than this one, `false` otherwise.
+         */
+        constexpr bool Contains(const IPv4Prefix &cPrefix) const { return cPrefix._length >= _length && Contains(cPrefix._address); }
+
+        /**
+         * @brief Returns all addresses of the prefix as a range.
+         * @return The IPv4 range [First(), Last()].
+         */
+        constexpr IPv4Range ToRange() const { return IPv4Range(First(), Last()); }
+
+        /**
+         * @brief Returns an iterator to the first address of the prefix.
+         * @return The begin iterator.
+         */
+        constexpr IPv4AddressIterator begin() const { return IPv4AddressIterator{_address.ToUint32()}; }
+
+        /**
+         * @brief Returns an iterator past the last address of the prefix.
+         * @return The end iterator.
+         */
+        constexpr IPv4AddressIterator end() const { return IPv4AddressIterator{_address.ToUint32() + Size()}; }
+
+        /**
+         * @brief Returns the prefix in CIDR notation.
+         * @return The prefix as a string (e.g., "192.168.0.0/24").
+         */
+        std::string ToString() const;
+
+        constexpr bool operator==(const IPv4Prefix &cOther) const { return _length == cOther._length && _address.ToUint32() == cOther._address.ToUint32(); }
+        constexpr bool operator!=(const IPv4Prefix &cOther) const { return !(*this == cOther); }
+
+    private:
+        /**
+         * @brief Network address (host bits cleared).
+         */
+        IPv4Address _address{};
+
+        /**
+         * @brief Prefix length in bits.
+         */
+        uint8_t _length{};
+
+        /**
+         * @brief Separator between address and prefix length.
+         */
+        static constexpr char SLASH{'/'};
+
+        /**
+         * @brief Error message indicating a prefix length greater than 32.
+         */
+        static constexpr char PREFIX_LENGTH_OUT_OF_RANGE[]{"[EthernetParameter::IPv4Prefix] Prefix length out of range!"};
+
+        /**
+         * @brief Error message indicating a string without a prefix length.
+         */
+        static constexpr char MISSING_PREFIX_LENGTH[]{"[EthernetParameter::IPv4Prefix] Missing prefix length!"};
+
+        /**
+         * @brief Error message indicating an empty string encountered.
+         */
+        static constexpr char EMPTY_STRING[]{"[EthernetParameter::IPv4Prefix] Empty string encountered!"};
+    }; /* class IPv4Prefix */
+
+    constexpr IPv4Prefix::IPv4Prefix(const IPv4Address &cAddress, const uint8_t &cLength)
+        : _address{IPv4Address::FromUint32(cAddress.ToUint32() & MaskFromLength(cLength <= MAX_PREFIX_LENGTH ? cLength : 0))}, _length{cLength}
+    {
+        if (cLength > MAX_PREFIX_LENGTH)
+        {
+            throw std::out_of_range(PREFIX_LENGTH_OUT_OF_RANGE);
+        }
+    } /* IPv4Prefix::IPv4Prefix(const IPv4Address &cAddress, const uint8_t &cLength) */
+}
+
+#endif /* IPV4PREFIX_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,214 @@
+/**
+ * @file IPv4Range.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief IPv4Range and IPv4AddressIterator class definitions.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV4RANGE_H
+#define IPV4RANGE_H
+#include "IPv4Address.hpp"
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv4AddressIterator
+     * @brief Random-access iterator over consecutive IPv4 addresses.
+     *
+     * The iterator keeps the address as a plain 64-bit counter, so stepping through a range
+     * is a single integer operation. The counter may hold 2^32, which is the past-the-end
+     * position of a range ending at 255.255.255.255. Dereferencing yields the address by value.
+     */
+    class IPv4AddressIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = IPv4Address;
+        using difference_type = int64_t;
+        using pointer = void;
+        using reference = IPv4Address;
+
+        /**
+         * @brief Default constructor. Points at 0.0.0.0.
+         */
+        constexpr IPv4AddressIterator() = default;
+
+        /**
+         * @brief Constructor that points the iterator at the given numeric position.
+         * @param cPosition The address as a host-order integer, or 2^32 for past-the-end.
+         */
+        constexpr explicit IPv4AddressIterator(const uint64_t &cPosition) : _position{cPosition} {}
+
+        /**
+         * @brief Returns the address the iterator points at.
+         * @return The current IPv4 address.
+         */
+        constexpr IPv4Address operator*() const { return IPv4Address::FromUint32(static_cast<uint32_t>(_position)); }
+
+        /**
+         * @brief Returns the address at the given offset from the iterator.
+         * @param cOffset The offset, may be negative.
+         * @return The IPv4 address at the offset.
+         */
+        constexpr IPv4Address operator[](const difference_type &cOffset) const { return *(*this + cOffset); }
+
+        constexpr IPv4AddressIterator &operator++()
+        {
+            ++_position;
+            return *this;
+        }
+
+        constexpr IPv4AddressIterator operator++(int)
+        {
+            IPv4AddressIterator previous{*this};
+            ++_position;
+            return previous;
+        }
+
+        constexpr IPv4AddressIterator &operator--()
+        {
+            --_position;
+            return *this;
+        }
+
+        constexpr IPv4AddressIterator operator--(int)
+        {
+            IPv4AddressIterator previous{*this};
+            --_position;
+            return previous;
+        }
+
+        constexpr IPv4AddressIterator &operator+=(const difference_type &cOffset)
+        {
+            _position += static_cast<uint64_t>(cOffset);
+            return *this;
+        }
+
+        constexpr IPv4AddressIterator &operator-=(const difference_type &cOffset)
+        {
+            _position -= static_cast<uint64_t>(cOffset);
+            return *this;
+        }
+
+        constexpr IPv4AddressIterator operator+(const difference_type &cOffset) const { return IPv4AddressIterator{_position + static_cast<uint64_t>(cOffset)}; }
+        constexpr IPv4AddressIterator operator-(const difference_type &cOffset) const { return IPv4AddressIterator{_position - static_cast<uint64_t>(cOffset)}; }
+        constexpr difference_type operator-(const IPv4AddressIterator &cOther) const { return static_cast<difference_type>(_position - cOther._position); }
+
+        friend constexpr IPv4AddressIterator operator+(const difference_type &cOffset, const IPv4AddressIterator &cIterator) { return cIterator + cOffset; }
+
+        constexpr bool operator==(const IPv4AddressIterator &cOther) const { return _position == cOther._position; }
+        constexpr bool operator!=(const IPv4AddressIterator &cOther) const { return _position != cOther._position; }
+        constexpr bool operator<(const IPv4AddressIterator &cOther) const { return _position < cOther._position; }
+        constexpr bool operator>(const IPv4AddressIterator &cOther) const { return _position > cOther._position; }
+        constexpr bool operator<=(const IPv4AddressIterator &cOther) const { return _position <= cOther._position; }
+        constexpr bool operator>=(const IPv4AddressIterator &cOther) const { return _position >= cOther._position; }
+
+    private:
+        /**
+         * @brief Current address as a host-order integer (2^32 means past 255.255.255.255).
+         */
+        uint64_t _position{};
+    }; /* class IPv4AddressIterator */
+
+    /**
+     * @class IPv4Range
+     * @brief Represents an inclusive range of IPv4 addresses [first, last].
+     */
+    class IPv4Range
+    {
+    public:
+        /**
+         * @brief Constructor for the IPv4Range class.
+         * @param cFirst The first address of the range.
+         * @param cLast The last address of the range (inclusive).
+         * @throws std::invalid_argument If the first address is greater than the last one.
+         */
+        constexpr IPv4Range(const IPv4Address &cFirst, const IPv4Address &cLast);
+
+        /**
+         * @brief Returns the first address of the range.
+         * @return The first IPv4 address.
+         */
+        constexpr IPv4Address GetFirst() const { return _first; }
+
+        /**
+         * @brief Returns the last address of the range.
+         * @return The last IPv4 address.
+         */
+        constexpr IPv4Address GetLast() const { return _last; }
+
+        /**
+         * @brief Returns the number of addresses in the range.
+         * @return The number of addresses, up to 2^32.
+         */
+        constexpr uint64_t Size() const { return static_cast<uint64_t>(_last.ToUint32()) - _first.ToUint32() + 1; }
+
+        /**
+         * @brief Checks whether the address belongs to the range.
+         * @param cAddress The IPv4 address to check.
+         * @return `true` if the address is within [first, last], `false` otherwise.
+         */
+        constexpr bool Contains(const IPv4Address &cAddress) const { return _first <= cAddress && cAddress <= _last; }
+
+        /**
+         * @brief Returns the address at the given index of the range. The index is not checked.
+         * @param cIndex The index, must be lower than Size().
+         * @return The IPv4 address at the index.
+         */
+        constexpr IPv4Address operator[](const uint64_t &cIndex) const { return IPv4Address::FromUint32(static_cast<uint32_t>(_first.ToUint32() + cIndex)); }
+
+        /**
+         * @brief Returns an iterator to the first address of the range.
+         * @return The begin iterator.
+         */
+        constexpr IPv4AddressIterator begin() const { return IPv4AddressIterator{_first.ToUint32()}; }
+
+        /**
+         * @brief Returns an iterator past the last address of the range.
+         * @return The end iterator.
+         */
+        constexpr IPv4AddressIterator end() const { return IPv4AddressIterator{static_cast<uint64_t>(_last.ToUint32()) + 1}; }
+
+        constexpr bool operator==(const IPv4Range &cOther) const { return _first.ToUint32() == cOther._first.ToUint32() && _last.ToUint32() == cOther._last.ToUint32(); }
+        constexpr bool operator!=(const IPv4Range &cOther) const { return !(*this == cOther); }
+
+    private:
+        /**
+         * @brief First address of the range.
+         */
+        IPv4Address _first{};
+
+        /**
+         * @brief Last address of the range (inclusive).
+         */
+        IPv4Address _last{};
+
+        /**
+         * @brief Error message indicating a range whose first address is greater than the last one.
+         */
+        static constexpr char INVALID_RANGE[]{"[EthernetParameter::IPv4Range] First address is greater than the last one!"};
+    }; /* class IPv4Range */
+
+    constexpr IPv4Range::IPv4Range(const IPv4Address &cFirst, const IPv4Address &cLast) : _first{cFirst}, _last{cLast}
+    {
+        if (cLast < cFirst)
+        {
+            throw std::invalid_argument(INVALID_RANGE);
+        }
+    } /* IPv4Range::IPv4Range(const IPv4Address &cFirst, const IPv4Address &cLast) */
+}
+
+#endif /* IPV4RANGE_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
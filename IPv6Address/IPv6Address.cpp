@@ -12,19 +12,161 @@
  *            All rights reserved.
  */
 #include "IPv6Address.hpp"
+#include <array>
 #include <stdexcept>
-#include <sstream>
-#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <string_view>
 #include <cstring>
 
 namespace EthernetParameter
 {
-    /**
-     * @brief Default constructor for IPv6Address class.
-     * Initializes an empty IPv6 address.
-     */
-    IPv6Address::IPv6Address()
+    namespace
     {
+        /**
+         * @brief Builds the lookup table of reverse nibble labels: byte 0xAB maps to "b.a.".
+         * @return The table indexed by byte value.
+         */
+        constexpr std::array<std::array<char, 4>, 256> MakeNibbleLabels()
+        {
+            constexpr char cHexDigits[]{"0123456789abcdef"};
+            std::array<std::array<char, 4>, 256> table{};
+            for (uint16_t value = 0; value < 256; value++)
+            {
+                table[value] = {cHexDigits[value & 0x0F], '.', cHexDigits[value >> 4], '.'};
+            }
+            return table;
+        }
+
+        /**
+         * @brief Builds the lookup table of hexadecimal digit values, 0xFF for non-digits.
+         * @return The table indexed by character.
+         */
+        constexpr std::array<uint8_t, 256> MakeHexValues()
+        {
+            std::array<uint8_t, 256> table{};
+            for (uint16_t c = 0; c < 256; c++)
+            {
+                table[c] = (c >= '0' && c <= '9') ? static_cast<uint8_t>(c - '0')
+                           : (c >= 'a' && c <= 'f') ? static_cast<uint8_t>(c - 'a' + 10)
+                           : (c >= 'A' && c <= 'F') ? static_cast<uint8_t>(c - 'A' + 10)
+                                                    : 0xFF;
+            }
+            return table;
+        }
+
+        /**
+         * @brief Reverse nibble labels of all byte values.
+         */
+        constexpr std::array<std::array<char, 4>, 256> NIBBLE_LABELS = MakeNibbleLabels();
+
+        /**
+         * @brief Values of hexadecimal digits.
+         */
+        constexpr std::array<uint8_t, 256> HEX_VALUES = MakeHexValues();
+
+        /**
+         * @brief Reverse DNS zone suffix for IPv6.
+         */
+        constexpr char IP6_ARPA[]{"ip6.arpa"};
+
+        /**
+         * @brief Parses a dotted-decimal IPv4 address that ends an IPv6 address.
+         * @param cText The text of the IPv4 part.
+         * @param cLength The length of the IPv4 part.
+         * @param octets The four parsed octets.
+         * @return `true` if the text is a valid IPv4 address, `false` otherwise.
+         */
+        bool ParseIPv4Tail(const char *cText, const size_t &cLength, uint8_t *octets)
+        {
+            size_t i{};
+            for (uint8_t octet = 0; octet < 4; octet++)
+            {
+                const size_t cStart = i;
+                uint16_t value{};
+                while (i < cLength && i - cStart < 3 && cText[i] >= '0' && cText[i] <= '9')
+                {
+                    value = static_cast<uint16_t>(value * 10 + (cText[i] - '0'));
+                    i++;
+                }
+
+                if (i == cStart || value > 255 || (i - cStart > 1 && cText[cStart] == '0'))
+                {
+                    return false;
+                }
+                octets[octet] = static_cast<uint8_t>(value);
+
+                if (octet < 3 && (i == cLength || cText[i++] != '.'))
+                {
+                    return false;
+                }
+            }
+
+            return i == cLength;
+        }
+
+        /**
+         * @brief Lowercase hexadecimal digits.
+         */
+        constexpr char HEX_DIGITS[]{"0123456789abcdef"};
+
+        /**
+         * @brief Longest text TryParse() accepts: six groups and a dotted IPv4 tail.
+         */
+        constexpr size_t MAX_TEXT_LENGTH = 45;
+
+        /**
+         * @brief Writes the full text of an address: eight groups of four hex digits.
+         * @param cGroups The eight groups.
+         * @param output Receives the text; at least 40 bytes, for the colon stored after the last group.
+         * @return The length of the text, always 39.
+         */
+        size_t WriteGroups(const uint16_t *cGroups, char *output)
+        {
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                char *group = output + 5 * i;
+                group[0] = HEX_DIGITS[cGroups[i] >> 12];
+                group[1] = HEX_DIGITS[cGroups[i] >> 8 & 0x0F];
+                group[2] = HEX_DIGITS[cGroups[i] >> 4 & 0x0F];
+                group[3] = HEX_DIGITS[cGroups[i] & 0x0F];
+                group[4] = ':';
+            }
+            return 39;
+        }
+
+        /**
+         * @brief Reads the characters an IPv6 address can hold from a stream, after leading whitespace.
+         * @param is The input stream; eofbit is set if the text runs to the end of the stream.
+         * @param text Receives the characters.
+         * @param cCapacity The size of the text buffer.
+         * @return The number of characters read, or cCapacity + 1 if the text does not fit.
+         */
+        size_t ExtractToken(std::istream &is, char *text, const size_t &cCapacity)
+        {
+            using Traits = std::istream::traits_type;
+            std::streambuf *buffer = is.rdbuf();
+            size_t length{};
+            for (Traits::int_type character = buffer->sgetc();; character = buffer->snextc())
+            {
+                if (Traits::eq_int_type(character, Traits::eof()))
+                {
+                    is.setstate(std::ios_base::eofbit);
+                    break;
+                }
+                const char cCharacter = Traits::to_char_type(character);
+                if (HEX_VALUES[static_cast<uint8_t>(cCharacter)] == 0xFF && cCharacter != ':' && cCharacter != '.')
+                {
+                    break;
+                }
+                if (length == cCapacity)
+                {
+                    return cCapacity + 1;
+                }
+                text[length++] = cCharacter;
+            }
+            return length;
+        }
     }
 
     /**
@@ -35,14 +177,7 @@ namespace EthernetParameter
      */
     IPv6Address::IPv6Address(const uint8_t *cBinaryContent)
     {
-        if (cBinaryContent)
-        {
-            memcpy(_ipv6Address, cBinaryContent, IPV6_ADDRESS_BYTE_LENGTH);
-        }
-        else
-        {
-            throw std::invalid_argument(NULL_PTR_EXCEPTION_MESSAGE);
-        }
+        SetFromBinary(cBinaryContent);
     } /* IPv6Address::IPv6Address(const uint8_t *cBinaryContent) */
 
     /**
@@ -56,7 +191,7 @@ namespace EthernetParameter
         if (!cBinaryContent.empty())
         {
             if (cBinaryContent.size() == IPV6_ADDRESS_BYTE_LENGTH)
-                memcpy(_ipv6Address, cBinaryContent.data(), IPV6_ADDRESS_BYTE_LENGTH);
+                SetFromBinary(cBinaryContent.data());
             else
                 throw std::invalid_argument(INVALID_BINARY_CONTENT_SIZE_EXCEPTION_MESSAGE);
         }
@@ -99,21 +234,122 @@ namespace EthernetParameter
         }
     } /* IPv6Address::IPv6Address(const std::string &cAddressStr) */
 
+    /**
+     * @brief Parses an IPv6 address in any RFC 4291 text form without throwing or allocating.
+     *
+     * Groups are collected left to right, the position of "::" is remembered and the groups
+     * after it are moved to the end once the whole text is read. A dotted IPv4 tail is accepted
+     * in place of the last two groups.
+     *
+     * @param cText The text to parse (not necessarily null-terminated).
+     * @param cLength The number of characters to parse.
+     * @param address The parsed address, untouched if the text is invalid.
+     * @return `true` if the text is a valid IPv6 address, `false` otherwise.
+     */
+    bool IPv6Address::TryParse(const char *cText, const size_t &cLength, IPv6Address &address)
+    {
+        if (!cText || cLength < 2 || cLength > 45)
+        {
+            return false;
+        }
+
+        uint16_t groups[IPV6_ADDRESS_GROUPS_NUMBER]{};
+        uint8_t groupCount{};
+        int8_t compressedAt{-1};
+        size_t i{};
+
+        if (cText[0] == ':')
+        {
+            if (cText[1] != ':')
+            {
+                return false;
+            }
+            compressedAt = 0;
+            i = 2;
+        }
+
+        while (i < cLength)
+        {
+            const size_t cGroupStart = i;
+            uint16_t value{};
+            while (i < cLength && i - cGroupStart < 4 && HEX_VALUES[static_cast<uint8_t>(cText[i])] != 0xFF)
+            {
+                value = static_cast<uint16_t>((value << 4) | HEX_VALUES[static_cast<uint8_t>(cText[i])]);
+                i++;
+            }
+
+            if (i < cLength && cText[i] == '.')
+            {
+                // Dotted IPv4 tail, it has to be the last part of the text.
+                uint8_t octets[4]{};
+                if (groupCount > IPV6_ADDRESS_GROUPS_NUMBER - 2 || !ParseIPv4Tail(cText + cGroupStart, cLength - cGroupStart, octets))
+                {
+                    return false;
+                }
+                groups[groupCount++] = static_cast<uint16_t>((octets[0] << 8) | octets[1]);
+                groups[groupCount++] = static_cast<uint16_t>((octets[2] << 8) | octets[3]);
+                i = cLength;
+                break;
+            }
+
+            if (i == cGroupStart || groupCount == IPV6_ADDRESS_GROUPS_NUMBER)
+            {
+                return false;
+            }
+            groups[groupCount++] = value;
+
+            if (i == cLength)
+            {
+                break;
+            }
+
+            if (cText[i] != ':' || ++i == cLength)
+            {
+                return false;
+            }
+
+            if (cText[i] == ':')
+            {
+                if (compressedAt >= 0)
+                {
+                    return false;
+                }
+                compressedAt = static_cast<int8_t>(groupCount);
+                i++;
+            }
+        }
+
+        if (compressedAt >= 0)
+        {
+            if (groupCount == IPV6_ADDRESS_GROUPS_NUMBER)
+            {
+                return false;
+            }
+
+            const uint8_t cTail = static_cast<uint8_t>(groupCount - compressedAt);
+            for (uint8_t j = 0; j < cTail; j++)
+            {
+                groups[IPV6_ADDRESS_GROUPS_NUMBER - 1 - j] = groups[groupCount - 1 - j];
+                groups[groupCount - 1 - j] = 0;
+            }
+        }
+        else if (groupCount != IPV6_ADDRESS_GROUPS_NUMBER)
+        {
+            return false;
+        }
+
+        memcpy(address._ipv6Address, groups, sizeof(groups));
+        return true;
+    } /* bool IPv6Address::TryParse(const char *cText, const size_t &cLength, IPv6Address &address) */
+
     /**
      * @brief Returns a string representation of the IPv6 address.
      * @return A string representation of the IPv6 address.
      */
     std::string IPv6Address::ToString() const
     {
-        std::stringstream ss;
-        ss << std::hex << std::setfill('0');
-        for (int i = 0; i < IPV6_ADDRESS_GROUPS_NUMBER; i++)
-        {
-            ss << std::setw(4) << _ipv6Address[i];
-            if (i < IPV6_ADDRESS_GROUPS_NUMBER - 1)
-                ss << ":";
-        }
-        return ss.str();
+        char text[40];
+        return std::string(text, WriteGroups(_ipv6Address, text));
     } /* std::string IPv6Address::ToString() const */
 
     /**
@@ -125,14 +361,11 @@ namespace EthernetParameter
     {
         if (destDataPtr)
         {
-            uint8_t bytes[2]{};
-            uint16_t group{};
+            // Binary form is in network byte order (most significant byte of each group first).
             for (int i = 0; i < IPV6_ADDRESS_GROUPS_NUMBER; ++i)
             {
-                group = _ipv6Address[i];
-                memcpy(bytes, &group, sizeof(bytes));
-                *destDataPtr++ = bytes[0];
-                *destDataPtr++ = bytes[1];
+                *destDataPtr++ = static_cast<uint8_t>(_ipv6Address[i] >> 8);
+                *destDataPtr++ = static_cast<uint8_t>(_ipv6Address[i]);
             }
         }
         else
@@ -145,8 +378,7 @@ namespace EthernetParameter
      */
     std::vector<uint8_t> IPv6Address::ToBinary() const
     {
-        std::vector<uint8_t> binaryRepresentation;
-        binaryRepresentation.reserve(IPV6_ADDRESS_BYTE_LENGTH);
+        std::vector<uint8_t> binaryRepresentation(IPV6_ADDRESS_BYTE_LENGTH);
         ToBinary(binaryRepresentation.data());
         return binaryRepresentation;
     } /* std::vector<uint8_t> IPv6Address::ToBinary() const */
@@ -160,14 +392,11 @@ namespace EthernetParameter
     {
         if (cBinaryAddress)
         {
-            uint8_t bytes[2]{};
-            uint16_t group;
+            // Binary form is in network byte order (most significant byte of each group first).
             for (int i = 0; i < IPV6_ADDRESS_GROUPS_NUMBER; ++i)
             {
-                bytes[0] = *cBinaryAddress++;
-                bytes[1] = *cBinaryAddress++;
-                memcpy(&group, bytes, sizeof(group));
-                _ipv6Address[i] = group;
+                _ipv6Address[i] = static_cast<uint16_t>((cBinaryAddress[0] << 8) | cBinaryAddress[1]);
+                cBinaryAddress += 2;
             }
         }
         else
@@ -198,16 +427,80 @@ namespace EthernetParameter
     } /* void IPv6Address::Clear() */
 
     /**
-     * @brief Copy assignment operator.
-     * @param cAddress The IPv6 address to copy.
-     * @return A reference to the left-hand side object.
+     * @brief Writes the reverse DNS (PTR) name of the address in nibble form.
+     *
+     * Every byte is written as two labels taken from a lookup table, starting with the least
+     * significant byte, so no memory is allocated.
+     *
+     * @param destBuffer The buffer to write the null-terminated name to.
+     * @param cBufferSize The size of the buffer, at least REVERSE_NAME_LENGTH + 1 bytes.
+     * @return The length of the name without the terminating null (always REVERSE_NAME_LENGTH).
+     * @throw std::invalid_argument If the buffer is null or too small for the name.
      */
-    IPv6Address &IPv6Address::operator=(const IPv6Address &cAddress)
+    size_t IPv6Address::ToReverseName(char *destBuffer, const size_t &cBufferSize) const
     {
-        if (this != &cAddress)
-            memcpy(_ipv6Address, cAddress._ipv6Address, IPV6_ADDRESS_BYTE_LENGTH);
-        return *this;
-    } /* IPv6Address &IPv6Address::operator=(const IPv6Address &cAddress) */
+        if (!destBuffer)
+        {
+            throw std::invalid_argument(NULL_PTR_EXCEPTION_MESSAGE);
+        }
+
+        if (cBufferSize <= REVERSE_NAME_LENGTH)
+        {
+            throw std::invalid_argument(BUFFER_TOO_SMALL_EXCEPTION_MESSAGE);
+        }
+
+        char *position = destBuffer;
+        for (uint8_t i = IPV6_ADDRESS_GROUPS_NUMBER; i > 0; i--)
+        {
+            const uint16_t cGroup = _ipv6Address[i - 1];
+            memcpy(position, NIBBLE_LABELS[cGroup & 0xFF].data(), 4);
+            memcpy(position + 4, NIBBLE_LABELS[cGroup >> 8].data(), 4);
+            position += 8;
+        }
+        memcpy(position, IP6_ARPA, sizeof(IP6_ARPA));
+
+        return REVERSE_NAME_LENGTH;
+    } /* size_t IPv6Address::ToReverseName(char *destBuffer, const size_t &cBufferSize) const */
+
+    /**
+     * @brief Parses a nibble form reverse DNS name into an address.
+     * @param cName The name, 32 hexadecimal nibble labels followed by "ip6.arpa" (any case, optional trailing dot).
+     * @param cLength The length of the name.
+     * @param address The parsed address, untouched if the name is invalid.
+     * @return `true` if the name was parsed, `false` if it is not a valid reverse name.
+     */
+    bool IPv6Address::FromReverseName(const char *cName, const size_t &cLength, IPv6Address &address)
+    {
+        if (!cName || (cLength != REVERSE_NAME_LENGTH && !(cLength == REVERSE_NAME_LENGTH + 1 && cName[REVERSE_NAME_LENGTH] == '.')))
+        {
+            return false;
+        }
+
+        uint16_t groups[IPV6_ADDRESS_GROUPS_NUMBER]{};
+        for (uint8_t nibble = 0; nibble < 4 * IPV6_ADDRESS_GROUPS_NUMBER; nibble++)
+        {
+            const uint8_t cValue = HEX_VALUES[static_cast<uint8_t>(cName[2 * nibble])];
+            if (cValue == 0xFF || cName[2 * nibble + 1] != '.')
+            {
+                return false;
+            }
+
+            groups[IPV6_ADDRESS_GROUPS_NUMBER - 1 - nibble / 4] |= static_cast<uint16_t>(cValue << (4 * (nibble % 4)));
+        }
+
+        const char *cSuffix = cName + 8 * IPV6_ADDRESS_GROUPS_NUMBER;
+        for (size_t i = 0; i < sizeof(IP6_ARPA) - 1; i++)
+        {
+            const char cLower = (cSuffix[i] >= 'A' && cSuffix[i] <= 'Z') ? static_cast<char>(cSuffix[i] | 0x20) : cSuffix[i];
+            if (cLower != IP6_ARPA[i])
+            {
+                return false;
+            }
+        }
+
+        memcpy(address._ipv6Address, groups, sizeof(groups));
+        return true;
+    } /* bool IPv6Address::FromReverseName(const char *cName, const size_t &cLength, IPv6Address &address) */
 
     /**
      * @brief Equality comparison operator.
@@ -238,64 +531,54 @@ namespace EthernetParameter
      */
     std::ostream &operator<<(std::ostream &os, const IPv6Address &cAddress)
     {
-        return os << cAddress.ToString();
+        char text[40];
+        const size_t cLength = WriteGroups(cAddress._ipv6Address, text);
+        if (os.width())
+        {
+            // Padding needs formatted output; a string_view still avoids the temporary string.
+            return os << std::string_view(text, cLength);
+        }
+        return os.write(text, static_cast<std::streamsize>(cLength));
     } /* std::ostream &operator<<(std::ostream &os, const IPv6Address &cAddress) */
 
+    /**
+     * @brief Stream extraction operator.
+     * Skips leading whitespace, then reads hex digits, colons and dots into a stack buffer and
+     * parses them with TryParse(). Reading stops at the first other character, which is left in
+     * the stream.
+     * @param is The input stream.
+     * @param address The IPv6 address read, untouched if the text is invalid.
+     * @return The input stream, with failbit set if the text is not a valid IPv6 address.
+     */
+    std::istream &operator>>(std::istream &is, IPv6Address &address)
+    {
+        const std::istream::sentry cSentry(is);
+        if (cSentry)
+        {
+            char text[MAX_TEXT_LENGTH];
+            const size_t cLength = ExtractToken(is, text, sizeof(text));
+            if (cLength > sizeof(text) || !IPv6Address::TryParse(text, cLength, address))
+            {
+                is.setstate(std::ios_base::failbit);
+            }
+        }
+        return is;
+    } /* std::istream &operator>>(std::istream &is, IPv6Address &address) */
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // Private Methods.
 
     /**
-     * @brief Parses an IPv6 address string and fills the IPv6Address object.
-     * @param cAddressCStr A pointer to a null-terminated string that represents an IPv6 address.
-     * @throw std::invalid_argument if cAddressCStr is an invalid IPv6 address string.
+     * @brief Parses the IPv6 address string.
+     * @param cAddressCStr The null-terminated IPv6 address string to parse.
+     * @throw std::invalid_argument If the string is not a valid IPv6 address.
      */
     void IPv6Address::ParseIpV6(const char *cAddressCStr)
     {
-        uint8_t groupIndex = 0;
-        uint16_t value = 0;
-        uint8_t digits = 0;
-        const char *token = cAddressCStr;
-
-        while (groupIndex < IPV6_ADDRESS_GROUPS_NUMBER)
+        if (!TryParse(cAddressCStr, strlen(cAddressCStr), *this))
         {
-            // Parse each token as a hexadecimal number
-            value = 0;
-            digits = 0;
-
-            while (*token != '\0' && *token != ':')
-            {
-                char c = *token;
-                value <<= 4; // Shift left by 4 bits
-
-                if (c >= '0' && c <= '9')
-                    value |= (c - '0'); // Add the decimal digit
-                else if (c >= 'a' && c <= 'f')
-                    value |= (c - 'a' + 10); // Add the hexadecimal digit (lowercase)
-                else if (c >= 'A' && c <= 'F')
-                    value |= (c - 'A' + 10); // Add the hexadecimal digit (uppercase)
-                else
-                    throw std::invalid_argument(INVALID_IPV6_ADDRESS_EXCEPTION_MESSAGE);
-
-                digits++;
-                token++;
-            } /* while (*token != '\0' && *token != ':')*/
-
-            if (digits == 0 || digits > 4)
-                throw std::invalid_argument(INVALID_IPV6_ADDRESS_EXCEPTION_MESSAGE);
-
-            _ipv6Address[groupIndex] = value;
-            groupIndex++;
-
-            if (*token == '\0')
-                break;
-
-            token++; // Skip the colon
-
-        } /*while (groupIndex < IPV6_ADDRESS_GROUPS_NUMBER)*/
-
-        if (groupIndex != IPV6_ADDRESS_GROUPS_NUMBER || *token != '\0')
             throw std::invalid_argument(INVALID_IPV6_ADDRESS_EXCEPTION_MESSAGE);
-
+        }
     } /* void IPv6Address::ParseIpV6(const char *cAddressCStr) */
 
 }
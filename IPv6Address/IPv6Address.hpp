@@ -13,7 +13,9 @@
  */
 #ifndef IPV6ADDRESS_H
 #define IPV6ADDRESS_H
+#include <cstddef>
 #include <cstdint>
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -34,7 +36,21 @@ namespace EthernetParameter
         /**
          * @brief Default constructor.
          */
-        IPv6Address();
+        constexpr IPv6Address() = default;
+
+        /**
+         * @brief Constructor that sets the IPv6 address from its eight 16-bit groups.
+         * @param cGroup1 The first (most significant) group.
+         * @param cGroup2 The second group.
+         * @param cGroup3 The third group.
+         * @param cGroup4 The fourth group.
+         * @param cGroup5 The fifth group.
+         * @param cGroup6 The sixth group.
+         * @param cGroup7 The seventh group.
+         * @param cGroup8 The eighth (least significant) group.
+         */
+        constexpr IPv6Address(const uint16_t &cGroup1, const uint16_t &cGroup2, const uint16_t &cGroup3, const uint16_t &cGroup4,
+                              const uint16_t &cGroup5, const uint16_t &cGroup6, const uint16_t &cGroup7, const uint16_t &cGroup8);
 
         /**
          * @brief Constructor that sets the IPv6 address from binary content.
@@ -60,6 +76,39 @@ namespace EthernetParameter
          */
         IPv6Address(const std::string &cAddressStr);
 
+        /**
+         * @brief Parses an IPv6 address in any RFC 4291 text form without throwing or allocating.
+         *
+         * Accepts the full form, "::" compression and an embedded dotted IPv4 tail
+         * (e.g. "2001:db8::1", "::ffff:192.0.2.1"). Groups have 1 to 4 hexadecimal digits of any case.
+         *
+         * @param cText The text to parse (not necessarily null-terminated).
+         * @param cLength The number of characters to parse, all of them must belong to the address.
+         * @param address The parsed address, untouched if the text is invalid.
+         * @return `true` if the text is a valid IPv6 address, `false` otherwise.
+         */
+        static bool TryParse(const char *cText, const size_t &cLength, IPv6Address &address);
+
+        /**
+         * @brief Creates an IPv6 address from its numeric value split into two 64-bit halves.
+         * @param cUpper The most significant 64 bits (groups 1-4).
+         * @param cLower The least significant 64 bits (groups 5-8).
+         * @return The IPv6 address.
+         */
+        static constexpr IPv6Address FromUint64(const uint64_t &cUpper, const uint64_t &cLower);
+
+        /**
+         * @brief Returns the most significant 64 bits (groups 1-4) of the IPv6 address.
+         * @return The upper half as a host-order integer.
+         */
+        constexpr uint64_t GetUpper64() const;
+
+        /**
+         * @brief Returns the least significant 64 bits (groups 5-8) of the IPv6 address.
+         * @return The lower half as a host-order integer.
+         */
+        constexpr uint64_t GetLower64() const;
+
         /**
          * @brief Returns the IPv6 address as a string.
          * @return The IPv6 address as a string.
@@ -95,12 +144,38 @@ namespace EthernetParameter
          */
         void Clear();
 
+        /**
+         * @brief Length of a reverse DNS name (32 nibble labels and "ip6.arpa") without the terminating null.
+         */
+        static constexpr size_t REVERSE_NAME_LENGTH = 72;
+
+        /**
+         * @brief Writes the reverse DNS (PTR) name of the address in nibble form, e.g. "1.0.0.0.[...].8.b.d.0.1.0.0.2.ip6.arpa".
+         * @param destBuffer The buffer to write the null-terminated name to.
+         * @param cBufferSize The size of the buffer, at least REVERSE_NAME_LENGTH + 1 bytes.
+         * @return The length of the name without the terminating null (always REVERSE_NAME_LENGTH).
+         * @throws std::invalid_argument If the buffer is null or too small for the name.
+         */
+        size_t ToReverseName(char *destBuffer, const size_t &cBufferSize) const;
+
+        /**
+         * @brief Parses a nibble form reverse DNS name into an address.
+         * @param cName The name, 32 hexadecimal nibble labels followed by "ip6.arpa" (any case, optional trailing dot).
+         * @param cLength The length of the name.
+         * @param address The parsed address, untouched if the name is invalid.
+         * @return `true` if the name was parsed, `false` if it is not a valid reverse name.
+         */
+        static bool FromReverseName(const char *cName, const size_t &cLength, IPv6Address &address);
+
         /**
          * @brief Assignment operator.
+         *
+         * Defaulted so the class stays trivially copyable and copies in batch loops are inlined.
+         *
          * @param cAddress The IPv6 address to assign.
          * @return A reference to the IPv6 address.
          */
-        IPv6Address &operator=(const IPv6Address &cAddress);
+        IPv6Address &operator=(const IPv6Address &cAddress) = default;
 
         /**
          * @brief Equality comparison operator.
@@ -116,6 +191,94 @@ namespace EthernetParameter
          */
         bool operator!=(const IPv6Address &cAddress) const;
 
+        /**
+         * @brief Less than comparison operator (numeric order).
+         * @param cAddress The IPv6 address to compare.
+         * @return True if this address is numerically lower, false otherwise.
+         */
+        constexpr bool operator<(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Greater than comparison operator (numeric order).
+         * @param cAddress The IPv6 address to compare.
+         * @return True if this address is numerically greater, false otherwise.
+         */
+        constexpr bool operator>(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Less than or equal comparison operator (numeric order).
+         * @param cAddress The IPv6 address to compare.
+         * @return True if this address is numerically lower or equal, false otherwise.
+         */
+        constexpr bool operator<=(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Greater than or equal comparison operator (numeric order).
+         * @param cAddress The IPv6 address to compare.
+         * @return True if this address is numerically greater or equal, false otherwise.
+         */
+        constexpr bool operator>=(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Pre-increment operator. Moves to the next address, wrapping the all-ones address to ::.
+         * @return A reference to the incremented IPv6 address.
+         */
+        constexpr IPv6Address &operator++();
+
+        /**
+         * @brief Post-increment operator. Moves to the next address, wrapping the all-ones address to ::.
+         * @return The IPv6 address before incrementing.
+         */
+        constexpr IPv6Address operator++(int);
+
+        /**
+         * @brief Pre-decrement operator. Moves to the previous address, wrapping :: to the all-ones address.
+         * @return A reference to the decremented IPv6 address.
+         */
+        constexpr IPv6Address &operator--();
+
+        /**
+         * @brief Post-decrement operator. Moves to the previous address, wrapping :: to the all-ones address.
+         * @return The IPv6 address before decrementing.
+         */
+        constexpr IPv6Address operator--(int);
+
+        /**
+         * @brief Moves the address by the given offset (modulo 2^128).
+         * @param cOffset The number of addresses to move by, may be negative.
+         * @return A reference to the moved IPv6 address.
+         */
+        constexpr IPv6Address &operator+=(const int64_t &cOffset);
+
+        /**
+         * @brief Moves the address back by the given offset (modulo 2^128).
+         * @param cOffset The number of addresses to move back by, may be negative.
+         * @return A reference to the moved IPv6 address.
+         */
+        constexpr IPv6Address &operator-=(const int64_t &cOffset);
+
+        /**
+         * @brief Returns the address moved by the given offset (modulo 2^128).
+         * @param cOffset The number of addresses to move by, may be negative.
+         * @return The moved IPv6 address.
+         */
+        constexpr IPv6Address operator+(const int64_t &cOffset) const;
+
+        /**
+         * @brief Returns the address moved back by the given offset (modulo 2^128).
+         * @param cOffset The number of addresses to move back by, may be negative.
+         * @return The moved IPv6 address.
+         */
+        constexpr IPv6Address operator-(const int64_t &cOffset) const;
+
+        /**
+         * @brief Returns the signed distance between two addresses.
+         * The result is only meaningful when the distance fits into int64_t; otherwise it is truncated to the low 64 bits.
+         * @param cAddress The IPv6 address to subtract.
+         * @return The number of addresses from `cAddress` to this address (negative if `cAddress` is greater).
+         */
+        constexpr int64_t operator-(const IPv6Address &cAddress) const;
+
         /**
          * @brief Friend function to write the IPv6 address to an output stream.
          * @param os The output stream.
@@ -124,6 +287,14 @@ namespace EthernetParameter
          */
         friend std::ostream &operator<<(std::ostream &os, const IPv6Address &cAddress);
 
+        /**
+         * @brief Friend function to read an IPv6 address from an input stream, without a temporary string.
+         * @param is The input stream.
+         * @param address The IPv6 address read, untouched on failure.
+         * @return The input stream, with failbit set if the text is not a valid IPv6 address.
+         */
+        friend std::istream &operator>>(std::istream &is, IPv6Address &address);
+
     private:
         /**
          * @brief Number of groups in IPv6 address.
@@ -135,6 +306,13 @@ namespace EthernetParameter
          */
         uint16_t _ipv6Address[IPV6_ADDRESS_GROUPS_NUMBER]{};
 
+        /**
+         * @brief Overwrites all groups with the given numeric value.
+         * @param cUpper The most significant 64 bits.
+         * @param cLower The least significant 64 bits.
+         */
+        constexpr void StoreUint64(const uint64_t &cUpper, const uint64_t &cLower);
+
         /**
          * @brief Parses the IPv6 address string.
          * @param cAddressStr The IPv6 address string to parse.
@@ -156,11 +334,140 @@ namespace EthernetParameter
          */
         static constexpr char EMPTY_STRING_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Address] Empty string exception!"};
 
+        /**
+         * @brief Buffer too small exception error message.
+         */
+        static constexpr char BUFFER_TOO_SMALL_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Address] Destination buffer too small!"};
+
         /**
          * @brief Invalid IPv6 address exception error message.
          */
         static constexpr char INVALID_IPV6_ADDRESS_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Address] Invalid IPv6 address!"};
     }; /* class IPv6Address */
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Constexpr definitions.
+
+    constexpr IPv6Address::IPv6Address(const uint16_t &cGroup1, const uint16_t &cGroup2, const uint16_t &cGroup3, const uint16_t &cGroup4,
+                                       const uint16_t &cGroup5, const uint16_t &cGroup6, const uint16_t &cGroup7, const uint16_t &cGroup8)
+        : _ipv6Address{cGroup1, cGroup2, cGroup3, cGroup4, cGroup5, cGroup6, cGroup7, cGroup8}
+    {
+    } /* IPv6Address::IPv6Address(const uint16_t &cGroup1, ..., const uint16_t &cGroup8) */
+
+    constexpr IPv6Address IPv6Address::FromUint64(const uint64_t &cUpper, const uint64_t &cLower)
+    {
+        IPv6Address address{};
+        address.StoreUint64(cUpper, cLower);
+        return address;
+    } /* IPv6Address IPv6Address::FromUint64(const uint64_t &cUpper, const uint64_t &cLower) */
+
+    constexpr uint64_t IPv6Address::GetUpper64() const
+    {
+        return (static_cast<uint64_t>(_ipv6Address[0]) << 48) | (static_cast<uint64_t>(_ipv6Address[1]) << 32) |
+               (static_cast<uint64_t>(_ipv6Address[2]) << 16) | static_cast<uint64_t>(_ipv6Address[3]);
+    } /* uint64_t IPv6Address::GetUpper64() const */
+
+    constexpr uint64_t IPv6Address::GetLower64() const
+    {
+        return (static_cast<uint64_t>(_ipv6Address[4]) << 48) | (static_cast<uint64_t>(_ipv6Address[5]) << 32) |
+               (static_cast<uint64_t>(_ipv6Address[6]) << 16) | static_cast<uint64_t>(_ipv6Address[7]);
+    } /* uint64_t IPv6Address::GetLower64() const */
+
+    constexpr void IPv6Address::StoreUint64(const uint64_t &cUpper, const uint64_t &cLower)
+    {
+        for (int i = 0; i < IPV6_ADDRESS_GROUPS_NUMBER / 2; i++)
+        {
+            _ipv6Address[i] = static_cast<uint16_t>(cUpper >> (48 - 16 * i));
+            _ipv6Address[i + IPV6_ADDRESS_GROUPS_NUMBER / 2] = static_cast<uint16_t>(cLower >> (48 - 16 * i));
+        }
+    } /* void IPv6Address::StoreUint64(const uint64_t &cUpper, const uint64_t &cLower) */
+
+    constexpr bool IPv6Address::operator<(const IPv6Address &cAddress) const
+    {
+        return GetUpper64() < cAddress.GetUpper64() ||
+               (GetUpper64() == cAddress.GetUpper64() && GetLower64() < cAddress.GetLower64());
+    } /* bool IPv6Address::operator<(const IPv6Address &cAddress) const */
+
+    constexpr bool IPv6Address::operator>(const IPv6Address &cAddress) const
+    {
+        return cAddress < *this;
+    } /* bool IPv6Address::operator>(const IPv6Address &cAddress) const */
+
+    constexpr bool IPv6Address::operator<=(const IPv6Address &cAddress) const
+    {
+        return !(cAddress < *this);
+    } /* bool IPv6Address::operator<=(const IPv6Address &cAddress) const */
+
+    constexpr bool IPv6Address::operator>=(const IPv6Address &cAddress) const
+    {
+        return !(*this < cAddress);
+    } /* bool IPv6Address::operator>=(const IPv6Address &cAddress) const */
+
+    constexpr IPv6Address &IPv6Address::operator++()
+    {
+        return *this += 1;
+    } /* IPv6Address &IPv6Address::operator++() */
+
+    constexpr IPv6Address IPv6Address::operator++(int)
+    {
+        IPv6Address previous{*this};
+        *this += 1;
+        return previous;
+    } /* IPv6Address IPv6Address::operator++(int) */
+
+    constexpr IPv6Address &IPv6Address::operator--()
+    {
+        return *this -= 1;
+    } /* IPv6Address &IPv6Address::operator--() */
+
+    constexpr IPv6Address IPv6Address::operator--(int)
+    {
+        IPv6Address previous{*this};
+        *this -= 1;
+        return previous;
+    } /* IPv6Address IPv6Address::operator--(int) */
+
+    constexpr IPv6Address &IPv6Address::operator+=(const int64_t &cOffset)
+    {
+        // 128-bit two's complement addition of the sign-extended offset.
+        const uint64_t cLower = GetLower64();
+        const uint64_t cNewLower = cLower + static_cast<uint64_t>(cOffset);
+        const uint64_t cCarry = cNewLower < cLower ? 1 : 0;
+        const uint64_t cSignExtension = cOffset < 0 ? UINT64_MAX : 0;
+        StoreUint64(GetUpper64() + cSignExtension + cCarry, cNewLower);
+        return *this;
+    } /* IPv6Address &IPv6Address::operator+=(const int64_t &cOffset) */
+
+    constexpr IPv6Address &IPv6Address::operator-=(const int64_t &cOffset)
+    {
+        // 128-bit subtraction of the sign-extended offset.
+        const uint64_t cLower = GetLower64();
+        const uint64_t cNewLower = cLower - static_cast<uint64_t>(cOffset);
+        const uint64_t cBorrow = cNewLower > cLower ? 1 : 0;
+        const uint64_t cSignExtension = cOffset < 0 ? UINT64_MAX : 0;
+        StoreUint64(GetUpper64() - cSignExtension - cBorrow, cNewLower);
+        return *this;
+    } /* IPv6Address &IPv6Address::operator-=(const int64_t &cOffset) */
+
+    constexpr IPv6Address IPv6Address::operator+(const int64_t &cOffset) const
+    {
+        IPv6Address result{*this};
+        result += cOffset;
+        return result;
+    } /* IPv6Address IPv6Address::operator+(const int64_t &cOffset) const */
+
+    constexpr IPv6Address IPv6Address::operator-(const int64_t &cOffset) const
+    {
+        IPv6Address result{*this};
+        result -= cOffset;
+        return result;
+    } /* IPv6Address IPv6Address::operator-(const int64_t &cOffset) const */
+
+    constexpr int64_t IPv6Address::operator-(const IPv6Address &cAddress) const
+    {
+        // The low 64 bits of the two's complement difference carry the whole result when it fits.
+        return static_cast<int64_t>(GetLower64() - cAddress.GetLower64());
+    } /* int64_t IPv6Address::operator-(const IPv6Address &cAddress) const */
 }
 
 #endif
@@ -0,0 +1,54 @@
+/**
+ * @file IPv6Prefix.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Implementation of the IPv6Prefix class for representing IPv6 prefixes (subnets).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "IPv6Prefix.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor that accepts CIDR notation.
+     * @param cPrefixStr The IPv6 prefix string, host bits of the address part are cleared.
+     * @throw std::invalid_argument if the string is empty, has no prefix length or an invalid address.
+     * @throw std::out_of_range if the prefix length is greater than 128.
+     */
+    IPv6Prefix::IPv6Prefix(const std::string &cPrefixStr)
+    {
+        if (cPrefixStr.empty())
+            throw std::invalid_argument(EMPTY_STRING_EXCEPTION_MESSAGE);
+
+        const size_t cSlashPos = cPrefixStr.find(SLASH);
+        if (cSlashPos == std::string::npos || cSlashPos + 1 == cPrefixStr.size())
+            throw std::invalid_argument(MISSING_PREFIX_LENGTH_EXCEPTION_MESSAGE);
+
+        const int cLength = std::stoi(cPrefixStr.substr(cSlashPos + 1));
+        if (cLength < 0 || cLength > MAX_PREFIX_LENGTH)
+            throw std::out_of_range(PREFIX_LENGTH_OUT_OF_RANGE_EXCEPTION_MESSAGE);
+
+        *this = IPv6Prefix(IPv6Address(cPrefixStr.substr(0, cSlashPos)), static_cast<uint8_t>(cLength));
+    } /* IPv6Prefix::IPv6Prefix(const std::string &cPrefixStr) */
+
+    /**
+     * @brief Returns the prefix in CIDR notation.
+     * @return The prefix as a string.
+     */
+    std::string IPv6Prefix::ToString() const
+    {
+        return _address.ToString() + SLASH + std::to_string(_length);
+    } /* std::string IPv6Prefix::ToString() const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
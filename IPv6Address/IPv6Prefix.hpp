@@ -0,0 +1,212 @@
+/**
+ * @file IPv6Prefix.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Defines the IPv6Prefix class for representing IPv6 prefixes (subnets).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV6PREFIX_H
+#define IPV6PREFIX_H
+#include "IPv6Address.hpp"
+#include "IPv6Range.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv6Prefix
+     * @brief Represents an IPv6 prefix (subnet) in CIDR notation, e.g. 2001:db8::/32.
+     *
+     * Host bits of the address are always cleared, so the stored address is the first address of the prefix.
+     */
+    class IPv6Prefix
+    {
+    public:
+        /**
+         * @brief Maximum IPv6 prefix length.
+         */
+        static constexpr uint8_t MAX_PREFIX_LENGTH{128};
+
+        /**
+         * @brief Default constructor. Creates the ::/0 prefix.
+         */
+        constexpr IPv6Prefix() = default;
+
+        /**
+         * @brief Constructor for the IPv6Prefix class.
+         * @param cAddress Any address within the prefix. Host bits are cleared.
+         * @param cLength The prefix length in bits.
+         * @throw std::out_of_range if the prefix length is greater than 128.
+         */
+        constexpr IPv6Prefix(const IPv6Address &cAddress, const uint8_t &cLength);
+
+        /**
+         * @brief Constructor that accepts CIDR notation.
+         * @param cPrefixStr The IPv6 prefix string (e.g., "2001:0db8:0000:0000:0000:0000:0000:0000/32").
+         * @throw std::invalid_argument if the string is empty, has no prefix length or an invalid address.
+         * @throw std::out_of_range if the prefix length is greater than 128.
+         */
+        IPv6Prefix(const std::string &cPrefixStr);
+
+        /**
+         * @brief Returns the upper 64 bits of the network mask for the given prefix length.
+         * @param cLength The prefix length in bits, must not exceed 128.
+         * @return The upper half of the mask.
+         */
+        static constexpr uint64_t UpperMaskFromLength(const uint8_t &cLength)
+        {
+            return cLength == 0 ? 0 : (cLength >= 64 ? UINT64_MAX : UINT64_MAX << (64 - cLength));
+        }
+
+        /**
+         * @brief Returns the lower 64 bits of the network mask for the given prefix length.
+         * @param cLength The prefix length in bits, must not exceed 128.
+         * @return The lower half of the mask.
+         */
+        static constexpr uint64_t LowerMaskFromLength(const uint8_t &cLength)
+        {
+            return cLength <= 64 ? 0 : UINT64_MAX << (MAX_PREFIX_LENGTH - cLength);
+        }
+
+        /**
+         * @brief Returns the network address of the prefix.
+         * @return The first IPv6 address of the prefix.
+         */
+        constexpr IPv6Address GetAddress() const { return _address; }
+
+        /**
+         * @brief Returns the prefix length.
+         * @return The prefix length in bits.
+         */
+        constexpr uint8_t GetLength() const { return _length; }
+
+        /**
+         * @brief Returns the network mask of the prefix.
+         * @return The network mask as an IPv6 address.
+         */
+        constexpr IPv6Address GetMask() const { return IPv6Address::FromUint64(UpperMaskFromLength(_length), LowerMaskFromLength(_length)); }
+
+        /**
+         * @brief Returns the first address of the prefix.
+         * @return The first IPv6 address.
+         */
+        constexpr IPv6Address First() const { return _address; }
+
+        /**
+         * @brief Returns the last address of the prefix.
+         * @return The last IPv6 address.
+         */
+        constexpr IPv6Address Last() const
+        {
+            return IPv6Address::FromUint64(_address.GetUpper64() | ~UpperMaskFromLength(_length), _address.GetLower64() | ~LowerMaskFromLength(_length));
+        }
+
+        /**
+         * @brief Returns the number of addresses in the prefix, saturated to UINT64_MAX.
+         * @return The number of addresses, or UINT64_MAX for prefixes of length 64 or shorter.
+         */
+        constexpr uint64_t Size() const { return _length <= 64 ? UINT64_MAX : static_cast<uint64_t>(1) << (MAX_PREFIX_LENGTH - _length); }
+
+        /**
+         * @brief Checks whether the address belongs to the prefix.
+         * @param cAddress The IPv6 address to check.
+         * @return True if the address is within the prefix, false otherwise.
+         */
+        constexpr bool Contains(const IPv6Address &cAddress) const
+        {
+            return (cAddress.GetUpper64() & UpperMaskFromLength(_length)) == _address.GetUpper64() &&
+                   (cAddress.GetLower64() & LowerMaskFromLength(_length)) == _address.GetLower64();
+        }
+
+        /**
+         * @brief Checks whether another prefix is fully covered by this one.
+         * @param cPrefix The IPv6 prefix to check.
+         * @return True if the prefix is equal to or more specific than this one, false otherwise.
+         */
+        constexpr bool Contains(const IPv6Prefix &cPrefix) const { return cPrefix._length >= _length && Contains(cPrefix._address); }
+
+        /**
+         * @brief Returns all addresses of the prefix as a range.
+         * @return The IPv6 range [First(), Last()].
+         */
+        constexpr IPv6Range ToRange() const { return IPv6Range(First(), Last()); }
+
+        /**
+         * @brief Returns an iterator to the first address of the prefix.
+         * @return The begin iterator.
+         */
+        constexpr IPv6AddressIterator begin() const { return ToRange().begin(); }
+
+        /**
+         * @brief Returns an iterator past the last address of the prefix.
+         * @return The end iterator.
+         */
+        constexpr IPv6AddressIterator end() const { return ToRange().end(); }
+
+        /**
+         * @brief Returns the prefix in CIDR notation.
+         * @return The prefix as a string.
+         */
+        std::string ToString() const;
+
+        constexpr bool operator==(const IPv6Prefix &cOther) const
+        {
+            return _length == cOther._length && _address.GetUpper64() == cOther._address.GetUpper64() && _address.GetLower64() == cOther._address.GetLower64();
+        }
+
+        constexpr bool operator!=(const IPv6Prefix &cOther) const { return !(*this == cOther); }
+
+    private:
+        /**
+         * @brief Network address (host bits cleared).
+         */
+        IPv6Address _address{};
+
+        /**
+         * @brief Prefix length in bits.
+         */
+        uint8_t _length{};
+
+        /**
+         * @brief Separator between address and prefix length.
+         */
+        static constexpr char SLASH{'/'};
+
+        /**
+         * @brief Prefix length out of range error message.
+         */
+        static constexpr char PREFIX_LENGTH_OUT_OF_RANGE_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Prefix] Prefix length out of range!"};
+
+        /**
+         * @brief Missing prefix length error message.
+         */
+        static constexpr char MISSING_PREFIX_LENGTH_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Prefix] Missing prefix length!"};
+
+        /**
+         * @brief Empty string exception error message.
+         */
+        static constexpr char EMPTY_STRING_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Prefix] Empty string exception!"};
+    }; /* class IPv6Prefix */
+
+    constexpr IPv6Prefix::IPv6Prefix(const IPv6Address &cAddress, const uint8_t &cLength)
+        : _address{IPv6Address::FromUint64(cAddress.GetUpper64() & UpperMaskFromLength(cLength <= MAX_PREFIX_LENGTH ? cLength : 0),
+                                           cAddress.GetLower64() & LowerMaskFromLength(cLength <= MAX_PREFIX_LENGTH ? cLength : 0))},
+          _length{cLength}
+    {
+        if (cLength > MAX_PREFIX_LENGTH)
+            throw std::out_of_range(PREFIX_LENGTH_OUT_OF_RANGE_EXCEPTION_MESSAGE);
+    } /* IPv6Prefix::IPv6Prefix(const IPv6Address &cAddress, const uint8_t &cLength) */
+}
+
+#endif
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
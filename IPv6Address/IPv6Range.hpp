@@ -0,0 +1,253 @@
+/**
+ * @file IPv6Range.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Defines the IPv6Range and IPv6AddressIterator classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef IPV6RANGE_H
+#define IPV6RANGE_H
+#include "IPv6Address.hpp"
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @class IPv6AddressIterator
+     * @brief Random-access iterator over consecutive IPv6 addresses.
+     *
+     * The position is kept as a 129-bit counter (two 64-bit words plus an overflow bit), so that
+     * the past-the-end position of a range ending at ffff:...:ffff is representable.
+     * Distances between iterators are truncated to int64_t.
+     */
+    class IPv6AddressIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = IPv6Address;
+        using difference_type = int64_t;
+        using pointer = void;
+        using reference = IPv6Address;
+
+        /**
+         * @brief Default constructor. Points at ::.
+         */
+        constexpr IPv6AddressIterator() = default;
+
+        /**
+         * @brief Constructor that points the iterator at the given numeric position.
+         * @param cUpper The most significant 64 bits of the position.
+         * @param cLower The least significant 64 bits of the position.
+         * @param cOverflow The 129th bit of the position (set only for past-the-end of the full space).
+         */
+        constexpr IPv6AddressIterator(const uint64_t &cUpper, const uint64_t &cLower, const bool &cOverflow = false)
+            : _upper{cUpper}, _lower{cLower}, _overflow{cOverflow} {}
+
+        /**
+         * @brief Returns the address the iterator points at.
+         * @return The current IPv6 address.
+         */
+        constexpr IPv6Address operator*() const { return IPv6Address::FromUint64(_upper, _lower); }
+
+        /**
+         * @brief Returns the address at the given offset from the iterator.
+         * @param cOffset The offset, may be negative.
+         * @return The IPv6 address at the offset.
+         */
+        constexpr IPv6Address operator[](const difference_type &cOffset) const { return *(*this + cOffset); }
+
+        constexpr IPv6AddressIterator &operator++() { return *this += 1; }
+
+        constexpr IPv6AddressIterator operator++(int)
+        {
+            IPv6AddressIterator previous{*this};
+            *this += 1;
+            return previous;
+        }
+
+        constexpr IPv6AddressIterator &operator--() { return *this += -1; }
+
+        constexpr IPv6AddressIterator operator--(int)
+        {
+            IPv6AddressIterator previous{*this};
+            *this += -1;
+            return previous;
+        }
+
+        constexpr IPv6AddressIterator &operator+=(const difference_type &cOffset)
+        {
+            // 129-bit two's complement addition of the sign-extended offset.
+            const uint64_t cSignExtension = cOffset < 0 ? UINT64_MAX : 0;
+            const uint64_t cNewLower = _lower + static_cast<uint64_t>(cOffset);
+            const uint64_t cLowerCarry = cNewLower < _lower ? 1 : 0;
+            const uint64_t cPartialUpper = _upper + cSignExtension;
+            const uint64_t cNewUpper = cPartialUpper + cLowerCarry;
+            const unsigned cUpperCarry = (cPartialUpper < _upper ? 1u : 0u) + (cNewUpper < cPartialUpper ? 1u : 0u);
+            _overflow = ((static_cast<unsigned>(_overflow) + (cOffset < 0 ? 1u : 0u) + cUpperCarry) & 1u) != 0;
+            _upper = cNewUpper;
+            _lower = cNewLower;
+            return *this;
+        }
+
+        constexpr IPv6AddressIterator &operator-=(const difference_type &cOffset) { return *this += -cOffset; }
+
+        constexpr IPv6AddressIterator operator+(const difference_type &cOffset) const
+        {
+            IPv6AddressIterator result{*this};
+            result += cOffset;
+            return result;
+        }
+
+        constexpr IPv6AddressIterator operator-(const difference_type &cOffset) const
+        {
+            IPv6AddressIterator result{*this};
+            result += -cOffset;
+            return result;
+        }
+
+        constexpr difference_type operator-(const IPv6AddressIterator &cOther) const { return static_cast<difference_type>(_lower - cOther._lower); }
+
+        friend constexpr IPv6AddressIterator operator+(const difference_type &cOffset, const IPv6AddressIterator &cIterator) { return cIterator + cOffset; }
+
+        constexpr bool operator==(const IPv6AddressIterator &cOther) const { return _lower == cOther._lower && _upper == cOther._upper && _overflow == cOther._overflow; }
+        constexpr bool operator!=(const IPv6AddressIterator &cOther) const { return !(*this == cOther); }
+
+        constexpr bool operator<(const IPv6AddressIterator &cOther) const
+        {
+            if (_overflow != cOther._overflow)
+                return cOther._overflow;
+            if (_upper != cOther._upper)
+                return _upper < cOther._upper;
+            return _lower < cOther._lower;
+        }
+
+        constexpr bool operator>(const IPv6AddressIterator &cOther) const { return cOther < *this; }
+        constexpr bool operator<=(const IPv6AddressIterator &cOther) const { return !(cOther < *this); }
+        constexpr bool operator>=(const IPv6AddressIterator &cOther) const { return !(*this < cOther); }
+
+    private:
+        /**
+         * @brief Most significant 64 bits of the position.
+         */
+        uint64_t _upper{};
+
+        /**
+         * @brief Least significant 64 bits of the position.
+         */
+        uint64_t _lower{};
+
+        /**
+         * @brief 129th bit of the position.
+         */
+        bool _overflow{};
+    }; /* class IPv6AddressIterator */
+
+    /**
+     * @class IPv6Range
+     * @brief Represents an inclusive range of IPv6 addresses [first, last].
+     */
+    class IPv6Range
+    {
+    public:
+        /**
+         * @brief Constructor for the IPv6Range class.
+         * @param cFirst The first address of the range.
+         * @param cLast The last address of the range (inclusive).
+         * @throw std::invalid_argument if the first address is greater than the last one.
+         */
+        constexpr IPv6Range(const IPv6Address &cFirst, const IPv6Address &cLast);
+
+        /**
+         * @brief Returns the first address of the range.
+         * @return The first IPv6 address.
+         */
+        constexpr IPv6Address GetFirst() const { return _first; }
+
+        /**
+         * @brief Returns the last address of the range.
+         * @return The last IPv6 address.
+         */
+        constexpr IPv6Address GetLast() const { return _last; }
+
+        /**
+         * @brief Returns the number of addresses in the range, saturated to UINT64_MAX.
+         * @return The number of addresses, or UINT64_MAX if there are 2^64 or more.
+         */
+        constexpr uint64_t Size() const
+        {
+            const uint64_t cLowerDiff = _last.GetLower64() - _first.GetLower64();
+            const uint64_t cBorrow = _last.GetLower64() < _first.GetLower64() ? 1 : 0;
+            const uint64_t cUpperDiff = _last.GetUpper64() - _first.GetUpper64() - cBorrow;
+            return (cUpperDiff != 0 || cLowerDiff == UINT64_MAX) ? UINT64_MAX : cLowerDiff + 1;
+        }
+
+        /**
+         * @brief Checks whether the address belongs to the range.
+         * @param cAddress The IPv6 address to check.
+         * @return True if the address is within [first, last], false otherwise.
+         */
+        constexpr bool Contains(const IPv6Address &cAddress) const { return _first <= cAddress && cAddress <= _last; }
+
+        /**
+         * @brief Returns the address at the given index of the range. The index is not checked.
+         * @param cIndex The index, must be lower than the number of addresses.
+         * @return The IPv6 address at the index.
+         */
+        constexpr IPv6Address operator[](const uint64_t &cIndex) const { return *(begin() + static_cast<int64_t>(cIndex)); }
+
+        /**
+         * @brief Returns an iterator to the first address of the range.
+         * @return The begin iterator.
+         */
+        constexpr IPv6AddressIterator begin() const { return IPv6AddressIterator{_first.GetUpper64(), _first.GetLower64()}; }
+
+        /**
+         * @brief Returns an iterator past the last address of the range.
+         * @return The end iterator.
+         */
+        constexpr IPv6AddressIterator end() const { return ++IPv6AddressIterator{_last.GetUpper64(), _last.GetLower64()}; }
+
+        constexpr bool operator==(const IPv6Range &cOther) const
+        {
+            return _first.GetUpper64() == cOther._first.GetUpper64() && _first.GetLower64() == cOther._first.GetLower64() &&
+                   _last.GetUpper64() == cOther._last.GetUpper64() && _last.GetLower64() == cOther._last.GetLower64();
+        }
+
+        constexpr bool operator!=(const IPv6Range &cOther) const { return !(*this == cOther); }
+
+    private:
+        /**
+         * @brief First address of the range.
+         */
+        IPv6Address _first{};
+
+        /**
+         * @brief Last address of the range (inclusive).
+         */
+        IPv6Address _last{};
+
+        /**
+         * @brief Invalid range exception error message.
+         */
+        static constexpr char INVALID_RANGE_EXCEPTION_MESSAGE[]{"[EthernetParameter::IPv6Range] First address is greater than the last one!"};
+    }; /* class IPv6Range */
+
+    constexpr IPv6Range::IPv6Range(const IPv6Address &cFirst, const IPv6Address &cLast) : _first{cFirst}, _last{cLast}
+    {
+        if (cLast < cFirst)
+            throw std::invalid_argument(INVALID_RANGE_EXCEPTION_MESSAGE);
+    } /* IPv6Range::IPv6Range(const IPv6Address &cFirst, const IPv6Address &cLast) */
+}
+
+#endif
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,305 @@
+/**
+ * @file LeaseTable.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief LeaseTable (DHCP-style MAC to IPv4 address bindings with expiry) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "LeaseTable.hpp"
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the LeaseTable class.
+     * @param cStartTime The current time in ticks.
+     * @param cExpectedLeases The number of leases to size the arrays and indexes for.
+     */
+    LeaseTable::LeaseTable(const uint64_t &cStartTime, const size_t &cExpectedLeases)
+        : _wheel{cStartTime}
+    {
+        _macs.reserve(cExpectedLeases);
+        _addresses.reserve(cExpectedLeases);
+        _expiries.reserve(cExpectedLeases);
+        ReserveIndexes(cExpectedLeases);
+    } /* LeaseTable::LeaseTable(const uint64_t &cStartTime, const size_t &cExpectedLeases) */
+
+    /**
+     * @brief Binds an address to a MAC address, or renews and moves the existing lease of the MAC address.
+     * @param cMac The client MAC address.
+     * @param cAddress The leased address.
+     * @param cExpiry The absolute expiry time in ticks.
+     * @throws std::invalid_argument If the address is leased to another MAC address.
+     */
+    void LeaseTable::Bind(const MacAddress &cMac, const IPv4Address &cAddress, const uint64_t &cExpiry)
+    {
+        const uint64_t cMacKey = cMac.ToUint64();
+        const uint32_t cAddressKey = cAddress.ToUint32();
+
+        ReserveIndexes(Size() + 1);
+
+        size_t addressPosition = Probe(false, cAddressKey);
+        if (_addressIndex[addressPosition] != EMPTY && _macs[_addressIndex[addressPosition]] != cMacKey)
+        {
+            throw std::invalid_argument(ADDRESS_IN_USE);
+        }
+
+        const size_t cMacPosition = Probe(true, cMacKey);
+        uint32_t slot = _macIndex[cMacPosition];
+        if (slot != EMPTY)
+        {
+            if (_addresses[slot] != cAddressKey)
+            {
+                EraseAt(false, Probe(false, _addresses[slot]));
+                _addresses[slot] = cAddressKey;
+                _addressIndex[Probe(false, cAddressKey)] = slot;
+            }
+        }
+        else
+        {
+            if (!_freeSlots.empty())
+            {
+                slot = _freeSlots.back();
+                _freeSlots.pop_back();
+                _macs[slot] = cMacKey;
+                _addresses[slot] = cAddressKey;
+            }
+            else
+            {
+                slot = static_cast<uint32_t>(_macs.size());
+                _macs.push_back(cMacKey);
+                _addresses.push_back(cAddressKey);
+                _expiries.push_back(0);
+            }
+
+            _macIndex[cMacPosition] = slot;
+            _addressIndex[addressPosition] = slot;
+        }
+
+        _expiries[slot] = cExpiry;
+        _wheel.Schedule(slot, cExpiry);
+    } /* void LeaseTable::Bind(const MacAddress &cMac, const IPv4Address &cAddress, const uint64_t &cExpiry) */
+
+    /**
+     * @brief Changes the expiry time of an existing lease.
+     * @param cMac The client MAC address.
+     * @param cExpiry The new absolute expiry time in ticks.
+     * @return `true` if the MAC address has a lease, `false` otherwise.
+     */
+    bool LeaseTable::Renew(const MacAddress &cMac, const uint64_t &cExpiry)
+    {
+        const uint32_t cSlot = _macIndex[Probe(true, cMac.ToUint64())];
+        if (cSlot == EMPTY)
+        {
+            return false;
+        }
+
+        _expiries[cSlot] = cExpiry;
+        _wheel.Schedule(cSlot, cExpiry);
+        return true;
+    } /* bool LeaseTable::Renew(const MacAddress &cMac, const uint64_t &cExpiry) */
+
+    /**
+     * @brief Removes the lease of a MAC address.
+     * @param cMac The client MAC address.
+     * @return `true` if a lease was removed, `false` if the MAC address had no lease.
+     */
+    bool LeaseTable::Release(const MacAddress &cMac)
+    {
+        const uint32_t cSlot = _macIndex[Probe(true, cMac.ToUint64())];
+        if (cSlot == EMPTY)
+        {
+            return false;
+        }
+
+        _wheel.Cancel(cSlot);
+        RemoveSlot(cSlot);
+        return true;
+    } /* bool LeaseTable::Release(const MacAddress &cMac) */
+
+    /**
+     * @brief Looks up the lease of a MAC address.
+     * @param cMac The client MAC address.
+     * @param lease The lease, untouched if there is none.
+     * @return `true` if the MAC address has a lease, `false` otherwise.
+     */
+    bool LeaseTable::FindByMac(const MacAddress &cMac, Lease &lease) const
+    {
+        const uint32_t cSlot = _macIndex[Probe(true, cMac.ToUint64())];
+        if (cSlot == EMPTY)
+        {
+            return false;
+        }
+
+        lease = Lease{cMac, IPv4Address::FromUint32(_addresses[cSlot]), _expiries[cSlot]};
+        return true;
+    } /* bool LeaseTable::FindByMac(const MacAddress &cMac, Lease &lease) const */
+
+    /**
+     * @brief Looks up the lease of an IPv4 address.
+     * @param cAddress The leased address.
+     * @param lease The lease, untouched if there is none.
+     * @return `true` if the address is leased, `false` otherwise.
+     */
+    bool LeaseTable::FindByAddress(const IPv4Address &cAddress, Lease &lease) const
+    {
+        const uint32_t cSlot = _addressIndex[Probe(false, cAddress.ToUint32())];
+        if (cSlot == EMPTY)
+        {
+            return false;
+        }
+
+        lease = Lease{MacAddress::FromUint64(_macs[cSlot]), cAddress, _expiries[cSlot]};
+        return true;
+    } /* bool LeaseTable::FindByAddress(const IPv4Address &cAddress, Lease &lease) const */
+
+    /**
+     * @brief Advances the time and removes all leases that expire at or before it.
+     * @param cNow The new current time in ticks.
+     * @param expired The vector to append the removed leases to.
+     * @return The number of leases removed.
+     */
+    size_t LeaseTable::Expire(const uint64_t &cNow, std::vector<Lease> &expired)
+    {
+        _expiredSlots.clear();
+        const size_t cExpiredCount = _wheel.Advance(cNow, _expiredSlots);
+
+        expired.reserve(expired.size() + cExpiredCount);
+        for (const uint32_t &cSlot : _expiredSlots)
+        {
+            expired.push_back(Lease{MacAddress::FromUint64(_macs[cSlot]), IPv4Address::FromUint32(_addresses[cSlot]), _expiries[cSlot]});
+            RemoveSlot(cSlot);
+        }
+
+        return cExpiredCount;
+    } /* size_t LeaseTable::Expire(const uint64_t &cNow, std::vector<Lease> &expired) */
+
+    // Private Methods.
+
+    /**
+     * @brief Returns the home position of a key in an index (Fibonacci hashing).
+     * @param cKey The key (MAC or IPv4 address value).
+     * @return The position the probe sequence starts at.
+     */
+    size_t LeaseTable::HomePosition(const uint64_t &cKey) const
+    {
+        return static_cast<size_t>((cKey * 0x9E3779B97F4A7C15ull) >> (64 - _indexBits));
+    } /* size_t LeaseTable::HomePosition(const uint64_t &cKey) const */
+
+    /**
+     * @brief Returns the key a slot is stored under in one of the indexes.
+     * @param cByMac `true` for the MAC index, `false` for the address index.
+     * @param cSlot The slot.
+     * @return The key of the slot.
+     */
+    uint64_t LeaseTable::KeyOf(const bool &cByMac, const uint32_t &cSlot) const
+    {
+        return cByMac ? _macs[cSlot] : _addresses[cSlot];
+    } /* uint64_t LeaseTable::KeyOf(const bool &cByMac, const uint32_t &cSlot) const */
+
+    /**
+     * @brief Finds the index position holding a key, or the empty position where it would be inserted.
+     * @param cByMac `true` for the MAC index, `false` for the address index.
+     * @param cKey The key to find.
+     * @return The position in the index.
+     */
+    size_t LeaseTable::Probe(const bool &cByMac, const uint64_t &cKey) const
+    {
+        const std::vector<uint32_t> &cIndex = cByMac ? _macIndex : _addressIndex;
+        const size_t cMask = cIndex.size() - 1;
+
+        size_t position = HomePosition(cKey);
+        while (cIndex[position] != EMPTY && KeyOf(cByMac, cIndex[position]) != cKey)
+        {
+            position = (position + 1) & cMask;
+        }
+
+        return position;
+    } /* size_t LeaseTable::Probe(const bool &cByMac, const uint64_t &cKey) const */
+
+    /**
+     * @brief Removes the entry at a position of an index, shifting the following entries back.
+     *
+     * Every entry of the probe run after the hole is moved into it if the hole lies between the
+     * entry's home position and its current position, so no tombstones are needed.
+     *
+     * @param cByMac `true` for the MAC index, `false` for the address index.
+     * @param cPosition The position to clear.
+     */
+    void LeaseTable::EraseAt(const bool &cByMac, const size_t &cPosition)
+    {
+        std::vector<uint32_t> &index = cByMac ? _macIndex : _addressIndex;
+        const size_t cMask = index.size() - 1;
+
+        size_t hole = cPosition;
+        size_t next = (cPosition + 1) & cMask;
+        while (index[next] != EMPTY)
+        {
+            const size_t cHome = HomePosition(KeyOf(cByMac, index[next]));
+            if (((next - cHome) & cMask) >= ((next - hole) & cMask))
+            {
+                index[hole] = index[next];
+                hole = next;
+            }
+            next = (next + 1) & cMask;
+        }
+
+        index[hole] = EMPTY;
+    } /* void LeaseTable::EraseAt(const bool &cByMac, const size_t &cPosition) */
+
+    /**
+     * @brief Doubles the index capacity until the load factor is at most 1/2, rehashing all leases.
+     * @param cLeases The number of leases the indexes must hold.
+     */
+    void LeaseTable::ReserveIndexes(const size_t &cLeases)
+    {
+        if (!_macIndex.empty() && 2 * cLeases <= _macIndex.size())
+        {
+            return;
+        }
+
+        size_t capacity = _macIndex.empty() ? MIN_INDEX_CAPACITY : _macIndex.size();
+        while (capacity < 2 * cLeases)
+        {
+            capacity *= 2;
+        }
+
+        _indexBits = 0;
+        while ((size_t{1} << _indexBits) < capacity)
+        {
+            _indexBits++;
+        }
+
+        _macIndex.assign(capacity, EMPTY);
+        _addressIndex.assign(capacity, EMPTY);
+        for (uint32_t slot = 0; slot < _macs.size(); slot++)
+        {
+            if (_wheel.IsScheduled(slot))
+            {
+                _macIndex[Probe(true, _macs[slot])] = slot;
+                _addressIndex[Probe(false, _addresses[slot])] = slot;
+            }
+        }
+    } /* void LeaseTable::ReserveIndexes(const size_t &cLeases) */
+
+    /**
+     * @brief Removes the lease stored in a slot from both indexes and frees the slot.
+     * @param cSlot The slot to remove.
+     */
+    void LeaseTable::RemoveSlot(const uint32_t &cSlot)
+    {
+        EraseAt(true, Probe(true, _macs[cSlot]));
+        EraseAt(false, Probe(false, _addresses[cSlot]));
+        _freeSlots.push_back(cSlot);
+    } /* void LeaseTable::RemoveSlot(const uint32_t &cSlot) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,225 @@
+/**
+ * @file LeaseTable.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief LeaseTable (DHCP-style MAC to IPv4 address bindings with expiry) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef LEASETABLE_H
+#define LEASETABLE_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "MacAddress/MacAddress.hpp"
+#include "TimingWheel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class LeaseTable
+     * @brief Table of DHCP-style leases binding MAC addresses to IPv4 addresses until an expiry time.
+     *
+     * Bindings live in flat arrays indexed by a slot number; freed slots are reused. Two open
+     * addressing hash indexes (linear probing, backward shift deletion) map a MAC address and an
+     * IPv4 address to the slot, so every binding is found by either key with one or two cache
+     * misses. Expiry is driven by a TimingWheel keyed by slot, which makes binding, renewing and
+     * expiring a lease O(1). Time is an abstract tick count (e.g. seconds) chosen by the caller.
+     */
+    class LeaseTable
+    {
+    public:
+        /**
+         * @struct Lease
+         * @brief A single binding.
+         */
+        struct Lease
+        {
+            MacAddress mac{};
+            IPv4Address address{};
+            uint64_t expiry{};
+        };
+
+        /**
+         * @brief Constructor for the LeaseTable class.
+         * @param cStartTime The current time in ticks.
+         * @param cExpectedLeases The number of leases to size the arrays and indexes for.
+         */
+        explicit LeaseTable(const uint64_t &cStartTime = 0, const size_t &cExpectedLeases = 0);
+
+        /**
+         * @brief Binds an address to a MAC address, or renews and moves the existing lease of the MAC address.
+         * @param cMac The client MAC address.
+         * @param cAddress The leased address.
+         * @param cExpiry The absolute expiry time in ticks.
+         * @throws std::invalid_argument If the address is leased to another MAC address.
+         */
+        void Bind(const MacAddress &cMac, const IPv4Address &cAddress, const uint64_t &cExpiry);
+
+        /**
+         * @brief Changes the expiry time of an existing lease.
+         * @param cMac The client MAC address.
+         * @param cExpiry The new absolute expiry time in ticks.
+         * @return `true` if the MAC address has a lease, `false` otherwise.
+         */
+        bool Renew(const MacAddress &cMac, const uint64_t &cExpiry);
+
+        /**
+         * @brief Removes the lease of a MAC address.
+         * @param cMac The client MAC address.
+         * @return `true` if a lease was removed, `false` if the MAC address had no lease.
+         */
+        bool Release(const MacAddress &cMac);
+
+        /**
+         * @brief Looks up the lease of a MAC address.
+         * @param cMac The client MAC address.
+         * @param lease The lease, untouched if there is none.
+         * @return `true` if the MAC address has a lease, `false` otherwise.
+         */
+        bool FindByMac(const MacAddress &cMac, Lease &lease) const;
+
+        /**
+         * @brief Looks up the lease of an IPv4 address.
+         * @param cAddress The leased address.
+         * @param lease The lease, untouched if there is none.
+         * @return `true` if the address is leased, `false` otherwise.
+         */
+        bool FindByAddress(const IPv4Address &cAddress, Lease &lease) const;
+
+        /**
+         * @brief Advances the time and removes all leases that expire at or before it.
+         * @param cNow The new current time in ticks.
+         * @param expired The vector to append the removed leases to.
+         * @return The number of leases removed.
+         */
+        size_t Expire(const uint64_t &cNow, std::vector<Lease> &expired);
+
+        /**
+         * @brief Returns the current time of the table.
+         * @return The time in ticks up to which leases have been expired.
+         */
+        uint64_t GetTime() const { return _wheel.GetTime(); }
+
+        /**
+         * @brief Returns the number of active leases.
+         * @return The number of leases.
+         */
+        size_t Size() const { return _wheel.Size(); }
+
+    private:
+        /**
+         * @brief Marker of an empty index entry.
+         */
+        static constexpr uint32_t EMPTY = UINT32_MAX;
+
+        /**
+         * @brief Smallest index capacity (power of two).
+         */
+        static constexpr size_t MIN_INDEX_CAPACITY = 16;
+
+        /**
+         * @brief Per-slot MAC addresses (48-bit values).
+         */
+        std::vector<uint64_t> _macs{};
+
+        /**
+         * @brief Per-slot IPv4 addresses (host-order values).
+         */
+        std::vector<uint32_t> _addresses{};
+
+        /**
+         * @brief Per-slot expiry times.
+         */
+        std::vector<uint64_t> _expiries{};
+
+        /**
+         * @brief Slots released for reuse.
+         */
+        std::vector<uint32_t> _freeSlots{};
+
+        /**
+         * @brief Hash index from MAC address to slot.
+         */
+        std::vector<uint32_t> _macIndex{};
+
+        /**
+         * @brief Hash index from IPv4 address to slot.
+         */
+        std::vector<uint32_t> _addressIndex{};
+
+        /**
+         * @brief log2 of the index capacity.
+         */
+        uint8_t _indexBits{};
+
+        /**
+         * @brief Expiry wheel keyed by slot.
+         */
+        TimingWheel _wheel;
+
+        /**
+         * @brief Scratch buffer for slots expired by the wheel.
+         */
+        std::vector<uint32_t> _expiredSlots{};
+
+        /**
+         * @brief Returns the home position of a key in an index.
+         * @param cKey The key (MAC or IPv4 address value).
+         * @return The position the probe sequence starts at.
+         */
+        size_t HomePosition(const uint64_t &cKey) const;
+
+        /**
+         * @brief Returns the key a slot is stored under in one of the indexes.
+         * @param cByMac `true` for the MAC index, `false` for the address index.
+         * @param cSlot The slot.
+         * @return The key of the slot.
+         */
+        uint64_t KeyOf(const bool &cByMac, const uint32_t &cSlot) const;
+
+        /**
+         * @brief Finds the index position holding a key, or the empty position where it would be inserted.
+         * @param cByMac `true` for the MAC index, `false` for the address index.
+         * @param cKey The key to find.
+         * @return The position in the index.
+         */
+        size_t Probe(const bool &cByMac, const uint64_t &cKey) const;
+
+        /**
+         * @brief Removes the entry at a position of an index, shifting the following entries back.
+         * @param cByMac `true` for the MAC index, `false` for the address index.
+         * @param cPosition The position to clear.
+         */
+        void EraseAt(const bool &cByMac, const size_t &cPosition);
+
+        /**
+         * @brief Doubles the index capacity when the load factor exceeds 1/2.
+         * @param cLeases The number of leases the indexes must hold.
+         */
+        void ReserveIndexes(const size_t &cLeases);
+
+        /**
+         * @brief Removes the lease stored in a slot from both indexes and frees the slot.
+         * @param cSlot The slot to remove.
+         */
+        void RemoveSlot(const uint32_t &cSlot);
+
+        /**
+         * @brief Error message indicating an address leased to another client.
+         */
+        static constexpr char ADDRESS_IN_USE[]{"[EthernetParameter::LeaseTable] Address is leased to another MAC address!"};
+    }; /* class LeaseTable */
+}
+
+#endif /* LEASETABLE_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
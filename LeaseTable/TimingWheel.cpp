@@ -0,0 +1,295 @@
+/**
+ * @file TimingWheel.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief TimingWheel (hierarchical timer wheel for expiry processing) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "TimingWheel.hpp"
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor for the TimingWheel class.
+     * @param cStartTime The current time in ticks.
+     */
+    TimingWheel::TimingWheel(const uint64_t &cStartTime)
+        : _nextTick{cStartTime + 1},
+          _heads(LEVELS * SLOTS + 1, NIL)
+    {
+    } /* TimingWheel::TimingWheel(const uint64_t &cStartTime) */
+
+    /**
+     * @brief Schedules (or reschedules) an id to expire at the given tick.
+     * @param cId The id to schedule.
+     * @param cExpiry The absolute expiry time in ticks.
+     */
+    void TimingWheel::Schedule(const uint32_t &cId, const uint64_t &cExpiry)
+    {
+        if (cId >= _buckets.size())
+        {
+            const size_t cNewSize = cId + 1 > 2 * _buckets.size() ? cId + 1 : 2 * _buckets.size();
+            _next.resize(cNewSize, NIL);
+            _previous.resize(cNewSize, NIL);
+            _buckets.resize(cNewSize, NOT_SCHEDULED);
+            _expiries.resize(cNewSize);
+        }
+
+        if (_buckets[cId] != NOT_SCHEDULED)
+        {
+            Unlink(cId);
+        }
+        else
+        {
+            _size++;
+        }
+
+        _expiries[cId] = cExpiry;
+        Place(cId);
+    } /* void TimingWheel::Schedule(const uint32_t &cId, const uint64_t &cExpiry) */
+
+    /**
+     * @brief Cancels the timer of an id.
+     * @param cId The id to cancel.
+     * @return `true` if the id was scheduled, `false` otherwise.
+     */
+    bool TimingWheel::Cancel(const uint32_t &cId)
+    {
+        if (!IsScheduled(cId))
+        {
+            return false;
+        }
+
+        Unlink(cId);
+        _size--;
+        return true;
+    } /* bool TimingWheel::Cancel(const uint32_t &cId) */
+
+    /**
+     * @brief Checks whether an id is scheduled.
+     * @param cId The id to check.
+     * @return `true` if the id is scheduled, `false` otherwise.
+     */
+    bool TimingWheel::IsScheduled(const uint32_t &cId) const
+    {
+        return cId < _buckets.size() && _buckets[cId] != NOT_SCHEDULED;
+    } /* bool TimingWheel::IsScheduled(const uint32_t &cId) const */
+
+    /**
+     * @brief Returns the expiry time of a scheduled id.
+     * @param cId The id to look up.
+     * @return The absolute expiry time in ticks.
+     * @throws std::invalid_argument If the id is not scheduled.
+     */
+    uint64_t TimingWheel::GetExpiry(const uint32_t &cId) const
+    {
+        if (!IsScheduled(cId))
+        {
+            throw std::invalid_argument(NOT_SCHEDULED_ID);
+        }
+
+        return _expiries[cId];
+    } /* uint64_t TimingWheel::GetExpiry(const uint32_t &cId) const */
+
+    /**
+     * @brief Advances the wheel and collects all ids whose expiry is at or before the given time.
+     *
+     * Ticks are processed one by one, except that whenever the lowest levels are empty the wheel
+     * jumps straight to the next tick at which the lowest non-empty level is cascaded.
+     *
+     * @param cNow The new current time in ticks. Times before the current time are ignored.
+     * @param expired The vector to append the expired ids to.
+     * @return The number of ids appended.
+     */
+    size_t TimingWheel::Advance(const uint64_t &cNow, std::vector<uint32_t> &expired)
+    {
+        size_t expiredCount = Drain(DUE_BUCKET, expired);
+
+        while (_nextTick <= cNow)
+        {
+            if (_size == 0)
+            {
+                _nextTick = cNow + 1;
+                break;
+            }
+
+            uint8_t lowestLevel{};
+            while (_levelCounts[lowestLevel] == 0)
+            {
+                lowestLevel++;
+            }
+
+            if (lowestLevel > 0)
+            {
+                const uint64_t cSpan = uint64_t{1} << (SLOT_BITS * lowestLevel);
+                const uint64_t cBoundary = (_nextTick + cSpan - 1) & ~(cSpan - 1);
+                if (cBoundary > _nextTick)
+                {
+                    _nextTick = cBoundary < cNow + 1 ? cBoundary : cNow + 1;
+                    continue;
+                }
+            }
+
+            const uint32_t cIndex = static_cast<uint32_t>(_nextTick & (SLOTS - 1));
+            if (cIndex == 0)
+            {
+                for (uint8_t level = 1; level < LEVELS; level++)
+                {
+                    const uint32_t cSlot = static_cast<uint32_t>((_nextTick >> (SLOT_BITS * level)) & (SLOTS - 1));
+                    Cascade(level, cSlot);
+                    if (cSlot != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            expiredCount += Drain(static_cast<uint16_t>(cIndex), expired);
+            _nextTick++;
+        }
+
+        return expiredCount;
+    } /* size_t TimingWheel::Advance(const uint64_t &cNow, std::vector<uint32_t> &expired) */
+
+    // Private Methods.
+
+    /**
+     * @brief Links an id into the bucket matching its expiry relative to the next tick.
+     *
+     * Expiries further than the top level can hold are parked in the last top level slot to be
+     * cascaded and placed again from there.
+     *
+     * @param cId The id to place.
+     */
+    void TimingWheel::Place(const uint32_t &cId)
+    {
+        uint64_t expiry = _expiries[cId];
+        if (expiry < _nextTick)
+        {
+            Link(cId, DUE_BUCKET);
+            return;
+        }
+
+        uint64_t delta = expiry - _nextTick;
+        const uint64_t cMaxDelta = (uint64_t{1} << (SLOT_BITS * LEVELS)) - 1;
+        if (delta > cMaxDelta)
+        {
+            delta = cMaxDelta;
+            expiry = _nextTick + cMaxDelta;
+        }
+
+        uint8_t level{};
+        while (level + 1 < LEVELS && delta >= (uint64_t{1} << (SLOT_BITS * (level + 1))))
+        {
+            level++;
+        }
+
+        const uint32_t cSlot = static_cast<uint32_t>((expiry >> (SLOT_BITS * level)) & (SLOTS - 1));
+        Link(cId, static_cast<uint16_t>(level * SLOTS + cSlot));
+    } /* void TimingWheel::Place(const uint32_t &cId) */
+
+    /**
+     * @brief Links an id at the head of a bucket.
+     * @param cId The id to link.
+     * @param cBucket The bucket to link into.
+     */
+    void TimingWheel::Link(const uint32_t &cId, const uint16_t &cBucket)
+    {
+        const uint32_t cHead = _heads[cBucket];
+        _next[cId] = cHead;
+        _previous[cId] = NIL;
+        if (cHead != NIL)
+        {
+            _previous[cHead] = cId;
+        }
+
+        _heads[cBucket] = cId;
+        _buckets[cId] = cBucket;
+        _levelCounts[cBucket / SLOTS]++;
+    } /* void TimingWheel::Link(const uint32_t &cId, const uint16_t &cBucket) */
+
+    /**
+     * @brief Unlinks an id from its bucket.
+     * @param cId The id to unlink.
+     */
+    void TimingWheel::Unlink(const uint32_t &cId)
+    {
+        const uint16_t cBucket = _buckets[cId];
+        const uint32_t cNext = _next[cId];
+        const uint32_t cPrevious = _previous[cId];
+
+        if (cPrevious != NIL)
+        {
+            _next[cPrevious] = cNext;
+        }
+        else
+        {
+            _heads[cBucket] = cNext;
+        }
+
+        if (cNext != NIL)
+        {
+            _previous[cNext] = cPrevious;
+        }
+
+        _buckets[cId] = NOT_SCHEDULED;
+        _levelCounts[cBucket / SLOTS]--;
+    } /* void TimingWheel::Unlink(const uint32_t &cId) */
+
+    /**
+     * @brief Moves all ids of a bucket one level down.
+     * @param cLevel The level of the bucket.
+     * @param cSlot The slot of the bucket.
+     */
+    void TimingWheel::Cascade(const uint8_t &cLevel, const uint32_t &cSlot)
+    {
+        const uint16_t cBucket = static_cast<uint16_t>(cLevel * SLOTS + cSlot);
+        uint32_t id = _heads[cBucket];
+        _heads[cBucket] = NIL;
+
+        while (id != NIL)
+        {
+            const uint32_t cNext = _next[id];
+            _levelCounts[cLevel]--;
+            Place(id);
+            id = cNext;
+        }
+    } /* void TimingWheel::Cascade(const uint8_t &cLevel, const uint32_t &cSlot) */
+
+    /**
+     * @brief Unlinks all ids of a bucket and appends them to the expired list.
+     * @param cBucket The bucket to drain.
+     * @param expired The vector to append the expired ids to.
+     * @return The number of ids appended.
+     */
+    size_t TimingWheel::Drain(const uint16_t &cBucket, std::vector<uint32_t> &expired)
+    {
+        size_t drained{};
+        uint32_t id = _heads[cBucket];
+        _heads[cBucket] = NIL;
+
+        while (id != NIL)
+        {
+            const uint32_t cNext = _next[id];
+            _buckets[id] = NOT_SCHEDULED;
+            expired.push_back(id);
+            drained++;
+            id = cNext;
+        }
+
+        _levelCounts[cBucket / SLOTS] -= drained;
+        _size -= drained;
+        return drained;
+    } /* size_t TimingWheel::Drain(const uint16_t &cBucket, std::vector<uint32_t> &expired) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
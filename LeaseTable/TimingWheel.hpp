@@ -0,0 +1,213 @@
+/**
+ * @file TimingWheel.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief TimingWheel (hierarchical timer wheel for expiry processing) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class TimingWheel
+     * @brief Hierarchical timing wheel scheduling integer ids for expiry at integer ticks.
+     *
+     * The wheel has 4 levels of 256 slots. Level 0 holds timers due within the next 256 ticks,
+     * every higher level covers 256 times the span of the one below and is cascaded down when
+     * the lower level wraps around. Scheduling and cancelling are O(1); advancing costs O(1) per
+     * tick plus the number of expired or cascaded timers, and runs of ticks with nothing to do are
+     * skipped. Timers are kept in intrusive doubly linked lists stored in flat arrays indexed by id,
+     * so ids should be small and dense (e.g. slot indices of a table).
+     */
+    class TimingWheel
+    {
+    public:
+        /**
+         * @brief Number of wheel levels.
+         */
+        static constexpr uint8_t LEVELS = 4;
+
+        /**
+         * @brief Number of bits of the tick consumed by one level.
+         */
+        static constexpr uint8_t SLOT_BITS = 8;
+
+        /**
+         * @brief Number of slots on one level.
+         */
+        static constexpr uint32_t SLOTS = 1u << SLOT_BITS;
+
+        /**
+         * @brief Constructor for the TimingWheel class.
+         * @param cStartTime The current time in ticks.
+         */
+        explicit TimingWheel(const uint64_t &cStartTime = 0);
+
+        /**
+         * @brief Schedules (or reschedules) an id to expire at the given tick.
+         *
+         * An expiry at or before the current time fires on the next call to Advance().
+         *
+         * @param cId The id to schedule.
+         * @param cExpiry The absolute expiry time in ticks.
+         */
+        void Schedule(const uint32_t &cId, const uint64_t &cExpiry);
+
+        /**
+         * @brief Cancels the timer of an id.
+         * @param cId The id to cancel.
+         * @return `true` if the id was scheduled, `false` otherwise.
+         */
+        bool Cancel(const uint32_t &cId);
+
+        /**
+         * @brief Checks whether an id is scheduled.
+         * @param cId The id to check.
+         * @return `true` if the id is scheduled, `false` otherwise.
+         */
+        bool IsScheduled(const uint32_t &cId) const;
+
+        /**
+         * @brief Returns the expiry time of a scheduled id.
+         * @param cId The id to look up.
+         * @return The absolute expiry time in ticks.
+         * @throws std::invalid_argument If the id is not scheduled.
+         */
+        uint64_t GetExpiry(const uint32_t &cId) const;
+
+        /**
+         * @brief Returns the current time of the wheel.
+         * @return The time in ticks up to which all timers have been processed.
+         */
+        uint64_t GetTime() const { return _nextTick - 1; }
+
+        /**
+         * @brief Returns the number of scheduled ids.
+         * @return The number of scheduled ids.
+         */
+        size_t Size() const { return _size; }
+
+        /**
+         * @brief Advances the wheel and collects all ids whose expiry is at or before the given time.
+         *
+         * Expired ids are unscheduled and appended in expiry order (ids scheduled in the past first).
+         *
+         * @param cNow The new current time in ticks. Times before the current time are ignored.
+         * @param expired The vector to append the expired ids to.
+         * @return The number of ids appended.
+         */
+        size_t Advance(const uint64_t &cNow, std::vector<uint32_t> &expired);
+
+    private:
+        /**
+         * @brief Marker of an empty list link.
+         */
+        static constexpr uint32_t NIL = UINT32_MAX;
+
+        /**
+         * @brief Bucket of timers scheduled at or before the current time.
+         */
+        static constexpr uint16_t DUE_BUCKET = LEVELS * SLOTS;
+
+        /**
+         * @brief Bucket marker of an unscheduled id.
+         */
+        static constexpr uint16_t NOT_SCHEDULED = UINT16_MAX;
+
+        /**
+         * @brief Next tick to process. All expiries before it have fired.
+         */
+        uint64_t _nextTick{};
+
+        /**
+         * @brief Number of scheduled ids.
+         */
+        size_t _size{};
+
+        /**
+         * @brief Number of ids linked into each level, DUE_BUCKET counted as the last one.
+         */
+        size_t _levelCounts[LEVELS + 1]{};
+
+        /**
+         * @brief List heads of all buckets (LEVELS * SLOTS slots and the due bucket).
+         */
+        std::vector<uint32_t> _heads{};
+
+        /**
+         * @brief Per-id next links.
+         */
+        std::vector<uint32_t> _next{};
+
+        /**
+         * @brief Per-id previous links.
+         */
+        std::vector<uint32_t> _previous{};
+
+        /**
+         * @brief Per-id bucket, NOT_SCHEDULED if the id has no timer.
+         */
+        std::vector<uint16_t> _buckets{};
+
+        /**
+         * @brief Per-id expiry time.
+         */
+        std::vector<uint64_t> _expiries{};
+
+        /**
+         * @brief Links an id into the bucket matching its expiry relative to the next tick.
+         * @param cId The id to place.
+         */
+        void Place(const uint32_t &cId);
+
+        /**
+         * @brief Links an id at the head of a bucket.
+         * @param cId The id to link.
+         * @param cBucket The bucket to link into.
+         */
+        void Link(const uint32_t &cId, const uint16_t &cBucket);
+
+        /**
+         * @brief Unlinks an id from its bucket.
+         * @param cId The id to unlink.
+         */
+        void Unlink(const uint32_t &cId);
+
+        /**
+         * @brief Moves all ids of a bucket one level down.
+         * @param cLevel The level of the bucket.
+         * @param cSlot The slot of the bucket.
+         */
+        void Cascade(const uint8_t &cLevel, const uint32_t &cSlot);
+
+        /**
+         * @brief Unlinks all ids of a bucket and appends them to the expired list.
+         * @param cBucket The bucket to drain.
+         * @param expired The vector to append the expired ids to.
+         * @return The number of ids appended.
+         */
+        size_t Drain(const uint16_t &cBucket, std::vector<uint32_t> &expired);
+
+        /**
+         * @brief Error message indicating an id without a timer.
+         */
+        static constexpr char NOT_SCHEDULED_ID[]{"[EthernetParameter::TimingWheel] Id is not scheduled!"};
+    }; /* class TimingWheel */
+}
+
+#endif /* TIMINGWHEEL_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
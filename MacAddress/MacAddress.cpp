@@ -0,0 +1,203 @@
+/**
+ * @file MacAddress.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MacAddress ethernet parameter class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "MacAddress.hpp"
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+namespace EthernetParameter
+{
+    /**
+     * @brief Constructor that creates a MAC address from a uint8_t array of 6 octets.
+     * @param cData The pointer to the uint8_t array containing the address data.
+     * @throw std::invalid_argument If the provided pointer is null (nullptr).
+     */
+    MacAddress::MacAddress(const uint8_t *cData)
+    {
+        if (cData)
+        {
+            memcpy(_octets, cData, MAC_ADDRESS_OCTETS);
+        }
+        else
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+    } /* MacAddress::MacAddress(const uint8_t *cData) */
+
+    /**
+     * @brief Constructor that creates a MAC address from binary data.
+     * @param cBinaryAddress The binary representation of the MAC address, must hold exactly 6 bytes.
+     * @throw std::invalid_argument If the provided binary address vector has an invalid size.
+     */
+    MacAddress::MacAddress(const std::vector<uint8_t> &cBinaryAddress)
+    {
+        if (cBinaryAddress.size() != MAC_ADDRESS_OCTETS)
+        {
+            throw std::invalid_argument(INVALID_BINARY_ADDRESS_SIZE);
+        }
+
+        memcpy(_octets, cBinaryAddress.data(), MAC_ADDRESS_OCTETS);
+    } /* MacAddress::MacAddress(const std::vector<uint8_t> &cBinaryAddress) */
+
+    /**
+     * @brief Constructor that accepts a string representation of a MAC address.
+     *
+     * The string must consist of 6 groups of 2 hexadecimal digits separated by ':' or '-',
+     * such as "00:1a:2b:3c:4d:5e". Both lowercase and uppercase digits are accepted.
+     *
+     * @param cAddressStr A string representation of a MAC address.
+     * @throw std::invalid_argument If the provided string is not a valid MAC address.
+     */
+    MacAddress::MacAddress(const std::string &cAddressStr)
+    {
+        if (cAddressStr.size() != MAC_ADDRESS_STRING_LENGTH)
+        {
+            throw std::invalid_argument(INVALID_MAC_ADDRESS);
+        }
+
+        const char cSeparator = cAddressStr[2];
+        if (cSeparator != ':' && cSeparator != '-')
+        {
+            throw std::invalid_argument(INVALID_MAC_ADDRESS);
+        }
+
+        for (uint8_t i = 0; i < MAC_ADDRESS_OCTETS; i++)
+        {
+            uint8_t octet{};
+            for (uint8_t j = 0; j < 2; j++)
+            {
+                const char c = cAddressStr[3 * i + j];
+                octet <<= 4;
+                if (c >= '0' && c <= '9')
+                    octet |= c - '0';
+                else if (c >= 'a' && c <= 'f')
+                    octet |= c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F')
+                    octet |= c - 'A' + 10;
+                else
+                    throw std::invalid_argument(INVALID_MAC_ADDRESS);
+            }
+
+            if (i + 1 < MAC_ADDRESS_OCTETS && cAddressStr[3 * i + 2] != cSeparator)
+            {
+                throw std::invalid_argument(INVALID_MAC_ADDRESS);
+            }
+            _octets[i] = octet;
+        }
+    } /* MacAddress::MacAddress(const std::string &cAddressStr) */
+
+    /**
+     * @brief Sets the value of the octet at the specified index.
+     * @param cIndex The index of the octet to set.
+     * @param cValue The value to set the octet to.
+     * @throws std::out_of_range If the provided index is out of range [0, 5].
+     */
+    void MacAddress::SetOctet(const uint8_t &cIndex, const uint8_t &cValue)
+    {
+        if (cIndex < MAC_ADDRESS_OCTETS)
+        {
+            _octets[cIndex] = cValue;
+        }
+        else
+        {
+            throw std::out_of_range(OCTET_OUT_OF_RANGE);
+        }
+    } /* void MacAddress::SetOctet(const uint8_t &cIndex, const uint8_t &cValue) */
+
+    /**
+     * @brief Returns the value of the octet at the specified index.
+     * @param cIndex The index of the octet to retrieve.
+     * @return The value of the octet at the specified index.
+     * @throws std::out_of_range If the provided index is out of range [0, 5].
+     */
+    uint8_t MacAddress::GetOctet(const uint8_t &cIndex) const
+    {
+        if (cIndex < MAC_ADDRESS_OCTETS)
+        {
+            return _octets[cIndex];
+        }
+        else
+        {
+            throw std::out_of_range(OCTET_OUT_OF_RANGE);
+        }
+    } /* uint8_t MacAddress::GetOctet(const uint8_t &cIndex) const */
+
+    /**
+     * @brief Converts the MAC address to a lowercase, colon separated string.
+     * @return A string representation of the MAC address.
+     */
+    std::string MacAddress::ToString() const
+    {
+        static constexpr char cHexDigits[]{"0123456789abcdef"};
+        std::string macStrRetVal(MAC_ADDRESS_STRING_LENGTH, ':');
+
+        for (uint8_t i = 0; i < MAC_ADDRESS_OCTETS; i++)
+        {
+            macStrRetVal[3 * i] = cHexDigits[_octets[i] >> 4];
+            macStrRetVal[3 * i + 1] = cHexDigits[_octets[i] & 0x0F];
+        }
+
+        return macStrRetVal;
+    } /* std::string MacAddress::ToString() const */
+
+    /**
+     * @brief Copies the binary representation of the MAC address to the destination pointer.
+     * @param destDataPtr A pointer to the destination memory location (at least 6 bytes).
+     * @throw std::invalid_argument If the provided destination pointer is null (nullptr).
+     */
+    void MacAddress::ToBinary(uint8_t *destDataPtr) const
+    {
+        if (destDataPtr)
+        {
+            memcpy(destDataPtr, _octets, MAC_ADDRESS_OCTETS);
+        }
+        else
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+    } /* void MacAddress::ToBinary(uint8_t *destDataPtr) const */
+
+    /**
+     * @brief Returns the MAC address as binary data.
+     * @return The MAC address as binary data.
+     */
+    std::vector<uint8_t> MacAddress::ToBinary() const
+    {
+        return std::vector<uint8_t>(_octets, _octets + MAC_ADDRESS_OCTETS);
+    } /* std::vector<uint8_t> MacAddress::ToBinary() const */
+
+    /**
+     * @brief Resets all octets of the MAC address to 0.
+     */
+    void MacAddress::Clear()
+    {
+        memset(_octets, 0, MAC_ADDRESS_OCTETS);
+    } /* void MacAddress::Clear() */
+
+    /**
+     * @brief Overloads the << operator to enable output of the MAC address to an output stream.
+     * @param os The output stream to write to.
+     * @param cAddress The MAC address to output.
+     * @return The output stream that was written to.
+     */
+    std::ostream &operator<<(std::ostream &os, const MacAddress &cAddress)
+    {
+        return os << cAddress.ToString();
+    } /* std::ostream &operator<<(std::ostream &os, const MacAddress &cAddress) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
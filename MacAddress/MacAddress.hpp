@@ -0,0 +1,186 @@
+/**
+ * @file MacAddress.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief MacAddress ethernet parameter class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef MACADDRESS_H
+#define MACADDRESS_H
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class MacAddress
+     * @brief Represents an IEEE 802 MAC-48 address.
+     *
+     * This class represents a MAC address as a set of 6 octets. It provides methods to construct
+     * an address from a string ("aa:bb:cc:dd:ee:ff" or "aa-bb-cc-dd-ee-ff"), binary data or a
+     * 48-bit integer, and to convert it back.
+     */
+    class MacAddress
+    {
+    public:
+        /**
+         * @brief Number of MAC address octets.
+         */
+        static constexpr uint8_t MAC_ADDRESS_OCTETS = 6;
+
+        /**
+         * @brief Total length of a MAC address string including separators.
+         */
+        static constexpr uint8_t MAC_ADDRESS_STRING_LENGTH = 17;
+
+        /**
+         * @brief Default constructor for the MacAddress class. Creates 00:00:00:00:00:00.
+         */
+        constexpr MacAddress() = default;
+
+        /**
+         * @brief Constructor for the MacAddress class that creates a MAC address from binary data.
+         * @param cData The binary representation of the MAC address (6 bytes).
+         * @throws std::invalid_argument If the provided pointer is null (nullptr).
+         */
+        MacAddress(const uint8_t *cData);
+
+        /**
+         * @brief Constructor for the MacAddress class that creates a MAC address from binary data.
+         * @param cBinaryAddress The binary representation of the MAC address.
+         * @throws std::invalid_argument If the provided binary address vector has an invalid size.
+         */
+        MacAddress(const std::vector<uint8_t> &cBinaryAddress);
+
+        /**
+         * @brief Constructor for the MacAddress class that accepts a string representation of a MAC address.
+         * @param cAddressStr A string representation of a MAC address (e.g., "00:1a:2b:3c:4d:5e").
+         * @throws std::invalid_argument If the provided string is not a valid MAC address.
+         */
+        MacAddress(const std::string &cAddressStr);
+
+        /**
+         * @brief Creates a MAC address from its 48-bit numeric value.
+         * @param cValue The address as a host-order integer (upper 16 bits are ignored).
+         * @return The MAC address.
+         */
+        static constexpr MacAddress FromUint64(const uint64_t &cValue);
+
+        /**
+         * @brief Returns the 48-bit numeric value of the MAC address.
+         * @return The address as a host-order integer.
+         */
+        constexpr uint64_t ToUint64() const;
+
+        /**
+         * @brief Setter for a specific octet.
+         * @param cIndex The index of the octet to set.
+         * @param cValue The value to set for the octet.
+         * @throws std::out_of_range If the provided index is out of range [0, 5].
+         */
+        void SetOctet(const uint8_t &cIndex, const uint8_t &cValue);
+
+        /**
+         * @brief Getter for a specific octet.
+         * @param cIndex The index of the octet to retrieve.
+         * @return The value of the octet at the specified index.
+         * @throws std::out_of_range If the provided index is out of range [0, 5].
+         */
+        uint8_t GetOctet(const uint8_t &cIndex) const;
+
+        /**
+         * @brief Returns the MAC address as a lowercase, colon separated string.
+         * @return The MAC address as a string.
+         */
+        std::string ToString() const;
+
+        /**
+         * @brief Copies the binary representation of the MAC address to the provided destination pointer.
+         * @param destDataPtr Pointer to the destination memory location (at least 6 bytes).
+         * @throws std::invalid_argument If the provided destination pointer is null (nullptr).
+         */
+        void ToBinary(uint8_t *destDataPtr) const;
+
+        /**
+         * @brief Returns the MAC address as binary data.
+         * @return The MAC address as binary data.
+         */
+        std::vector<uint8_t> ToBinary() const;
+
+        /**
+         * @brief Clears the entire MAC address.
+         */
+        void Clear();
+
+        /**
+         * @brief Overloads the insertion operator for output.
+         * @param os The output stream.
+         * @param cAddress The MAC address to output.
+         * @return The output stream after the MAC address has been written.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const MacAddress &cAddress);
+
+        constexpr bool operator==(const MacAddress &cAddress) const { return ToUint64() == cAddress.ToUint64(); }
+        constexpr bool operator!=(const MacAddress &cAddress) const { return ToUint64() != cAddress.ToUint64(); }
+        constexpr bool operator<(const MacAddress &cAddress) const { return ToUint64() < cAddress.ToUint64(); }
+
+    private:
+        /**
+         * @brief MAC address container.
+         */
+        uint8_t _octets[MAC_ADDRESS_OCTETS]{};
+
+        /**
+         * @brief Error message indicating an invalid binary address size.
+         */
+        static constexpr char INVALID_BINARY_ADDRESS_SIZE[]{"[EthernetParameter::MacAddress] Invalid binary address size!"};
+
+        /**
+         * @brief Error message indicating an out-of-range octet index.
+         */
+        static constexpr char OCTET_OUT_OF_RANGE[]{"[EthernetParameter::MacAddress] Octet index out of range!"};
+
+        /**
+         * @brief Error message indicating a null pointer encountered.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::MacAddress] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating an invalid string.
+         */
+        static constexpr char INVALID_MAC_ADDRESS[]{"[EthernetParameter::MacAddress] Invalid MAC address!"};
+    }; /* class MacAddress */
+
+    constexpr MacAddress MacAddress::FromUint64(const uint64_t &cValue)
+    {
+        MacAddress address{};
+        for (uint8_t i = 0; i < MAC_ADDRESS_OCTETS; i++)
+        {
+            address._octets[i] = static_cast<uint8_t>(cValue >> (8 * (MAC_ADDRESS_OCTETS - 1 - i)));
+        }
+        return address;
+    } /* MacAddress MacAddress::FromUint64(const uint64_t &cValue) */
+
+    constexpr uint64_t MacAddress::ToUint64() const
+    {
+        uint64_t value{};
+        for (uint8_t i = 0; i < MAC_ADDRESS_OCTETS; i++)
+        {
+            value = (value << 8) | _octets[i];
+        }
+        return value;
+    } /* uint64_t MacAddress::ToUint64() const */
+}
+
+#endif /* MACADDRESS_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
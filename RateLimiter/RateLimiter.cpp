@@ -0,0 +1,273 @@
+/**
+ * @file RateLimiter.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief RateLimiter (per-address and per-prefix token buckets for millions of clients) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "RateLimiter.hpp"
+#include <stdexcept>
+#include <thread>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Finalizer of MurmurHash3: every input bit affects every output bit.
+         * @param value The value.
+         * @return The mixed value.
+         */
+        constexpr uint64_t Mix(uint64_t value)
+        {
+            value = (value ^ value >> 33) * 0xFF51AFD7ED558CCDull;
+            value = (value ^ value >> 33) * 0xC4CEB9FE1A85EC53ull;
+            return value ^ value >> 33;
+        }
+
+        /**
+         * @brief Rounds up to a power of two.
+         * @param cValue The value, at least 1.
+         * @return The smallest power of two not below the value.
+         */
+        size_t RoundUpToPowerOfTwo(const size_t &cValue)
+        {
+            size_t power{1};
+            while (power < cValue)
+            {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        /**
+         * @brief Makes a hash usable as a key; zero marks empty entries.
+         * @param cHash The hash.
+         * @return The key.
+         */
+        constexpr uint64_t NonZero(const uint64_t &cHash)
+        {
+            return cHash ? cHash : 1;
+        }
+    }
+
+    /**
+     * @brief Constructor.
+     * @param cTicksPerToken The ticks it takes to earn one token, i.e. the inverse of the sustained rate.
+     * @param cBurst The size of a bucket: the requests a fresh or idle client may make at once.
+     * @param cCapacity The number of clients to track; rounded up so every shard has a power of two sets.
+     * @param cShardCount The number of shards, rounded up to a power of two; defaults to four per hardware thread.
+     * @param cIPv4PrefixLength The prefix IPv4 clients are grouped by, 32 for one bucket per address.
+     * @param cIPv6PrefixLength The prefix IPv6 clients are grouped by, 64 for one bucket per /64.
+     * @throw std::invalid_argument If the rate, burst or capacity is zero, their product overflows,
+     *                              or a prefix length is out of range.
+     */
+    RateLimiter::RateLimiter(const uint64_t &cTicksPerToken, const uint32_t &cBurst, const size_t &cCapacity, const size_t &cShardCount,
+                             const uint8_t &cIPv4PrefixLength, const uint8_t &cIPv6PrefixLength)
+        : _ticksPerToken{cTicksPerToken}, _burstTicks{}, _ipv4Mask{}, _ipv6Masks{}, _shardCount{}, _setsPerShard{}
+    {
+        if (!cTicksPerToken || !cBurst || !cCapacity)
+        {
+            throw std::invalid_argument(INVALID_LIMIT);
+        }
+        if (cTicksPerToken > UINT64_MAX / 2 / cBurst)
+        {
+            throw std::invalid_argument(LIMIT_OVERFLOW);
+        }
+        if (cIPv4PrefixLength > 32 || cIPv6PrefixLength > 128)
+        {
+            throw std::invalid_argument(INVALID_PREFIX_LENGTH);
+        }
+        _burstTicks = cTicksPerToken * cBurst;
+        _ipv4Mask = cIPv4PrefixLength ? UINT32_MAX << (32 - cIPv4PrefixLength) : 0;
+        _ipv6Masks[0] = cIPv6PrefixLength >= 64 ? UINT64_MAX : cIPv6PrefixLength ? UINT64_MAX << (64 - cIPv6PrefixLength) : 0;
+        _ipv6Masks[1] = cIPv6PrefixLength > 64 ? UINT64_MAX << (128 - cIPv6PrefixLength) : 0;
+
+        const size_t cThreads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+        _shardCount = RoundUpToPowerOfTwo(cShardCount ? cShardCount : 4 * cThreads);
+        const size_t cSets = (cCapacity + WAYS - 1) / WAYS;
+        _setsPerShard = RoundUpToPowerOfTwo((cSets + _shardCount - 1) / _shardCount);
+        _shards.reset(new Shard[_shardCount]);
+        for (size_t i = 0; i < _shardCount; i++)
+        {
+            _shards[i].sets.assign(_setsPerShard, Set{});
+        }
+    } /* RateLimiter::RateLimiter(const uint64_t &cTicksPerToken, const uint32_t &cBurst, const size_t &cCapacity, const size_t &cShardCount, const uint8_t &cIPv4PrefixLength, const uint8_t &cIPv6PrefixLength) */
+
+    /**
+     * @brief Takes a token from the bucket of an IPv4 client.
+     * @param cAddress The client address.
+     * @param cNow The current time in ticks.
+     * @return `true` if the request is allowed, `false` if the bucket is empty.
+     */
+    bool RateLimiter::Allow(const IPv4Address &cAddress, const uint64_t &cNow)
+    {
+        return Take(KeyOf(cAddress), cNow);
+    } /* bool RateLimiter::Allow(const IPv4Address &cAddress, const uint64_t &cNow) */
+
+    /**
+     * @brief Takes a token from the bucket of an IPv6 client's prefix.
+     * @param cAddress The client address.
+     * @param cNow The current time in ticks.
+     * @return `true` if the request is allowed, `false` if the bucket is empty.
+     */
+    bool RateLimiter::Allow(const IPv6Address &cAddress, const uint64_t &cNow)
+    {
+        return Take(KeyOf(cAddress), cNow);
+    } /* bool RateLimiter::Allow(const IPv6Address &cAddress, const uint64_t &cNow) */
+
+    /**
+     * @brief Takes a token from the bucket of each of a batch of IPv4 clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param cNow The current time in ticks.
+     * @param allowed Receives `true` for every allowed request.
+     * @return The number of allowed requests.
+     * @throw std::invalid_argument If an array is null.
+     */
+    size_t RateLimiter::AllowBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed)
+    {
+        return TakeBatch(cAddresses, cCount, cNow, allowed);
+    } /* size_t RateLimiter::AllowBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed) */
+
+    /**
+     * @brief Takes a token from the bucket of each of a batch of IPv6 clients' prefixes.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param cNow The current time in ticks.
+     * @param allowed Receives `true` for every allowed request.
+     * @return The number of allowed requests.
+     * @throw std::invalid_argument If an array is null.
+     */
+    size_t RateLimiter::AllowBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed)
+    {
+        return TakeBatch(cAddresses, cCount, cNow, allowed);
+    } /* size_t RateLimiter::AllowBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed) */
+
+    /**
+     * @brief Forgets all clients.
+     */
+    void RateLimiter::Clear()
+    {
+        for (size_t i = 0; i < _shardCount; i++)
+        {
+            std::lock_guard<std::mutex> lock(_shards[i].mutex);
+            _shards[i].sets.assign(_setsPerShard, Set{});
+        }
+    } /* void RateLimiter::Clear() */
+
+    // Private Methods.
+
+    /**
+     * @brief Returns the key of an IPv4 client.
+     * @param cAddress The client address.
+     * @return The 64-bit hash of its prefix, not zero.
+     */
+    uint64_t RateLimiter::KeyOf(const IPv4Address &cAddress) const
+    {
+        // The family is mixed in so an IPv4 key never equals an IPv6 one.
+        return NonZero(Mix((cAddress.ToUint32() & _ipv4Mask) ^ 0x0400000000000000ull));
+    } /* uint64_t RateLimiter::KeyOf(const IPv4Address &cAddress) const */
+
+    /**
+     * @brief Returns the key of an IPv6 client.
+     * @param cAddress The client address.
+     * @return The 64-bit hash of its prefix, not zero.
+     */
+    uint64_t RateLimiter::KeyOf(const IPv6Address &cAddress) const
+    {
+        const uint64_t cUpper = Mix((cAddress.GetUpper64() & _ipv6Masks[0]) ^ 0x0600000000000000ull);
+        return NonZero(Mix(cUpper ^ (cAddress.GetLower64() & _ipv6Masks[1])));
+    } /* uint64_t RateLimiter::KeyOf(const IPv6Address &cAddress) const */
+
+    /**
+     * @brief Takes a token from the bucket of each of a batch of clients.
+     * @param cAddresses The client addresses.
+     * @param cCount The number of addresses.
+     * @param cNow The current time in ticks.
+     * @param allowed Receives `true` for every allowed request.
+     * @return The number of allowed requests.
+     * @throw std::invalid_argument If an array is null.
+     */
+    template <typename Address>
+    size_t RateLimiter::TakeBatch(const Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed)
+    {
+        if (!cAddresses || !allowed)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        uint64_t keys[BATCH];
+        size_t total{};
+        for (size_t start = 0; start < cCount; start += BATCH)
+        {
+            const size_t cChunk = (cCount - start < BATCH) ? cCount - start : BATCH;
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                keys[i] = KeyOf(cAddresses[start + i]);
+#if defined(__GNUC__)
+                __builtin_prefetch(&ShardOf(keys[i]).sets[keys[i] & (_setsPerShard - 1)]);
+#endif
+            }
+            for (size_t i = 0; i < cChunk; i++)
+            {
+                allowed[start + i] = Take(keys[i], cNow);
+                total += allowed[start + i];
+            }
+        }
+        return total;
+    } /* size_t RateLimiter::TakeBatch(const Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed) */
+
+    /**
+     * @brief Takes a token from the bucket of a key.
+     * @param cKey The 64-bit hash of the client key, not zero.
+     * @param cNow The current time in ticks.
+     * @return `true` if the request is allowed.
+     */
+    bool RateLimiter::Take(const uint64_t &cKey, const uint64_t &cNow)
+    {
+        Shard &shard = ShardOf(cKey);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Set &set = shard.sets[cKey & (_setsPerShard - 1)];
+
+        size_t way{WAYS};
+        size_t victim{};
+        for (size_t i = 0; i < WAYS; i++)
+        {
+            if (set.keys[i] == cKey)
+            {
+                way = i;
+                break;
+            }
+            // Empty entries have a zero timestamp, so they are taken first.
+            if (set.fullAt[i] < set.fullAt[victim])
+            {
+                victim = i;
+            }
+        }
+        if (way == WAYS)
+        {
+            way = victim;
+            set.keys[way] = cKey;
+            set.fullAt[way] = 0;
+        }
+
+        // The bucket is full at fullAt; each token taken moves that one refill period later.
+        const uint64_t cFullAt = (set.fullAt[way] > cNow ? set.fullAt[way] : cNow) + _ticksPerToken;
+        if (cFullAt - cNow > _burstTicks)
+        {
+            return false;
+        }
+        set.fullAt[way] = cFullAt;
+        return true;
+    } /* bool RateLimiter::Take(const uint64_t &cKey, const uint64_t &cNow) */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
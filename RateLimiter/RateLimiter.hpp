@@ -0,0 +1,249 @@
+/**
+ * @file RateLimiter.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief RateLimiter (per-address and per-prefix token buckets for millions of clients) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef RATELIMITER_H
+#define RATELIMITER_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace EthernetParameter
+{
+    /**
+     * @class RateLimiter
+     * @brief Thread-safe token buckets keyed by IPv4 address or prefix and by IPv6 prefix.
+     *
+     * Every client has a bucket of `burst` tokens that refills by one token every `ticksPerToken`
+     * ticks, and each request takes one token. A bucket is a single timestamp: the time at which
+     * it will be full again (the theoretical arrival time of the generic cell rate algorithm).
+     * The refill is computed from it and the current time at each request, so idle buckets cost
+     * nothing. Time is an abstract tick count (e.g. nanoseconds) chosen by the caller.
+     *
+     * The buckets live in a fixed table of 64-byte sets of WAYS entries, each holding a 64-bit
+     * hash of the client key and its timestamp, so the memory is bounded and a request touches
+     * one cache line. A client missing from its set replaces the entry with the earliest
+     * timestamp: the least recently admitted client. An entry whose timestamp has passed holds a
+     * full bucket, the same as a client that was never seen, so evicting it loses nothing, while
+     * throttled clients, whose timestamps lie in the future, are the last to go.
+     *
+     * The table is split into shards, each with its own lock and sets, and a key's shard is
+     * chosen by its hash, so threads checking different clients rarely wait for each other.
+     */
+    class RateLimiter
+    {
+    public:
+        /**
+         * @brief Entries per set; one set fills a cache line.
+         */
+        static constexpr size_t WAYS = 4;
+
+        /**
+         * @brief Number of clients a batch check hashes and prefetches before it takes their tokens.
+         */
+        static constexpr size_t BATCH = 32;
+
+        /**
+         * @brief Constructor.
+         * @param cTicksPerToken The ticks it takes to earn one token, i.e. the inverse of the sustained rate.
+         * @param cBurst The size of a bucket: the requests a fresh or idle client may make at once.
+         * @param cCapacity The number of clients to track; rounded up so every shard has a power of two sets.
+         * @param cShardCount The number of shards, rounded up to a power of two; defaults to four per hardware thread.
+         * @param cIPv4PrefixLength The prefix IPv4 clients are grouped by, 32 for one bucket per address.
+         * @param cIPv6PrefixLength The prefix IPv6 clients are grouped by, 64 for one bucket per /64.
+         * @throws std::invalid_argument If the rate, burst or capacity is zero, their product overflows,
+         *                               or a prefix length is out of range.
+         */
+        RateLimiter(const uint64_t &cTicksPerToken, const uint32_t &cBurst, const size_t &cCapacity, const size_t &cShardCount = 0,
+                    const uint8_t &cIPv4PrefixLength = 32, const uint8_t &cIPv6PrefixLength = 64);
+
+        /**
+         * @brief Takes a token from the bucket of an IPv4 client.
+         * @param cAddress The client address.
+         * @param cNow The current time in ticks.
+         * @return `true` if the request is allowed, `false` if the bucket is empty.
+         */
+        bool Allow(const IPv4Address &cAddress, const uint64_t &cNow);
+
+        /**
+         * @brief Takes a token from the bucket of an IPv6 client's prefix.
+         * @param cAddress The client address.
+         * @param cNow The current time in ticks.
+         * @return `true` if the request is allowed, `false` if the bucket is empty.
+         */
+        bool Allow(const IPv6Address &cAddress, const uint64_t &cNow);
+
+        /**
+         * @brief Takes a token from the bucket of each of a batch of IPv4 clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param cNow The current time in ticks.
+         * @param allowed Receives `true` for every allowed request.
+         * @return The number of allowed requests.
+         * @throws std::invalid_argument If an array is null.
+         */
+        size_t AllowBatch(const IPv4Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed);
+
+        /**
+         * @brief Takes a token from the bucket of each of a batch of IPv6 clients' prefixes.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param cNow The current time in ticks.
+         * @param allowed Receives `true` for every allowed request.
+         * @return The number of allowed requests.
+         * @throws std::invalid_argument If an array is null.
+         */
+        size_t AllowBatch(const IPv6Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed);
+
+        /**
+         * @brief Forgets all clients.
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the number of clients the table can track.
+         * @return The number of entries.
+         */
+        size_t Capacity() const { return _shardCount * _setsPerShard * WAYS; }
+
+        /**
+         * @brief Returns the memory taken by the table.
+         * @return The size in bytes.
+         */
+        size_t MemoryBytes() const { return _shardCount * (sizeof(Shard) + _setsPerShard * sizeof(Set)); }
+
+    private:
+        /**
+         * @brief One cache line of entries; a zero key marks an empty entry.
+         */
+        struct alignas(64) Set
+        {
+            uint64_t keys[WAYS];
+            uint64_t fullAt[WAYS];
+        };
+
+        /**
+         * @brief A lock and its sets, aligned to avoid false sharing between shards.
+         */
+        struct alignas(64) Shard
+        {
+            std::mutex mutex{};
+            std::vector<Set> sets{};
+        };
+
+        /**
+         * @brief Ticks to earn one token.
+         */
+        uint64_t _ticksPerToken;
+
+        /**
+         * @brief Ticks to refill a whole bucket: how far the timestamp may run ahead of the clock.
+         */
+        uint64_t _burstTicks;
+
+        /**
+         * @brief Mask of the IPv4 prefix.
+         */
+        uint32_t _ipv4Mask;
+
+        /**
+         * @brief Masks of the IPv6 prefix halves.
+         */
+        uint64_t _ipv6Masks[2];
+
+        /**
+         * @brief Number of shards, a power of two.
+         */
+        size_t _shardCount;
+
+        /**
+         * @brief Number of sets per shard, a power of two.
+         */
+        size_t _setsPerShard;
+
+        /**
+         * @brief The shards.
+         */
+        std::unique_ptr<Shard[]> _shards;
+
+        /**
+         * @brief Returns the key of an IPv4 client.
+         * @param cAddress The client address.
+         * @return The 64-bit hash of its prefix, not zero.
+         */
+        uint64_t KeyOf(const IPv4Address &cAddress) const;
+
+        /**
+         * @brief Returns the key of an IPv6 client.
+         * @param cAddress The client address.
+         * @return The 64-bit hash of its prefix, not zero.
+         */
+        uint64_t KeyOf(const IPv6Address &cAddress) const;
+
+        /**
+         * @brief Returns the shard of a key.
+         * @param cKey The key.
+         * @return The shard.
+         */
+        Shard &ShardOf(const uint64_t &cKey) const { return _shards[(cKey >> 32) & (_shardCount - 1)]; }
+
+        /**
+         * @brief Takes a token from the bucket of each of a batch of clients.
+         * @param cAddresses The client addresses.
+         * @param cCount The number of addresses.
+         * @param cNow The current time in ticks.
+         * @param allowed Receives `true` for every allowed request.
+         * @return The number of allowed requests.
+         * @throws std::invalid_argument If an array is null.
+         */
+        template <typename Address>
+        size_t TakeBatch(const Address *cAddresses, const size_t &cCount, const uint64_t &cNow, bool *allowed);
+
+        /**
+         * @brief Takes a token from the bucket of a key.
+         * @param cKey The 64-bit hash of the client key, not zero.
+         * @param cNow The current time in ticks.
+         * @return `true` if the request is allowed.
+         */
+        bool Take(const uint64_t &cKey, const uint64_t &cNow);
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::RateLimiter] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a zero rate, burst or capacity.
+         */
+        static constexpr char INVALID_LIMIT[]{"[EthernetParameter::RateLimiter] Rate, burst and capacity must not be zero!"};
+
+        /**
+         * @brief Error message indicating a bucket size too large for the tick count.
+         */
+        static constexpr char LIMIT_OVERFLOW[]{"[EthernetParameter::RateLimiter] Burst times ticks per token overflows!"};
+
+        /**
+         * @brief Error message indicating a prefix length out of range.
+         */
+        static constexpr char INVALID_PREFIX_LENGTH[]{"[EthernetParameter::RateLimiter] Prefix length out of range!"};
+    }; /* class RateLimiter */
+}
+
+#endif /* RATELIMITER_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
@@ -0,0 +1,277 @@
+/**
+ * @file SocketAddress.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief SocketAddress (address, port and scope ID with sockaddr interop) class implementation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "SocketAddress.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace EthernetParameter
+{
+    namespace
+    {
+        /**
+         * @brief Loads a big-endian word; compilers turn the loop into one load and a byte swap.
+         * @param cData The 8 bytes.
+         * @return The word.
+         */
+        uint64_t LoadBigEndian(const uint8_t *cData)
+        {
+            uint64_t value{};
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                value = value << 8 | cData[i];
+            }
+            return value;
+        }
+
+        /**
+         * @brief Stores a big-endian word; compilers turn the loop into a byte swap and one store.
+         * @param cValue The word.
+         * @param data Receives the 8 bytes.
+         */
+        void StoreBigEndian(const uint64_t &cValue, uint8_t *data)
+        {
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                data[i] = static_cast<uint8_t>(cValue >> (56 - 8 * i));
+            }
+        }
+
+        /**
+         * @brief Converts a port from network byte order.
+         * @param cPort The port as stored in sin_port / sin6_port.
+         * @return The port in host byte order.
+         */
+        uint16_t LoadPort(const uint16_t &cPort)
+        {
+            uint8_t bytes[2];
+            std::memcpy(bytes, &cPort, sizeof(bytes));
+            return static_cast<uint16_t>(bytes[0] << 8 | bytes[1]);
+        }
+
+        /**
+         * @brief Converts a port to network byte order.
+         * @param cPort The port in host byte order.
+         * @return The port as stored in sin_port / sin6_port.
+         */
+        uint16_t StorePort(const uint16_t &cPort)
+        {
+            const uint8_t cBytes[2]{static_cast<uint8_t>(cPort >> 8), static_cast<uint8_t>(cPort)};
+            uint16_t port;
+            std::memcpy(&port, cBytes, sizeof(port));
+            return port;
+        }
+    }
+
+    /**
+     * @brief Constructor for an IPv4 endpoint.
+     * @param cAddress The address.
+     * @param cPort The port.
+     */
+    SocketAddress::SocketAddress(const IPv4Address &cAddress, const uint16_t &cPort)
+        : _family{Family::IPv4}, _ipv4{cAddress}, _port{cPort}
+    {
+    } /* SocketAddress::SocketAddress(const IPv4Address &cAddress, const uint16_t &cPort) */
+
+    /**
+     * @brief Constructor for an IPv6 endpoint.
+     * @param cAddress The address.
+     * @param cPort The port.
+     * @param cScopeId The scope ID, e.g. the interface index of a link-local address.
+     */
+    SocketAddress::SocketAddress(const IPv6Address &cAddress, const uint16_t &cPort, const uint32_t &cScopeId)
+        : _family{Family::IPv6}, _ipv6{cAddress}, _port{cPort}, _scopeId{cScopeId}
+    {
+    } /* SocketAddress::SocketAddress(const IPv6Address &cAddress, const uint16_t &cPort, const uint32_t &cScopeId) */
+
+    /**
+     * @brief Constructor from an IPv4 socket address.
+     * @param cAddress The socket address.
+     */
+    SocketAddress::SocketAddress(const sockaddr_in &cAddress)
+        : _family{Family::IPv4}, _ipv4{FromInAddr(cAddress.sin_addr)}, _port{LoadPort(cAddress.sin_port)}
+    {
+    } /* SocketAddress::SocketAddress(const sockaddr_in &cAddress) */
+
+    /**
+     * @brief Constructor from an IPv6 socket address.
+     * @param cAddress The socket address.
+     */
+    SocketAddress::SocketAddress(const sockaddr_in6 &cAddress)
+        : _family{Family::IPv6}, _ipv6{FromIn6Addr(cAddress.sin6_addr)}, _port{LoadPort(cAddress.sin6_port)}, _scopeId{cAddress.sin6_scope_id}
+    {
+    } /* SocketAddress::SocketAddress(const sockaddr_in6 &cAddress) */
+
+    /**
+     * @brief Constructor from a socket address of either family, e.g. filled by accept().
+     * @param cAddress The socket address.
+     * @throw std::invalid_argument If the family is neither AF_INET nor AF_INET6.
+     */
+    SocketAddress::SocketAddress(const sockaddr_storage &cAddress)
+        : SocketAddress(reinterpret_cast<const sockaddr *>(&cAddress), sizeof(cAddress))
+    {
+    } /* SocketAddress::SocketAddress(const sockaddr_storage &cAddress) */
+
+    /**
+     * @brief Constructor from a generic socket address and its length.
+     * @param cAddress The socket address.
+     * @param cLength The length of the socket address in bytes.
+     * @throw std::invalid_argument If the pointer is null, the family is neither AF_INET nor
+     *                              AF_INET6, or the length is too small for the family.
+     */
+    SocketAddress::SocketAddress(const sockaddr *cAddress, const size_t &cLength)
+    {
+        if (!cAddress)
+        {
+            throw std::invalid_argument(NULL_PTR_ENCOUNTERED);
+        }
+        if (cAddress->sa_family == AF_INET)
+        {
+            if (cLength < sizeof(sockaddr_in))
+            {
+                throw std::invalid_argument(LENGTH_TOO_SMALL);
+            }
+            *this = SocketAddress(*reinterpret_cast<const sockaddr_in *>(cAddress));
+        }
+        else if (cAddress->sa_family == AF_INET6)
+        {
+            if (cLength < sizeof(sockaddr_in6))
+            {
+                throw std::invalid_argument(LENGTH_TOO_SMALL);
+            }
+            *this = SocketAddress(*reinterpret_cast<const sockaddr_in6 *>(cAddress));
+        }
+        else
+        {
+            throw std::invalid_argument(UNSUPPORTED_FAMILY);
+        }
+    } /* SocketAddress::SocketAddress(const sockaddr *cAddress, const size_t &cLength) */
+
+    /**
+     * @brief Returns the IPv4 socket address.
+     * @return The socket address.
+     * @throw std::logic_error If the endpoint is IPv6.
+     */
+    sockaddr_in SocketAddress::ToSockaddrIn() const
+    {
+        if (_family != Family::IPv4)
+        {
+            throw std::logic_error(FAMILY_MISMATCH);
+        }
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = StorePort(_port);
+        address.sin_addr = ToInAddr(_ipv4);
+        return address;
+    } /* sockaddr_in SocketAddress::ToSockaddrIn() const */
+
+    /**
+     * @brief Returns the IPv6 socket address.
+     * @return The socket address.
+     * @throw std::logic_error If the endpoint is IPv4.
+     */
+    sockaddr_in6 SocketAddress::ToSockaddrIn6() const
+    {
+        if (_family != Family::IPv6)
+        {
+            throw std::logic_error(FAMILY_MISMATCH);
+        }
+        sockaddr_in6 address{};
+        address.sin6_family = AF_INET6;
+        address.sin6_port = StorePort(_port);
+        address.sin6_addr = ToIn6Addr(_ipv6);
+        address.sin6_scope_id = _scopeId;
+        return address;
+    } /* sockaddr_in6 SocketAddress::ToSockaddrIn6() const */
+
+    /**
+     * @brief Writes the socket address of either family, e.g. for connect() or sendto().
+     * @param storage Receives the socket address.
+     * @return The length of the socket address in bytes.
+     */
+    size_t SocketAddress::ToSockaddr(sockaddr_storage &storage) const
+    {
+        if (_family == Family::IPv4)
+        {
+            const sockaddr_in cAddress = ToSockaddrIn();
+            std::memcpy(&storage, &cAddress, sizeof(cAddress));
+            return sizeof(cAddress);
+        }
+        const sockaddr_in6 cAddress = ToSockaddrIn6();
+        std::memcpy(&storage, &cAddress, sizeof(cAddress));
+        return sizeof(cAddress);
+    } /* size_t SocketAddress::ToSockaddr(sockaddr_storage &storage) const */
+
+    /**
+     * @brief Converts an in_addr.
+     * @param cAddress The address in network byte order.
+     * @return The address.
+     */
+    IPv4Address SocketAddress::FromInAddr(const in_addr &cAddress)
+    {
+        // Both hold the octets in network order: a plain 32-bit copy.
+        return IPv4Address(reinterpret_cast<const uint8_t *>(&cAddress));
+    } /* IPv4Address SocketAddress::FromInAddr(const in_addr &cAddress) */
+
+    /**
+     * @brief Converts an in6_addr.
+     * @param cAddress The address in network byte order.
+     * @return The address.
+     */
+    IPv6Address SocketAddress::FromIn6Addr(const in6_addr &cAddress)
+    {
+        const uint8_t *cBytes = reinterpret_cast<const uint8_t *>(&cAddress);
+        return IPv6Address::FromUint64(LoadBigEndian(cBytes), LoadBigEndian(cBytes + 8));
+    } /* IPv6Address SocketAddress::FromIn6Addr(const in6_addr &cAddress) */
+
+    /**
+     * @brief Converts to an in_addr.
+     * @param cAddress The address.
+     * @return The address in network byte order.
+     */
+    in_addr SocketAddress::ToInAddr(const IPv4Address &cAddress)
+    {
+        in_addr address{};
+        cAddress.ToBinary(reinterpret_cast<uint8_t *>(&address));
+        return address;
+    } /* in_addr SocketAddress::ToInAddr(const IPv4Address &cAddress) */
+
+    /**
+     * @brief Converts to an in6_addr.
+     * @param cAddress The address.
+     * @return The address in network byte order.
+     */
+    in6_addr SocketAddress::ToIn6Addr(const IPv6Address &cAddress)
+    {
+        in6_addr address{};
+        uint8_t *bytes = reinterpret_cast<uint8_t *>(&address);
+        StoreBigEndian(cAddress.GetUpper64(), bytes);
+        StoreBigEndian(cAddress.GetLower64(), bytes + 8);
+        return address;
+    } /* in6_addr SocketAddress::ToIn6Addr(const IPv6Address &cAddress) */
+
+    /**
+     * @brief Equal comparison operator: family, address, port and scope ID.
+     * @param cOther The endpoint to compare.
+     * @return `true` if the endpoints are equal.
+     */
+    bool SocketAddress::operator==(const SocketAddress &cOther) const
+    {
+        return _family == cOther._family && _port == cOther._port && _scopeId == cOther._scopeId &&
+               (_family == Family::IPv4 ? _ipv4 == cOther._ipv4 : _ipv6 == cOther._ipv6);
+    } /* bool SocketAddress::operator==(const SocketAddress &cOther) const */
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
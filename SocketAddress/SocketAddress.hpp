@@ -0,0 +1,243 @@
+/**
+ * @file SocketAddress.hpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief SocketAddress (address, port and scope ID with sockaddr interop) class definition.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#ifndef SOCKETADDRESS_H
+#define SOCKETADDRESS_H
+#include "IPv4Address/IPv4Address.hpp"
+#include "IPv6Address/IPv6Address.hpp"
+#include <cstddef>
+#include <cstdint>
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+namespace EthernetParameter
+{
+    /**
+     * @class SocketAddress
+     * @brief A socket endpoint: an IPv4 or IPv6 address, a port and, for IPv6, a scope ID.
+     *
+     * Converts to and from sockaddr_in, sockaddr_in6, sockaddr_storage, in_addr and in6_addr by
+     * moving the address bytes as words (a 32-bit copy for IPv4, two byte-swapped 64-bit words
+     * for IPv6), without inet_ntop()/inet_pton() text. Ports are kept in host byte order.
+     */
+    class SocketAddress
+    {
+    public:
+        /**
+         * @brief Address family of the endpoint.
+         */
+        enum class Family : uint8_t
+        {
+            IPv4 = 4,
+            IPv6 = 6
+        };
+
+        /**
+         * @brief Default constructor: 0.0.0.0, port 0.
+         */
+        SocketAddress() = default;
+
+        /**
+         * @brief Constructor for an IPv4 endpoint.
+         * @param cAddress The address.
+         * @param cPort The port.
+         */
+        SocketAddress(const IPv4Address &cAddress, const uint16_t &cPort);
+
+        /**
+         * @brief Constructor for an IPv6 endpoint.
+         * @param cAddress The address.
+         * @param cPort The port.
+         * @param cScopeId The scope ID, e.g. the interface index of a link-local address.
+         */
+        SocketAddress(const IPv6Address &cAddress, const uint16_t &cPort, const uint32_t &cScopeId = 0);
+
+        /**
+         * @brief Constructor from an IPv4 socket address.
+         * @param cAddress The socket address.
+         */
+        explicit SocketAddress(const sockaddr_in &cAddress);
+
+        /**
+         * @brief Constructor from an IPv6 socket address.
+         * @param cAddress The socket address.
+         */
+        explicit SocketAddress(const sockaddr_in6 &cAddress);
+
+        /**
+         * @brief Constructor from a socket address of either family, e.g. filled by accept().
+         * @param cAddress The socket address.
+         * @throws std::invalid_argument If the family is neither AF_INET nor AF_INET6.
+         */
+        explicit SocketAddress(const sockaddr_storage &cAddress);
+
+        /**
+         * @brief Constructor from a generic socket address and its length.
+         * @param cAddress The socket address.
+         * @param cLength The length of the socket address in bytes.
+         * @throws std::invalid_argument If the pointer is null, the family is neither AF_INET nor
+         *                               AF_INET6, or the length is too small for the family.
+         */
+        SocketAddress(const sockaddr *cAddress, const size_t &cLength);
+
+        /**
+         * @brief Returns the address family.
+         * @return The family.
+         */
+        Family GetFamily() const { return _family; }
+
+        /**
+         * @brief Returns the IPv4 address; 0.0.0.0 for an IPv6 endpoint.
+         * @return The address.
+         */
+        const IPv4Address &GetIPv4() const { return _ipv4; }
+
+        /**
+         * @brief Returns the IPv6 address; :: for an IPv4 endpoint.
+         * @return The address.
+         */
+        const IPv6Address &GetIPv6() const { return _ipv6; }
+
+        /**
+         * @brief Returns the port.
+         * @return The port in host byte order.
+         */
+        uint16_t GetPort() const { return _port; }
+
+        /**
+         * @brief Returns the scope ID; 0 for an IPv4 endpoint.
+         * @return The scope ID.
+         */
+        uint32_t GetScopeId() const { return _scopeId; }
+
+        /**
+         * @brief Returns the IPv4 socket address.
+         * @return The socket address.
+         * @throws std::logic_error If the endpoint is IPv6.
+         */
+        sockaddr_in ToSockaddrIn() const;
+
+        /**
+         * @brief Returns the IPv6 socket address.
+         * @return The socket address.
+         * @throws std::logic_error If the endpoint is IPv4.
+         */
+        sockaddr_in6 ToSockaddrIn6() const;
+
+        /**
+         * @brief Writes the socket address of either family, e.g. for connect() or sendto().
+         * @param storage Receives the socket address.
+         * @return The length of the socket address in bytes.
+         */
+        size_t ToSockaddr(sockaddr_storage &storage) const;
+
+        /**
+         * @brief Converts an in_addr.
+         * @param cAddress The address in network byte order.
+         * @return The address.
+         */
+        static IPv4Address FromInAddr(const in_addr &cAddress);
+
+        /**
+         * @brief Converts an in6_addr.
+         * @param cAddress The address in network byte order.
+         * @return The address.
+         */
+        static IPv6Address FromIn6Addr(const in6_addr &cAddress);
+
+        /**
+         * @brief Converts to an in_addr.
+         * @param cAddress The address.
+         * @return The address in network byte order.
+         */
+        static in_addr ToInAddr(const IPv4Address &cAddress);
+
+        /**
+         * @brief Converts to an in6_addr.
+         * @param cAddress The address.
+         * @return The address in network byte order.
+         */
+        static in6_addr ToIn6Addr(const IPv6Address &cAddress);
+
+        /**
+         * @brief Equal comparison operator: family, address, port and scope ID.
+         * @param cOther The endpoint to compare.
+         * @return `true` if the endpoints are equal.
+         */
+        bool operator==(const SocketAddress &cOther) const;
+
+        /**
+         * @brief Not equal comparison operator.
+         * @param cOther The endpoint to compare.
+         * @return `true` if the endpoints differ.
+         */
+        bool operator!=(const SocketAddress &cOther) const { return !(*this == cOther); }
+
+    private:
+        /**
+         * @brief The address family.
+         */
+        Family _family{Family::IPv4};
+
+        /**
+         * @brief The address of an IPv4 endpoint.
+         */
+        IPv4Address _ipv4{};
+
+        /**
+         * @brief The address of an IPv6 endpoint.
+         */
+        IPv6Address _ipv6{};
+
+        /**
+         * @brief The port in host byte order.
+         */
+        uint16_t _port{};
+
+        /**
+         * @brief The scope ID of an IPv6 endpoint.
+         */
+        uint32_t _scopeId{};
+
+        /**
+         * @brief Error message indicating null pointer.
+         */
+        static constexpr char NULL_PTR_ENCOUNTERED[]{"[EthernetParameter::SocketAddress] Null pointer encountered!"};
+
+        /**
+         * @brief Error message indicating a family other than AF_INET and AF_INET6.
+         */
+        static constexpr char UNSUPPORTED_FAMILY[]{"[EthernetParameter::SocketAddress] Unsupported address family!"};
+
+        /**
+         * @brief Error message indicating a socket address shorter than its family requires.
+         */
+        static constexpr char LENGTH_TOO_SMALL[]{"[EthernetParameter::SocketAddress] Socket address length too small!"};
+
+        /**
+         * @brief Error message indicating a conversion to the other family.
+         */
+        static constexpr char FAMILY_MISMATCH[]{"[EthernetParameter::SocketAddress] Address family mismatch!"};
+    }; /* class SocketAddress */
+}
+
+#endif /* SOCKETADDRESS_H */
+
+/******************************************************************************
+********************************* End of file *********************************
+******************************************************************************/
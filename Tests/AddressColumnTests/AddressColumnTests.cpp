@@ -0,0 +1,316 @@
+/**
+ * @file AddressColumnTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for IPv4AddressColumn, IPv6AddressColumn and PrefixMatch classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressColumn/IPv4AddressColumn.hpp"
+#include "AddressColumn/IPv6AddressColumn.hpp"
+#include "AddressColumn/PrefixMatch.hpp"
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    // Sizes are not multiples of the SIMD step, so the scalar tail is exercised too.
+    constexpr size_t cRows = 1003;
+
+    std::vector<IPv4Address> RandomIPv4(const size_t &cCount)
+    {
+        std::mt19937 random(7);
+        std::vector<IPv4Address> addresses;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            // Few distinct /24s so that filters and dictionaries see repeated values.
+            addresses.push_back(IPv4Address::FromUint32(0x0A000000u | (random() % 8) << 8 | (random() % 4)));
+        }
+        return addresses;
+    }
+
+    std::vector<IPv6Address> RandomIPv6(const size_t &cCount)
+    {
+        std::mt19937_64 random(7);
+        std::vector<IPv6Address> addresses;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            addresses.push_back(IPv6Address::FromUint64(0x20010DB800000000ull | (random() % 4) << 16, random() % 6));
+        }
+        return addresses;
+    }
+
+    template <typename Predicate>
+    std::vector<uint32_t> Expected(const size_t &cCount, const Predicate &cPredicate)
+    {
+        std::vector<uint32_t> rows;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            if (cPredicate(i))
+            {
+                rows.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return rows;
+    }
+
+    template <typename Predicate>
+    std::vector<uint64_t> ExpectedBits(const size_t &cCount, const Predicate &cPredicate)
+    {
+        std::vector<uint64_t> bits(PrefixMatch::WordCount(cCount));
+        for (size_t i = 0; i < cCount; i++)
+        {
+            bits[i / 64] |= static_cast<uint64_t>(cPredicate(i)) << (i % 64);
+        }
+        return bits;
+    }
+}
+
+TEST(IPv4AddressColumnTest, Append_Addresses_StoresHostOrderValues)
+{
+    IPv4AddressColumn column;
+    column.PushBack(IPv4Address("192.168.1.1"));
+    const IPv4Address cMore[]{IPv4Address("10.0.0.1"), IPv4Address("255.255.255.255")};
+    column.Append(cMore, 2);
+
+    ASSERT_EQ(column.Size(), 3u);
+    EXPECT_EQ(column.Data()[0], 0xC0A80101u);
+    EXPECT_EQ(column.Get(1), IPv4Address("10.0.0.1"));
+    column.Set(2, IPv4Address("1.2.3.4"));
+    EXPECT_EQ(column.Get(2), IPv4Address("1.2.3.4"));
+    EXPECT_THROW(column.Get(3), std::out_of_range);
+    EXPECT_THROW(column.Set(3, IPv4Address("1.2.3.4")), std::out_of_range);
+    EXPECT_THROW(column.Append(nullptr, 1), std::invalid_argument);
+}
+
+TEST(IPv4AddressColumnTest, Filters_RandomColumn_MatchScalarReference)
+{
+    const std::vector<IPv4Address> cAddresses = RandomIPv4(cRows);
+    const IPv4AddressColumn cColumn(cAddresses);
+    std::vector<uint32_t> selection(cColumn.Size());
+
+    const IPv4Address cNeedle = cAddresses[17];
+    selection.resize(cColumn.FilterEqual(cNeedle, selection.data()));
+    EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cAddresses[cRow] == cNeedle; }));
+
+    const IPv4Prefix cPrefix(IPv4Address("10.0.3.0"), 24);
+    selection.resize(cColumn.Size());
+    selection.resize(cColumn.FilterPrefix(cPrefix, selection.data()));
+    EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); }));
+
+    const IPv4Range cRange(IPv4Address("10.0.2.2"), IPv4Address("10.0.5.1"));
+    selection.resize(cColumn.Size());
+    selection.resize(cColumn.FilterRange(cRange, selection.data()));
+    EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cRange.Contains(cAddresses[cRow]); }));
+    EXPECT_FALSE(selection.empty());
+}
+
+TEST(IPv4AddressColumnTest, FilterRange_SignBitBoundaries_ComparesUnsigned)
+{
+    const IPv4AddressColumn cColumn({IPv4Address("127.255.255.255"), IPv4Address("128.0.0.0"), IPv4Address("0.0.0.0"), IPv4Address("255.255.255.255")});
+    uint32_t selection[4]{};
+
+    ASSERT_EQ(cColumn.FilterRange(IPv4Range(IPv4Address("127.0.0.0"), IPv4Address("128.0.0.0")), selection), 2u);
+    EXPECT_EQ(selection[0], 0u);
+    EXPECT_EQ(selection[1], 1u);
+    EXPECT_EQ(cColumn.FilterPrefix(IPv4Prefix(IPv4Address("0.0.0.0"), 0), selection), 4u);
+    EXPECT_THROW(cColumn.FilterEqual(IPv4Address("0.0.0.0"), nullptr), std::invalid_argument);
+}
+
+TEST(IPv4AddressColumnTest, GatherScatter_Selection_MovesRows)
+{
+    const std::vector<IPv4Address> cAddresses = RandomIPv4(cRows);
+    IPv4AddressColumn column(cAddresses);
+    const uint32_t cIndices[]{5, 0, 1002, 5};
+
+    const IPv4AddressColumn cGathered = column.Gather(cIndices, 4);
+    ASSERT_EQ(cGathered.Size(), 4u);
+    EXPECT_EQ(cGathered.Get(0), cAddresses[5]);
+    EXPECT_EQ(cGathered.Get(2), cAddresses[1002]);
+    EXPECT_EQ(cGathered.Get(3), cAddresses[5]);
+
+    const uint32_t cTargets[]{1, 2};
+    column.Scatter(cTargets, IPv4AddressColumn({IPv4Address("1.1.1.1"), IPv4Address("2.2.2.2")}));
+    EXPECT_EQ(column.Get(0), cAddresses[0]);
+    EXPECT_EQ(column.Get(1), IPv4Address("1.1.1.1"));
+    EXPECT_EQ(column.Get(2), IPv4Address("2.2.2.2"));
+
+    const uint32_t cBad[]{0, 1003};
+    EXPECT_THROW(column.Gather(cBad, 2), std::out_of_range);
+    EXPECT_THROW(column.Scatter(cBad, IPv4AddressColumn({IPv4Address("1.1.1.1"), IPv4Address("2.2.2.2")})), std::out_of_range);
+}
+
+TEST(IPv4AddressColumnTest, DictionaryEncode_RepeatedValues_RoundTrips)
+{
+    const std::vector<IPv4Address> cAddresses = RandomIPv4(cRows);
+    const IPv4AddressColumn cColumn(cAddresses);
+    std::vector<uint32_t> codes(cColumn.Size());
+
+    const IPv4AddressColumn cDictionary = cColumn.DictionaryEncode(codes.data());
+    EXPECT_EQ(cDictionary.Size(), 32u);
+    EXPECT_EQ(cDictionary.Get(0), cAddresses[0]);
+    EXPECT_EQ(codes[0], 0u);
+
+    const IPv4AddressColumn cDecoded = cDictionary.Gather(codes.data(), codes.size());
+    for (size_t i = 0; i < cRows; i++)
+    {
+        ASSERT_EQ(cDecoded.Get(i), cAddresses[i]);
+    }
+}
+
+TEST(IPv4AddressColumnTest, DictionaryEncode_ManyDistinctValues_GrowsTable)
+{
+    IPv4AddressColumn column;
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        column.PushBack(IPv4Address::FromUint32(i * 2654435761u));
+    }
+    std::vector<uint32_t> codes(column.Size());
+
+    const IPv4AddressColumn cDictionary = column.DictionaryEncode(codes.data());
+    ASSERT_EQ(cDictionary.Size(), 5000u);
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        ASSERT_EQ(codes[i], i);
+    }
+}
+
+TEST(IPv6AddressColumnTest, Append_Addresses_StoresTwoWords)
+{
+    IPv6AddressColumn column;
+    column.PushBack(IPv6Address("2001:db8::1"));
+
+    ASSERT_EQ(column.Size(), 1u);
+    EXPECT_EQ(column.UpperData()[0], 0x20010DB800000000ull);
+    EXPECT_EQ(column.LowerData()[0], 1u);
+    EXPECT_EQ(column.Get(0), IPv6Address("2001:db8::1"));
+    EXPECT_THROW(column.Get(1), std::out_of_range);
+}
+
+TEST(IPv6AddressColumnTest, Filters_RandomColumn_MatchScalarReference)
+{
+    const std::vector<IPv6Address> cAddresses = RandomIPv6(cRows);
+    const IPv6AddressColumn cColumn(cAddresses);
+    std::vector<uint32_t> selection(cColumn.Size());
+
+    const IPv6Address cNeedle = cAddresses[17];
+    selection.resize(cColumn.FilterEqual(cNeedle, selection.data()));
+    EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cAddresses[cRow] == cNeedle; }));
+
+    // One prefix only reads the upper words, the other one needs both.
+    for (const IPv6Prefix &cPrefix : {IPv6Prefix(IPv6Address("2001:db8:2::"), 48), IPv6Prefix(IPv6Address("2001:db8::4"), 126)})
+    {
+        selection.resize(cColumn.Size());
+        selection.resize(cColumn.FilterPrefix(cPrefix, selection.data()));
+        EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); }));
+        EXPECT_FALSE(selection.empty());
+    }
+
+    const IPv6Range cRange(IPv6Address("2001:db8:1::3"), IPv6Address("2001:db8:2::1"));
+    selection.resize(cColumn.Size());
+    selection.resize(cColumn.FilterRange(cRange, selection.data()));
+    EXPECT_EQ(selection, Expected(cRows, [&](const size_t &cRow) { return cRange.Contains(cAddresses[cRow]); }));
+    EXPECT_FALSE(selection.empty());
+}
+
+TEST(IPv6AddressColumnTest, GatherScatter_Selection_MovesRows)
+{
+    const std::vector<IPv6Address> cAddresses = RandomIPv6(cRows);
+    IPv6AddressColumn column(cAddresses);
+    const uint32_t cIndices[]{9, 1002};
+
+    const IPv6AddressColumn cGathered = column.Gather(cIndices, 2);
+    EXPECT_EQ(cGathered.Get(0), cAddresses[9]);
+    EXPECT_EQ(cGathered.Get(1), cAddresses[1002]);
+
+    column.Scatter(cIndices, IPv6AddressColumn({IPv6Address("::1"), IPv6Address("::2")}));
+    EXPECT_EQ(column.Get(9), IPv6Address("::1"));
+    EXPECT_EQ(column.Get(1002), IPv6Address("::2"));
+
+    const uint32_t cBad[]{1003};
+    EXPECT_THROW(column.Gather(cBad, 1), std::out_of_range);
+    EXPECT_THROW(column.Gather(nullptr, 1), std::invalid_argument);
+}
+
+TEST(IPv6AddressColumnTest, DictionaryEncode_RepeatedValues_RoundTrips)
+{
+    const std::vector<IPv6Address> cAddresses = RandomIPv6(cRows);
+    const IPv6AddressColumn cColumn(cAddresses);
+    std::vector<uint32_t> codes(cColumn.Size());
+
+    const IPv6AddressColumn cDictionary = cColumn.DictionaryEncode(codes.data());
+    EXPECT_EQ(cDictionary.Size(), 24u);
+
+    const IPv6AddressColumn cDecoded = cDictionary.Gather(codes.data(), codes.size());
+    for (size_t i = 0; i < cRows; i++)
+    {
+        ASSERT_EQ(cDecoded.Get(i), cAddresses[i]);
+    }
+}
+
+TEST(PrefixMatchTest, Match_IPv4Addresses_MatchesContains)
+{
+    const std::vector<IPv4Address> cAddresses = RandomIPv4(cRows);
+    std::vector<uint64_t> matches(PrefixMatch::WordCount(cRows));
+    for (const IPv4Prefix &cPrefix : {IPv4Prefix(IPv4Address("10.0.3.0"), 24), IPv4Prefix(IPv4Address("10.0.0.0"), 22), IPv4Prefix(cAddresses[5], 32),
+                                      IPv4Prefix(IPv4Address("0.0.0.0"), 0), IPv4Prefix(IPv4Address("192.168.0.0"), 16)})
+    {
+        const std::vector<uint64_t> cExpected = ExpectedBits(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); });
+        const size_t cCount = PrefixMatch::Match(cAddresses.data(), cRows, cPrefix, matches.data());
+        EXPECT_EQ(matches, cExpected);
+        EXPECT_EQ(cCount, Expected(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); }).size());
+    }
+
+    // One short of a full word keeps only the scalar tail.
+    EXPECT_EQ(PrefixMatch::Match(cAddresses.data(), 63, IPv4Prefix(IPv4Address("0.0.0.0"), 0), matches.data()), 63u);
+    EXPECT_EQ(matches[0], UINT64_MAX >> 1);
+    EXPECT_EQ(PrefixMatch::Match(static_cast<const IPv4Address *>(nullptr), 0, IPv4Prefix(), nullptr), 0u);
+    EXPECT_THROW(PrefixMatch::Match(cAddresses.data(), 1, IPv4Prefix(), nullptr), std::invalid_argument);
+}
+
+TEST(PrefixMatchTest, Match_IPv6Addresses_MatchesContains)
+{
+    const std::vector<IPv6Address> cAddresses = RandomIPv6(cRows);
+    std::vector<uint64_t> matches(PrefixMatch::WordCount(cRows));
+    for (const IPv6Prefix &cPrefix : {IPv6Prefix(IPv6Address("2001:db8:2::"), 64), IPv6Prefix(IPv6Address("2001:db8::"), 46), IPv6Prefix(cAddresses[3], 128),
+                                      IPv6Prefix(IPv6Address("2001:db8:1::4"), 126), IPv6Prefix(IPv6Address("::"), 0)})
+    {
+        const std::vector<uint64_t> cExpected = ExpectedBits(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); });
+        const size_t cCount = PrefixMatch::Match(cAddresses.data(), cRows, cPrefix, matches.data());
+        EXPECT_EQ(matches, cExpected);
+        EXPECT_EQ(cCount, Expected(cRows, [&](const size_t &cRow) { return cPrefix.Contains(cAddresses[cRow]); }).size());
+    }
+    EXPECT_THROW(PrefixMatch::Match(static_cast<const IPv6Address *>(nullptr), 1, IPv6Prefix(), matches.data()), std::invalid_argument);
+}
+
+TEST(PrefixMatchTest, Match_OneAddressManyPrefixes_SetsContainingPrefixes)
+{
+    std::vector<IPv4Prefix> prefixes;
+    for (uint8_t length = 0; length <= 32; length++)
+    {
+        prefixes.emplace_back(IPv4Address("10.1.2.3"), length);
+        prefixes.emplace_back(IPv4Address("10.129.2.3"), length);
+    }
+    std::vector<uint64_t> matches(PrefixMatch::WordCount(prefixes.size()));
+    // 10.1.2.3 shares its first 8 bits with 10.129.2.3.
+    EXPECT_EQ(PrefixMatch::Match(IPv4Address("10.1.2.3"), prefixes.data(), prefixes.size(), matches.data()), 33u + 9u);
+    EXPECT_EQ(matches, ExpectedBits(prefixes.size(), [&](const size_t &cRow) { return prefixes[cRow].Contains(IPv4Address("10.1.2.3")); }));
+
+    const IPv6Prefix cPrefixes[]{IPv6Prefix(IPv6Address("2001:db8::"), 32), IPv6Prefix(IPv6Address("2001:db9::"), 32), IPv6Prefix(IPv6Address("::"), 0)};
+    EXPECT_EQ(PrefixMatch::Match(IPv6Address("2001:db8::1"), cPrefixes, 3, matches.data()), 2u);
+    EXPECT_EQ(matches[0], 0b101u);
+    EXPECT_THROW(PrefixMatch::Match(IPv6Address("::1"), cPrefixes, 3, nullptr), std::invalid_argument);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,414 @@
+/**
+ * @file AddressCompressionTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for BitPacking, CompressedIPv4List, CompressedIPv6List and the Elias-Fano classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressCompression/CompressedIPv4List.hpp"
+#include "AddressCompression/CompressedIPv6List.hpp"
+#include "AddressCompression/EliasFanoIPv4Set.hpp"
+#include "AddressCompression/EliasFanoIPv6Set.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Returns sorted random values: runs of neighbours separated by jumps of up to 2^cJumpBits.
+     */
+    std::vector<uint32_t> SortedValues(const size_t &cCount, const uint32_t &cJumpBits, const uint32_t &cSeed)
+    {
+        std::mt19937 random(cSeed);
+        std::vector<uint32_t> values;
+        uint32_t value = random() % 1000;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            values.push_back(value);
+            value += random() % 4 ? 1 : random() % (1u << cJumpBits);
+        }
+        return values;
+    }
+}
+
+TEST(BitPackingTest, PackUnpack_EveryBitWidth_RoundTrips)
+{
+    std::mt19937 random(7);
+    for (uint32_t bitWidth = 0; bitWidth <= BitPacking::MAX_BIT_WIDTH; bitWidth++)
+    {
+        std::vector<uint32_t> values(BitPacking::BLOCK_SIZE);
+        for (uint32_t &value : values)
+        {
+            value = bitWidth == 32 ? random() : random() & ((1u << bitWidth) - 1);
+        }
+        values[5] = bitWidth == 0 ? 0 : UINT32_MAX >> (32 - bitWidth);
+
+        std::vector<uint32_t> packed(BitPacking::PackedWords(bitWidth));
+        std::vector<uint32_t> unpacked(BitPacking::BLOCK_SIZE);
+        EXPECT_EQ(BitPacking::BitWidth(values.data()), bitWidth);
+        BitPacking::Pack(values.data(), bitWidth, packed.data());
+        BitPacking::Unpack(packed.data(), bitWidth, unpacked.data());
+        EXPECT_EQ(unpacked, values) << "bit width " << bitWidth;
+
+        std::vector<uint32_t> sums(BitPacking::BLOCK_SIZE);
+        BitPacking::UnpackPrefixSum(packed.data(), bitWidth, 100, 3, sums.data());
+        uint32_t expected = 100;
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            expected += values[i] + 3;
+            ASSERT_EQ(sums[i], expected) << "bit width " << bitWidth << ", value " << i;
+        }
+    }
+}
+
+TEST(BitPackingTest, Pack_EveryBitWidth_MatchesInterleavedLayout)
+{
+    std::mt19937 random(11);
+    for (uint32_t bitWidth = 1; bitWidth <= BitPacking::MAX_BIT_WIDTH; bitWidth++)
+    {
+        std::vector<uint32_t> values(BitPacking::BLOCK_SIZE);
+        for (uint32_t &value : values)
+        {
+            value = bitWidth == 32 ? random() : random() & ((1u << bitWidth) - 1);
+        }
+
+        // Value i goes to lane i % 4 at bit (i / 4) * bitWidth; lane words are interleaved.
+        std::vector<uint32_t> expected(BitPacking::PackedWords(bitWidth));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            const uint64_t cBit = (i / 4) * bitWidth;
+            const uint64_t cShifted = static_cast<uint64_t>(values[i]) << (cBit % 32);
+            expected[4 * (cBit / 32) + i % 4] |= static_cast<uint32_t>(cShifted);
+            if (cBit % 32 + bitWidth > 32)
+            {
+                expected[4 * (cBit / 32 + 1) + i % 4] |= static_cast<uint32_t>(cShifted >> 32);
+            }
+        }
+
+        std::vector<uint32_t> packed(BitPacking::PackedWords(bitWidth));
+        BitPacking::Pack(values.data(), bitWidth, packed.data());
+        EXPECT_EQ(packed, expected) << "bit width " << bitWidth;
+
+        std::vector<uint32_t> unpacked(BitPacking::BLOCK_SIZE);
+        BitPacking::Unpack(expected.data(), bitWidth, unpacked.data());
+        EXPECT_EQ(unpacked, values) << "bit width " << bitWidth;
+    }
+}
+
+TEST(CompressedIPv4ListTest, Decode_VariousLengths_RoundTrips)
+{
+    for (const size_t &cCount : std::vector<size_t>{0, 1, 127, 128, 129, 1000, 4096})
+    {
+        const std::vector<uint32_t> cValues = SortedValues(cCount, 20, static_cast<uint32_t>(cCount));
+        const CompressedIPv4List cList(cValues.data(), cValues.size());
+        EXPECT_EQ(cList.Size(), cCount);
+        EXPECT_EQ(cList.BlockCount(), (cCount + 127) / 128);
+
+        std::vector<uint32_t> decoded(cCount);
+        cList.Decode(decoded.data());
+        EXPECT_EQ(decoded, cValues) << cCount << " values";
+    }
+}
+
+TEST(CompressedIPv4ListTest, Decode_ExtremesAndDuplicates_RoundTrips)
+{
+    const std::vector<IPv4Address> cAddresses{IPv4Address("0.0.0.0"), IPv4Address("0.0.0.0"), IPv4Address("10.0.0.1"),
+                                              IPv4Address("10.0.0.1"), IPv4Address("192.168.1.1"), IPv4Address("255.255.255.255")};
+    const CompressedIPv4List cList(cAddresses);
+
+    EXPECT_EQ(cList.Decode(), cAddresses);
+    EXPECT_EQ(cList.Get(3), IPv4Address("10.0.0.1"));
+    EXPECT_EQ(cList.Get(5), IPv4Address("255.255.255.255"));
+    EXPECT_THROW(cList.Get(6), std::out_of_range);
+}
+
+TEST(CompressedIPv4ListTest, Construct_ContiguousRange_PacksToDirectoryOnly)
+{
+    std::vector<uint32_t> values(1024);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = 0xC0A80000u + 2 * static_cast<uint32_t>(i);
+    }
+    const CompressedIPv4List cList(values.data(), values.size());
+
+    // Constant gaps are all taken by the frame of reference, so no block has packed words.
+    EXPECT_EQ(cList.CompressedSize(), (3 * cList.BlockCount() + 1) * sizeof(uint32_t));
+    EXPECT_EQ(cList.Get(1000), IPv4Address::FromUint32(0xC0A80000u + 2000));
+}
+
+TEST(CompressedIPv4ListTest, DecodeBlockAndContains_RandomAccess_MatchesSource)
+{
+    const std::vector<uint32_t> cValues = SortedValues(1000, 12, 3);
+    const CompressedIPv4List cList(cValues.data(), cValues.size());
+
+    uint32_t block[CompressedIPv4List::BLOCK_SIZE];
+    EXPECT_EQ(cList.DecodeBlock(7, block), 1000u - 7 * 128);
+    EXPECT_TRUE(std::equal(block, block + 1000 - 7 * 128, cValues.begin() + 7 * 128));
+    EXPECT_THROW(cList.DecodeBlock(8, block), std::out_of_range);
+
+    for (uint32_t value = 0; value < cValues.back() + 10; value += 5)
+    {
+        EXPECT_EQ(cList.Contains(IPv4Address::FromUint32(value)), std::binary_search(cValues.begin(), cValues.end(), value)) << value;
+    }
+    EXPECT_FALSE(CompressedIPv4List().Contains(IPv4Address("1.2.3.4")));
+}
+
+TEST(CompressedIPv4ListTest, Serialize_RoundTripAndCorruption)
+{
+    const std::vector<uint32_t> cValues = SortedValues(777, 16, 5);
+    const CompressedIPv4List cList(cValues.data(), cValues.size());
+    std::vector<uint8_t> bytes = cList.Serialize();
+
+    const CompressedIPv4List cRestored = CompressedIPv4List::Deserialize(bytes.data(), bytes.size());
+    std::vector<uint32_t> decoded(cValues.size());
+    cRestored.Decode(decoded.data());
+    EXPECT_EQ(decoded, cValues);
+
+    EXPECT_THROW(CompressedIPv4List::Deserialize(bytes.data(), bytes.size() - 1), std::invalid_argument);
+    EXPECT_THROW(CompressedIPv4List::Deserialize(nullptr, 0), std::invalid_argument);
+    bytes[0] ^= 1;
+    EXPECT_THROW(CompressedIPv4List::Deserialize(bytes.data(), bytes.size()), std::invalid_argument);
+}
+
+TEST(CompressedIPv4ListTest, Construct_InvalidInput_Throws)
+{
+    const std::vector<IPv4Address> cUnsorted{IPv4Address("10.0.0.2"), IPv4Address("10.0.0.1")};
+    EXPECT_THROW(CompressedIPv4List cList(cUnsorted), std::invalid_argument);
+    EXPECT_THROW(CompressedIPv4List cList(nullptr, 1), std::invalid_argument);
+}
+
+TEST(CompressedIPv6ListTest, Decode_WideGaps_RoundTrips)
+{
+    std::mt19937_64 random(11);
+    std::vector<IPv6Address> addresses;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        // Hosts of a few /64s, whole /48s and fully random addresses, so every limb is used.
+        addresses.push_back(IPv6Address::FromUint64(0x20010DB800000000ull | random() % 4, random() % 5000));
+        addresses.push_back(IPv6Address::FromUint64(0x2A00000000000000ull | (random() % 64) << 16, 0));
+        addresses.push_back(IPv6Address::FromUint64(random(), random()));
+    }
+    addresses.push_back(IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX));
+    addresses.push_back(IPv6Address::FromUint64(0, 0));
+    std::sort(addresses.begin(), addresses.end());
+
+    const CompressedIPv6List cList(addresses);
+    EXPECT_EQ(cList.Size(), addresses.size());
+    EXPECT_EQ(cList.Decode(), addresses);
+    EXPECT_EQ(cList.Get(1500), addresses[1500]);
+    EXPECT_TRUE(cList.Contains(addresses[2999]));
+    EXPECT_TRUE(cList.Contains(IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX)));
+    EXPECT_FALSE(cList.Contains(IPv6Address::FromUint64(0x20010DB800000000ull, 5001)));
+}
+
+TEST(CompressedIPv6ListTest, Construct_SortedPrefixes_UsesOnlyUpperLimbs)
+{
+    std::vector<IPv6Address> prefixes;
+    for (uint64_t i = 0; i < 128; i++)
+    {
+        prefixes.push_back(IPv6Address::FromUint64(0x20010DB800000000ull + 3 * i, 0));
+    }
+    const CompressedIPv6List cList(prefixes);
+
+    // One block: directory plus the two-bit low limb of the upper half.
+    EXPECT_EQ(cList.CompressedSize(), 4 * sizeof(uint64_t) + sizeof(uint32_t) + BitPacking::PackedWords(2) * sizeof(uint32_t));
+    EXPECT_EQ(cList.Decode(), prefixes);
+}
+
+TEST(CompressedIPv6ListTest, SerializeAndInvalidInput)
+{
+    const std::vector<IPv6Address> cAddresses{IPv6Address("::1"), IPv6Address("2001:db8::1"), IPv6Address("fe80::1")};
+    const CompressedIPv6List cList(cAddresses);
+    std::vector<uint8_t> bytes = cList.Serialize();
+    EXPECT_EQ(CompressedIPv6List::Deserialize(bytes.data(), bytes.size()).Decode(), cAddresses);
+
+    bytes[bytes.size() - 1] ^= 0x80;
+    EXPECT_NO_THROW(CompressedIPv6List::Deserialize(bytes.data(), bytes.size()));
+    bytes.push_back(0);
+    EXPECT_THROW(CompressedIPv6List::Deserialize(bytes.data(), bytes.size()), std::invalid_argument);
+
+    const std::vector<IPv6Address> cUnsorted{IPv6Address("::2"), IPv6Address("::1")};
+    EXPECT_THROW(CompressedIPv6List cUnsortedList(cUnsorted), std::invalid_argument);
+    uint64_t upper[CompressedIPv6List::BLOCK_SIZE];
+    EXPECT_THROW(cList.DecodeBlock(1, upper, upper), std::out_of_range);
+}
+
+TEST(EliasFanoTest, Queries_VariousDensities_MatchStandardAlgorithms)
+{
+    std::mt19937_64 random(13);
+    for (const uint64_t &cRange : std::vector<uint64_t>{1, 100, 1ull << 20, 1ull << 40, UINT64_MAX})
+    {
+        std::vector<uint64_t> values(3000);
+        for (uint64_t &value : values)
+        {
+            value = random() % cRange;
+        }
+        values.push_back(0);
+        values.push_back(values[7]);
+        std::sort(values.begin(), values.end());
+        const EliasFano cSequence(values.data(), values.size());
+        ASSERT_EQ(cSequence.Size(), values.size());
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            ASSERT_EQ(cSequence.Select(i), values[i]) << i;
+        }
+        for (size_t i = 0; i < 3000; i++)
+        {
+            const uint64_t cProbe = i % 2 ? values[random() % values.size()] + i % 3 - 1 : random() % cRange;
+            const auto cLower = std::lower_bound(values.begin(), values.end(), cProbe);
+            const auto cUpper = std::upper_bound(values.begin(), values.end(), cProbe);
+            ASSERT_EQ(cSequence.Rank(cProbe), static_cast<size_t>(cLower - values.begin())) << cProbe;
+            ASSERT_EQ(cSequence.Contains(cProbe), cLower != cUpper) << cProbe;
+            uint64_t predecessor{};
+            ASSERT_EQ(cSequence.Predecessor(cProbe, predecessor), cUpper != values.begin()) << cProbe;
+            if (cUpper != values.begin())
+            {
+                ASSERT_EQ(predecessor, *(cUpper - 1)) << cProbe;
+            }
+        }
+        EXPECT_THROW(cSequence.Select(values.size()), std::out_of_range);
+    }
+}
+
+TEST(EliasFanoTest, Construct_EmptyAndExtremes)
+{
+    const EliasFano cEmpty;
+    uint64_t predecessor{};
+    EXPECT_EQ(cEmpty.Size(), 0u);
+    EXPECT_EQ(cEmpty.Rank(UINT64_MAX), 0u);
+    EXPECT_FALSE(cEmpty.Contains(0));
+    EXPECT_FALSE(cEmpty.Predecessor(UINT64_MAX, predecessor));
+
+    const std::vector<uint64_t> cValues{5, UINT64_MAX};
+    const EliasFano cSequence(cValues.data(), cValues.size());
+    EXPECT_TRUE(cSequence.Contains(UINT64_MAX));
+    EXPECT_FALSE(cSequence.Contains(UINT64_MAX - 1));
+    EXPECT_FALSE(cSequence.Predecessor(4, predecessor));
+    EXPECT_TRUE(cSequence.Predecessor(UINT64_MAX - 1, predecessor));
+    EXPECT_EQ(predecessor, 5u);
+
+    // A dense run and a far outlier put every run value in one bucket: a long run of ones.
+    std::vector<uint64_t> clustered(20000);
+    for (size_t i = 0; i < clustered.size(); i++)
+    {
+        clustered[i] = 1000 + i;
+    }
+    clustered.push_back(UINT64_MAX - 3);
+    const EliasFano cClustered(clustered.data(), clustered.size());
+    EXPECT_EQ(cClustered.Rank(15000), 14000u);
+    EXPECT_EQ(cClustered.Select(19999), 20999u);
+    EXPECT_TRUE(cClustered.Contains(UINT64_MAX - 3));
+    EXPECT_FALSE(cClustered.Contains(999));
+    EXPECT_TRUE(cClustered.Predecessor(UINT64_MAX - 4, predecessor));
+    EXPECT_EQ(predecessor, 20999u);
+
+    const std::vector<uint64_t> cUnsorted{2, 1};
+    EXPECT_THROW(EliasFano(cUnsorted.data(), cUnsorted.size()), std::invalid_argument);
+    EXPECT_THROW(EliasFano(nullptr, 1), std::invalid_argument);
+}
+
+TEST(EliasFanoTest, View_SerializedWords_QueriesInPlaceAndRejectsCorruption)
+{
+    std::vector<uint64_t> values(5000);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = 7 * i + i % 5;
+    }
+    const EliasFano cSequence(values.data(), values.size());
+    const std::vector<uint8_t> cBytes = cSequence.Serialize();
+    ASSERT_EQ(cBytes.size(), cSequence.SizeInBytes());
+
+    // A word buffer stands in for a memory-mapped file: aligned and owned by the caller.
+    std::vector<uint64_t> image(cBytes.size() / sizeof(uint64_t));
+    std::memcpy(image.data(), cBytes.data(), cBytes.size());
+    const uint8_t *const cImage = reinterpret_cast<const uint8_t *>(image.data());
+    const EliasFano cView = EliasFano::View(cImage, cBytes.size());
+    EXPECT_EQ(cView.Size(), values.size());
+    EXPECT_EQ(cView.Select(4321), values[4321]);
+    EXPECT_EQ(cView.Rank(values[4000]), 4000u);
+    EXPECT_EQ(cView.Serialize(), cBytes);
+
+    EXPECT_THROW(EliasFano::View(nullptr, 0), std::invalid_argument);
+    EXPECT_THROW(EliasFano::View(cImage + 8, cBytes.size() - 8), std::invalid_argument);
+    EXPECT_THROW(EliasFano::View(cImage, cBytes.size() - 8), std::invalid_argument);
+    std::vector<uint64_t> misaligned(image.size() + 1);
+    EXPECT_THROW(EliasFano::View(reinterpret_cast<const uint8_t *>(misaligned.data()) + 1, cBytes.size()), std::invalid_argument);
+
+    // A header field out of place is caught by View() itself; a count that still fits the layout
+    // or a flipped bit in the body only by Validate(), which reads the whole image.
+    EXPECT_NO_THROW(cView.Validate());
+    for (const size_t &cWord : std::vector<size_t>{0, 3})
+    {
+        std::vector<uint64_t> corrupted = image;
+        corrupted[cWord] ^= 1;
+        EXPECT_THROW(EliasFano::View(reinterpret_cast<const uint8_t *>(corrupted.data()), cBytes.size()), std::invalid_argument) << cWord;
+    }
+    for (const size_t &cWord : std::vector<size_t>{1, image.size() / 2, image.size() - 1})
+    {
+        std::vector<uint64_t> corrupted = image;
+        corrupted[cWord] ^= 1;
+        const EliasFano cCorrupted = EliasFano::View(reinterpret_cast<const uint8_t *>(corrupted.data()), cBytes.size());
+        EXPECT_THROW(cCorrupted.Validate(), std::invalid_argument) << cWord;
+    }
+}
+
+TEST(EliasFanoIPv4SetTest, Queries_UnsortedInput_SortsAndDeduplicates)
+{
+    const std::vector<IPv4Address> cAddresses{IPv4Address("192.0.2.7"), IPv4Address("10.0.0.1"), IPv4Address("255.255.255.255"), IPv4Address("10.0.0.1"),
+                                              IPv4Address("0.0.0.0")};
+    const EliasFanoIPv4Set cSet(cAddresses);
+    EXPECT_EQ(cSet.Size(), 4u);
+    EXPECT_EQ(cSet.Select(1), IPv4Address("10.0.0.1"));
+    EXPECT_EQ(cSet.Rank(IPv4Address("192.0.2.7")), 2u);
+    EXPECT_TRUE(cSet.Contains(IPv4Address("255.255.255.255")));
+    EXPECT_FALSE(cSet.Contains(IPv4Address("10.0.0.2")));
+
+    IPv4Address predecessor;
+    EXPECT_TRUE(cSet.Predecessor(IPv4Address("192.0.2.6"), predecessor));
+    EXPECT_EQ(predecessor, IPv4Address("10.0.0.1"));
+
+    std::vector<uint64_t> image(cSet.SizeInBytes() / sizeof(uint64_t));
+    std::memcpy(image.data(), cSet.Serialize().data(), cSet.SizeInBytes());
+    EXPECT_TRUE(EliasFanoIPv4Set::View(reinterpret_cast<const uint8_t *>(image.data()), cSet.SizeInBytes()).Contains(IPv4Address("192.0.2.7")));
+
+    // A valid sequence holding a value above 32 bits is not an IPv4 set.
+    const std::vector<uint64_t> cWide{1ull << 32};
+    const std::vector<uint8_t> cWideBytes = EliasFano(cWide.data(), cWide.size()).Serialize();
+    image.assign(cWideBytes.size() / sizeof(uint64_t), 0);
+    std::memcpy(image.data(), cWideBytes.data(), cWideBytes.size());
+    EXPECT_THROW(EliasFanoIPv4Set::View(reinterpret_cast<const uint8_t *>(image.data()), cWideBytes.size()).Validate(), std::invalid_argument);
+}
+
+TEST(EliasFanoIPv6SetTest, Queries_KeyOnUpperHalves)
+{
+    const std::vector<IPv6Address> cAddresses{IPv6Address("2001:db8:0:1::5"), IPv6Address("2001:db8:0:1::6"), IPv6Address("2001:db8:0:9::1"),
+                                              IPv6Address("fe80::1")};
+    const EliasFanoIPv6Set cSet(cAddresses);
+    EXPECT_EQ(cSet.Size(), 3u);
+    EXPECT_TRUE(cSet.Contains(IPv6Address("2001:db8:0:1:ffff::")));
+    EXPECT_FALSE(cSet.Contains(IPv6Address("2001:db8:0:2::5")));
+    EXPECT_EQ(cSet.Select(1), IPv6Address("2001:db8:0:9::"));
+    EXPECT_EQ(cSet.Rank(IPv6Address("fe80::")), 2u);
+
+    IPv6Address predecessor;
+    EXPECT_TRUE(cSet.Predecessor(IPv6Address("2001:db8:0:8::"), predecessor));
+    EXPECT_EQ(predecessor, IPv6Address("2001:db8:0:1::"));
+    EXPECT_FALSE(cSet.Predecessor(IPv6Address("::1"), predecessor));
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
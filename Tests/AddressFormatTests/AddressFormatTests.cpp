@@ -0,0 +1,134 @@
+/**
+ * @file AddressFormatTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for AddressFormat class and the address formatters.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressFormat/AddressFormatter.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    template <typename Address>
+    std::string Format(const Address &cAddress, const char *cSpec)
+    {
+        const char *position = cSpec;
+        const char *cEnd = cSpec + std::strlen(cSpec);
+        AddressFormat::Spec spec;
+        const char *cError = AddressFormat::Parse(position, cEnd, std::is_same<Address, IPv4Address>::value ? AddressFormat::IPV4_FLAGS : AddressFormat::IPV6_FLAGS, spec);
+        if (cError)
+        {
+            return cError;
+        }
+        char text[AddressFormat::MAX_LENGTH];
+        std::string result;
+        const size_t cLength = AddressFormat::Write(cAddress, spec, text);
+        AddressFormat::Pad(std::back_inserter(result), cLength, spec, [&](const auto &cOutput) { return std::copy(text, text + cLength, cOutput); });
+        return result;
+    }
+
+    template <typename Address>
+    std::string Streamed(const Address &cAddress)
+    {
+        std::ostringstream stream;
+        stream << cAddress;
+        return stream.str();
+    }
+}
+
+TEST(AddressFormatTest, Write_IPv4Specs_MatchesForms)
+{
+    const IPv4Address cAddress(10, 0, 100, 255);
+    EXPECT_EQ(Format(cAddress, ""), Streamed(cAddress));
+    EXPECT_EQ(Format(cAddress, ""), "10.0.100.255");
+    EXPECT_EQ(Format(cAddress, "p"), "010.000.100.255");
+    EXPECT_EQ(Format(cAddress, ">15"), "   10.0.100.255");
+    EXPECT_EQ(Format(cAddress, "*^16"), "**10.0.100.255**");
+    EXPECT_EQ(Format(cAddress, "<3"), "10.0.100.255");
+    EXPECT_EQ(Format(IPv4Address(255, 255, 255, 255), ""), "255.255.255.255");
+    EXPECT_EQ(Format(IPv4Address(), "p"), "000.000.000.000");
+}
+
+TEST(AddressFormatTest, Write_IPv6Specs_MatchesForms)
+{
+    const IPv6Address cAddress("2001:db8::ab:1");
+    EXPECT_EQ(Format(cAddress, ""), Streamed(cAddress));
+    EXPECT_EQ(Format(cAddress, "e"), "2001:0db8:0000:0000:0000:0000:00ab:0001");
+    EXPECT_EQ(Format(cAddress, "c"), "2001:db8::ab:1");
+    EXPECT_EQ(Format(cAddress, "cU"), "2001:DB8::AB:1");
+    EXPECT_EQ(Format(cAddress, ">16c"), "  2001:db8::ab:1");
+    EXPECT_EQ(Format(IPv6Address("::"), "c"), "::");
+    EXPECT_EQ(Format(IPv6Address("::1"), "c"), "::1");
+    EXPECT_EQ(Format(IPv6Address("fe80::"), "c"), "fe80::");
+    // RFC 5952: a single zero group is not compressed, and the first of equal runs is.
+    EXPECT_EQ(Format(IPv6Address("2001:db8:0:1:1:1:1:1"), "c"), "2001:db8:0:1:1:1:1:1");
+    EXPECT_EQ(Format(IPv6Address("2001:0:0:1:0:0:1:1"), "c"), "2001::1:0:0:1:1");
+    EXPECT_EQ(Format(IPv6Address("2001:db8:0:0:1:0:0:0"), "c"), "2001:db8:0:0:1::");
+    // RFC 5952 section 5: IPv4-mapped addresses end in dotted decimal.
+    EXPECT_EQ(Format(IPv6Address("::ffff:0:4670"), "c"), "::ffff:0.0.70.112");
+    EXPECT_EQ(Format(IPv6Address("::ffff:c000:201"), "cU"), "::FFFF:192.0.2.1");
+    EXPECT_EQ(Format(IPv6Address("::ffff:ffff:ffff"), ">24c"), "  ::ffff:255.255.255.255");
+    EXPECT_EQ(Format(IPv6Address("::ffff:c000:201"), "e"), "0000:0000:0000:0000:0000:ffff:c000:0201");
+    EXPECT_EQ(Format(IPv6Address("::fffe:c000:201"), "c"), "::fffe:c000:201");
+}
+
+TEST(AddressFormatTest, Parse_InvalidSpecs_ReturnsError)
+{
+    EXPECT_NE(Format(IPv4Address(), "c")[0], '0');
+    EXPECT_NE(Format(IPv4Address(), "x")[0], '0');
+    EXPECT_NE(Format(IPv6Address(), "p")[0], '0');
+    EXPECT_NE(Format(IPv6Address(), "ce")[0], '0');
+    EXPECT_NE(Format(IPv6Address(), "ec")[0], '0');
+    EXPECT_NE(Format(IPv6Address(), "99999999")[0], '0');
+
+    // Parsing stops at the closing brace.
+    const char cSpec[]{">20c}tail"};
+    const char *position = cSpec;
+    AddressFormat::Spec spec;
+    EXPECT_EQ(AddressFormat::Parse(position, cSpec + sizeof(cSpec) - 1, AddressFormat::IPV6_FLAGS, spec), nullptr);
+    EXPECT_EQ(*position, '}');
+    EXPECT_EQ(spec.width, 20u);
+    EXPECT_TRUE(spec.compressed);
+}
+
+#if defined(ETHERNET_PARAMETER_WITH_FMT)
+TEST(AddressFormatTest, FmtFormat_Specs_MatchesAddressFormat)
+{
+    const IPv4Address cIpv4(192, 168, 1, 7);
+    const IPv6Address cIpv6("2001:db8::1");
+    EXPECT_EQ(fmt::format("{}", cIpv4), Streamed(cIpv4));
+    EXPECT_EQ(fmt::format("{}", cIpv6), Streamed(cIpv6));
+    EXPECT_EQ(fmt::format("[{:p}] [{:>12}]", cIpv4, IPv4Address(1, 2, 3, 4)), "[192.168.001.007] [     1.2.3.4]");
+    EXPECT_EQ(fmt::format("{:c} {:cU} {:-^15c}", cIpv6, IPv6Address("fe80::A"), IPv6Address("::1")), "2001:db8::1 FE80::A ------::1------");
+    EXPECT_THROW(static_cast<void>(fmt::format(fmt::runtime("{:c}"), cIpv4)), fmt::format_error);
+}
+#endif
+
+#if defined(__cpp_lib_format)
+TEST(AddressFormatTest, StdFormat_Specs_MatchesAddressFormat)
+{
+    const IPv6Address cIpv6("2001:db8::1");
+    EXPECT_EQ(std::format("{}", cIpv6), Streamed(cIpv6));
+    EXPECT_EQ(std::format("{:p} {:c}", IPv4Address(1, 2, 3, 4), cIpv6), "001.002.003.004 2001:db8::1");
+    EXPECT_THROW(static_cast<void>(std::vformat("{:p}", std::make_format_args(cIpv6))), std::format_error);
+}
+#endif
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,344 @@
+/**
+ * @file AddressIndexTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for MinimalPerfectHash, StaticAddressMap, EytzingerAddressSet and AddressSetOperations classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressIndex/AddressSetOperations.hpp"
+#include "AddressIndex/EytzingerAddressSet.hpp"
+#include "AddressIndex/MinimalPerfectHash.hpp"
+#include "AddressIndex/StaticAddressMap.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Copies bytes into a word buffer, which stands in for an aligned memory-mapped file.
+     */
+    std::vector<uint64_t> AlignedImage(const std::vector<uint8_t> &cBytes)
+    {
+        std::vector<uint64_t> image(cBytes.size() / sizeof(uint64_t));
+        std::memcpy(image.data(), cBytes.data(), cBytes.size());
+        return image;
+    }
+}
+
+TEST(MinimalPerfectHashTest, Lookup_VariousSizes_IsBijective)
+{
+    std::mt19937_64 random(3);
+    for (const size_t &cCount : std::vector<size_t>{0, 1, 2, 63, 1000, 100000})
+    {
+        std::vector<uint64_t> upper(cCount);
+        std::vector<uint64_t> lower(cCount);
+        for (size_t i = 0; i < cCount; i++)
+        {
+            upper[i] = random() % 4;
+            lower[i] = i * 0x10001;
+        }
+        const MinimalPerfectHash cHash(upper.data(), lower.data(), cCount, 1);
+        ASSERT_EQ(cHash.Size(), cCount);
+        EXPECT_LT(cHash.SizeInBytes() * 8, 4.5 * cCount + 4096) << cCount;
+
+        std::vector<size_t> positions(cCount);
+        cHash.Lookup(upper.data(), lower.data(), cCount, positions.data());
+        std::vector<bool> used(cCount);
+        for (size_t i = 0; i < cCount; i++)
+        {
+            ASSERT_LT(positions[i], cCount);
+            ASSERT_FALSE(used[positions[i]]) << i;
+            used[positions[i]] = true;
+            ASSERT_EQ(cHash.Lookup(upper[i], lower[i]), positions[i]);
+        }
+        EXPECT_LE(cHash.Lookup(UINT64_MAX, UINT64_MAX), cCount);
+    }
+}
+
+TEST(MinimalPerfectHashTest, Construct_ThreadCount_DoesNotChangeResult)
+{
+    std::vector<uint64_t> lower(300000);
+    for (size_t i = 0; i < lower.size(); i++)
+    {
+        lower[i] = 0x0A000000u + 7 * i;
+    }
+    const std::vector<uint8_t> cSingle = MinimalPerfectHash(nullptr, lower.data(), lower.size(), 1).Serialize();
+    EXPECT_EQ(MinimalPerfectHash(nullptr, lower.data(), lower.size(), 4).Serialize(), cSingle);
+}
+
+TEST(MinimalPerfectHashTest, Construct_InvalidInput_Throws)
+{
+    const std::vector<uint64_t> cDuplicates{1, 2, 3, 2};
+    EXPECT_THROW(MinimalPerfectHash(nullptr, cDuplicates.data(), cDuplicates.size()), std::invalid_argument);
+    EXPECT_THROW(MinimalPerfectHash(nullptr, nullptr, 1), std::invalid_argument);
+    EXPECT_NO_THROW(MinimalPerfectHash(nullptr, nullptr, 0));
+}
+
+TEST(MinimalPerfectHashTest, View_SerializedWords_LooksUpInPlaceAndRejectsCorruption)
+{
+    std::vector<uint64_t> lower(5000);
+    for (size_t i = 0; i < lower.size(); i++)
+    {
+        lower[i] = i * i;
+    }
+    const MinimalPerfectHash cHash(nullptr, lower.data(), lower.size());
+    const std::vector<uint8_t> cBytes = cHash.Serialize();
+    ASSERT_EQ(cBytes.size(), cHash.SizeInBytes());
+
+    std::vector<uint64_t> image = AlignedImage(cBytes);
+    const uint8_t *const cImage = reinterpret_cast<const uint8_t *>(image.data());
+    const MinimalPerfectHash cView = MinimalPerfectHash::View(cImage, cBytes.size());
+    for (size_t i = 0; i < lower.size(); i += 97)
+    {
+        EXPECT_EQ(cView.Lookup(0, lower[i]), cHash.Lookup(0, lower[i]));
+    }
+
+    EXPECT_THROW(MinimalPerfectHash::View(nullptr, 0), std::invalid_argument);
+    EXPECT_THROW(MinimalPerfectHash::View(cImage, cBytes.size() - 8), std::invalid_argument);
+    EXPECT_THROW(MinimalPerfectHash::View(cImage + 4, cBytes.size() - 8), std::invalid_argument);
+    // The header and the level offsets are checked by View() itself; the blocks and the fallback
+    // table only by Validate(), which reads the whole image.
+    EXPECT_NO_THROW(cView.Validate());
+    for (const size_t &cWord : std::vector<size_t>{0, 2, 5, 9})
+    {
+        std::vector<uint64_t> corrupted = image;
+        corrupted[cWord] ^= 1;
+        EXPECT_THROW(MinimalPerfectHash::View(reinterpret_cast<const uint8_t *>(corrupted.data()), cBytes.size()), std::invalid_argument) << cWord;
+    }
+    for (const size_t &cWord : std::vector<size_t>{1, image.size() / 2})
+    {
+        std::vector<uint64_t> corrupted = image;
+        corrupted[cWord] ^= 1;
+        const MinimalPerfectHash cCorrupted = MinimalPerfectHash::View(reinterpret_cast<const uint8_t *>(corrupted.data()), cBytes.size());
+        EXPECT_THROW(cCorrupted.Validate(), std::invalid_argument) << cWord;
+    }
+}
+
+TEST(StaticAddressMapTest, Find_IPv4Keys_ReturnsValuesAndRejectsOthers)
+{
+    std::vector<IPv4Address> keys;
+    std::vector<uint32_t> tenants;
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        keys.push_back(IPv4Address::FromUint32(0xC0A80000u + 3 * i));
+        tenants.push_back(i % 97);
+    }
+    const StaticAddressMap<IPv4Address, uint32_t> cMap(keys, tenants);
+    EXPECT_EQ(cMap.Size(), keys.size());
+
+    uint32_t tenant{};
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        ASSERT_TRUE(cMap.Find(keys[i], tenant)) << i;
+        ASSERT_EQ(tenant, tenants[i]);
+    }
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        ASSERT_FALSE(cMap.Contains(IPv4Address::FromUint32(0xC0A80001u + 3 * i)));
+    }
+    EXPECT_FALSE((StaticAddressMap<IPv4Address, uint32_t>().Contains(IPv4Address("10.0.0.1"))));
+
+    EXPECT_THROW((StaticAddressMap<IPv4Address, uint32_t>(keys, std::vector<uint32_t>(3))), std::invalid_argument);
+    keys.push_back(keys[5]);
+    tenants.push_back(0);
+    EXPECT_THROW((StaticAddressMap<IPv4Address, uint32_t>(keys, tenants)), std::invalid_argument);
+}
+
+TEST(StaticAddressMapTest, View_IPv6Keys_QueriesInPlace)
+{
+    struct Record
+    {
+        uint16_t asn;
+        uint8_t country[2];
+    };
+    std::mt19937_64 random(9);
+    std::vector<IPv6Address> keys;
+    std::vector<Record> records;
+    for (uint16_t i = 0; i < 3000; i++)
+    {
+        keys.push_back(IPv6Address::FromUint64(0x20010DB800000000ull | i, random()));
+        records.push_back(Record{i, {'P', 'L'}});
+    }
+    const StaticAddressMap<IPv6Address, Record> cMap(keys, records);
+    const std::vector<uint8_t> cBytes = cMap.Serialize();
+    ASSERT_EQ(cBytes.size(), cMap.SizeInBytes());
+
+    const std::vector<uint64_t> cImage = AlignedImage(cBytes);
+    const auto cView = StaticAddressMap<IPv6Address, Record>::View(reinterpret_cast<const uint8_t *>(cImage.data()), cBytes.size());
+    EXPECT_NO_THROW(cView.Validate());
+    Record record{};
+    ASSERT_TRUE(cView.Find(keys[1234], record));
+    EXPECT_EQ(record.asn, 1234);
+    EXPECT_EQ(record.country[1], 'L');
+    EXPECT_FALSE(cView.Contains(IPv6Address::FromUint64(keys[1234].GetUpper64(), keys[1234].GetLower64() + 1)));
+
+    // Another key or value type does not match the image.
+    EXPECT_THROW((StaticAddressMap<IPv6Address, uint64_t>::View(reinterpret_cast<const uint8_t *>(cImage.data()), cBytes.size())), std::invalid_argument);
+    EXPECT_THROW((StaticAddressMap<IPv4Address, Record>::View(reinterpret_cast<const uint8_t *>(cImage.data()), cBytes.size())), std::invalid_argument);
+    EXPECT_THROW((StaticAddressMap<IPv6Address, Record>::View(reinterpret_cast<const uint8_t *>(cImage.data()), cBytes.size() - 8)), std::invalid_argument);
+}
+
+TEST(EytzingerAddressSetTest, Search_IPv4Keys_MatchesSortedArray)
+{
+    std::mt19937 random(5);
+    for (const size_t &cCount : std::vector<size_t>{0, 1, 2, 15, 16, 17, 100, 4095, 20000})
+    {
+        std::vector<IPv4Address> addresses;
+        for (size_t i = 0; i < cCount; i++)
+        {
+            addresses.push_back(IPv4Address::FromUint32(random() % 100000 * 4));
+        }
+        const EytzingerAddressSet<IPv4Address> cSet(addresses);
+        std::vector<uint32_t> sorted;
+        for (const IPv4Address &cAddress : addresses)
+        {
+            sorted.push_back(cAddress.ToUint32());
+        }
+        std::sort(sorted.begin(), sorted.end());
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        ASSERT_EQ(cSet.Size(), sorted.size());
+
+        for (uint32_t probe = 0; probe < 400010; probe += 1 + probe % 7)
+        {
+            const auto cLower = std::lower_bound(sorted.begin(), sorted.end(), probe);
+            IPv4Address found;
+            ASSERT_EQ(cSet.LowerBound(IPv4Address::FromUint32(probe), found), cLower != sorted.end()) << probe;
+            if (cLower != sorted.end())
+            {
+                ASSERT_EQ(found.ToUint32(), *cLower);
+            }
+            ASSERT_EQ(cSet.Contains(IPv4Address::FromUint32(probe)), cLower != sorted.end() && *cLower == probe);
+
+            const auto cUpper = std::upper_bound(sorted.begin(), sorted.end(), probe);
+            ASSERT_EQ(cSet.Predecessor(IPv4Address::FromUint32(probe), found), cUpper != sorted.begin()) << probe;
+            if (cUpper != sorted.begin())
+            {
+                ASSERT_EQ(found.ToUint32(), *(cUpper - 1));
+            }
+        }
+    }
+    const EytzingerAddressSet<IPv4Address> cFull(std::vector<IPv4Address>{IPv4Address("0.0.0.0"), IPv4Address("255.255.255.255")});
+    IPv4Address found;
+    EXPECT_TRUE(cFull.Predecessor(IPv4Address("255.255.255.254"), found));
+    EXPECT_EQ(found, IPv4Address("0.0.0.0"));
+    EXPECT_TRUE(cFull.LowerBound(IPv4Address("0.0.0.1"), found));
+    EXPECT_EQ(found, IPv4Address("255.255.255.255"));
+}
+
+TEST(EytzingerAddressSetTest, Search_IPv6Keys_ComparesBothHalves)
+{
+    std::vector<IPv6Address> addresses;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        addresses.push_back(IPv6Address::FromUint64(0x20010DB800000000ull + i / 10, (i % 10) << 60));
+    }
+    const EytzingerAddressSet<IPv6Address> cSet(addresses);
+    EXPECT_EQ(cSet.Size(), addresses.size());
+
+    IPv6Address found;
+    ASSERT_TRUE(cSet.Predecessor(IPv6Address::FromUint64(0x20010DB800000007ull, UINT64_MAX), found));
+    EXPECT_EQ(found, IPv6Address::FromUint64(0x20010DB800000007ull, 9ull << 60));
+    ASSERT_TRUE(cSet.LowerBound(IPv6Address::FromUint64(0x20010DB800000007ull, (9ull << 60) + 1), found));
+    EXPECT_EQ(found, IPv6Address::FromUint64(0x20010DB800000008ull, 0));
+    EXPECT_TRUE(cSet.Contains(addresses[555]));
+    EXPECT_FALSE(cSet.Contains(IPv6Address::FromUint64(addresses[555].GetUpper64(), addresses[555].GetLower64() + 1)));
+    EXPECT_FALSE(cSet.Predecessor(IPv6Address::FromUint64(0x20010DB7FFFFFFFFull, UINT64_MAX), found));
+    EXPECT_FALSE(cSet.LowerBound(IPv6Address::FromUint64(0x20010DB800000063ull, (9ull << 60) + 1), found));
+}
+
+TEST(AddressSetOperationsTest, IPv4Operations_VariousOverlaps_MatchStandardAlgorithms)
+{
+    std::mt19937 random(11);
+    for (const size_t &cCount : std::vector<size_t>{0, 3, 4, 7, 8, 9, 37, 1000, 400000})
+    {
+        // Random subsets of a range, so the inputs overlap in runs of every length.
+        std::vector<IPv4Address> left;
+        std::vector<IPv4Address> right;
+        for (uint32_t value = 0xC0000000u; left.size() < cCount; value++)
+        {
+            const uint32_t cDraw = random() % 8;
+            if (cDraw < 3 || cDraw == 7)
+            {
+                left.push_back(IPv4Address::FromUint32(value));
+            }
+            if (cDraw >= 2 && cDraw < 5)
+            {
+                right.push_back(IPv4Address::FromUint32(value));
+            }
+        }
+        std::vector<IPv4Address> expected;
+        std::vector<IPv4Address> output(left.size() + right.size());
+        for (const size_t &cThreads : std::vector<size_t>{1, 4})
+        {
+            expected.clear();
+            std::set_intersection(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+            size_t count = AddressSetOperations::Intersection(left.data(), left.size(), right.data(), right.size(), output.data(), cThreads);
+            ASSERT_EQ(std::vector<IPv4Address>(output.begin(), output.begin() + count), expected) << cCount;
+
+            expected.clear();
+            std::set_difference(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+            count = AddressSetOperations::Difference(left.data(), left.size(), right.data(), right.size(), output.data(), cThreads);
+            ASSERT_EQ(std::vector<IPv4Address>(output.begin(), output.begin() + count), expected) << cCount;
+
+            expected.clear();
+            std::set_difference(right.begin(), right.end(), left.begin(), left.end(), std::back_inserter(expected));
+            count = AddressSetOperations::Difference(right.data(), right.size(), left.data(), left.size(), output.data(), cThreads);
+            ASSERT_EQ(std::vector<IPv4Address>(output.begin(), output.begin() + count), expected) << cCount;
+
+            expected.clear();
+            std::set_union(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+            count = AddressSetOperations::Union(left.data(), left.size(), right.data(), right.size(), output.data(), cThreads);
+            ASSERT_EQ(std::vector<IPv4Address>(output.begin(), output.begin() + count), expected) << cCount;
+        }
+    }
+}
+
+TEST(AddressSetOperationsTest, IPv6Operations_UnevenInputs_MatchStandardAlgorithms)
+{
+    std::vector<IPv6Address> left;
+    std::vector<IPv6Address> right;
+    for (uint64_t i = 0; i < 300000; i++)
+    {
+        left.push_back(IPv6Address::FromUint64(0x20010DB800000000ull + i / 3, i % 3 << 62));
+        if (i % 50 == 0)
+        {
+            right.push_back(IPv6Address::FromUint64(0x20010DB800000000ull + i / 3, (i % 3 << 62) + i % 100));
+        }
+    }
+    std::vector<IPv6Address> expected;
+    std::vector<IPv6Address> output(left.size() + right.size());
+    std::set_intersection(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    size_t count = AddressSetOperations::Intersection(right.data(), right.size(), left.data(), left.size(), output.data(), 3);
+    ASSERT_EQ(std::vector<IPv6Address>(output.begin(), output.begin() + count), expected);
+
+    expected.clear();
+    std::set_difference(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    count = AddressSetOperations::Difference(left.data(), left.size(), right.data(), right.size(), output.data(), 3);
+    ASSERT_EQ(std::vector<IPv6Address>(output.begin(), output.begin() + count), expected);
+
+    expected.clear();
+    std::set_union(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    count = AddressSetOperations::Union(right.data(), right.size(), left.data(), left.size(), output.data(), 3);
+    ASSERT_EQ(std::vector<IPv6Address>(output.begin(), output.begin() + count), expected);
+
+    EXPECT_THROW(AddressSetOperations::Union(left.data(), left.size(), nullptr, 1, output.data()), std::invalid_argument);
+    EXPECT_THROW(AddressSetOperations::Intersection(left.data(), left.size(), right.data(), right.size(), nullptr), std::invalid_argument);
+    EXPECT_EQ(AddressSetOperations::Difference(static_cast<const IPv6Address *>(nullptr), 0, nullptr, 0, nullptr), 0u);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,315 @@
+/**
+ * @file AddressPoolTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for AddressBitmap, IPv4AddressPool, IPv6AddressPool and ConcurrentAddressPool classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressPool/AddressBitmap.hpp"
+#include "AddressPool/ConcurrentAddressPool.hpp"
+#include "AddressPool/IPv4AddressPool.hpp"
+#include "AddressPool/IPv6AddressPool.hpp"
+#include "gtest/gtest.h"
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+TEST(AddressBitmapTest, FindFirstZero_AcrossLevels_LowestFreeSlot)
+{
+    AddressBitmap bitmap(64 * 64 * 3 + 5);
+    for (uint64_t i = 0; i < 64 * 64 + 10; i++)
+    {
+        ASSERT_EQ(i, bitmap.FindFirstZero());
+        bitmap.Set(i);
+    }
+    ASSERT_EQ(64u * 64 + 10, bitmap.Count());
+
+    bitmap.Reset(77);
+    ASSERT_EQ(77u, bitmap.FindFirstZero());
+    bitmap.Set(77);
+    ASSERT_EQ(64u * 64 + 10, bitmap.FindFirstZero());
+}
+
+TEST(AddressBitmapTest, FindFirstZero_Full_ReturnsSize)
+{
+    AddressBitmap bitmap(130);
+    for (uint64_t i = 0; i < 130; i++)
+    {
+        bitmap.Set(i);
+    }
+    ASSERT_EQ(130u, bitmap.FindFirstZero());
+    ASSERT_EQ(130u, bitmap.Count());
+
+    bitmap.Reset(129);
+    ASSERT_EQ(129u, bitmap.FindFirstZero());
+}
+
+TEST(AddressBitmapTest, Constructor_InvalidSize_Throws)
+{
+    ASSERT_THROW(AddressBitmap(0), std::invalid_argument);
+    ASSERT_THROW(AddressBitmap(AddressBitmap::MAX_SIZE + 1), std::invalid_argument);
+}
+
+TEST(AddressBitmapTest, Binary_RoundTrip_SameState)
+{
+    AddressBitmap bitmap(1000);
+    bitmap.Set(0);
+    bitmap.Set(500);
+    bitmap.Set(999);
+
+    std::vector<uint8_t> binary;
+    bitmap.AppendBinary(binary);
+    ASSERT_EQ(bitmap.BinarySize(), binary.size());
+
+    AddressBitmap restored(1000);
+    restored.SetFromBinary(binary.data());
+    ASSERT_EQ(3u, restored.Count());
+    ASSERT_TRUE(restored.Test(500));
+    ASSERT_EQ(1u, restored.FindFirstZero());
+}
+
+TEST(IPv4AddressPoolTest, Allocate_Prefix_LowestAddressesFirst)
+{
+    IPv4AddressPool pool(IPv4Prefix("10.0.0.0/30"));
+    ASSERT_EQ(4u, pool.Size());
+    ASSERT_EQ(IPv4Address(10, 0, 0, 0), pool.Allocate());
+    ASSERT_EQ(IPv4Address(10, 0, 0, 1), pool.Allocate());
+    ASSERT_EQ(2u, pool.Available());
+
+    pool.Free(IPv4Address(10, 0, 0, 0));
+    ASSERT_EQ(IPv4Address(10, 0, 0, 0), pool.Allocate());
+    ASSERT_EQ(IPv4Address(10, 0, 0, 2), pool.Allocate());
+    ASSERT_EQ(IPv4Address(10, 0, 0, 3), pool.Allocate());
+    ASSERT_THROW(pool.Allocate(), std::runtime_error);
+
+    IPv4Address untouched(1, 2, 3, 4);
+    ASSERT_FALSE(pool.TryAllocate(untouched));
+    ASSERT_EQ(IPv4Address(1, 2, 3, 4), untouched);
+}
+
+TEST(IPv4AddressPoolTest, Reserve_NetworkAndBroadcast_NeverAllocated)
+{
+    IPv4AddressPool pool(IPv4Prefix("192.168.1.0/29"));
+    pool.Reserve(IPv4Address(192, 168, 1, 0));
+    pool.Reserve(IPv4Range(IPv4Address(192, 168, 1, 7), IPv4Address(192, 168, 2, 10)));
+
+    ASSERT_TRUE(pool.IsReserved(IPv4Address(192, 168, 1, 7)));
+    ASSERT_TRUE(pool.IsAllocated(IPv4Address(192, 168, 1, 7)));
+    ASSERT_EQ(6u, pool.Available());
+
+    std::vector<IPv4Address> addresses(10);
+    ASSERT_EQ(6u, pool.AllocateBatch(addresses.data(), addresses.size()));
+    ASSERT_EQ(IPv4Address(192, 168, 1, 1), addresses[0]);
+    ASSERT_EQ(IPv4Address(192, 168, 1, 6), addresses[5]);
+
+    ASSERT_THROW(pool.Free(IPv4Address(192, 168, 1, 0)), std::invalid_argument);
+    pool.Unreserve(IPv4Address(192, 168, 1, 0));
+    ASSERT_EQ(IPv4Address(192, 168, 1, 0), pool.Allocate());
+}
+
+TEST(IPv4AddressPoolTest, ReserveRange_AllocatedAddress_NothingReserved)
+{
+    IPv4AddressPool pool(IPv4Prefix("10.0.0.0/29"));
+    ASSERT_TRUE(pool.Allocate(IPv4Address(10, 0, 0, 5)));
+    ASSERT_THROW(pool.Reserve(IPv4Range(IPv4Address(10, 0, 0, 2), IPv4Address(10, 0, 0, 6))), std::invalid_argument);
+
+    ASSERT_FALSE(pool.IsReserved(IPv4Address(10, 0, 0, 2)));
+    ASSERT_FALSE(pool.IsAllocated(IPv4Address(10, 0, 0, 4)));
+    ASSERT_EQ(7u, pool.Available());
+}
+
+TEST(IPv4AddressPoolTest, AllocateSpecific_AndErrors)
+{
+    IPv4AddressPool pool(IPv4Range(IPv4Address(10, 0, 0, 10), IPv4Address(10, 0, 0, 20)));
+    ASSERT_TRUE(pool.Allocate(IPv4Address(10, 0, 0, 10)));
+    ASSERT_FALSE(pool.Allocate(IPv4Address(10, 0, 0, 10)));
+    ASSERT_EQ(IPv4Address(10, 0, 0, 11), pool.Allocate());
+
+    ASSERT_THROW(pool.Allocate(IPv4Address(10, 0, 0, 21)), std::out_of_range);
+    ASSERT_THROW(pool.Free(IPv4Address(10, 0, 0, 9)), std::out_of_range);
+    ASSERT_THROW(pool.Free(IPv4Address(10, 0, 0, 15)), std::invalid_argument);
+    ASSERT_THROW(pool.Reserve(IPv4Address(10, 0, 0, 10)), std::invalid_argument);
+    ASSERT_FALSE(pool.IsAllocated(IPv4Address(10, 0, 0, 9)));
+}
+
+TEST(IPv4AddressPoolTest, Binary_SnapshotRestore_SameState)
+{
+    IPv4AddressPool pool(IPv4Prefix("172.16.0.0/22"));
+    pool.Reserve(IPv4Address(172, 16, 0, 1));
+    for (int i = 0; i < 300; i++)
+    {
+        pool.Allocate();
+    }
+    pool.Free(IPv4Address(172, 16, 0, 100));
+
+    IPv4AddressPool restored(pool.ToBinary());
+    ASSERT_EQ(pool.GetRange(), restored.GetRange());
+    ASSERT_EQ(pool.Available(), restored.Available());
+    ASSERT_TRUE(restored.IsReserved(IPv4Address(172, 16, 0, 1)));
+    ASSERT_EQ(IPv4Address(172, 16, 0, 100), restored.Allocate());
+    ASSERT_EQ(IPv4Address(172, 16, 1, 45), restored.Allocate());
+
+    std::vector<uint8_t> truncated = pool.ToBinary();
+    truncated.pop_back();
+    ASSERT_THROW(IPv4AddressPool{truncated}, std::invalid_argument);
+}
+
+TEST(IPv6AddressPoolTest, Allocate_Prefix_LowestAddressesFirst)
+{
+    IPv6Prefix prefix(IPv6Address(0x2001, 0x0db8, 0, 0, 0, 0, 0, 0), 120);
+    IPv6AddressPool pool(prefix);
+    ASSERT_EQ(256u, pool.Size());
+    pool.Reserve(prefix.First());
+
+    ASSERT_EQ(prefix.First() + 1, pool.Allocate());
+    ASSERT_EQ(prefix.First() + 2, pool.Allocate());
+    pool.Free(prefix.First() + 1);
+    ASSERT_EQ(prefix.First() + 1, pool.Allocate());
+    ASSERT_EQ(253u, pool.Available());
+
+    IPv6AddressPool restored(pool.ToBinary());
+    ASSERT_EQ(prefix.First() + 3, restored.Allocate());
+    ASSERT_TRUE(restored.IsReserved(prefix.First()));
+}
+
+TEST(IPv6AddressPoolTest, Constructor_PrefixTooLarge_Throws)
+{
+    ASSERT_THROW(IPv6AddressPool(IPv6Prefix(IPv6Address(), 64)), std::invalid_argument);
+    ASSERT_NO_THROW(IPv6AddressPool(IPv6Prefix(IPv6Address(), 112)));
+}
+
+TEST(IPv6AddressPoolTest, Constructor_WindowOfSlash64_CoversFirstAddresses)
+{
+    const IPv6Prefix cPrefix(IPv6Address(0x2001, 0x0db8, 0, 0x0042, 0, 0, 0, 0), 64);
+    IPv6AddressPool pool(cPrefix, 1024);
+    ASSERT_EQ(1024u, pool.Size());
+    ASSERT_EQ(cPrefix.First(), pool.GetRange().GetFirst());
+    ASSERT_EQ(cPrefix.First() + 1023, pool.GetRange().GetLast());
+    ASSERT_EQ(cPrefix.First(), pool.Allocate());
+    ASSERT_THROW(pool.Free(cPrefix.First() + 1024), std::out_of_range);
+
+    // The window is capped to the prefix, and must fit into a bitmap.
+    ASSERT_EQ(256u, IPv6AddressPool(IPv6Prefix(IPv6Address(), 120), 1024).Size());
+    ASSERT_THROW(IPv6AddressPool(cPrefix, 0), std::invalid_argument);
+    ASSERT_THROW(IPv6AddressPool(cPrefix, AddressBitmap::MAX_SIZE + 1), std::invalid_argument);
+}
+
+TEST(ConcurrentAddressPoolTest, Allocate_ManyThreads_UniqueAddresses)
+{
+    ConcurrentIPv4AddressPool pool(IPv4AddressPool(IPv4Prefix("10.0.0.0/16")), 4, 16);
+    constexpr int cThreads = 4;
+    constexpr int cPerThread = 5000;
+    std::vector<std::vector<IPv4Address>> allocated(cThreads);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < cThreads; t++)
+    {
+        threads.emplace_back([&pool, &allocated, t]()
+                             {
+                                 for (int i = 0; i < cPerThread; i++)
+                                 {
+                                     allocated[t].push_back(pool.Allocate());
+                                     if (i % 3 == 0)
+                                     {
+                                         pool.Free(allocated[t].back());
+                                         allocated[t].pop_back();
+                                     }
+                                 } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<uint32_t> unique;
+    size_t total{};
+    for (const std::vector<IPv4Address> &cAddresses : allocated)
+    {
+        for (const IPv4Address &cAddress : cAddresses)
+        {
+            unique.insert(cAddress.ToUint32());
+            total++;
+        }
+    }
+    ASSERT_EQ(total, unique.size());
+    ASSERT_EQ(65536u - total, pool.Available());
+
+    IPv4AddressPool snapshot(pool.ToBinary());
+    ASSERT_EQ(65536u - total, snapshot.Available());
+}
+
+TEST(ConcurrentAddressPoolTest, Allocate_Exhausted_StealsFromOtherCaches)
+{
+    ConcurrentIPv4AddressPool pool(IPv4AddressPool(IPv4Prefix("10.0.0.0/28")), 2, 8);
+
+    IPv4Address first = pool.Allocate();
+    std::thread([&pool]()
+                {
+                    for (int i = 0; i < 15; i++)
+                    {
+                        pool.Allocate();
+                    } })
+        .join();
+
+    IPv4Address address;
+    ASSERT_FALSE(pool.TryAllocate(address));
+    pool.Free(first);
+    ASSERT_EQ(first, pool.Allocate());
+    ASSERT_THROW(pool.Allocate(), std::runtime_error);
+}
+
+TEST(ConcurrentAddressPoolTest, Free_Twice_ThrowsAndNeverDuplicates)
+{
+    ConcurrentIPv4AddressPool pool(IPv4AddressPool(IPv4Prefix("10.0.0.0/24")), 1, 4);
+    const IPv4Address cAddress = pool.Allocate();
+    pool.Free(cAddress);
+    ASSERT_THROW(pool.Free(cAddress), std::invalid_argument);
+
+    std::set<uint32_t> unique;
+    for (int i = 0; i < 256; i++)
+    {
+        ASSERT_TRUE(unique.insert(pool.Allocate().ToUint32()).second);
+    }
+    ASSERT_THROW(pool.Allocate(), std::runtime_error);
+}
+
+TEST(ConcurrentAddressPoolTest, Free_OutOfPoolOrNeverAllocated_Throws)
+{
+    ConcurrentIPv4AddressPool pool(IPv4AddressPool(IPv4Prefix("10.0.0.0/24")), 1, 4);
+    pool.WithPool([](IPv4AddressPool &shared)
+                  { shared.Reserve(IPv4Address(10, 0, 0, 1)); });
+    ASSERT_THROW(pool.Free(IPv4Address(192, 168, 1, 1)), std::out_of_range);
+    ASSERT_THROW(pool.Free(IPv4Address(10, 0, 0, 200)), std::invalid_argument);
+    ASSERT_THROW(pool.Free(IPv4Address(10, 0, 0, 1)), std::invalid_argument);
+
+    for (int i = 0; i < 255; i++)
+    {
+        const IPv4Address cAddress = pool.Allocate();
+        ASSERT_TRUE(IPv4Prefix("10.0.0.0/24").Contains(cAddress));
+        ASSERT_NE(IPv4Address(10, 0, 0, 1), cAddress);
+    }
+    ASSERT_THROW(pool.Allocate(), std::runtime_error);
+}
+
+TEST(ConcurrentAddressPoolTest, Free_AllocatedOnSharedPool_ReturnsToSharedPool)
+{
+    ConcurrentIPv4AddressPool pool(IPv4AddressPool(IPv4Prefix("10.0.0.0/30")), 1, 4);
+    pool.WithPool([](IPv4AddressPool &shared)
+                  { shared.Allocate(IPv4Address(10, 0, 0, 2)); });
+    pool.Free(IPv4Address(10, 0, 0, 2));
+    ASSERT_THROW(pool.Free(IPv4Address(10, 0, 0, 2)), std::invalid_argument);
+    ASSERT_EQ(4u, pool.Available());
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,202 @@
+/**
+ * @file AddressScannerTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for AddressScanner and AddressReader classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "AddressScanner/AddressReader.hpp"
+#include "AddressScanner/AddressScanner.hpp"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    const std::string cLog =
+        "2026-10-17T12:00:01Z sshd[811]: Accepted publickey for root from 192.168.10.7 port 52214\n"
+        "nginx: 10.0.0.1:8080 -> [2001:db8::8a2e:370:7334]:443 \"GET /index.html\" fe80::1%eth0\n"
+        "version v1.2.3.4 build 1.2.3.4.5 mac 00:1a:2b:3c:4d:5e std::vector deadbeef 12:34:56\n"
+        "mapped ::ffff:203.0.113.9, bad 256.1.1.1 and 01.2.3.4, last hop 8.8.8.8.\n"
+        "fields ip:1.2.3.4 host:10.0.0.1 peer:2001:db8::1";
+
+    std::vector<std::string> Texts(const std::string &cText, const std::vector<AddressScanner::Match> &cMatches)
+    {
+        std::vector<std::string> texts;
+        for (const AddressScanner::Match &cMatch : cMatches)
+        {
+            texts.push_back(cText.substr(cMatch.offset, cMatch.length));
+        }
+        return texts;
+    }
+}
+
+TEST(AddressScannerTest, Scan_LogLines_FindsAllAddresses)
+{
+    std::vector<AddressScanner::Match> matches;
+    ASSERT_EQ(9u, AddressScanner::Scan(cLog.data(), cLog.size(), matches));
+
+    const std::vector<std::string> cExpected{"192.168.10.7", "10.0.0.1", "2001:db8::8a2e:370:7334", "fe80::1",
+                                             "::ffff:203.0.113.9", "8.8.8.8", "1.2.3.4", "10.0.0.1", "2001:db8::1"};
+    ASSERT_EQ(cExpected, Texts(cLog, matches));
+
+    ASSERT_EQ(AddressScanner::Family::IPv4, matches[0].family);
+    ASSERT_EQ(IPv4Address(192, 168, 10, 7), matches[0].ipv4);
+    ASSERT_EQ(AddressScanner::Family::IPv6, matches[2].family);
+    ASSERT_EQ(IPv6Address(0x2001, 0x0db8, 0, 0, 0, 0x8a2e, 0x0370, 0x7334), matches[2].ipv6);
+    ASSERT_EQ(IPv6Address(0, 0, 0, 0, 0, 0xffff, 0xcb00, 0x7109), matches[4].ipv6);
+    ASSERT_EQ(IPv6Address(0x2001, 0x0db8, 0, 0, 0, 0, 0, 1), matches[8].ipv6);
+}
+
+TEST(AddressScannerTest, Feed_AnyChunkSize_SameMatchesAsScan)
+{
+    std::string text;
+    for (int i = 0; i < 20; i++)
+    {
+        text += cLog + "\n";
+    }
+
+    std::vector<AddressScanner::Match> expected;
+    AddressScanner::Scan(text.data(), text.size(), expected);
+
+    for (size_t chunkSize = 1; chunkSize < 200; chunkSize += 7)
+    {
+        AddressScanner scanner;
+        std::vector<AddressScanner::Match> matches;
+        for (size_t offset = 0; offset < text.size(); offset += chunkSize)
+        {
+            scanner.Feed(text.data() + offset, std::min(chunkSize, text.size() - offset), matches);
+        }
+        scanner.Finish(matches);
+
+        ASSERT_EQ(Texts(text, expected), Texts(text, matches)) << chunkSize;
+        for (size_t i = 0; i < matches.size(); i++)
+        {
+            ASSERT_EQ(expected[i].offset, matches[i].offset);
+        }
+    }
+}
+
+TEST(AddressScannerTest, Scan_NoAddresses_NothingFound)
+{
+    const std::string cText(1000, 'a');
+    std::vector<AddressScanner::Match> matches;
+    ASSERT_EQ(0u, AddressScanner::Scan(cText.data(), cText.size(), matches));
+    ASSERT_EQ(0u, AddressScanner::Scan(nullptr, 0, matches));
+    ASSERT_EQ(0u, AddressScanner::Scan("1.2.3.4", 6, matches));
+    ASSERT_EQ(1u, AddressScanner::Scan("1.2.3.4", 7, matches));
+}
+
+TEST(AddressScannerTest, Scan_CharactersNextToCandidateRanges_OnlyAddressesFound)
+{
+    // Neighbours of '0'-':' and 'a'-'f' in both cases, and the same bytes with the high bit set.
+    const std::string cSeparators{"/;@G`g \xB0\xBA\xC1\xE6\xFF"};
+    std::string text;
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < 3 * cSeparators.size(); i++)
+    {
+        const char cSeparator = cSeparators[i % cSeparators.size()];
+        const char cNext = cSeparators[(i + 1) % cSeparators.size()];
+        const std::string cAddress = i % 2 ? "2001:db8::" + std::to_string(i) : "192.0.2." + std::to_string(i);
+        // Letters next to an address make it part of a word.
+        if (cSeparator != 'G' && cSeparator != 'g' && cNext != 'G' && cNext != 'g')
+        {
+            expected.push_back(cAddress);
+        }
+        text += std::string(1 + i % 5, cSeparator) + cAddress;
+    }
+    text += cSeparators[0];
+
+    std::vector<AddressScanner::Match> matches;
+    AddressScanner::Scan(text.data(), text.size(), matches);
+    ASSERT_EQ(expected, Texts(text, matches));
+}
+
+TEST(AddressReaderTest, Next_StreamWithComments_ReadsAllAddresses)
+{
+    // The smallest buffer splits addresses and comments across refills.
+    std::string text = "# block list\n10.0.0.1 10.0.0.2\t# trailing comment 1.1.1.1\n\n";
+    for (uint16_t i = 0; i < 200; i++)
+    {
+        text += "192.168." + std::to_string(i / 100) + "." + std::to_string(i % 100) + (i % 7 ? " " : "\r\n");
+    }
+    for (const size_t cBufferSize : {AddressReader::MIN_BUFFER_SIZE, AddressReader::DEFAULT_BUFFER_SIZE})
+    {
+        std::istringstream stream(text);
+        AddressReader reader(stream, cBufferSize);
+        IPv4Address address;
+        ASSERT_TRUE(reader.Next(address));
+        ASSERT_EQ(IPv4Address(10, 0, 0, 1), address);
+        ASSERT_EQ(2u, reader.Line());
+        ASSERT_TRUE(reader.Next(address));
+        ASSERT_EQ(IPv4Address(10, 0, 0, 2), address);
+        for (uint16_t i = 0; i < 200; i++)
+        {
+            ASSERT_TRUE(reader.Next(address)) << i;
+            ASSERT_EQ(IPv4Address(192, 168, static_cast<uint8_t>(i / 100), static_cast<uint8_t>(i % 100)), address) << i;
+        }
+        ASSERT_FALSE(reader.Next(address));
+        ASSERT_FALSE(reader.Next(address));
+    }
+    ASSERT_THROW(AddressReader(std::cin, 16), std::invalid_argument);
+}
+
+TEST(AddressReaderTest, Next_InvalidToken_ThrowsWithLineAndContinues)
+{
+    std::istringstream stream("2001:db8::1\n::1 bogus\n" + std::string(100, 'f') + " fe80::1");
+    AddressReader reader(stream, AddressReader::MIN_BUFFER_SIZE);
+    IPv6Address address;
+    ASSERT_TRUE(reader.Next(address));
+    ASSERT_TRUE(reader.Next(address));
+    ASSERT_EQ(IPv6Address("::1"), address);
+    try
+    {
+        reader.Next(address);
+        FAIL();
+    }
+    catch (const std::runtime_error &cError)
+    {
+        ASSERT_NE(std::string(cError.what()).find("line 2"), std::string::npos) << cError.what();
+    }
+    ASSERT_THROW(reader.Next(address), std::runtime_error);
+    ASSERT_EQ(3u, reader.Line());
+    ASSERT_TRUE(reader.Next(address));
+    ASSERT_EQ(IPv6Address("fe80::1"), address);
+    ASSERT_FALSE(reader.Next(address));
+}
+
+TEST(AddressReaderTest, Next_File_ReadsAllAddresses)
+{
+    std::FILE *file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    std::fputs("1.2.3.4\n# comment\n5.6.7.8", file);
+    std::rewind(file);
+    {
+        AddressReader reader(file);
+        IPv4Address address;
+        ASSERT_TRUE(reader.Next(address));
+        ASSERT_EQ(IPv4Address(1, 2, 3, 4), address);
+        ASSERT_TRUE(reader.Next(address));
+        ASSERT_EQ(IPv4Address(5, 6, 7, 8), address);
+        ASSERT_EQ(3u, reader.Line());
+        ASSERT_FALSE(reader.Next(address));
+    }
+    std::fclose(file);
+    ASSERT_THROW(AddressReader(static_cast<std::FILE *>(nullptr)), std::invalid_argument);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,387 @@
+/**
+ * @file AnonymizationTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for Aes128 and CryptoPAn classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "Anonymization/Aes128.hpp"
+#include "Anonymization/CryptoPAn.hpp"
+#include "Anonymization/Pseudonymizer.hpp"
+#include "Anonymization/SipHash.hpp"
+#include "CpuDispatch/CpuFeatures.hpp"
+#include "gtest/gtest.h"
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    // Key of the reference implementation's sample program.
+    const std::vector<uint8_t> cReferenceKey{21, 34, 23, 141, 51, 164, 207, 128, 19, 10, 91, 22, 73, 144, 125, 16,
+                                             216, 152, 143, 131, 121, 121, 101, 39, 98, 87, 76, 45, 42, 132, 34, 2};
+
+    // Pairs from the reference implementation's sample trace.
+    const std::vector<std::pair<const char *, const char *>> cReferencePairs{
+        {"128.11.68.132", "135.242.180.132"},
+        {"129.118.74.4", "134.136.186.123"},
+        {"130.132.252.244", "133.68.164.234"},
+        {"141.223.7.43", "141.167.8.160"},
+        {"141.233.145.108", "141.129.237.235"},
+        {"152.163.225.39", "151.140.114.167"},
+        {"156.29.3.236", "147.225.12.42"},
+        {"165.247.96.84", "162.9.99.234"},
+        {"166.107.77.190", "160.132.178.185"},
+        {"192.102.249.13", "252.138.62.131"}};
+
+    size_t CommonPrefix(const uint64_t &cA, const uint64_t &cB, const size_t &cBits)
+    {
+        size_t length = 0;
+        while (length < cBits && ((cA >> (cBits - 1 - length)) & 1) == ((cB >> (cBits - 1 - length)) & 1))
+        {
+            length++;
+        }
+        return length;
+    }
+}
+
+TEST(Aes128Test, EncryptBlock_Fips197Vector_MatchesCiphertext)
+{
+    uint8_t key[16];
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        key[i] = i;
+    }
+    const uint8_t cPlaintext[16]{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    const uint8_t cExpected[16]{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a};
+
+    for (const bool cUseHardware : {false, true})
+    {
+        uint8_t ciphertext[16];
+        Aes128(key, cUseHardware).EncryptBlock(cPlaintext, ciphertext);
+        EXPECT_EQ(std::vector<uint8_t>(ciphertext, ciphertext + 16), std::vector<uint8_t>(cExpected, cExpected + 16));
+    }
+}
+
+TEST(Aes128Test, EncryptBlocks_HardwareAndPortable_SameOutput)
+{
+    std::mt19937 generator{7};
+    uint8_t key[16];
+    for (uint8_t &byte : key)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    // 21 blocks exercise both the 8-way loop and the tail.
+    std::vector<uint8_t> input(21 * Aes128::BLOCK_SIZE);
+    for (uint8_t &byte : input)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    std::vector<uint8_t> portable(input.size());
+    std::vector<uint8_t> hardware(input.size());
+    Aes128(key, false).EncryptBlocks(input.data(), portable.data(), 21);
+    Aes128(key, true).EncryptBlocks(input.data(), hardware.data(), 21);
+    EXPECT_EQ(portable, hardware);
+}
+
+TEST(Aes128Test, HasHardwareSupport_TierBelowSse42_PortableOnly)
+{
+    uint8_t key[16]{};
+    if (CpuFeatures::Selected() < CpuFeatures::Tier::SSE4_2)
+    {
+        EXPECT_FALSE(Aes128::HasHardwareSupport());
+    }
+    EXPECT_EQ(Aes128::HasHardwareSupport(), Aes128(key, true).UsesHardware());
+}
+
+TEST(Aes128Test, Constructor_NullKey_ThrowsInvalidArgument)
+{
+    EXPECT_THROW(Aes128(nullptr), std::invalid_argument);
+}
+
+TEST(CryptoPAnTest, Anonymize_ReferenceTrace_MatchesReferenceOutput)
+{
+    for (const bool cUseHardware : {false, true})
+    {
+        CryptoPAn anonymizer(cReferenceKey, cUseHardware);
+        for (const auto &cPair : cReferencePairs)
+        {
+            EXPECT_EQ(anonymizer.Anonymize(IPv4Address(cPair.first)), IPv4Address(cPair.second)) << cPair.first;
+        }
+    }
+}
+
+TEST(CryptoPAnTest, Anonymize_RandomIPv4Pairs_PreservesCommonPrefixLength)
+{
+    CryptoPAn anonymizer(cReferenceKey);
+    std::mt19937 generator{1};
+
+    for (size_t i = 0; i < 2000; i++)
+    {
+        const uint32_t cA = generator();
+        // Flip one bit so every prefix length occurs.
+        const uint32_t cB = cA ^ (uint32_t{1} << (i % 32)) ^ (generator() & ((uint32_t{1} << (i % 32)) - 1));
+        const uint32_t cAnonymizedA = anonymizer.Anonymize(IPv4Address::FromUint32(cA)).ToUint32();
+        const uint32_t cAnonymizedB = anonymizer.Anonymize(IPv4Address::FromUint32(cB)).ToUint32();
+        EXPECT_EQ(CommonPrefix(cA, cB, 32), CommonPrefix(cAnonymizedA, cAnonymizedB, 32));
+    }
+}
+
+TEST(CryptoPAnTest, Anonymize_RandomIPv6Pairs_PreservesCommonPrefixLength)
+{
+    CryptoPAn anonymizer(cReferenceKey);
+    std::mt19937_64 generator{2};
+
+    for (size_t i = 0; i < 512; i++)
+    {
+        const IPv6Address cA = IPv6Address::FromUint64(generator(), generator());
+        const size_t cBit = i % 128;
+        uint64_t upper = cA.GetUpper64();
+        uint64_t lower = cA.GetLower64();
+        if (cBit < 64)
+        {
+            upper ^= uint64_t{1} << (63 - cBit);
+            lower = generator();
+        }
+        else
+        {
+            lower ^= uint64_t{1} << (127 - cBit);
+        }
+
+        const IPv6Address cAnonymizedA = anonymizer.Anonymize(cA);
+        const IPv6Address cAnonymizedB = anonymizer.Anonymize(IPv6Address::FromUint64(upper, lower));
+        if (cBit < 64)
+        {
+            EXPECT_EQ(CommonPrefix(cAnonymizedA.GetUpper64(), cAnonymizedB.GetUpper64(), 64), cBit);
+        }
+        else
+        {
+            EXPECT_EQ(cAnonymizedA.GetUpper64(), cAnonymizedB.GetUpper64());
+            EXPECT_EQ(CommonPrefix(cAnonymizedA.GetLower64(), cAnonymizedB.GetLower64(), 64), cBit - 64);
+        }
+    }
+}
+
+TEST(CryptoPAnTest, Anonymize_IPv6_HardwareAndPortable_SameResult)
+{
+    CryptoPAn hardware(cReferenceKey, true);
+    CryptoPAn portable(cReferenceKey, false);
+
+    const IPv6Address cAddress("2001:db8:85a3::8a2e:370:7334");
+    EXPECT_EQ(hardware.Anonymize(cAddress), portable.Anonymize(cAddress));
+    EXPECT_NE(hardware.Anonymize(cAddress), cAddress);
+}
+
+TEST(CryptoPAnTest, AnonymizeBatch_IPv4_MatchesSingleCalls)
+{
+    CryptoPAn batchAnonymizer(cReferenceKey);
+    CryptoPAn singleAnonymizer(cReferenceKey);
+    std::mt19937 generator{3};
+
+    // 100 addresses span several internal batches, clustered in a few /16 networks.
+    std::vector<IPv4Address> addresses;
+    for (size_t i = 0; i < 100; i++)
+    {
+        addresses.push_back(IPv4Address::FromUint32((0x0A000000u + (i % 3) * 0x10000u) | (generator() & 0xFFFF)));
+    }
+
+    std::vector<IPv4Address> anonymized(addresses.size());
+    batchAnonymizer.AnonymizeBatch(addresses.data(), anonymized.data(), addresses.size());
+    for (size_t i = 0; i < addresses.size(); i++)
+    {
+        EXPECT_EQ(anonymized[i], singleAnonymizer.Anonymize(addresses[i]));
+    }
+
+    // In place.
+    batchAnonymizer.AnonymizeBatch(addresses.data(), addresses.data(), addresses.size());
+    EXPECT_EQ(addresses, anonymized);
+}
+
+TEST(CryptoPAnTest, AnonymizeBatch_IPv6_MatchesSingleCalls)
+{
+    CryptoPAn batchAnonymizer(cReferenceKey);
+    CryptoPAn singleAnonymizer(cReferenceKey);
+
+    const std::vector<IPv6Address> cAddresses{IPv6Address("2001:db8::1"), IPv6Address("2001:db8::2"), IPv6Address("fe80::1"), IPv6Address("::")};
+    std::vector<IPv6Address> anonymized(cAddresses.size());
+    batchAnonymizer.AnonymizeBatch(cAddresses.data(), anonymized.data(), cAddresses.size());
+    for (size_t i = 0; i < cAddresses.size(); i++)
+    {
+        EXPECT_EQ(anonymized[i], singleAnonymizer.Anonymize(cAddresses[i]));
+    }
+}
+
+TEST(CryptoPAnTest, Constructor_InvalidKey_ThrowsInvalidArgument)
+{
+    EXPECT_THROW(CryptoPAn(nullptr), std::invalid_argument);
+    EXPECT_THROW(CryptoPAn(std::vector<uint8_t>(16)), std::invalid_argument);
+}
+
+TEST(SipHashTest, Hash64_ReferenceVectors_MatchExpected)
+{
+    uint8_t key[16];
+    uint8_t message[15];
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        key[i] = i;
+        if (i < 15)
+        {
+            message[i] = i;
+        }
+    }
+
+    const SipHash cHash(key);
+    EXPECT_EQ(cHash.Hash64(message, 0), 0x726FDB47DD0E0E31ull);
+    EXPECT_EQ(cHash.Hash64(message, 15), 0xA129CA6149BE45E5ull);
+}
+
+TEST(SipHashTest, Hash64_AddressFastPath_MatchesByteString)
+{
+    uint8_t key[16]{9, 8, 7, 6, 5, 4, 3, 2, 1};
+    const SipHash cHash(key);
+
+    const IPv4Address cAddress("192.0.2.77");
+    uint8_t bytes[4];
+    cAddress.ToBinary(bytes);
+    EXPECT_EQ(cHash.Hash64(cAddress.ToUint32()), cHash.Hash64(bytes, 4));
+}
+
+TEST(SipHashTest, Constructor_NullKey_ThrowsInvalidArgument)
+{
+    EXPECT_THROW(SipHash(nullptr), std::invalid_argument);
+}
+
+TEST(PseudonymizerTest, Truncation_DefaultLengths_ClearsHostBits)
+{
+    const TruncatingPseudonymizer cPseudonymizer{TruncationPolicy()};
+
+    EXPECT_EQ(cPseudonymizer.Apply(IPv4Address("192.0.2.77")), IPv4Address("192.0.2.0"));
+    EXPECT_EQ(cPseudonymizer.Apply(IPv6Address("2001:db8:1:2::5")), IPv6Address("2001:db8:1::"));
+}
+
+TEST(PseudonymizerTest, Truncation_CustomLengths_ClearsHostBits)
+{
+    const TruncatingPseudonymizer cPseudonymizer{TruncationPolicy(20, 100)};
+
+    EXPECT_EQ(cPseudonymizer.Apply(IPv4Address("10.20.30.40")), IPv4Address("10.20.16.0"));
+    EXPECT_EQ(cPseudonymizer.Apply(IPv6Address("2001:db8::ffff:ffff:ffff")), IPv6Address("2001:db8::ffff:f000:0"));
+    EXPECT_EQ(TruncatingPseudonymizer{TruncationPolicy(0, 0)}.Apply(IPv4Address("10.20.30.40")), IPv4Address("0.0.0.0"));
+    EXPECT_EQ(TruncatingPseudonymizer{TruncationPolicy(32, 128)}.Apply(IPv4Address("10.20.30.40")), IPv4Address("10.20.30.40"));
+}
+
+TEST(PseudonymizerTest, Truncation_IPv6Batch_MatchesIntegerMasks)
+{
+    for (const uint8_t cLength : {0, 1, 16, 48, 63, 64, 65, 100, 127, 128})
+    {
+        const TruncationPolicy cPolicy(24, cLength);
+        std::vector<IPv6Address> addresses;
+        for (uint64_t i = 0; i < 300; i++)
+        {
+            addresses.push_back(IPv6Address::FromUint64(0x20010DB800000000ull ^ (i * 0x9E3779B97F4A7C15ull), ~i * 0xC2B2AE3D27D4EB4Full));
+        }
+
+        std::vector<IPv6Address> truncated(addresses.size());
+        TruncatingPseudonymizer{cPolicy}.ApplyBatch(addresses.data(), truncated.data(), addresses.size());
+        for (size_t i = 0; i < addresses.size(); i++)
+        {
+            uint64_t upper = addresses[i].GetUpper64();
+            uint64_t lower = addresses[i].GetLower64();
+            cPolicy.Map(&upper, &lower, 1);
+            EXPECT_EQ(IPv6Address::FromUint64(upper, lower), truncated[i]);
+        }
+    }
+}
+
+TEST(PseudonymizerTest, Truncation_InvalidLength_ThrowsOutOfRange)
+{
+    EXPECT_THROW(TruncationPolicy(33, 48), std::out_of_range);
+    EXPECT_THROW(TruncationPolicy(24, 129), std::out_of_range);
+}
+
+TEST(PseudonymizerTest, KeyedMapping_DefaultTargets_MapsIntoReservedRanges)
+{
+    const uint8_t cKey[16]{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const KeyedPseudonymizer cPseudonymizer{KeyedMappingPolicy(cKey)};
+
+    for (uint32_t value = 0; value < 1000; value++)
+    {
+        const IPv4Address cAddress = IPv4Address::FromUint32(0x0A000000u + value * 7919u);
+        const IPv4Address cMapped = cPseudonymizer.Apply(cAddress);
+        EXPECT_TRUE(KeyedMappingPolicy::DEFAULT_IPV4_TARGET.Contains(cMapped));
+        EXPECT_EQ(cMapped, cPseudonymizer.Apply(cAddress));
+    }
+
+    const IPv6Address cMapped = cPseudonymizer.Apply(IPv6Address("fe80::1"));
+    EXPECT_TRUE(KeyedMappingPolicy::DEFAULT_IPV6_TARGET.Contains(cMapped));
+    EXPECT_NE(cMapped, cPseudonymizer.Apply(IPv6Address("fe80::2")));
+}
+
+TEST(PseudonymizerTest, KeyedMapping_DifferentKeys_DifferentMappings)
+{
+    const uint8_t cKey1[16]{1};
+    const uint8_t cKey2[16]{2};
+    const IPv4Address cAddress("198.51.100.23");
+
+    EXPECT_NE(KeyedPseudonymizer{KeyedMappingPolicy(cKey1)}.Apply(cAddress), KeyedPseudonymizer{KeyedMappingPolicy(cKey2)}.Apply(cAddress));
+}
+
+TEST(PseudonymizerTest, KeyedMapping_CustomTargets_MapsIntoTargets)
+{
+    const uint8_t cKey[16]{7};
+    const IPv4Prefix cIPv4Target("100.64.0.0/10");
+    const IPv6Prefix cIPv6Target(IPv6Address("fd00:1234::"), 96);
+    const KeyedPseudonymizer cPseudonymizer{KeyedMappingPolicy(cKey, cIPv4Target, cIPv6Target)};
+
+    EXPECT_TRUE(cIPv4Target.Contains(cPseudonymizer.Apply(IPv4Address("8.8.8.8"))));
+    EXPECT_TRUE(cIPv6Target.Contains(cPseudonymizer.Apply(IPv6Address("2001:4860:4860::8888"))));
+}
+
+TEST(PseudonymizerTest, ApplyBatch_MoreThanOneChunk_MatchesSingleCalls)
+{
+    const uint8_t cKey[16]{3};
+    const KeyedPseudonymizer cPseudonymizer{KeyedMappingPolicy(cKey)};
+    std::mt19937_64 generator{5};
+
+    std::vector<IPv4Address> ipv4(1000);
+    std::vector<IPv6Address> ipv6(300);
+    for (IPv4Address &address : ipv4)
+    {
+        address = IPv4Address::FromUint32(static_cast<uint32_t>(generator()));
+    }
+    for (IPv6Address &address : ipv6)
+    {
+        address = IPv6Address::FromUint64(generator(), generator());
+    }
+
+    std::vector<IPv4Address> ipv4Mapped(ipv4.size());
+    std::vector<IPv6Address> ipv6Mapped(ipv6.size());
+    cPseudonymizer.ApplyBatch(ipv4.data(), ipv4Mapped.data(), ipv4.size());
+    cPseudonymizer.ApplyBatch(ipv6.data(), ipv6Mapped.data(), ipv6.size());
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        EXPECT_EQ(ipv4Mapped[i], cPseudonymizer.Apply(ipv4[i]));
+    }
+    for (size_t i = 0; i < ipv6.size(); i++)
+    {
+        EXPECT_EQ(ipv6Mapped[i], cPseudonymizer.Apply(ipv6[i]));
+    }
+
+    // In place.
+    cPseudonymizer.ApplyBatch(ipv4.data(), ipv4.data(), ipv4.size());
+    EXPECT_EQ(ipv4, ipv4Mapped);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,388 @@
+/**
+ * @file ColumnExportTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for AddressTextWriter, ArrowExporter and ParquetWriter classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ColumnExport/AddressTextWriter.hpp"
+#include "ColumnExport/ArrowExporter.hpp"
+#include "ColumnExport/ParquetWriter.hpp"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Minimal Thrift compact protocol reader, enough to walk a Parquet footer.
+     */
+    class CompactReader
+    {
+    public:
+        CompactReader(const std::string &cData, const size_t &cPosition) : _data{cData}, _position{cPosition} {}
+
+        /**
+         * @brief Reads a structure and returns its integer fields; nested values are skipped.
+         */
+        std::map<int16_t, int64_t> ReadStruct()
+        {
+            std::map<int16_t, int64_t> fields;
+            int16_t lastField{};
+            for (uint8_t header = Byte(); header; header = Byte())
+            {
+                const uint8_t cType = header & 0x0F;
+                lastField = header >> 4 ? static_cast<int16_t>(lastField + (header >> 4)) : static_cast<int16_t>(ZigZag());
+                if (cType == 5 || cType == 6)
+                {
+                    fields[lastField] = ZigZag();
+                }
+                else
+                {
+                    Skip(cType);
+                }
+            }
+            return fields;
+        }
+
+        size_t Position() const { return _position; }
+
+    private:
+        const std::string &_data;
+        size_t _position;
+
+        uint8_t Byte() { return static_cast<uint8_t>(_data.at(_position++)); }
+
+        uint64_t Varint()
+        {
+            uint64_t value{};
+            for (uint8_t shift = 0;; shift += 7)
+            {
+                const uint8_t cByte = Byte();
+                value |= static_cast<uint64_t>(cByte & 0x7F) << shift;
+                if (cByte < 0x80)
+                {
+                    return value;
+                }
+            }
+        }
+
+        int64_t ZigZag()
+        {
+            const uint64_t cValue = Varint();
+            return static_cast<int64_t>(cValue >> 1) ^ -static_cast<int64_t>(cValue & 1);
+        }
+
+        void Skip(const uint8_t &cType)
+        {
+            switch (cType)
+            {
+            case 1:
+            case 2:
+                break;
+            case 3:
+                Byte();
+                break;
+            case 4:
+            case 5:
+            case 6:
+                Varint();
+                break;
+            case 8:
+                _position += Varint();
+                break;
+            case 9:
+            {
+                const uint8_t cHeader = Byte();
+                const uint64_t cSize = cHeader >> 4 == 15 ? Varint() : cHeader >> 4;
+                for (uint64_t i = 0; i < cSize; i++)
+                {
+                    Skip(cHeader & 0x0F);
+                }
+                break;
+            }
+            case 12:
+                ReadStruct();
+                break;
+            default:
+                throw std::runtime_error("unexpected Thrift type");
+            }
+        }
+    };
+
+    /**
+     * @brief Checks the file framing and returns the integer fields of FileMetaData.
+     */
+    std::map<int16_t, int64_t> ReadFooter(const std::string &cFile)
+    {
+        EXPECT_EQ(cFile.substr(0, 4), "PAR1");
+        EXPECT_EQ(cFile.substr(cFile.size() - 4), "PAR1");
+        uint32_t footerSize{};
+        std::memcpy(&footerSize, cFile.data() + cFile.size() - 8, sizeof(footerSize));
+
+        CompactReader reader(cFile, cFile.size() - 8 - footerSize);
+        const std::map<int16_t, int64_t> cFields = reader.ReadStruct();
+        EXPECT_EQ(reader.Position(), cFile.size() - 8);
+        return cFields;
+    }
+
+    std::string WriteFile(const IPv4AddressColumn &cColumn, const uint8_t *cValidity, const ParquetWriter::Encoding &cEncoding)
+    {
+        std::ostringstream stream;
+        ParquetWriter writer(stream);
+        writer.WriteColumn("source", cColumn, cValidity, cEncoding);
+        writer.Close();
+        return stream.str();
+    }
+}
+
+TEST(ArrowExporterTest, ExportIPv4Addresses_WithValidity_SharesMemory)
+{
+    const std::vector<IPv4Address> cAddresses{IPv4Address("10.0.0.1"), IPv4Address("192.168.1.1"), IPv4Address("8.8.8.8")};
+    const uint8_t cValidity[]{0b101};
+    ArrowArray array{};
+    ArrowSchema schema{};
+
+    ArrowExporter::Export(cAddresses.data(), cAddresses.size(), cValidity, "source", &array, &schema);
+    EXPECT_STREQ(schema.format, "w:4");
+    EXPECT_STREQ(schema.name, "source");
+    EXPECT_EQ(schema.flags, ARROW_FLAG_NULLABLE);
+    EXPECT_EQ(array.length, 3);
+    EXPECT_EQ(array.null_count, 1);
+    ASSERT_EQ(array.n_buffers, 2);
+    EXPECT_EQ(array.buffers[0], cValidity);
+    EXPECT_EQ(array.buffers[1], static_cast<const void *>(cAddresses.data()));
+    EXPECT_EQ(std::memcmp(static_cast<const uint8_t *>(array.buffers[1]) + 4, "\xC0\xA8\x01\x01", 4), 0);
+
+    array.release(&array);
+    schema.release(&schema);
+    EXPECT_EQ(array.release, nullptr);
+    EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST(ArrowExporterTest, ExportIPv6Addresses_CopiesNetworkOrderBytes)
+{
+    const std::vector<IPv6Address> cAddresses{IPv6Address("2001:db8::1"), IPv6Address("fe80::abcd")};
+    uint8_t validity[]{0b10};
+    ArrowArray array{};
+    ArrowSchema schema{};
+
+    ArrowExporter::Export(cAddresses.data(), cAddresses.size(), validity, "destination", &array, &schema);
+    validity[0] = 0xFF;
+    EXPECT_STREQ(schema.format, "w:16");
+    EXPECT_EQ(array.null_count, 1);
+    EXPECT_EQ(*static_cast<const uint8_t *>(array.buffers[0]), 0b10);
+    const uint8_t *const cBytes = static_cast<const uint8_t *>(array.buffers[1]);
+    EXPECT_EQ(std::memcmp(cBytes, "\x20\x01\x0D\xB8\0\0\0\0\0\0\0\0\0\0\0\x01", 16), 0);
+    EXPECT_EQ(std::memcmp(cBytes + 16, "\xFE\x80\0\0\0\0\0\0\0\0\0\0\0\0\xAB\xCD", 16), 0);
+
+    array.release(&array);
+    schema.release(&schema);
+}
+
+TEST(ArrowExporterTest, ExportColumns_NoValidity_NotNullable)
+{
+    const IPv4AddressColumn cIpv4({IPv4Address("1.2.3.4")});
+    const IPv6AddressColumn cIpv6({IPv6Address("::1")});
+    ArrowArray array{};
+    ArrowSchema schema{};
+
+    ArrowExporter::Export(cIpv4, nullptr, "a", &array, &schema);
+    EXPECT_EQ(schema.flags, 0);
+    EXPECT_EQ(array.null_count, 0);
+    EXPECT_EQ(array.buffers[0], nullptr);
+    EXPECT_EQ(std::memcmp(array.buffers[1], "\x01\x02\x03\x04", 4), 0);
+    array.release(&array);
+    schema.release(&schema);
+
+    ArrowExporter::Export(cIpv6, nullptr, "b", &array, &schema);
+    EXPECT_EQ(static_cast<const uint8_t *>(array.buffers[1])[15], 1);
+    array.release(&array);
+    schema.release(&schema);
+
+    EXPECT_THROW(ArrowExporter::Export(cIpv4, nullptr, "a", nullptr, &schema), std::invalid_argument);
+    EXPECT_THROW(ArrowExporter::Export(static_cast<const IPv4Address *>(nullptr), 1, nullptr, "a", &array, &schema), std::invalid_argument);
+}
+
+TEST(ArrowExporterTest, CountNulls_LongBitmap_CountsClearedBits)
+{
+    std::vector<uint8_t> validity(20, 0xFF);
+    validity[0] = 0xFE;
+    validity[9] = 0x7F;
+    validity[19] = 0x0F;
+
+    EXPECT_EQ(ArrowExporter::CountNulls(validity.data(), 156), 2u);
+    EXPECT_EQ(ArrowExporter::CountNulls(validity.data(), 160), 6u);
+    EXPECT_EQ(ArrowExporter::CountNulls(nullptr, 160), 0u);
+}
+
+TEST(ParquetWriterTest, WriteColumns_AllEncodings_ProducesWellFormedFile)
+{
+    std::vector<IPv4Address> ipv4;
+    std::vector<IPv6Address> ipv6;
+    // More rows than one page, so the page split is exercised.
+    const size_t cRows = ParquetWriter::PAGE_ROWS + 100;
+    const std::vector<uint8_t> cValidity((cRows + 7) / 8, 0xEF);
+    for (size_t i = 0; i < cRows; i++)
+    {
+        ipv4.push_back(IPv4Address::FromUint32(static_cast<uint32_t>(0x0A000000u + i)));
+        ipv6.push_back(IPv6Address::FromUint64(0x20010DB800000000ull, i % 17));
+    }
+
+    std::ostringstream stream;
+    ParquetWriter writer(stream);
+    writer.WriteColumn("plain", IPv4AddressColumn(ipv4), nullptr, ParquetWriter::Encoding::Plain);
+    writer.WriteColumn("dictionary", IPv6AddressColumn(ipv6), cValidity.data(), ParquetWriter::Encoding::Dictionary);
+    writer.WriteColumn("delta", IPv4AddressColumn(ipv4), cValidity.data(), ParquetWriter::Encoding::Delta);
+    writer.Close();
+    writer.Close();
+
+    const std::map<int16_t, int64_t> cFooter = ReadFooter(stream.str());
+    EXPECT_EQ(cFooter.at(1), 1);
+    EXPECT_EQ(cFooter.at(3), static_cast<int64_t>(cRows));
+}
+
+TEST(ParquetWriterTest, WriteColumn_EmptyColumn_ProducesWellFormedFile)
+{
+    for (const ParquetWriter::Encoding &cEncoding : {ParquetWriter::Encoding::Plain, ParquetWriter::Encoding::Dictionary, ParquetWriter::Encoding::Delta})
+    {
+        EXPECT_EQ(ReadFooter(WriteFile(IPv4AddressColumn(), nullptr, cEncoding)).at(3), 0);
+    }
+}
+
+TEST(ParquetWriterTest, WriteColumn_RepetitiveOrSortedData_EncodingsShrinkFile)
+{
+    std::vector<IPv4Address> repetitive;
+    std::vector<IPv4Address> sorted;
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        repetitive.push_back(IPv4Address::FromUint32(0xC0A80000u + (i * 7919) % 50));
+        sorted.push_back(IPv4Address::FromUint32(0xC0A80000u + 3 * i));
+    }
+
+    const size_t cPlainSize = WriteFile(IPv4AddressColumn(repetitive), nullptr, ParquetWriter::Encoding::Plain).size();
+    EXPECT_LT(WriteFile(IPv4AddressColumn(repetitive), nullptr, ParquetWriter::Encoding::Dictionary).size(), cPlainSize / 4);
+    EXPECT_LT(WriteFile(IPv4AddressColumn(sorted), nullptr, ParquetWriter::Encoding::Delta).size(), cPlainSize / 2);
+}
+
+TEST(ParquetWriterTest, WriteColumn_InvalidUse_Throws)
+{
+    std::ostringstream stream;
+    ParquetWriter writer(stream);
+    writer.WriteColumn("first", IPv4AddressColumn({IPv4Address("1.1.1.1")}), nullptr);
+
+    EXPECT_THROW(writer.WriteColumn("second", IPv4AddressColumn(), nullptr), std::invalid_argument);
+    EXPECT_THROW(writer.WriteColumn("", IPv4AddressColumn({IPv4Address("1.1.1.1")}), nullptr), std::invalid_argument);
+    writer.Close();
+    EXPECT_THROW(writer.WriteColumn("third", IPv6AddressColumn({IPv6Address("::1")}), nullptr), std::invalid_argument);
+}
+
+TEST(AddressTextWriterTest, Write_IPv4Addresses_MatchesToString)
+{
+    // Every octet length in every position, so each digit shuffle is used.
+    const uint8_t cOctets[]{0, 7, 9, 10, 42, 99, 100, 199, 255};
+    std::vector<IPv4Address> addresses;
+    for (const uint8_t &cA : cOctets)
+    {
+        for (const uint8_t &cB : cOctets)
+        {
+            for (const uint8_t &cC : cOctets)
+            {
+                for (const uint8_t &cD : cOctets)
+                {
+                    addresses.emplace_back(cA, cB, cC, cD);
+                }
+            }
+        }
+    }
+    std::string lines;
+    std::string comma;
+    for (const IPv4Address &cAddress : addresses)
+    {
+        lines += cAddress.ToString() + "\n";
+        comma += (comma.empty() ? "" : ",") + cAddress.ToString();
+    }
+
+    AddressTextWriter writer;
+    writer.Write(addresses.data(), addresses.size());
+    EXPECT_EQ(std::string(writer.Data(), writer.Size()), lines);
+
+    // Several calls continue one text.
+    AddressTextWriter commaWriter(AddressTextWriter::Format::Comma);
+    commaWriter.Write(addresses.data(), 1);
+    commaWriter.Write(addresses.data() + 1, 0);
+    commaWriter.Write(addresses.data() + 1, addresses.size() - 1);
+    commaWriter.Close();
+    EXPECT_EQ(std::string(commaWriter.Data(), commaWriter.Size()), comma);
+}
+
+TEST(AddressTextWriterTest, Write_IPv6Addresses_MatchesToString)
+{
+    std::mt19937_64 random(3);
+    std::vector<IPv6Address> addresses{IPv6Address("::"), IPv6Address("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff")};
+    for (size_t i = 0; i < 100; i++)
+    {
+        addresses.push_back(IPv6Address::FromUint64(random(), random()));
+    }
+    std::string json = "[";
+    for (const IPv6Address &cAddress : addresses)
+    {
+        json += (json.size() > 1 ? ",\"" : "\"") + cAddress.ToString() + "\"";
+    }
+    json += "]";
+
+    AddressTextWriter writer(AddressTextWriter::Format::Json);
+    writer.Write(addresses.data(), addresses.size());
+    writer.Close();
+    EXPECT_EQ(std::string(writer.Data(), writer.Size()), json);
+    EXPECT_THROW(writer.Write(addresses.data(), 1), std::invalid_argument);
+    writer.Clear();
+    writer.Close();
+    EXPECT_EQ(std::string(writer.Data(), writer.Size()), "[]");
+}
+
+TEST(AddressTextWriterTest, Write_Stream_WritesChunks)
+{
+    std::vector<IPv4Address> addresses;
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        addresses.push_back(IPv4Address::FromUint32(i * 2654435761u));
+    }
+    std::string expected = "[";
+    for (const IPv4Address &cAddress : addresses)
+    {
+        expected += (expected.size() > 1 ? ",\"" : "\"") + cAddress.ToString() + "\"";
+    }
+    expected += "]";
+
+    std::ostringstream stream;
+    AddressTextWriter writer(stream, AddressTextWriter::Format::Json, 256);
+    writer.Write(addresses.data(), addresses.size());
+    // Only the text since the last full chunk stays buffered.
+    EXPECT_LT(writer.Size(), 256u + 18u);
+    EXPECT_FALSE(stream.str().empty());
+    writer.Close();
+    EXPECT_EQ(writer.Size(), 0u);
+    EXPECT_EQ(stream.str(), expected);
+
+    EXPECT_THROW(AddressTextWriter(stream, AddressTextWriter::Format::Lines, 0), std::invalid_argument);
+    AddressTextWriter other;
+    EXPECT_THROW(other.Write(static_cast<const IPv4Address *>(nullptr), 1), std::invalid_argument);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
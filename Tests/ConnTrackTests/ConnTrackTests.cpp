@@ -0,0 +1,279 @@
+/**
+ * @file ConnTrackTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for FlowKey and ConnTrackTable classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "ConnTrack/ConnTrackTable.hpp"
+#include "gtest/gtest.h"
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+using IPv4Table = ConnTrackTable<IPv4Address, uint32_t>;
+using IPv6Table = ConnTrackTable<IPv6Address, uint32_t>;
+
+TEST(FlowKeyTest, Constructor_PacksAllFields)
+{
+    const IPv4FlowKey cIPv4(IPv4Address("10.0.0.1"), IPv4Address("192.168.1.2"), 40000, 443, 6);
+    EXPECT_EQ(cIPv4.GetSource(), IPv4Address("10.0.0.1"));
+    EXPECT_EQ(cIPv4.GetDestination(), IPv4Address("192.168.1.2"));
+    EXPECT_EQ(cIPv4.GetSourcePort(), 40000);
+    EXPECT_EQ(cIPv4.GetDestinationPort(), 443);
+    EXPECT_EQ(cIPv4.GetProtocol(), 6);
+
+    const IPv6Address cSource = IPv6Address::FromUint64(0x20010DB800000001ull, 0x10);
+    const IPv6Address cDestination = IPv6Address::FromUint64(0x20010DB800000002ull, 0x20);
+    const IPv6FlowKey cIPv6(cSource, cDestination, 53, 5353, 17);
+    EXPECT_EQ(cIPv6.GetSource(), cSource);
+    EXPECT_EQ(cIPv6.GetDestination(), cDestination);
+    EXPECT_EQ(cIPv6.GetSourcePort(), 53);
+    EXPECT_EQ(cIPv6.GetDestinationPort(), 5353);
+    EXPECT_EQ(cIPv6.GetProtocol(), 17);
+
+    EXPECT_NE(cIPv4, IPv4FlowKey(IPv4Address("10.0.0.1"), IPv4Address("192.168.1.2"), 40000, 443, 17));
+    EXPECT_EQ(IPv4FlowKey(), IPv4FlowKey(IPv4Address("0.0.0.0"), IPv4Address("0.0.0.0"), 0, 0, 0));
+}
+
+TEST(FlowKeyTest, Normalized_SameForBothDirections)
+{
+    const IPv4FlowKey cForward(IPv4Address("192.168.1.2"), IPv4Address("10.0.0.1"), 443, 40000, 6);
+    const IPv4FlowKey cReply = cForward.Reversed();
+    EXPECT_EQ(cReply.GetSource(), IPv4Address("10.0.0.1"));
+    EXPECT_EQ(cReply.GetSourcePort(), 40000);
+    EXPECT_FALSE(cForward.IsNormalized());
+    EXPECT_TRUE(cReply.IsNormalized());
+    EXPECT_EQ(cForward.Normalized(), cReply.Normalized());
+    EXPECT_EQ(cForward.Normalized().Hash(), cReply.Normalized().Hash());
+    EXPECT_NE(cForward.Hash(), cReply.Hash());
+
+    // Equal addresses are ordered by port.
+    const IPv6Address cHost = IPv6Address::FromUint64(0x20010DB800000000ull, 1);
+    const IPv6FlowKey cLoop(cHost, cHost, 9000, 80, 6);
+    EXPECT_FALSE(cLoop.IsNormalized());
+    EXPECT_EQ(cLoop.Normalized().GetSourcePort(), 80);
+    EXPECT_EQ(cLoop.Reversed().Normalized(), cLoop.Normalized());
+
+    // IPv6 endpoints compare by the upper half first.
+    const IPv6FlowKey cSplit(IPv6Address::FromUint64(1, 0), IPv6Address::FromUint64(0, UINT64_MAX), 1, 1, 17);
+    EXPECT_FALSE(cSplit.IsNormalized());
+}
+
+TEST(ConnTrackTableTest, Insert_Lookup_BothDirections)
+{
+    EXPECT_THROW(IPv4Table(0), std::invalid_argument);
+
+    IPv4Table table(1000);
+    const IPv4FlowKey cOriginal(IPv4Address("192.168.1.2"), IPv4Address("10.0.0.1"), 443, 40000, 6);
+    uint32_t value{};
+    EXPECT_EQ(table.Lookup(cOriginal, value), IPv4Table::Match::NONE);
+
+    EXPECT_TRUE(table.Insert(cOriginal, 7, 100));
+    EXPECT_EQ(table.Size(), 1u);
+    EXPECT_EQ(table.Lookup(cOriginal, value), IPv4Table::Match::ORIGINAL);
+    EXPECT_EQ(value, 7u);
+    EXPECT_EQ(table.Lookup(cOriginal.Reversed(), value), IPv4Table::Match::REPLY);
+    EXPECT_EQ(table.ShardOf(cOriginal), table.ShardOf(cOriginal.Reversed()));
+
+    // Updating from the reply direction keeps the original direction.
+    EXPECT_TRUE(table.Insert(cOriginal.Reversed(), 8, 100));
+    EXPECT_EQ(table.Size(), 1u);
+    EXPECT_EQ(table.Lookup(cOriginal, value), IPv4Table::Match::ORIGINAL);
+    EXPECT_EQ(value, 8u);
+
+    EXPECT_EQ(table.Lookup(IPv4FlowKey(IPv4Address("192.168.1.2"), IPv4Address("10.0.0.1"), 443, 40001, 6), value), IPv4Table::Match::NONE);
+    EXPECT_TRUE(table.Remove(cOriginal.Reversed()));
+    EXPECT_FALSE(table.Remove(cOriginal));
+    EXPECT_EQ(table.Size(), 0u);
+}
+
+TEST(ConnTrackTableTest, Expire_AgesFlows_RefreshedFlowsSurvive)
+{
+    IPv4Table table(1000, 0, 2);
+    const IPv4FlowKey cIdle(IPv4Address("10.0.0.2"), IPv4Address("10.0.0.1"), 1000, 80, 6);
+    const IPv4FlowKey cBusy(IPv4Address("10.0.0.3"), IPv4Address("10.0.0.1"), 1000, 80, 6);
+    ASSERT_TRUE(table.Insert(cIdle, 1, 100));
+    ASSERT_TRUE(table.Insert(cBusy, 2, 100));
+
+    uint32_t value{};
+    EXPECT_EQ(table.Lookup(cBusy.Reversed(), value, 200), IPv4Table::Match::REPLY);
+
+    std::vector<IPv4Table::Flow> expired;
+    EXPECT_EQ(table.Expire(99, expired), 0u);
+    EXPECT_EQ(table.Expire(150, expired), 1u);
+    ASSERT_EQ(expired.size(), 1u);
+    // Expired flows come back in their original direction.
+    EXPECT_EQ(expired[0].key, cIdle);
+    EXPECT_FALSE(cIdle.IsNormalized());
+    EXPECT_EQ(expired[0].value, 1u);
+    EXPECT_EQ(expired[0].expiry, 100u);
+    EXPECT_EQ(table.Lookup(cIdle, value), IPv4Table::Match::NONE);
+    EXPECT_EQ(table.Lookup(cBusy, value), IPv4Table::Match::ORIGINAL);
+
+    // A shorter expiry set by an insert takes effect.
+    ASSERT_TRUE(table.Insert(cBusy, 2, 160));
+    EXPECT_EQ(table.Expire(160, expired), 1u);
+    EXPECT_EQ(table.Size(), 0u);
+
+    ASSERT_TRUE(table.Insert(cIdle, 3, 170));
+    EXPECT_TRUE(table.Remove(cIdle));
+    EXPECT_EQ(table.Expire(1000, expired), 0u);
+    EXPECT_EQ(expired.size(), 2u);
+}
+
+TEST(ConnTrackTableTest, Expire_FarExpiriesAndJumps_FireOnTime)
+{
+    // Expiries further than a turn of the wheel, and jumps of the clock longer than a turn.
+    IPv6Table table(1000, 0, 1);
+    const IPv6Address cServer = IPv6Address::FromUint64(0x20010DB800000000ull, 1);
+    const IPv6FlowKey cLong(IPv6Address::FromUint64(0x20010DB800000001ull, 1), cServer, 5000, 22, 6);
+    const IPv6FlowKey cShort(IPv6Address::FromUint64(0x20010DB800000001ull, 2), cServer, 5000, 53, 17);
+    const IPv6FlowKey cRefreshed(IPv6Address::FromUint64(0x20010DB800000001ull, 3), cServer, 5000, 80, 6);
+    ASSERT_TRUE(table.Insert(cLong, 1, 100000));
+    ASSERT_TRUE(table.Insert(cShort, 2, 50));
+    ASSERT_TRUE(table.Insert(cRefreshed, 3, 100));
+    uint32_t value{};
+    ASSERT_EQ(table.Lookup(cRefreshed, value, 60000), IPv6Table::Match::ORIGINAL);
+
+    std::vector<IPv6Table::Flow> expired;
+    EXPECT_EQ(table.Expire(49, expired), 0u);
+    EXPECT_EQ(table.Expire(50000, expired), 1u);
+    ASSERT_EQ(expired.size(), 1u);
+    EXPECT_EQ(expired[0].key, cShort);
+    EXPECT_EQ(table.Expire(59999, expired), 0u);
+    EXPECT_EQ(table.Expire(60000, expired), 1u);
+    EXPECT_EQ(expired.back().key, cRefreshed);
+    EXPECT_EQ(table.Expire(99999, expired), 0u);
+    EXPECT_EQ(table.Expire(1000000, expired), 1u);
+    EXPECT_EQ(expired.back().key, cLong);
+    EXPECT_EQ(table.Size(), 0u);
+
+    // Flows created after a jump age from the new time.
+    ASSERT_TRUE(table.Insert(cShort, 2, 1000010));
+    EXPECT_EQ(table.Expire(1000009, expired), 0u);
+    EXPECT_EQ(table.Expire(1000010, expired), 1u);
+}
+
+TEST(ConnTrackTableTest, Insert_ShardFull_DropsUntilFlowsLeave)
+{
+    IPv6Table table(1000, 0, 1);
+    ASSERT_EQ(table.Capacity(), 1000u);
+    const size_t cEmptyBytes = table.MemoryBytes();
+    EXPECT_GE(cEmptyBytes, 1000 * (sizeof(IPv6FlowKey) + 2 * sizeof(uint64_t)));
+
+    std::vector<IPv6FlowKey> keys;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        keys.emplace_back(IPv6Address::FromUint64(0x20010DB800000000ull, i), IPv6Address::FromUint64(0x20010DB8FFFF0000ull, 1), static_cast<uint16_t>(i), 443, 6);
+        ASSERT_TRUE(table.Insert(keys.back(), static_cast<uint32_t>(i), 100));
+    }
+    const IPv6FlowKey cExtra(IPv6Address::FromUint64(1, 1), IPv6Address::FromUint64(2, 2), 1, 2, 17);
+    EXPECT_FALSE(table.Insert(cExtra, 0, 100));
+
+    // Removing every other flow shifts index entries back; the rest must still be found.
+    for (size_t i = 0; i < keys.size(); i += 2)
+    {
+        ASSERT_TRUE(table.Remove(keys[i]));
+    }
+    uint32_t value{};
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(table.Lookup(keys[i], value) != IPv6Table::Match::NONE, i % 2 == 1) << i;
+    }
+    EXPECT_TRUE(table.Insert(cExtra, 0, 100));
+    EXPECT_EQ(table.Size(), 501u);
+    EXPECT_GT(table.MemoryBytes(), cEmptyBytes);
+}
+
+TEST(ConnTrackTableTest, Batch_MatchesSingleOperations)
+{
+    IPv4Table batched(1 << 14, 0, 4);
+    IPv4Table single(1 << 14, 0, 4);
+    std::mt19937 random(7);
+    std::vector<IPv4FlowKey> keys;
+    std::vector<uint32_t> values;
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        keys.emplace_back(IPv4Address::FromUint32(random()), IPv4Address::FromUint32(random()), static_cast<uint16_t>(random()), 80, 6);
+        values.push_back(i);
+    }
+    std::unique_ptr<bool[]> inserted(new bool[keys.size()]);
+    EXPECT_EQ(batched.InsertBatch(keys.data(), values.data(), keys.size(), 100, inserted.get()), keys.size());
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_TRUE(inserted[i]);
+        single.Insert(keys[i], values[i], 100);
+    }
+
+    // Look up reply directions for half of the flows, and some unknown flows.
+    std::vector<IPv4FlowKey> packets;
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        packets.push_back(i % 2 ? keys[i].Reversed() : keys[i]);
+        if (i % 10 == 0)
+        {
+            packets.emplace_back(IPv4Address::FromUint32(random()), IPv4Address::FromUint32(random()), 1, 2, 17);
+        }
+    }
+    std::vector<uint32_t> found(packets.size());
+    std::vector<IPv4Table::Match> matches(packets.size());
+    EXPECT_EQ(batched.LookupBatch(packets.data(), packets.size(), 300, found.data(), matches.data()), keys.size());
+    for (size_t i = 0; i < packets.size(); i++)
+    {
+        uint32_t value{};
+        ASSERT_EQ(matches[i], single.Lookup(packets[i], value)) << i;
+        if (matches[i] != IPv4Table::Match::NONE)
+        {
+            EXPECT_EQ(found[i], value) << i;
+        }
+    }
+
+    // The lookups extended every flow.
+    std::vector<IPv4Table::Flow> expired;
+    EXPECT_EQ(batched.Expire(200, expired), 0u);
+    EXPECT_EQ(single.Expire(200, expired), keys.size());
+    EXPECT_EQ(static_cast<const IPv4Table &>(batched).LookupBatch(keys.data(), keys.size(), found.data(), matches.data()), keys.size());
+
+    EXPECT_THROW(batched.LookupBatch(nullptr, 1, found.data(), matches.data()), std::invalid_argument);
+    EXPECT_THROW(batched.InsertBatch(keys.data(), nullptr, 1, 0, inserted.get()), std::invalid_argument);
+}
+
+TEST(ConnTrackTableTest, ManyThreads_DisjointFlows_AllTracked)
+{
+    IPv4Table table(1 << 16, 0, 8);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&table, t]()
+                             {
+                                 for (uint32_t i = 0; i < 5000; i++)
+                                 {
+                                     const IPv4FlowKey cKey(IPv4Address::FromUint32(0x0A000000u + t), IPv4Address::FromUint32(0xC0A80000u + i), 1234, 80, 6);
+                                     table.Insert(cKey, i, 100);
+                                     uint32_t value{};
+                                     table.Lookup(cKey.Reversed(), value, 200);
+                                 } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(table.Size(), 20000u);
+    std::vector<IPv4Table::Flow> expired;
+    EXPECT_EQ(table.Expire(200, expired), 20000u);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
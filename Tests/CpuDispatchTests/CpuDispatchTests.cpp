@@ -0,0 +1,55 @@
+/**
+ * @file CpuDispatchTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for CpuFeatures class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "CpuDispatch/CpuFeatures.hpp"
+#include "gtest/gtest.h"
+#include <stdexcept>
+
+using namespace EthernetParameter;
+using Tier = CpuFeatures::Tier;
+
+TEST(CpuFeaturesTest, Parse_Names_RoundTripIgnoringCase)
+{
+    for (uint8_t tier = 0; tier < CpuFeatures::TIER_COUNT; tier++)
+    {
+        EXPECT_EQ(CpuFeatures::Parse(CpuFeatures::Name(static_cast<Tier>(tier))), static_cast<Tier>(tier));
+    }
+    EXPECT_EQ(CpuFeatures::Parse("AVX2"), Tier::AVX2);
+    EXPECT_EQ(CpuFeatures::Parse("Sse4.2"), Tier::SSE4_2);
+    EXPECT_THROW(CpuFeatures::Parse("avx"), std::invalid_argument);
+    EXPECT_THROW(CpuFeatures::Parse("avx5120"), std::invalid_argument);
+    EXPECT_THROW(CpuFeatures::Parse(nullptr), std::invalid_argument);
+}
+
+TEST(CpuFeaturesTest, Select_Override_NeverRaisesTier)
+{
+    EXPECT_EQ(CpuFeatures::Select(Tier::AVX2, nullptr), Tier::AVX2);
+    EXPECT_EQ(CpuFeatures::Select(Tier::AVX2, ""), Tier::AVX2);
+    EXPECT_EQ(CpuFeatures::Select(Tier::AVX2, "sse2"), Tier::SSE2);
+    EXPECT_EQ(CpuFeatures::Select(Tier::AVX2, "scalar"), Tier::SCALAR);
+    EXPECT_EQ(CpuFeatures::Select(Tier::AVX2, "avx512"), Tier::AVX2);
+    EXPECT_EQ(CpuFeatures::Select(Tier::SSE2, "unknown"), Tier::SSE2);
+}
+
+TEST(CpuFeaturesTest, Selected_Environment_IsAtMostDetected)
+{
+    EXPECT_LE(CpuFeatures::Selected(), CpuFeatures::Detected());
+    EXPECT_EQ(CpuFeatures::Selected(), CpuFeatures::Selected());
+#if defined(__x86_64__) || defined(_M_X64)
+    EXPECT_GE(CpuFeatures::Detected(), Tier::SSE2);
+#endif
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
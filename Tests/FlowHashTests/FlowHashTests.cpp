@@ -0,0 +1,324 @@
+/**
+ * @file FlowHashTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for ToeplitzHash, MaglevTable and JumpHash classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "FlowHash/JumpHash.hpp"
+#include "FlowHash/MaglevTable.hpp"
+#include "FlowHash/ToeplitzHash.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+namespace
+{
+    /**
+     * @brief Bit-by-bit Toeplitz hash as written in the RSS specification.
+     */
+    uint32_t ReferenceHash(const ToeplitzHash::Key &cKey, const uint8_t *cData, const size_t &cLength)
+    {
+        uint32_t hash{};
+        uint32_t window = static_cast<uint32_t>(cKey[0]) << 24 | cKey[1] << 16 | cKey[2] << 8 | cKey[3];
+        for (size_t i = 0; i < cLength; i++)
+        {
+            for (int bit = 7; bit >= 0; bit--)
+            {
+                if (cData[i] >> bit & 1)
+                {
+                    hash ^= window;
+                }
+                window = window << 1 | (cKey[i + 4] >> bit & 1);
+            }
+        }
+        return hash;
+    }
+
+    IPv6Address MakeIPv6(const uint64_t &cUpper, const uint64_t &cLower)
+    {
+        return IPv6Address::FromUint64(cUpper, cLower);
+    }
+}
+
+TEST(ToeplitzHashTest, Hash_IPv4_MatchesRssVerificationSuite)
+{
+    const ToeplitzHash cHash;
+    EXPECT_EQ(cHash.Hash(IPv4Address("66.9.149.187"), IPv4Address("161.142.100.80")), 0x323E8FC2u);
+    EXPECT_EQ(cHash.Hash(IPv4Address("66.9.149.187"), IPv4Address("161.142.100.80"), 2794, 1766), 0x51CCC178u);
+    EXPECT_EQ(cHash.Hash(IPv4Address("199.92.111.2"), IPv4Address("65.69.140.83")), 0xD718262Au);
+    EXPECT_EQ(cHash.Hash(IPv4Address("199.92.111.2"), IPv4Address("65.69.140.83"), 14230, 4739), 0xC626B0EAu);
+    EXPECT_EQ(cHash.Hash(IPv4Address("24.19.198.95"), IPv4Address("12.22.207.184")), 0xD2D0A5DEu);
+    EXPECT_EQ(cHash.Hash(IPv4Address("24.19.198.95"), IPv4Address("12.22.207.184"), 12898, 38024), 0x5C2B394Au);
+}
+
+TEST(ToeplitzHashTest, Hash_IPv6_MatchesRssVerificationSuite)
+{
+    const ToeplitzHash cHash;
+    const IPv6Address cSource = MakeIPv6(0x3FFE250102001FFFull, 0x0000000000000007ull);
+    const IPv6Address cDestination = MakeIPv6(0x3FFE250102000003ull, 0x0000000000000001ull);
+    EXPECT_EQ(cHash.Hash(cSource, cDestination), 0x2CC18CD5u);
+    EXPECT_EQ(cHash.Hash(cSource, cDestination, 2794, 1766), 0x40207D3Du);
+
+    const IPv6Address cOtherSource = MakeIPv6(0x3FFE050100080000ull, 0x026097FFFE40EFABull);
+    const IPv6Address cOtherDestination = MakeIPv6(0xFF02000000000000ull, 0x0000000000000001ull);
+    EXPECT_EQ(cHash.Hash(cOtherSource, cOtherDestination), 0x0F0C461Cu);
+    EXPECT_EQ(cHash.Hash(cOtherSource, cOtherDestination, 14230, 4739), 0xDDE51BBFu);
+}
+
+TEST(ToeplitzHashTest, Hash_RandomKeyAndInput_MatchesReference)
+{
+    std::mt19937 random(7);
+    ToeplitzHash::Key key;
+    for (uint8_t &byte : key)
+    {
+        byte = static_cast<uint8_t>(random());
+    }
+    const ToeplitzHash cHash(key);
+    EXPECT_EQ(cHash.GetKey(), key);
+
+    uint8_t data[ToeplitzHash::MAX_INPUT_LENGTH];
+    for (size_t length = 0; length <= ToeplitzHash::MAX_INPUT_LENGTH; length++)
+    {
+        for (uint8_t &byte : data)
+        {
+            byte = static_cast<uint8_t>(random());
+        }
+        EXPECT_EQ(cHash.Hash(data, length), ReferenceHash(key, data, length)) << "length " << length;
+    }
+    EXPECT_THROW(cHash.Hash(data, ToeplitzHash::MAX_INPUT_LENGTH + 1), std::invalid_argument);
+    EXPECT_THROW(cHash.Hash(nullptr, 0), std::invalid_argument);
+}
+
+TEST(ToeplitzHashTest, Hash_SymmetricKey_SameForBothDirections)
+{
+    const ToeplitzHash cHash(ToeplitzHash::SYMMETRIC_KEY);
+    const IPv4Address cClient("192.168.10.7");
+    const IPv4Address cServer("10.0.0.1");
+    EXPECT_EQ(cHash.Hash(cClient, cServer, 52214, 443), cHash.Hash(cServer, cClient, 443, 52214));
+    EXPECT_EQ(cHash.Hash(cClient, cServer), cHash.Hash(cServer, cClient));
+
+    const IPv6Address cIPv6Client = MakeIPv6(0x20010DB800000000ull, 0x8A2E03707334ull);
+    const IPv6Address cIPv6Server = MakeIPv6(0xFE80000000000000ull, 1);
+    EXPECT_EQ(cHash.Hash(cIPv6Client, cIPv6Server, 52214, 443), cHash.Hash(cIPv6Server, cIPv6Client, 443, 52214));
+
+    const ToeplitzHash cDefault;
+    EXPECT_NE(cDefault.Hash(cClient, cServer, 52214, 443), cDefault.Hash(cServer, cClient, 443, 52214));
+}
+
+TEST(ToeplitzHashTest, HashBatch_BothFamilies_MatchesSingleHashes)
+{
+    const ToeplitzHash cHash;
+    std::mt19937_64 random(11);
+    const size_t cCount = 37;
+    std::vector<IPv4Address> sources4, destinations4;
+    std::vector<IPv6Address> sources6, destinations6;
+    std::vector<uint16_t> sourcePorts, destinationPorts;
+    for (size_t i = 0; i < cCount; i++)
+    {
+        sources4.push_back(IPv4Address::FromUint32(static_cast<uint32_t>(random())));
+        destinations4.push_back(IPv4Address::FromUint32(static_cast<uint32_t>(random())));
+        sources6.push_back(MakeIPv6(random(), random()));
+        destinations6.push_back(MakeIPv6(random(), random()));
+        sourcePorts.push_back(static_cast<uint16_t>(random()));
+        destinationPorts.push_back(static_cast<uint16_t>(random()));
+    }
+
+    std::vector<uint32_t> hashes(cCount);
+    cHash.HashBatch(sources4.data(), destinations4.data(), sourcePorts.data(), destinationPorts.data(), cCount, hashes.data());
+    for (size_t i = 0; i < cCount; i++)
+    {
+        EXPECT_EQ(hashes[i], cHash.Hash(sources4[i], destinations4[i], sourcePorts[i], destinationPorts[i]));
+    }
+    cHash.HashBatch(sources4.data(), destinations4.data(), nullptr, nullptr, cCount, hashes.data());
+    for (size_t i = 0; i < cCount; i++)
+    {
+        EXPECT_EQ(hashes[i], cHash.Hash(sources4[i], destinations4[i]));
+    }
+    cHash.HashBatch(sources6.data(), destinations6.data(), sourcePorts.data(), destinationPorts.data(), cCount, hashes.data());
+    for (size_t i = 0; i < cCount; i++)
+    {
+        EXPECT_EQ(hashes[i], cHash.Hash(sources6[i], destinations6[i], sourcePorts[i], destinationPorts[i]));
+    }
+
+    EXPECT_THROW(cHash.HashBatch(sources4.data(), destinations4.data(), sourcePorts.data(), nullptr, cCount, hashes.data()), std::invalid_argument);
+    EXPECT_THROW(cHash.HashBatch(sources6.data(), nullptr, nullptr, nullptr, cCount, hashes.data()), std::invalid_argument);
+    EXPECT_EQ(ToeplitzHash::TableIndex(0x51CCC178u, 128), 0x78u);
+}
+
+TEST(MaglevTableTest, Constructor_SizeNotPrime_Throws)
+{
+    EXPECT_THROW(MaglevTable(65536), std::invalid_argument);
+    EXPECT_THROW(MaglevTable(1), std::invalid_argument);
+    EXPECT_NO_THROW(MaglevTable(251));
+}
+
+TEST(MaglevTableTest, Build_Backends_EqualShares)
+{
+    MaglevTable table(65537);
+    EXPECT_EQ(table.Lookup(IPv4Address("10.0.0.1")), MaglevTable::NO_BACKEND);
+    for (uint32_t id = 100; id < 113; id++)
+    {
+        EXPECT_TRUE(table.AddBackend(id));
+    }
+    EXPECT_FALSE(table.AddBackend(105));
+    EXPECT_THROW(table.AddBackend(MaglevTable::NO_BACKEND), std::invalid_argument);
+    EXPECT_EQ(table.BackendCount(), 13u);
+    EXPECT_EQ(table.Build(), table.TableSize());
+
+    // The backends take turns, so their shares differ by at most one slot.
+    std::map<uint32_t, size_t> shares;
+    for (size_t slot = 0; slot < table.TableSize(); slot++)
+    {
+        shares[table.Entry(slot)]++;
+    }
+    ASSERT_EQ(shares.size(), 13u);
+    const auto cBounds = std::minmax_element(shares.begin(), shares.end(), [](const auto &cLeft, const auto &cRight)
+                                             { return cLeft.second < cRight.second; });
+    EXPECT_LE(cBounds.second->second - cBounds.first->second, 1u);
+    EXPECT_EQ(table.Build(), 0u);
+}
+
+TEST(MaglevTableTest, Build_InsertionOrder_SameTable)
+{
+    MaglevTable forward(251, 9);
+    MaglevTable backward(251, 9);
+    for (uint32_t id = 0; id < 7; id++)
+    {
+        forward.AddBackend(id);
+        backward.AddBackend(6 - id);
+    }
+    forward.Build();
+    backward.Build();
+    for (size_t slot = 0; slot < forward.TableSize(); slot++)
+    {
+        EXPECT_EQ(forward.Entry(slot), backward.Entry(slot));
+    }
+}
+
+TEST(MaglevTableTest, RemoveBackend_MovesFewSlots)
+{
+    MaglevTable table;
+    for (uint32_t id = 0; id < 20; id++)
+    {
+        table.AddBackend(id);
+    }
+    table.Build();
+    std::vector<uint32_t> before(table.TableSize());
+    for (size_t slot = 0; slot < before.size(); slot++)
+    {
+        before[slot] = table.Entry(slot);
+    }
+    EXPECT_TRUE(table.RemoveBackend(7));
+    EXPECT_FALSE(table.RemoveBackend(7));
+    const size_t cMoved = table.Build();
+
+    size_t removedSlots{};
+    for (size_t slot = 0; slot < before.size(); slot++)
+    {
+        EXPECT_NE(table.Entry(slot), 7u);
+        removedSlots += before[slot] == 7;
+    }
+    // Every slot of the removed backend moves, and only a few others do.
+    EXPECT_GE(cMoved, removedSlots);
+    EXPECT_LT(cMoved, removedSlots * 2);
+}
+
+TEST(MaglevTableTest, LookupBatch_BothFamilies_MatchesLookup)
+{
+    MaglevTable table(4099, 3);
+    for (uint32_t id = 1; id <= 5; id++)
+    {
+        table.AddBackend(id * 10);
+    }
+    table.Build();
+
+    std::mt19937_64 random(5);
+    std::vector<IPv4Address> ipv4(100);
+    std::vector<IPv6Address> ipv6(100);
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        ipv4[i] = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        ipv6[i] = MakeIPv6(random(), random());
+    }
+    std::vector<uint32_t> backends(ipv4.size());
+    table.LookupBatch(ipv4.data(), ipv4.size(), backends.data());
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        EXPECT_EQ(backends[i], table.Lookup(ipv4[i]));
+        EXPECT_NE(backends[i], MaglevTable::NO_BACKEND);
+    }
+    table.LookupBatch(ipv6.data(), ipv6.size(), backends.data());
+    for (size_t i = 0; i < ipv6.size(); i++)
+    {
+        EXPECT_EQ(backends[i], table.Lookup(ipv6[i]));
+    }
+    EXPECT_THROW(table.LookupBatch(ipv4.data(), ipv4.size(), nullptr), std::invalid_argument);
+}
+
+TEST(JumpHashTest, Bucket_GrowingBuckets_MovesOnlyToNewBucket)
+{
+    std::mt19937_64 random(13);
+    std::vector<IPv4Address> addresses(2000);
+    for (IPv4Address &address : addresses)
+    {
+        address = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+    }
+    for (uint32_t buckets = 1; buckets < 40; buckets++)
+    {
+        size_t moved{};
+        for (const IPv4Address &cAddress : addresses)
+        {
+            const uint32_t cBefore = JumpHash::Bucket(cAddress, buckets);
+            const uint32_t cAfter = JumpHash::Bucket(cAddress, buckets + 1);
+            ASSERT_LT(cBefore, buckets);
+            if (cBefore != cAfter)
+            {
+                EXPECT_EQ(cAfter, buckets);
+                moved++;
+            }
+        }
+        // About 1 / (buckets + 1) of the keys move.
+        EXPECT_LT(moved, 2 * addresses.size() / (buckets + 1) + 20);
+    }
+    EXPECT_THROW(JumpHash::Bucket(addresses[0], 0), std::invalid_argument);
+}
+
+TEST(JumpHashTest, BucketBatch_BothFamilies_MatchesBucket)
+{
+    std::mt19937_64 random(17);
+    std::vector<IPv4Address> ipv4(64);
+    std::vector<IPv6Address> ipv6(64);
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        ipv4[i] = IPv4Address::FromUint32(static_cast<uint32_t>(random()));
+        ipv6[i] = MakeIPv6(random(), random());
+    }
+    std::vector<uint32_t> buckets(ipv4.size());
+    JumpHash::BucketBatch(ipv4.data(), ipv4.size(), 9, buckets.data(), 1);
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        EXPECT_EQ(buckets[i], JumpHash::Bucket(ipv4[i], 9, 1));
+    }
+    JumpHash::BucketBatch(ipv6.data(), ipv6.size(), 9, buckets.data(), 1);
+    for (size_t i = 0; i < ipv6.size(); i++)
+    {
+        EXPECT_EQ(buckets[i], JumpHash::Bucket(ipv6[i], 9, 1));
+    }
+    EXPECT_THROW(JumpHash::BucketBatch(ipv6.data(), ipv6.size(), 0, buckets.data()), std::invalid_argument);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
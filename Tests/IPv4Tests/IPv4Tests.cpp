@@ -12,9 +12,13 @@
  *            All rights reserved.
  */
 #include "IPv4Address/IPv4Address.hpp"
+#include "IPv4Address/IPv4Prefix.hpp"
+#include "IPv4Address/IPv4Range.hpp"
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <iomanip>
 #include <sstream>
 
 using namespace EthernetParameter;
@@ -187,6 +191,204 @@ TEST_F(IPv4AddressTest, OutputOperator)
     // Add assertions to test the output operator
     ASSERT_EQ(oss.str(), validAddressStr);
 }
+// Test the numeric conversions
+TEST_F(IPv4AddressTest, Uint32Conversion)
+{
+    static_assert(IPv4Address::FromUint32(0xC0A80001).ToUint32() == 0xC0A80001, "constexpr round trip");
+
+    ASSERT_EQ(validAddress.ToUint32(), 0xC0A80001u);
+    ASSERT_EQ(IPv4Address::FromUint32(0xC0A80001), validAddress);
+}
+
+// Test the increment and decrement operators with carry over octets
+TEST_F(IPv4AddressTest, IncrementDecrement)
+{
+    EthernetParameter::IPv4Address address(10, 0, 0, 255);
+    ++address;
+    ASSERT_EQ(address, EthernetParameter::IPv4Address(10, 0, 1, 0));
+    ASSERT_EQ(address--, EthernetParameter::IPv4Address(10, 0, 1, 0));
+    ASSERT_EQ(address, EthernetParameter::IPv4Address(10, 0, 0, 255));
+
+    // Wrap around the address space.
+    EthernetParameter::IPv4Address broadcast(255, 255, 255, 255);
+    ASSERT_EQ(++broadcast, EthernetParameter::IPv4Address());
+    ASSERT_EQ(--broadcast, EthernetParameter::IPv4Address(255, 255, 255, 255));
+}
+
+// Test the offset and distance operators
+TEST_F(IPv4AddressTest, OffsetAndDistance)
+{
+    constexpr EthernetParameter::IPv4Address cBase(10, 0, 0, 0);
+    static_assert((cBase + 65536).ToUint32() == 0x0A010000, "constexpr offset");
+    static_assert((cBase + 300) - cBase == 300, "constexpr distance");
+
+    ASSERT_EQ(cBase + 258, EthernetParameter::IPv4Address(10, 0, 1, 2));
+    ASSERT_EQ(cBase - 1, EthernetParameter::IPv4Address(9, 255, 255, 255));
+    ASSERT_EQ(cBase + (-1), EthernetParameter::IPv4Address(9, 255, 255, 255));
+    ASSERT_EQ(EthernetParameter::IPv4Address(9, 255, 255, 255) - cBase, -1);
+
+    EthernetParameter::IPv4Address address(cBase);
+    address += 1000;
+    address -= 999;
+    ASSERT_EQ(address, EthernetParameter::IPv4Address(10, 0, 0, 1));
+}
+
+// Test the ordering operators
+TEST_F(IPv4AddressTest, OrderingOperators)
+{
+    EthernetParameter::IPv4Address lower(10, 255, 255, 255);
+    EthernetParameter::IPv4Address higher(11, 0, 0, 0);
+
+    ASSERT_TRUE(lower < higher);
+    ASSERT_TRUE(lower <= higher);
+    ASSERT_TRUE(higher > lower);
+    ASSERT_TRUE(higher >= lower);
+    ASSERT_FALSE(higher < lower);
+    ASSERT_TRUE(lower <= lower);
+}
+
+// Test iterating over a range
+TEST_F(IPv4AddressTest, RangeIteration)
+{
+    EthernetParameter::IPv4Range range(EthernetParameter::IPv4Address(192, 168, 0, 254), EthernetParameter::IPv4Address(192, 168, 1, 1));
+
+    ASSERT_EQ(range.Size(), 4u);
+    ASSERT_EQ(range.end() - range.begin(), 4);
+    ASSERT_EQ(range[2], EthernetParameter::IPv4Address(192, 168, 1, 0));
+    ASSERT_TRUE(range.Contains(EthernetParameter::IPv4Address(192, 168, 1, 0)));
+    ASSERT_FALSE(range.Contains(EthernetParameter::IPv4Address(192, 168, 1, 2)));
+
+    std::vector<EthernetParameter::IPv4Address> addresses(range.begin(), range.end());
+    ASSERT_EQ(addresses.size(), 4u);
+    ASSERT_EQ(addresses.front(), range.GetFirst());
+    ASSERT_EQ(addresses.back(), range.GetLast());
+
+    ASSERT_THROW(EthernetParameter::IPv4Range(range.GetLast(), range.GetFirst()), std::invalid_argument);
+}
+
+// Test a range ending at the last address of the address space
+TEST_F(IPv4AddressTest, RangeEndingAtBroadcast)
+{
+    EthernetParameter::IPv4Range range(EthernetParameter::IPv4Address(255, 255, 255, 250), EthernetParameter::IPv4Address(255, 255, 255, 255));
+
+    uint64_t count{};
+    for (const EthernetParameter::IPv4Address &cAddress : range)
+    {
+        ASSERT_TRUE(range.Contains(cAddress));
+        count++;
+    }
+    ASSERT_EQ(count, 6u);
+
+    EthernetParameter::IPv4Range everything(EthernetParameter::IPv4Address(), EthernetParameter::IPv4Address(255, 255, 255, 255));
+    ASSERT_EQ(everything.Size(), 1ull << 32);
+    ASSERT_EQ(everything.end() - everything.begin(), 1ll << 32);
+}
+
+// Test random access iterator operations with standard algorithms
+TEST_F(IPv4AddressTest, RangeRandomAccess)
+{
+    EthernetParameter::IPv4Prefix prefix(EthernetParameter::IPv4Address(10, 0, 0, 0), 8);
+
+    auto it = std::lower_bound(prefix.begin(), prefix.end(), EthernetParameter::IPv4Address(10, 20, 30, 40));
+    ASSERT_EQ(it - prefix.begin(), (20 << 16) + (30 << 8) + 40);
+    ASSERT_EQ(*it, EthernetParameter::IPv4Address(10, 20, 30, 40));
+    ASSERT_EQ(it[1], EthernetParameter::IPv4Address(10, 20, 30, 41));
+    ASSERT_EQ(*(it - 41), EthernetParameter::IPv4Address(10, 20, 29, 255));
+    ASSERT_TRUE(prefix.begin() < it);
+}
+
+// Test the prefix class
+TEST_F(IPv4AddressTest, Prefix)
+{
+    constexpr EthernetParameter::IPv4Prefix cPrefix(EthernetParameter::IPv4Address(192, 168, 7, 99), 22);
+    static_assert(cPrefix.Size() == 1024, "constexpr prefix size");
+
+    ASSERT_EQ(cPrefix.GetAddress(), EthernetParameter::IPv4Address(192, 168, 4, 0));
+    ASSERT_EQ(cPrefix.GetMask(), EthernetParameter::IPv4Address(255, 255, 252, 0));
+    ASSERT_EQ(cPrefix.Last(), EthernetParameter::IPv4Address(192, 168, 7, 255));
+    ASSERT_TRUE(cPrefix.Contains(EthernetParameter::IPv4Address(192, 168, 5, 1)));
+    ASSERT_FALSE(cPrefix.Contains(EthernetParameter::IPv4Address(192, 168, 8, 0)));
+    ASSERT_TRUE(cPrefix.Contains(EthernetParameter::IPv4Prefix("192.168.6.0/24")));
+    ASSERT_EQ(cPrefix.ToString(), "192.168.4.0/22");
+    ASSERT_EQ(EthernetParameter::IPv4Prefix("192.168.7.99/22"), cPrefix);
+    ASSERT_EQ(cPrefix.ToRange().Size(), cPrefix.Size());
+
+    ASSERT_EQ(EthernetParameter::IPv4Prefix().Size(), 1ull << 32);
+    ASSERT_THROW(EthernetParameter::IPv4Prefix(validAddress, 33), std::out_of_range);
+    ASSERT_THROW(EthernetParameter::IPv4Prefix("192.168.0.0"), std::invalid_argument);
+}
+
+// Test reverse DNS name formatting and parsing
+TEST_F(IPv4AddressTest, ReverseName)
+{
+    char buffer[EthernetParameter::IPv4Address::REVERSE_NAME_MAX_LENGTH + 1];
+    ASSERT_EQ(24u, validAddress.ToReverseName(buffer, sizeof(buffer)));
+    ASSERT_STREQ("1.0.168.192.in-addr.arpa", buffer);
+
+    ASSERT_EQ(28u, EthernetParameter::IPv4Address(255, 255, 255, 255).ToReverseName(buffer, sizeof(buffer)));
+    ASSERT_STREQ("255.255.255.255.in-addr.arpa", buffer);
+    ASSERT_THROW(validAddress.ToReverseName(buffer, 24), std::invalid_argument);
+    ASSERT_THROW(validAddress.ToReverseName(nullptr, 64), std::invalid_argument);
+
+    EthernetParameter::IPv4Address parsed;
+    const std::string cName = "4.3.2.10.IN-ADDR.ARPA.";
+    ASSERT_TRUE(EthernetParameter::IPv4Address::FromReverseName(cName.data(), cName.size(), parsed));
+    ASSERT_EQ(EthernetParameter::IPv4Address(10, 2, 3, 4), parsed);
+
+    for (const std::string cInvalid : {"1.2.3.in-addr.arpa", "256.2.3.4.in-addr.arpa", "01.2.3.4.in-addr.arpa",
+                                        "1.2.3.4.in-addr.arpb", "1.2.3.4.ip6.arpa", "1.2.3.4.5.in-addr.arpa", "1.2.3.4.in-addr.arpa.."})
+    {
+        ASSERT_FALSE(EthernetParameter::IPv4Address::FromReverseName(cInvalid.data(), cInvalid.size(), parsed)) << cInvalid;
+    }
+    ASSERT_EQ(EthernetParameter::IPv4Address(10, 2, 3, 4), parsed);
+}
+
+// Test the non-throwing parser
+TEST_F(IPv4AddressTest, TryParse)
+{
+    EthernetParameter::IPv4Address parsed;
+    const std::string cText = "10.20.30.40:8080";
+    ASSERT_TRUE(EthernetParameter::IPv4Address::TryParse(cText.data(), 11, parsed));
+    ASSERT_EQ(EthernetParameter::IPv4Address(10, 20, 30, 40), parsed);
+    ASSERT_TRUE(EthernetParameter::IPv4Address::TryParse("0.0.0.0", 7, parsed));
+    ASSERT_EQ(EthernetParameter::IPv4Address(), parsed);
+
+    for (const std::string cInvalid : {"10.20.30.40:8080", "1.2.3", "1.2.3.4.5", "256.1.1.1", "01.1.1.1", "1..2.3", "1.2.3.", "a.b.c.d", ""})
+    {
+        ASSERT_FALSE(EthernetParameter::IPv4Address::TryParse(cInvalid.data(), cInvalid.size(), parsed)) << cInvalid;
+    }
+    ASSERT_FALSE(EthernetParameter::IPv4Address::TryParse(nullptr, 7, parsed));
+}
+
+// Test the stream operators against ToString() and TryParse()
+TEST_F(IPv4AddressTest, StreamOperators)
+{
+    std::ostringstream oss;
+    oss << EthernetParameter::IPv4Address(255, 0, 10, 100) << ' ' << std::setw(10) << std::left << EthernetParameter::IPv4Address(1, 2, 3, 4) << '|';
+    ASSERT_EQ(oss.str(), "255.0.10.100 1.2.3.4   |");
+
+    std::istringstream iss("  10.20.30.40:8080 1.2.3.4\n256.1.1.1");
+    EthernetParameter::IPv4Address first;
+    EthernetParameter::IPv4Address second;
+    iss >> first;
+    ASSERT_TRUE(iss.good());
+    ASSERT_EQ(EthernetParameter::IPv4Address(10, 20, 30, 40), first);
+    ASSERT_EQ(iss.get(), ':');
+    uint16_t port{};
+    iss >> port >> second;
+    ASSERT_EQ(port, 8080);
+    ASSERT_EQ(EthernetParameter::IPv4Address(1, 2, 3, 4), second);
+
+    iss >> first;
+    ASSERT_TRUE(iss.fail());
+    ASSERT_TRUE(iss.eof());
+    ASSERT_EQ(EthernetParameter::IPv4Address(10, 20, 30, 40), first);
+
+    std::istringstream tooLong("1.2.3.4.5.6.7.8.9");
+    tooLong >> first;
+    ASSERT_TRUE(tooLong.fail());
+}
+
 /******************************************************************************
 **********************************End of file**********************************
 ******************************************************************************/
\ No newline at end of file
@@ -12,10 +12,14 @@
  *            All rights reserved.
  */
 #include "IPv6Address/IPv6Address.hpp"
+#include "IPv6Address/IPv6Prefix.hpp"
+#include "IPv6Address/IPv6Range.hpp"
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include <iomanip>
 #include <sstream>
 
 using namespace EthernetParameter;
@@ -170,6 +174,217 @@ TEST(IPv6AddressTest, ToString_ValidIPv6Address_ReturnIPv6AddressString)
     ASSERT_EQ("fe80::2:DAFF:FEFF:DC00", cAddress.ToString());
 }
 
+TEST(IPv6AddressTest, SetFromBinary_ValidVector_GroupsInNetworkByteOrder)
+{
+    IPv6Address cAddress;
+    cAddress.SetFromBinary({0x20, 0x01, 0x0D, 0xB8, 0x85, 0xA3, 0x00, 0x01, 0x6E, 0x9D, 0x70, 0x98, 0x01, 0x00, 0x00, 0x00});
+    ASSERT_EQ(IPv6Address(0x2001, 0x0DB8, 0x85A3, 0x0001, 0x6E9D, 0x7098, 0x0100, 0x0000), cAddress);
+    ASSERT_EQ(IPv6Address("2001:0db8:85a3:0001:6e9d:7098:0100:0000").ToBinary(), cAddress.ToBinary());
+}
+
+TEST(IPv6AddressTest, Uint64Conversion_RoundTrip_SameAddress)
+{
+    constexpr IPv6Address cAddress = IPv6Address::FromUint64(0x20010DB800000000ULL, 0x0000FF0000428329ULL);
+    static_assert(cAddress.GetUpper64() == 0x20010DB800000000ULL, "constexpr upper half");
+    static_assert(cAddress.GetLower64() == 0x0000FF0000428329ULL, "constexpr lower half");
+    ASSERT_EQ(IPv6Address("2001:0db8:0000:0000:0000:ff00:0042:8329"), cAddress);
+}
+
+TEST(IPv6AddressTest, Increment_CarryBetweenHalves_NextAddress)
+{
+    IPv6Address cAddress = IPv6Address::FromUint64(1, UINT64_MAX);
+    ++cAddress;
+    ASSERT_EQ(IPv6Address::FromUint64(2, 0), cAddress);
+    ASSERT_EQ(IPv6Address::FromUint64(2, 0), cAddress--);
+    ASSERT_EQ(IPv6Address::FromUint64(1, UINT64_MAX), cAddress);
+
+    IPv6Address cAllOnes = IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX);
+    ASSERT_EQ(IPv6Address(), ++cAllOnes);
+    ASSERT_EQ(IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX), --cAllOnes);
+}
+
+TEST(IPv6AddressTest, OffsetAndDistance_NegativeOffset_PreviousAddress)
+{
+    constexpr IPv6Address cBase = IPv6Address::FromUint64(5, 10);
+    static_assert((cBase + (-11)).GetUpper64() == 4, "constexpr borrow");
+    static_assert((cBase + 1000) - cBase == 1000, "constexpr distance");
+
+    ASSERT_EQ(IPv6Address::FromUint64(4, UINT64_MAX), cBase - 11);
+    ASSERT_EQ(IPv6Address::FromUint64(5, 20), cBase - (-10));
+    ASSERT_EQ(-11, (cBase - 11) - cBase);
+
+    IPv6Address cAddress = cBase;
+    cAddress += -20;
+    cAddress -= -20;
+    ASSERT_EQ(cBase, cAddress);
+}
+
+TEST(IPv6AddressTest, OrderingOperators_NumericOrder)
+{
+    IPv6Address cLower = IPv6Address::FromUint64(1, UINT64_MAX);
+    IPv6Address cHigher = IPv6Address::FromUint64(2, 0);
+    ASSERT_TRUE(cLower < cHigher);
+    ASSERT_TRUE(cLower <= cHigher);
+    ASSERT_TRUE(cHigher > cLower);
+    ASSERT_TRUE(cHigher >= cLower);
+    ASSERT_FALSE(cHigher < cLower);
+}
+
+TEST(IPv6AddressTest, Range_IterateAcrossHalves_AllAddresses)
+{
+    IPv6Range cRange(IPv6Address::FromUint64(7, UINT64_MAX - 1), IPv6Address::FromUint64(8, 1));
+    ASSERT_EQ(4u, cRange.Size());
+    ASSERT_EQ(4, cRange.end() - cRange.begin());
+    ASSERT_EQ(IPv6Address::FromUint64(8, 0), cRange[2]);
+
+    std::vector<IPv6Address> cAddresses(cRange.begin(), cRange.end());
+    ASSERT_EQ(4u, cAddresses.size());
+    ASSERT_EQ(cRange.GetFirst(), cAddresses.front());
+    ASSERT_EQ(cRange.GetLast(), cAddresses.back());
+    ASSERT_TRUE(cRange.Contains(IPv6Address::FromUint64(8, 0)));
+    ASSERT_FALSE(cRange.Contains(IPv6Address::FromUint64(8, 2)));
+
+    ASSERT_THROW(IPv6Range(cRange.GetLast(), cRange.GetFirst()), std::invalid_argument);
+}
+
+TEST(IPv6AddressTest, Range_EndingAtLastAddress_EndIsPastLast)
+{
+    IPv6Range cRange(IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX - 2), IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX));
+    int count = 0;
+    for (const IPv6Address &cAddress : cRange)
+    {
+        ASSERT_TRUE(cRange.Contains(cAddress));
+        count++;
+    }
+    ASSERT_EQ(3, count);
+    ASSERT_TRUE(cRange.begin() < cRange.end());
+
+    IPv6Range cEverything(IPv6Address(), IPv6Address::FromUint64(UINT64_MAX, UINT64_MAX));
+    ASSERT_EQ(UINT64_MAX, cEverything.Size());
+    ASSERT_NE(cEverything.begin(), cEverything.end());
+}
+
+TEST(IPv6AddressTest, Range_LowerBound_RandomAccess)
+{
+    IPv6Prefix cPrefix(IPv6Address::FromUint64(0x20010DB800000000ULL, 0), 96);
+    IPv6Address cTarget = IPv6Address::FromUint64(0x20010DB800000000ULL, 123456789);
+
+    auto it = std::lower_bound(cPrefix.begin(), cPrefix.end(), cTarget);
+    ASSERT_EQ(cTarget, *it);
+    ASSERT_EQ(123456789, it - cPrefix.begin());
+    ASSERT_EQ(cTarget + 1, it[1]);
+}
+
+TEST(IPv6AddressTest, Prefix_HostBitsCleared_ContainsAndBounds)
+{
+    constexpr IPv6Prefix cPrefix(IPv6Address(0x2001, 0x0db8, 0x1234, 0x5678, 0x9abc, 0, 0, 1), 48);
+    static_assert(cPrefix.GetAddress().GetUpper64() == 0x20010DB812340000ULL, "constexpr network address");
+
+    ASSERT_EQ(IPv6Address(0x2001, 0x0db8, 0x1234, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff), cPrefix.Last());
+    ASSERT_EQ(IPv6Address(0xffff, 0xffff, 0xffff, 0, 0, 0, 0, 0), cPrefix.GetMask());
+    ASSERT_TRUE(cPrefix.Contains(IPv6Address(0x2001, 0x0db8, 0x1234, 0, 0, 0, 0, 0)));
+    ASSERT_FALSE(cPrefix.Contains(IPv6Address(0x2001, 0x0db8, 0x1235, 0, 0, 0, 0, 0)));
+    ASSERT_TRUE(cPrefix.Contains(IPv6Prefix(IPv6Address(0x2001, 0x0db8, 0x1234, 0x1, 0, 0, 0, 0), 64)));
+    ASSERT_EQ(UINT64_MAX, cPrefix.Size());
+
+    IPv6Prefix cSmall(IPv6Address::FromUint64(1, 0x1234), 120);
+    ASSERT_EQ(256u, cSmall.Size());
+    ASSERT_EQ(IPv6Address::FromUint64(1, 0x1200), cSmall.First());
+    ASSERT_EQ(256, cSmall.end() - cSmall.begin());
+
+    ASSERT_EQ(IPv6Prefix("2001:0db8:1234:5678:9abc:0000:0000:0001/48"), cPrefix);
+    ASSERT_EQ("2001:0db8:1234:0000:0000:0000:0000:0000/48", cPrefix.ToString());
+    ASSERT_THROW(IPv6Prefix(IPv6Address(), 129), std::out_of_range);
+    ASSERT_THROW(IPv6Prefix("2001:0db8:0000:0000:0000:0000:0000:0000"), std::invalid_argument);
+}
+
+TEST(IPv6ReverseNameTest, FormatAndParse_RoundTrip)
+{
+    const IPv6Address cAddress(0x2001, 0x0db8, 0, 0, 0, 0, 0x00ab, 0xcd01);
+    char buffer[IPv6Address::REVERSE_NAME_LENGTH + 1];
+    ASSERT_EQ(IPv6Address::REVERSE_NAME_LENGTH, cAddress.ToReverseName(buffer, sizeof(buffer)));
+    ASSERT_STREQ("1.0.d.c.b.a.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.8.b.d.0.1.0.0.2.ip6.arpa", buffer);
+    ASSERT_THROW(cAddress.ToReverseName(buffer, IPv6Address::REVERSE_NAME_LENGTH), std::invalid_argument);
+
+    IPv6Address parsed;
+    ASSERT_TRUE(IPv6Address::FromReverseName(buffer, IPv6Address::REVERSE_NAME_LENGTH, parsed));
+    ASSERT_EQ(cAddress, parsed);
+
+    std::string upper = "1.0.D.C.B.A.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.8.B.D.0.1.0.0.2.IP6.ARPA.";
+    IPv6Address parsedUpper;
+    ASSERT_TRUE(IPv6Address::FromReverseName(upper.data(), upper.size(), parsedUpper));
+    ASSERT_EQ(cAddress, parsedUpper);
+
+    upper[4] = 'g';
+    ASSERT_FALSE(IPv6Address::FromReverseName(upper.data(), upper.size(), parsedUpper));
+    ASSERT_FALSE(IPv6Address::FromReverseName(buffer, IPv6Address::REVERSE_NAME_LENGTH - 1, parsedUpper));
+    buffer[3] = ':';
+    ASSERT_FALSE(IPv6Address::FromReverseName(buffer, IPv6Address::REVERSE_NAME_LENGTH, parsedUpper));
+    ASSERT_EQ(cAddress, parsedUpper);
+}
+
+TEST(IPv6TryParseTest, CompressedAndEmbeddedForms_Parsed)
+{
+    IPv6Address parsed;
+    const std::string cCompressed = "2001:DB8::ab:cd01";
+    ASSERT_TRUE(IPv6Address::TryParse(cCompressed.data(), cCompressed.size(), parsed));
+    ASSERT_EQ(IPv6Address(0x2001, 0x0db8, 0, 0, 0, 0, 0x00ab, 0xcd01), parsed);
+
+    ASSERT_TRUE(IPv6Address::TryParse("::", 2, parsed));
+    ASSERT_EQ(IPv6Address(), parsed);
+    ASSERT_TRUE(IPv6Address::TryParse("::1", 3, parsed));
+    ASSERT_EQ(IPv6Address::FromUint64(0, 1), parsed);
+    ASSERT_TRUE(IPv6Address::TryParse("fe80::", 6, parsed));
+    ASSERT_EQ(IPv6Address(0xfe80, 0, 0, 0, 0, 0, 0, 0), parsed);
+
+    const std::string cMapped = "::ffff:192.0.2.1";
+    ASSERT_TRUE(IPv6Address::TryParse(cMapped.data(), cMapped.size(), parsed));
+    ASSERT_EQ(IPv6Address(0, 0, 0, 0, 0, 0xffff, 0xc000, 0x0201), parsed);
+
+    const std::string cFull = "1:2:3:4:5:6:7:8";
+    ASSERT_TRUE(IPv6Address::TryParse(cFull.data(), cFull.size(), parsed));
+    ASSERT_EQ(IPv6Address(1, 2, 3, 4, 5, 6, 7, 8), parsed);
+    ASSERT_EQ(IPv6Address(1, 2, 3, 4, 5, 6, 7, 8), IPv6Address("1:2:3:4:5:6:7:8"));
+    ASSERT_EQ(IPv6Address(0x2001, 0x0db8, 0, 0, 0, 0, 0, 1), IPv6Address("2001:db8::1"));
+
+    for (const std::string cInvalid : {":", ":::", "1:2:3:4:5:6:7", "1:2:3:4:5:6:7:8:9", "1::2::3", "12345::", "1:2:3:4:5:6:7::8",
+                                       ":1::", "1:", "::g", "::1.2.3", "1:2:3:4:5:6:7:1.2.3.4", "::256.1.1.1", "00:1a:2b:3c:4d:5e"})
+    {
+        ASSERT_FALSE(IPv6Address::TryParse(cInvalid.data(), cInvalid.size(), parsed)) << cInvalid;
+    }
+    ASSERT_EQ(IPv6Address(1, 2, 3, 4, 5, 6, 7, 8), parsed);
+}
+
+TEST(EthernetParameterTest, IPv6AddressStreamOperators_RoundTrip)
+{
+    const IPv6Address cAddress(0x2001, 0x0db8, 0, 0, 0, 0xff00, 0x42, 0x8329);
+    std::ostringstream oss;
+    oss << cAddress << '|' << std::setw(41) << std::setfill('*') << std::right << IPv6Address("::1");
+    ASSERT_EQ(oss.str(), "2001:0db8:0000:0000:0000:ff00:0042:8329|**0000:0000:0000:0000:0000:0000:0000:0001");
+
+    std::istringstream iss(oss.str().substr(0, 39) + " ::ffff:192.0.2.1,fe80::1 ::g");
+    IPv6Address parsed;
+    iss >> parsed;
+    ASSERT_EQ(cAddress, parsed);
+    iss >> parsed;
+    ASSERT_EQ(IPv6Address(0, 0, 0, 0, 0, 0xffff, 0xc000, 0x0201), parsed);
+    ASSERT_EQ(iss.get(), ',');
+    iss >> parsed;
+    ASSERT_EQ(IPv6Address("fe80::1"), parsed);
+    ASSERT_TRUE(iss.good());
+
+    // "::" is read and the 'g' is left in the stream.
+    iss >> parsed;
+    ASSERT_FALSE(iss.fail());
+    ASSERT_EQ(IPv6Address(), parsed);
+    ASSERT_EQ(iss.get(), 'g');
+
+    std::istringstream invalid("1::2::3");
+    invalid >> parsed;
+    ASSERT_TRUE(invalid.fail());
+    ASSERT_EQ(IPv6Address(), parsed);
+}
+
 /******************************************************************************
 **********************************End of file**********************************
 ******************************************************************************/
\ No newline at end of file
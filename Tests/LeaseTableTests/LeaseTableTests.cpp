@@ -0,0 +1,136 @@
+/**
+ * @file LeaseTableTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for TimingWheel and LeaseTable classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "LeaseTable/LeaseTable.hpp"
+#include "LeaseTable/TimingWheel.hpp"
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+TEST(TimingWheelTest, Advance_RandomExpiries_FireExactlyOnTime)
+{
+    TimingWheel wheel(1000);
+    std::mt19937_64 random(7);
+    std::map<uint32_t, uint64_t> reference;
+
+    for (uint32_t id = 0; id < 2000; id++)
+    {
+        const uint64_t cSpan = uint64_t{1} << (random() % 34);
+        const uint64_t cExpiry = 1000 + random() % cSpan;
+        wheel.Schedule(id, cExpiry);
+        reference[id] = cExpiry;
+    }
+    wheel.Schedule(5, 1001);
+    reference[5] = 1001;
+    ASSERT_TRUE(wheel.Cancel(6));
+    reference.erase(6);
+    ASSERT_FALSE(wheel.Cancel(6));
+    ASSERT_EQ(reference.size(), wheel.Size());
+
+    std::vector<uint32_t> expired;
+    uint64_t now = 1000;
+    while (!reference.empty())
+    {
+        now += 1 + random() % (uint64_t{1} << (random() % 30));
+        expired.clear();
+        wheel.Advance(now, expired);
+        for (const uint32_t &cId : expired)
+        {
+            ASSERT_LE(reference.at(cId), now);
+            reference.erase(cId);
+        }
+        for (const auto &cEntry : reference)
+        {
+            ASSERT_GT(cEntry.second, now);
+        }
+    }
+    ASSERT_EQ(0u, wheel.Size());
+}
+
+TEST(TimingWheelTest, Schedule_InThePast_FiresOnNextAdvance)
+{
+    TimingWheel wheel(100);
+    wheel.Schedule(3, 50);
+    ASSERT_EQ(50u, wheel.GetExpiry(3));
+
+    std::vector<uint32_t> expired;
+    ASSERT_EQ(1u, wheel.Advance(100, expired));
+    ASSERT_EQ(3u, expired[0]);
+    ASSERT_FALSE(wheel.IsScheduled(3));
+    ASSERT_THROW(wheel.GetExpiry(3), std::invalid_argument);
+}
+
+TEST(LeaseTableTest, Bind_LookupByBothKeys_SameLease)
+{
+    LeaseTable table;
+    const MacAddress cMac("02:00:00:00:00:01");
+    table.Bind(cMac, IPv4Address(10, 0, 0, 1), 60);
+
+    LeaseTable::Lease lease;
+    ASSERT_TRUE(table.FindByMac(cMac, lease));
+    ASSERT_EQ(IPv4Address(10, 0, 0, 1), lease.address);
+    ASSERT_EQ(60u, lease.expiry);
+    ASSERT_TRUE(table.FindByAddress(IPv4Address(10, 0, 0, 1), lease));
+    ASSERT_EQ(cMac, lease.mac);
+
+    table.Bind(cMac, IPv4Address(10, 0, 0, 2), 90);
+    ASSERT_EQ(1u, table.Size());
+    ASSERT_FALSE(table.FindByAddress(IPv4Address(10, 0, 0, 1), lease));
+    ASSERT_TRUE(table.FindByAddress(IPv4Address(10, 0, 0, 2), lease));
+    ASSERT_EQ(90u, lease.expiry);
+
+    ASSERT_THROW(table.Bind(MacAddress("02:00:00:00:00:02"), IPv4Address(10, 0, 0, 2), 90), std::invalid_argument);
+    ASSERT_TRUE(table.Release(cMac));
+    ASSERT_FALSE(table.Release(cMac));
+    ASSERT_FALSE(table.FindByMac(cMac, lease));
+    ASSERT_EQ(0u, table.Size());
+}
+
+TEST(LeaseTableTest, Expire_ManyLeases_OnlyDueLeasesRemoved)
+{
+    LeaseTable table(0, 16);
+    for (uint32_t i = 0; i < 50000; i++)
+    {
+        table.Bind(MacAddress::FromUint64(0x020000000000ull + i), IPv4Address::FromUint32(0x0A000000 + i), 100 + i % 1000);
+    }
+    ASSERT_EQ(50000u, table.Size());
+    ASSERT_TRUE(table.Renew(MacAddress::FromUint64(0x020000000000ull), 5000));
+    ASSERT_FALSE(table.Renew(MacAddress::FromUint64(0x030000000000ull), 5000));
+
+    std::vector<LeaseTable::Lease> expired;
+    ASSERT_EQ(24999u, table.Expire(599, expired));
+    for (const LeaseTable::Lease &cLease : expired)
+    {
+        ASSERT_LE(cLease.expiry, 599u);
+    }
+    ASSERT_EQ(25001u, table.Size());
+    ASSERT_EQ(599u, table.GetTime());
+
+    LeaseTable::Lease lease;
+    ASSERT_FALSE(table.FindByAddress(IPv4Address::FromUint32(0x0A000000 + 1), lease));
+    ASSERT_TRUE(table.FindByAddress(IPv4Address::FromUint32(0x0A000000 + 600), lease));
+    ASSERT_EQ(MacAddress::FromUint64(0x020000000000ull + 600), lease.mac);
+
+    expired.clear();
+    ASSERT_EQ(25000u, table.Expire(4999, expired));
+    ASSERT_EQ(1u, table.Expire(5000, expired));
+    ASSERT_EQ(0u, table.Size());
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,72 @@
+/**
+ * @file MacAddressTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for MacAddress class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "MacAddress/MacAddress.hpp"
+#include "gtest/gtest.h"
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace EthernetParameter;
+
+TEST(MacAddressTest, Constructor_ValidString_CorrectOctets)
+{
+    MacAddress address("00:1a:2B:3c:4D:ff");
+    ASSERT_EQ(0x00, address.GetOctet(0));
+    ASSERT_EQ(0x1A, address.GetOctet(1));
+    ASSERT_EQ(0xFF, address.GetOctet(5));
+    ASSERT_EQ("00:1a:2b:3c:4d:ff", address.ToString());
+    ASSERT_EQ(address, MacAddress("00-1a-2b-3c-4d-ff"));
+}
+
+TEST(MacAddressTest, Constructor_InvalidString_Throws)
+{
+    ASSERT_THROW(MacAddress(std::string("00:1a:2b:3c:4d")), std::invalid_argument);
+    ASSERT_THROW(MacAddress(std::string("00:1a:2b:3c:4d:fg")), std::invalid_argument);
+    ASSERT_THROW(MacAddress(std::string("00:1a-2b:3c:4d:ff")), std::invalid_argument);
+    ASSERT_THROW(MacAddress(std::string("00.1a.2b.3c.4d.ff")), std::invalid_argument);
+}
+
+TEST(MacAddressTest, Uint64_RoundTrip_SameValue)
+{
+    constexpr MacAddress cAddress = MacAddress::FromUint64(0x001A2B3C4D5Eull);
+    static_assert(cAddress.ToUint64() == 0x001A2B3C4D5Eull, "constexpr round trip");
+    ASSERT_EQ("00:1a:2b:3c:4d:5e", cAddress.ToString());
+    ASSERT_LT(MacAddress::FromUint64(1), MacAddress::FromUint64(2));
+}
+
+TEST(MacAddressTest, Binary_RoundTrip_SameAddress)
+{
+    const std::vector<uint8_t> cBinary{0x02, 0x00, 0x5E, 0x10, 0x20, 0x30};
+    MacAddress address(cBinary);
+    ASSERT_EQ(cBinary, address.ToBinary());
+
+    uint8_t buffer[MacAddress::MAC_ADDRESS_OCTETS]{};
+    address.ToBinary(buffer);
+    ASSERT_EQ(address, MacAddress(buffer));
+
+    ASSERT_THROW(MacAddress(std::vector<uint8_t>(5)), std::invalid_argument);
+    ASSERT_THROW(address.ToBinary(nullptr), std::invalid_argument);
+    ASSERT_THROW(address.GetOctet(6), std::out_of_range);
+
+    std::ostringstream stream;
+    stream << address;
+    ASSERT_EQ("02:00:5e:10:20:30", stream.str());
+
+    address.Clear();
+    ASSERT_EQ(MacAddress(), address);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
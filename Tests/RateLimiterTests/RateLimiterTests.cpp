@@ -0,0 +1,157 @@
+/**
+ * @file RateLimiterTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for RateLimiter class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "RateLimiter/RateLimiter.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace EthernetParameter;
+
+TEST(RateLimiterTest, Constructor_InvalidLimits_Throws)
+{
+    EXPECT_THROW(RateLimiter(0, 10, 1000), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(10, 0, 1000), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(10, 10, 0), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(UINT64_MAX / 4, 10, 1000), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(10, 10, 1000, 1, 33), std::invalid_argument);
+    EXPECT_THROW(RateLimiter(10, 10, 1000, 1, 32, 129), std::invalid_argument);
+
+    const RateLimiter cLimiter(10, 10, 1000, 3);
+    EXPECT_GE(cLimiter.Capacity(), 1000u);
+    EXPECT_EQ(cLimiter.Capacity() % (4 * RateLimiter::WAYS), 0u);
+    EXPECT_GE(cLimiter.MemoryBytes(), cLimiter.Capacity() * 16);
+}
+
+TEST(RateLimiterTest, Allow_Burst_ThenRefillsLazily)
+{
+    // 5 tokens, one more every 100 ticks.
+    RateLimiter limiter(100, 5, 1024);
+    const IPv4Address cClient("192.168.10.7");
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(limiter.Allow(cClient, 1000)) << i;
+    }
+    EXPECT_FALSE(limiter.Allow(cClient, 1000));
+    EXPECT_FALSE(limiter.Allow(cClient, 1099));
+    EXPECT_TRUE(limiter.Allow(cClient, 1100));
+    EXPECT_FALSE(limiter.Allow(cClient, 1100));
+
+    // Other clients have their own buckets.
+    EXPECT_TRUE(limiter.Allow(IPv4Address("192.168.10.8"), 1100));
+
+    // After a long pause the bucket is full again, but never fuller.
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(limiter.Allow(cClient, 1000000)) << i;
+    }
+    EXPECT_FALSE(limiter.Allow(cClient, 1000000));
+
+    limiter.Clear();
+    EXPECT_TRUE(limiter.Allow(cClient, 1000000));
+}
+
+TEST(RateLimiterTest, Allow_Prefixes_ShareBuckets)
+{
+    RateLimiter limiter(1000, 2, 1024, 1, 24, 64);
+    EXPECT_TRUE(limiter.Allow(IPv4Address("10.1.2.3"), 0));
+    EXPECT_TRUE(limiter.Allow(IPv4Address("10.1.2.200"), 0));
+    EXPECT_FALSE(limiter.Allow(IPv4Address("10.1.2.99"), 0));
+    EXPECT_TRUE(limiter.Allow(IPv4Address("10.1.3.1"), 0));
+
+    const IPv6Address cFirst = IPv6Address::FromUint64(0x20010DB800000001ull, 1);
+    const IPv6Address cSameSubnet = IPv6Address::FromUint64(0x20010DB800000001ull, 0xFFFF);
+    const IPv6Address cOtherSubnet = IPv6Address::FromUint64(0x20010DB800000002ull, 1);
+    EXPECT_TRUE(limiter.Allow(cFirst, 0));
+    EXPECT_TRUE(limiter.Allow(cSameSubnet, 0));
+    EXPECT_FALSE(limiter.Allow(cFirst, 0));
+    EXPECT_TRUE(limiter.Allow(cOtherSubnet, 0));
+}
+
+TEST(RateLimiterTest, Allow_TableFull_EvictsLeastRecentlyAdmitted)
+{
+    // One shard of one set: four clients fit.
+    RateLimiter limiter(100, 5, RateLimiter::WAYS, 1);
+    ASSERT_EQ(limiter.Capacity(), RateLimiter::WAYS);
+    const IPv4Address cAbuser("10.0.0.1");
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(limiter.Allow(cAbuser, 0));
+    }
+    EXPECT_FALSE(limiter.Allow(cAbuser, 10));
+
+    // A stream of new clients evicts each other, but the throttled client stays tracked
+    // until it earns its next token at tick 100.
+    for (uint32_t i = 0; i < 60; i++)
+    {
+        EXPECT_TRUE(limiter.Allow(IPv4Address::FromUint32(0x0B000000u + i), 20 + i));
+        EXPECT_FALSE(limiter.Allow(cAbuser, 20 + i));
+    }
+}
+
+TEST(RateLimiterTest, AllowBatch_MatchesAllow)
+{
+    RateLimiter single(100, 3, 1 << 12);
+    RateLimiter batched(100, 3, 1 << 12);
+    std::vector<IPv4Address> ipv4;
+    std::vector<IPv6Address> ipv6;
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        // Repeated clients run out of tokens within the batch.
+        ipv4.push_back(IPv4Address::FromUint32(0xC0A80000u + i % 20));
+        ipv6.push_back(IPv6Address::FromUint64(0x20010DB800000000ull + i % 7, i));
+    }
+    bool allowed[100];
+    size_t expected{};
+    EXPECT_EQ(batched.AllowBatch(ipv4.data(), ipv4.size(), 0, allowed), 60u);
+    for (size_t i = 0; i < ipv4.size(); i++)
+    {
+        EXPECT_EQ(allowed[i], single.Allow(ipv4[i], 0)) << i;
+    }
+    for (size_t i = 0; i < ipv6.size(); i++)
+    {
+        expected += single.Allow(ipv6[i], 0);
+    }
+    EXPECT_EQ(batched.AllowBatch(ipv6.data(), ipv6.size(), 0, allowed), expected);
+    EXPECT_EQ(expected, 21u);
+    EXPECT_THROW(batched.AllowBatch(static_cast<const IPv4Address *>(nullptr), 1, 0, allowed), std::invalid_argument);
+    EXPECT_THROW(batched.AllowBatch(ipv6.data(), 1, 0, nullptr), std::invalid_argument);
+}
+
+TEST(RateLimiterTest, Allow_ManyThreads_CountsEveryToken)
+{
+    RateLimiter limiter(1000000, 1000, 4096, 8);
+    std::atomic<size_t> allowed{};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&limiter, &allowed]()
+                             {
+                                 for (uint32_t i = 0; i < 2000; i++)
+                                 {
+                                     // Four clients shared by all threads, 8000 requests each.
+                                     allowed += limiter.Allow(IPv4Address::FromUint32(0x0A000000u + i % 4), 0);
+                                 } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(allowed.load(), 4000u);
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -0,0 +1,117 @@
+/**
+ * @file SocketAddressTests.cpp
+ * @author Karol Pisarski (karol.pisarski@outlook.com)
+ * @brief Tests for SocketAddress class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @note This software is licensed under the BSD 3-Clause License.
+ *       SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @copyright Copyright (c) 2023, Karol Pisarski
+ *            All rights reserved.
+ */
+#include "SocketAddress/SocketAddress.hpp"
+#include "gtest/gtest.h"
+#include <arpa/inet.h>
+#include <cstring>
+#include <stdexcept>
+
+using namespace EthernetParameter;
+
+TEST(SocketAddressTest, InAddr_RoundTrip_MatchesInetPton)
+{
+    in_addr expected{};
+    ASSERT_EQ(inet_pton(AF_INET, "192.168.10.7", &expected), 1);
+    const IPv4Address cAddress = SocketAddress::FromInAddr(expected);
+    EXPECT_EQ(cAddress, IPv4Address("192.168.10.7"));
+
+    const in_addr cResult = SocketAddress::ToInAddr(cAddress);
+    EXPECT_EQ(std::memcmp(&cResult, &expected, sizeof(expected)), 0);
+}
+
+TEST(SocketAddressTest, In6Addr_RoundTrip_MatchesInetPton)
+{
+    in6_addr expected{};
+    ASSERT_EQ(inet_pton(AF_INET6, "2001:db8::8a2e:370:7334", &expected), 1);
+    const IPv6Address cAddress = SocketAddress::FromIn6Addr(expected);
+    EXPECT_EQ(cAddress, IPv6Address::FromUint64(0x20010DB800000000ull, 0x00008A2E03707334ull));
+
+    const in6_addr cResult = SocketAddress::ToIn6Addr(cAddress);
+    EXPECT_EQ(std::memcmp(&cResult, &expected, sizeof(expected)), 0);
+}
+
+TEST(SocketAddressTest, SockaddrIn_RoundTrip_KeepsAddressAndPort)
+{
+    sockaddr_in expected{};
+    expected.sin_family = AF_INET;
+    expected.sin_port = htons(8080);
+    ASSERT_EQ(inet_pton(AF_INET, "10.0.0.1", &expected.sin_addr), 1);
+
+    const SocketAddress cSocketAddress(expected);
+    EXPECT_EQ(cSocketAddress.GetFamily(), SocketAddress::Family::IPv4);
+    EXPECT_EQ(cSocketAddress.GetIPv4(), IPv4Address("10.0.0.1"));
+    EXPECT_EQ(cSocketAddress.GetPort(), 8080);
+    EXPECT_EQ(cSocketAddress.GetScopeId(), 0u);
+
+    const sockaddr_in cResult = cSocketAddress.ToSockaddrIn();
+    EXPECT_EQ(cResult.sin_family, AF_INET);
+    EXPECT_EQ(cResult.sin_port, expected.sin_port);
+    EXPECT_EQ(cResult.sin_addr.s_addr, expected.sin_addr.s_addr);
+    EXPECT_THROW(cSocketAddress.ToSockaddrIn6(), std::logic_error);
+}
+
+TEST(SocketAddressTest, SockaddrIn6_RoundTrip_KeepsAddressPortAndScopeId)
+{
+    sockaddr_in6 expected{};
+    expected.sin6_family = AF_INET6;
+    expected.sin6_port = htons(443);
+    expected.sin6_scope_id = 3;
+    ASSERT_EQ(inet_pton(AF_INET6, "fe80::1", &expected.sin6_addr), 1);
+
+    const SocketAddress cSocketAddress(expected);
+    EXPECT_EQ(cSocketAddress.GetFamily(), SocketAddress::Family::IPv6);
+    EXPECT_EQ(cSocketAddress.GetIPv6(), IPv6Address::FromUint64(0xFE80000000000000ull, 1));
+    EXPECT_EQ(cSocketAddress.GetPort(), 443);
+    EXPECT_EQ(cSocketAddress.GetScopeId(), 3u);
+
+    const sockaddr_in6 cResult = cSocketAddress.ToSockaddrIn6();
+    EXPECT_EQ(cResult.sin6_family, AF_INET6);
+    EXPECT_EQ(cResult.sin6_port, expected.sin6_port);
+    EXPECT_EQ(cResult.sin6_scope_id, expected.sin6_scope_id);
+    EXPECT_EQ(std::memcmp(&cResult.sin6_addr, &expected.sin6_addr, sizeof(expected.sin6_addr)), 0);
+    EXPECT_THROW(cSocketAddress.ToSockaddrIn(), std::logic_error);
+}
+
+TEST(SocketAddressTest, SockaddrStorage_BothFamilies_RoundTrip)
+{
+    const SocketAddress cIPv4(IPv4Address("172.16.0.9"), 53);
+    const SocketAddress cIPv6(IPv6Address::FromUint64(0x20010DB800000000ull, 0x42), 5353, 7);
+
+    sockaddr_storage storage{};
+    EXPECT_EQ(cIPv4.ToSockaddr(storage), sizeof(sockaddr_in));
+    EXPECT_EQ(storage.ss_family, AF_INET);
+    EXPECT_EQ(SocketAddress(storage), cIPv4);
+
+    EXPECT_EQ(cIPv6.ToSockaddr(storage), sizeof(sockaddr_in6));
+    EXPECT_EQ(storage.ss_family, AF_INET6);
+    EXPECT_EQ(SocketAddress(storage), cIPv6);
+    EXPECT_NE(SocketAddress(storage), cIPv4);
+}
+
+TEST(SocketAddressTest, Sockaddr_InvalidInput_Throws)
+{
+    EXPECT_THROW(SocketAddress(nullptr, sizeof(sockaddr_in)), std::invalid_argument);
+
+    sockaddr_storage storage{};
+    storage.ss_family = AF_UNIX;
+    EXPECT_THROW(SocketAddress{storage}, std::invalid_argument);
+
+    storage.ss_family = AF_INET6;
+    EXPECT_THROW(SocketAddress(reinterpret_cast<const sockaddr *>(&storage), sizeof(sockaddr_in)), std::invalid_argument);
+    EXPECT_NO_THROW(SocketAddress(reinterpret_cast<const sockaddr *>(&storage), sizeof(sockaddr_in6)));
+}
+
+/******************************************************************************
+**********************************End of file**********************************
+******************************************************************************/
@@ -16,6 +16,7 @@
 #include <vector>
 #include <bitset>
 #include "IPv4Address/IPv4Address.hpp"
+#include "IPv4Address/IPv4Prefix.hpp"
 #include "IPv6Address/IPv6Address.hpp"
 
 int main(int argc, char **argv)
@@ -58,6 +59,15 @@ int main(int argc, char **argv)
         {
             std::cout << "Binary conversion for IPv4 error!" << std::endl;
         }
+
+        // Address arithmetic and iteration over a subnet.
+        EthernetParameter::IPv4Prefix subnet("192.168.0.0/30");
+        std::cout << "Addresses in " << subnet.ToString() << ":" << std::endl;
+        for (const EthernetParameter::IPv4Address &cAddress : subnet)
+        {
+            std::cout << cAddress << std::endl;
+        }
+        std::cout << "Next address after " << ipv4Address1 << ": " << ipv4Address1 + 1 << std::endl;
     }
     catch (const std::exception &ex)
     {